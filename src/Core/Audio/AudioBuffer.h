@@ -0,0 +1,33 @@
+// src/Core/Audio/AudioBuffer.h
+// Decoded PCM for one clip: interleaved float samples at the clip's own rate
+// Immutable once built, so the mixer thread reads it without locking
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace FinalStorm {
+
+class AudioBuffer {
+public:
+    AudioBuffer(std::vector<float> samples, uint32_t channels, uint32_t sampleRate)
+        : m_samples(std::move(samples))
+        , m_channels(channels == 0 ? 1 : channels)
+        , m_sampleRate(sampleRate) {}
+
+    const float* getSamples() const { return m_samples.data(); }
+    size_t getFrameCount() const { return m_samples.size() / m_channels; }
+    uint32_t getChannels() const { return m_channels; }
+    uint32_t getSampleRate() const { return m_sampleRate; }
+    float getDuration() const { return m_sampleRate ? static_cast<float>(getFrameCount()) / m_sampleRate : 0.0f; }
+    size_t getByteSize() const { return m_samples.size() * sizeof(float); }
+
+private:
+    std::vector<float> m_samples;
+    uint32_t m_channels;
+    uint32_t m_sampleRate;
+};
+
+} // namespace FinalStorm
@@ -0,0 +1,57 @@
+// src/Core/Audio/AudioBufferCache.cpp
+// Decoded PCM cache implementation
+
+#include "Core/Audio/AudioBufferCache.h"
+#include "Core/Audio/WavReader.h"
+
+namespace FinalStorm {
+
+AudioBufferCache::AudioBufferCache(size_t budgetBytes)
+    : m_budget(budgetBytes)
+    , m_bytes(0) {
+}
+
+std::shared_ptr<AudioBuffer> AudioBufferCache::load(const std::string& path) {
+    auto it = m_index.find(path);
+    if (it != m_index.end()) {
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return it->second->buffer;
+    }
+
+    std::vector<float> samples;
+    uint32_t channels = 0;
+    uint32_t sampleRate = 0;
+    if (!WavReader::decode(path, samples, channels, sampleRate)) return nullptr;
+
+    auto buffer = std::make_shared<AudioBuffer>(std::move(samples), channels, sampleRate);
+    m_entries.push_front(Entry{ path, buffer });
+    m_index[path] = m_entries.begin();
+    m_bytes += buffer->getByteSize();
+    trim();
+    return buffer;
+}
+
+void AudioBufferCache::trim() {
+    auto it = m_entries.end();
+    while (m_bytes > m_budget && it != m_entries.begin()) {
+        --it;
+        if (it->buffer.use_count() > 1) continue;   // Held by a clip or a voice
+
+        m_bytes -= it->buffer->getByteSize();
+        m_index.erase(it->path);
+        it = m_entries.erase(it);
+    }
+}
+
+void AudioBufferCache::setBudget(size_t budgetBytes) {
+    m_budget = budgetBytes;
+    trim();
+}
+
+void AudioBufferCache::clear() {
+    m_entries.clear();
+    m_index.clear();
+    m_bytes = 0;
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,44 @@
+// src/Core/Audio/AudioBufferCache.h
+// Decoded PCM shared by path under a byte budget; buffers nobody else holds
+// are evicted least recently used first
+
+#pragma once
+
+#include "Core/Audio/AudioBuffer.h"
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace FinalStorm {
+
+class AudioBufferCache {
+public:
+    explicit AudioBufferCache(size_t budgetBytes = 32 * 1024 * 1024);
+
+    // Decodes on a miss; null if the file cannot be read
+    std::shared_ptr<AudioBuffer> load(const std::string& path);
+
+    // Evicts unused buffers until the cache fits its budget. Buffers still in
+    // use stay, so the total can run over while they play.
+    void trim();
+
+    void setBudget(size_t budgetBytes);
+    size_t getBudget() const { return m_budget; }
+    size_t getBytes() const { return m_bytes; }
+    size_t getEntryCount() const { return m_entries.size(); }
+    void clear();
+
+private:
+    struct Entry {
+        std::string path;
+        std::shared_ptr<AudioBuffer> buffer;
+    };
+
+    size_t m_budget;
+    size_t m_bytes;
+    std::list<Entry> m_entries;     // Most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+};
+
+} // namespace FinalStorm
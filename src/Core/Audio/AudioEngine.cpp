@@ -6,10 +6,28 @@
 //
 
 #include "Core/Audio/AudioEngine.h"
+#include "Core/Audio/AudioBuffer.h"
+#include "Core/Audio/WavReader.h"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 namespace FinalStorm {
 
+namespace {
+
+// Below this gain (-60 dB) a source is virtual even when voices are free
+constexpr float AudibleThreshold = 0.001f;
+
+// Sources already mixed keep their voice unless a rival is clearly louder,
+// so near-equal sources do not trade voices every update
+constexpr float RealVoiceBias = 1.25f;
+
+// Room mix falls off as the square root of the direct sound's attenuation
+constexpr float SendFalloff = 0.5f;
+
+} // namespace
+
 // AudioListener (internal class)
 class AudioListener {
 public:
@@ -29,7 +47,9 @@ public:
 AudioEngine::AudioEngine()
     : m_initialized(false)
     , m_masterVolume(1.0f)
-    , m_audioContext(nullptr)
+    , m_running(false)
+    , m_oneShotCount(0)
+    , m_spectrum(std::make_shared<SpectrumSnapshot>())
 {
 }
 
@@ -40,12 +60,53 @@ AudioEngine::~AudioEngine() {
 }
 
 bool AudioEngine::initialize() {
-    // Platform-specific initialization would go here
-    // For now, we'll just set up the basic structure
+    // No platform device is wired up yet; the mixer still runs at real-time pace
+    return initialize(Settings(), std::make_unique<NullAudioOutput>());
+}
+
+bool AudioEngine::initialize(const Settings& settings, std::unique_ptr<AudioOutput> output) {
+    if (m_initialized) {
+        shutdown();
+    }
+    if (!output || !output->open(settings.sampleRate, AudioMixer::Channels)) {
+        std::cerr << "Audio Engine: failed to open output" << std::endl;
+        return false;
+    }
+    
+    m_settings = settings;
+    m_output = std::move(output);
+    m_hrtf.reset();
+    if (settings.binaural) {
+        m_hrtf = settings.hrtf ? settings.hrtf : HrtfSet::createSphericalHead(settings.sampleRate);
+        if (m_hrtf->getSampleRate() != settings.sampleRate) {
+            std::cerr << "Audio Engine: HRTF set is at " << m_hrtf->getSampleRate()
+                      << " Hz, not " << settings.sampleRate << " Hz; binaural rendering is off" << std::endl;
+            m_hrtf.reset();
+        }
+    }
+    m_mixer = std::make_unique<AudioMixer>(settings.sampleRate, settings.maxVoices, m_hrtf);
+    m_streamer = std::make_unique<AudioStreamer>(!settings.offline);
+    m_bufferCache.setBudget(settings.pcmCacheBytes);
+    m_mixer->post(AudioCommand{ AudioCommandType::SetMasterGain, 0, nullptr, m_masterVolume });
+    AudioCommand reverb;
+    reverb.type = AudioCommandType::SetReverb;
+    reverb.reverb = m_reverb;
+    m_mixer->post(reverb);
+    
+    m_voices.assign(settings.maxVoices, VoiceSlot());
+    m_freeVoices.clear();
+    for (uint32_t i = settings.maxVoices; i > 0; --i) {
+        m_freeVoices.push_back(i - 1);
+    }
     
     m_listener = std::make_unique<AudioListener>();
     m_initialized = true;
     
+    if (!settings.offline) {
+        m_running = true;
+        m_audioThread = std::thread(&AudioEngine::audioThreadMain, this);
+    }
+    
     std::cout << "Audio Engine initialized" << std::endl;
     return true;
 }
@@ -53,32 +114,116 @@ bool AudioEngine::initialize() {
 void AudioEngine::shutdown() {
     if (!m_initialized) return;
     
+    m_running = false;
+    if (m_audioThread.joinable()) {
+        m_audioThread.join();
+    }
+    if (m_output) {
+        m_output->close();
+    }
+    
+    // The mixer is gone, so every voice is released at once
+    for (auto& source : m_sources) {
+        source->m_sourceId = 0;
+    }
+    m_mixer.reset();
+    m_output.reset();
+    m_voices.clear();
+    m_streamer.reset();
+    m_freeVoices.clear();
+    m_commandBacklog.clear();
+    
     // Clean up all sources
     m_sources.clear();
+    m_oneShotPool.clear();
+    m_oneShotCount = 0;
+    m_voiceStats = VoiceStats();
+    *m_spectrum = SpectrumSnapshot();
     m_audioClips.clear();
+    m_bufferCache.clear();
     
     m_initialized = false;
     std::cout << "Audio Engine shut down" << std::endl;
 }
 
-bool AudioEngine::loadAudioClip(const std::string& filename, const std::string& name) {
-    // This would load actual audio data
-    // For now, create a dummy clip
+void AudioEngine::renderOffline(size_t frames) {
+    if (!m_initialized || !m_settings.offline) return;
+    
+    std::vector<float> block(AudioMixer::BlockSize * AudioMixer::Channels);
+    while (frames > 0) {
+        size_t count = std::min(frames, AudioMixer::BlockSize);
+        m_streamer->pump();
+        m_mixer->render(block.data(), count);
+        m_output->write(block.data(), count);
+        frames -= count;
+    }
+    handleMixerEvents();
+}
+
+void AudioEngine::audioThreadMain() {
+    std::vector<float> block(AudioMixer::BlockSize * AudioMixer::Channels);
+    while (m_running.load(std::memory_order_relaxed)) {
+        m_mixer->render(block.data(), AudioMixer::BlockSize);
+        m_output->write(block.data(), AudioMixer::BlockSize);
+    }
+}
+
+bool AudioEngine::loadAudioClip(const std::string& filename, const std::string& name, AudioLoadMode mode) {
+    // Only the header is read here; streamed clips never decode up front
+    WavReader reader;
+    if (!reader.open(filename)) {
+        std::cerr << "Audio Engine: cannot load " << filename << std::endl;
+        return false;
+    }
+    
     auto clip = std::make_shared<AudioClip>();
     clip->name = name;
-    clip->format = AudioFormat::Stereo16;
-    clip->sampleRate = 44100;
-    clip->duration = 1.0f;
+    clip->format = AudioFormat::Float32;
+    clip->sampleRate = reader.getSampleRate();
+    clip->duration = static_cast<float>(reader.getDuration());
+    clip->path = filename;
+    clip->channels = reader.getChannels();
+    reader.close();
+    
+    clip->streaming = mode == AudioLoadMode::Stream ||
+                      (mode == AudioLoadMode::Auto && clip->duration > m_settings.streamThresholdSeconds);
+    if (!clip->streaming) {
+        clip->buffer = m_bufferCache.load(filename);
+        if (!clip->buffer) {
+            std::cerr << "Audio Engine: cannot decode " << filename << std::endl;
+            return false;
+        }
+    }
     
     m_audioClips[name] = clip;
     return true;
 }
 
+void AudioEngine::unloadAudioClip(const std::string& name) {
+    // Sources and voices still playing it keep their reference
+    m_audioClips.erase(name);
+    m_bufferCache.trim();
+}
+
 std::shared_ptr<AudioClip> AudioEngine::getAudioClip(const std::string& name) const {
     auto it = m_audioClips.find(name);
     return (it != m_audioClips.end()) ? it->second : nullptr;
 }
 
+std::shared_ptr<AudioClip> AudioEngine::createClip(const std::string& name, std::vector<float> samples,
+                                                   uint32_t channels, uint32_t sampleRate) {
+    auto clip = std::make_shared<AudioClip>();
+    clip->name = name;
+    clip->buffer = std::make_shared<AudioBuffer>(std::move(samples), channels, sampleRate);
+    clip->format = AudioFormat::Float32;
+    clip->sampleRate = sampleRate;
+    clip->duration = clip->buffer->getDuration();
+    clip->channels = clip->buffer->getChannels();
+    
+    m_audioClips[name] = clip;
+    return clip;
+}
+
 std::shared_ptr<AudioSource> AudioEngine::createSource() {
     auto source = std::make_shared<AudioSource>();
     m_sources.push_back(source);
@@ -86,6 +231,9 @@ std::shared_ptr<AudioSource> AudioEngine::createSource() {
 }
 
 void AudioEngine::removeSource(std::shared_ptr<AudioSource> source) {
+    if (source && source->m_sourceId) {
+        releaseVoice(*source);
+    }
     m_sources.erase(
         std::remove(m_sources.begin(), m_sources.end(), source),
         m_sources.end()
@@ -111,27 +259,375 @@ void AudioEngine::setListenerVelocity(const float3& velocity) {
     }
 }
 
+SpectrumSubscription AudioEngine::subscribeSpectrum(SpectrumBand first, SpectrumBand last) const {
+    return SpectrumSubscription(m_spectrum, first, last);
+}
+
+void AudioEngine::setReverb(const ReverbParams& params) {
+    if (params == m_reverb) return;
+    m_reverb = params;
+    if (m_mixer) {
+        AudioCommand command;
+        command.type = AudioCommandType::SetReverb;
+        command.reverb = params;
+        post(command);
+    }
+}
+
 void AudioEngine::setMasterVolume(float volume) {
     m_masterVolume = std::max(0.0f, std::min(1.0f, volume));
+    if (m_mixer) {
+        post(AudioCommand{ AudioCommandType::SetMasterGain, 0, nullptr, m_masterVolume });
+    }
 }
 
 void AudioEngine::update(float deltaTime) {
-    // Update all active sources
+    if (!m_initialized) return;
+    
+    handleMixerEvents();
+    flushCommands();
+    *m_spectrum = m_mixer->readSpectrum();
+    
+    // Collect every playing source with its audible gain
+    m_candidates.clear();
     for (auto& source : m_sources) {
-        if (source->isPlaying()) {
-            // Update 3D audio calculations
-            // This would involve calculating attenuation, panning, etc.
+        advanceSource(*source, deltaTime);
+        bool playable = source->isSynth() || (source->m_clip && source->m_clip->isPlayable());
+        if (!source->m_playing || !playable) {
+            // Nothing to mix, e.g. a synth whose last note has faded
+            if (source->m_sourceId) {
+                releaseVoice(*source);
+            }
+            continue;
+        }
+        
+        Candidate candidate{ source.get(), VoiceMix(), 0.0f };
+        computeMix(*source, candidate.mix);
+        candidate.score = std::max(candidate.mix.gainLeft, candidate.mix.gainRight) * source->m_priority;
+        if (source->m_sourceId) {
+            candidate.score *= RealVoiceBias;
+        }
+        m_candidates.push_back(candidate);
+    }
+    
+    // The loudest maxVoices get real voices
+    size_t realCount = std::min<size_t>(m_candidates.size(), m_voices.size());
+    auto louder = [](const Candidate& a, const Candidate& b) { return a.score > b.score; };
+    if (realCount < m_candidates.size()) {
+        std::nth_element(m_candidates.begin(), m_candidates.begin() + realCount, m_candidates.end(), louder);
+    }
+    
+    m_voiceStats.real = 0;
+    m_voiceStats.virtualized = 0;
+    for (size_t i = 0; i < m_candidates.size(); ++i) {
+        const Candidate& candidate = m_candidates[i];
+        AudioSource& source = *candidate.source;
+        bool real = i < realCount && candidate.score >= AudibleThreshold;
+        
+        if (!real) {
+            if (source.m_sourceId) {
+                releaseVoice(source);
+            }
+            m_voiceStats.virtualized++;
+            continue;
+        }
+        
+        if (source.m_sourceId) {
+            AudioCommand params{ AudioCommandType::SetParams, source.m_sourceId - 1, nullptr,
+                                 candidate.mix.gainLeft, candidate.mix.gainRight, source.m_pitch };
+            params.azimuth = candidate.mix.azimuth;
+            params.elevation = candidate.mix.elevation;
+            params.send = candidate.mix.send;
+            post(params);
+            sendNotes(source);
+            m_voiceStats.real++;
+        } else if (!m_freeVoices.empty()) {
+            startVoice(source, candidate.mix);
+            m_voiceStats.real++;
+        } else {
+            // Voices just released come back once the mixer lets go of them
+            m_voiceStats.virtualized++;
         }
     }
+    
+    reclaimOneShots();
+}
+
+void AudioEngine::advanceSource(AudioSource& source, float deltaTime) {
+    if (source.m_sourceId) {
+        // Stopped, restarted or paused: the voice goes; a paused source
+        // resumes from its play time on a fresh voice
+        // Same for a source that switched between clip and notes, or in or
+        // out of binaural rendering
+        const VoiceSlot& slot = m_voices[source.m_sourceId - 1];
+        if (!source.m_playing || slot.generation != source.m_playGeneration ||
+            (slot.synth != nullptr) != source.isSynth() || slot.binaural != isBinaural(source)) {
+            releaseVoice(source);
+        }
+    }
+    if (!source.m_playing) return;
+    
+    source.m_playTime += static_cast<double>(deltaTime) * source.m_pitch;
+    
+    // Notes age on the game side too, so a voice can pick them up mid-envelope
+    for (auto& held : source.m_notes) {
+        held.age += deltaTime;
+        if (held.releasedAt < 0.0f && held.note.duration >= 0.0f && held.age >= held.note.duration) {
+            held.releasedAt = held.note.duration;
+        }
+    }
+    source.m_notes.erase(std::remove_if(source.m_notes.begin(), source.m_notes.end(),
+        [](const AudioSource::HeldNote& held) {
+            return held.releasedAt >= 0.0f && held.age >= held.releasedAt + held.note.envelope.release;
+        }), source.m_notes.end());
+    
+    // A virtual one-shot finishes when its clip would have
+    const AudioClip* clip = source.m_clip.get();
+    if (!source.m_sourceId && !source.m_looping && !source.isSynth() && clip && clip->isPlayable() &&
+        source.m_playTime >= clip->duration) {
+        source.m_playing = false;
+        source.m_paused = false;
+    }
+}
+
+std::shared_ptr<AudioSource> AudioEngine::acquireOneShot() {
+    if (m_oneShotCount >= m_settings.maxOneShots) {
+        m_voiceStats.droppedOneShots++;
+        return nullptr;
+    }
+    
+    std::shared_ptr<AudioSource> source;
+    if (!m_oneShotPool.empty()) {
+        source = std::move(m_oneShotPool.back());
+        m_oneShotPool.pop_back();
+        *source = AudioSource();
+    } else {
+        source = std::make_shared<AudioSource>();
+    }
+    source->m_oneShot = true;
+    m_sources.push_back(source);
+    m_oneShotCount++;
+    m_voiceStats.oneShots = m_oneShotCount;
+    return source;
+}
+
+void AudioEngine::reclaimOneShots() {
+    auto finished = [](const std::shared_ptr<AudioSource>& source) {
+        return source->m_oneShot && !source->m_playing && !source->m_paused && source->m_sourceId == 0;
+    };
+    auto first = std::stable_partition(m_sources.begin(), m_sources.end(),
+        [&finished](const std::shared_ptr<AudioSource>& source) { return !finished(source); });
+    
+    for (auto it = first; it != m_sources.end(); ++it) {
+        m_oneShotPool.push_back(std::move(*it));
+        m_oneShotCount--;
+    }
+    m_sources.erase(first, m_sources.end());
+    m_voiceStats.oneShots = m_oneShotCount;
+}
+
+void AudioEngine::post(const AudioCommand& command) {
+    // Keeps command order: once anything is backlogged, everything queues behind it
+    if (!m_commandBacklog.empty() || !m_mixer->post(command)) {
+        m_commandBacklog.push_back(command);
+    }
+}
+
+void AudioEngine::flushCommands() {
+    size_t sent = 0;
+    while (sent < m_commandBacklog.size() && m_mixer->post(m_commandBacklog[sent])) {
+        ++sent;
+    }
+    m_commandBacklog.erase(m_commandBacklog.begin(), m_commandBacklog.begin() + sent);
+}
+
+void AudioEngine::handleMixerEvents() {
+    AudioEvent event;
+    while (m_mixer->pollEvent(event)) {
+        if (event.type != AudioEvent::VoiceEnded || event.voice >= m_voices.size()) continue;
+        
+        // A voice that ended by itself leaves its source stopped
+        VoiceSlot& slot = m_voices[event.voice];
+        if (slot.state == VoiceSlot::Playing && slot.source) {
+            slot.source->m_playing = false;
+            slot.source->m_paused = false;
+            slot.source->m_sourceId = 0;
+        }
+        slot = VoiceSlot();
+        m_freeVoices.push_back(event.voice);
+    }
+}
+
+void AudioEngine::startVoice(AudioSource& source, const VoiceMix& mix) {
+    uint32_t voice = m_freeVoices.back();
+    m_freeVoices.pop_back();
+    
+    VoiceSlot& slot = m_voices[voice];
+    slot.state = VoiceSlot::Playing;
+    slot.source = &source;
+    slot.clip = source.m_clip;
+    slot.generation = source.m_playGeneration;
+    slot.binaural = isBinaural(source);
+    source.m_sourceId = voice + 1;
+    
+    if (source.isSynth()) {
+        // A fresh bank per voice: the mixer owns it until the voice ends
+        slot.synth = std::make_shared<OscillatorBank>(m_settings.sampleRate, m_settings.maxSynthPartials);
+        AudioCommand command;
+        command.type = AudioCommandType::Play;
+        command.voice = voice;
+        command.gainLeft = mix.gainLeft;
+        command.gainRight = mix.gainRight;
+        command.azimuth = mix.azimuth;
+        command.elevation = mix.elevation;
+        command.send = mix.send;
+        command.binaural = slot.binaural;
+        command.synth = slot.synth.get();
+        post(command);
+        for (auto& held : source.m_notes) {
+            held.sent = false;
+        }
+        sendNotes(source);
+        return;
+    }
+    
+    const AudioClip& clip = *source.m_clip;
+    
+    // Picks up where the source would be had it been audible all along
+    double duration = clip.duration;
+    double playTime = source.m_looping && duration > 0.0 ? std::fmod(source.m_playTime, duration) : source.m_playTime;
+    
+    AudioCommand command;
+    command.type = AudioCommandType::Play;
+    command.voice = voice;
+    command.gainLeft = mix.gainLeft;
+    command.gainRight = mix.gainRight;
+    command.azimuth = mix.azimuth;
+    command.elevation = mix.elevation;
+    command.send = mix.send;
+    command.binaural = slot.binaural;
+    command.pitch = source.m_pitch;
+    command.looping = source.m_looping;
+    if (clip.streaming) {
+        // The stream seeks to the whole start frame; the mixer keeps the
+        // fraction. Until the streamer fills a chunk the voice plays silence.
+        double start = playTime * clip.sampleRate;
+        auto startFrame = static_cast<uint64_t>(start);
+        slot.stream = std::make_shared<AudioStream>(clip.path, clip.channels, clip.sampleRate, source.m_looping, startFrame);
+        m_streamer->add(slot.stream);
+        command.stream = slot.stream.get();
+        command.position = start - static_cast<double>(startFrame);
+    } else {
+        command.buffer = clip.buffer.get();
+        command.position = playTime * clip.sampleRate;
+    }
+    post(command);
+}
+
+bool AudioEngine::isBinaural(const AudioSource& source) const {
+    // Stereo clips keep their own image
+    return m_hrtf && source.m_spatial &&
+           (source.isSynth() || (source.m_clip && source.m_clip->channels == 1));
+}
+
+void AudioEngine::computeMix(const AudioSource& source, VoiceMix& mix) const {
+    mix = VoiceMix();
+    if (!source.m_spatial) {
+        mix.gainLeft = mix.gainRight = source.m_volume;
+        return;
+    }
+    
+    // Inverse distance, clamped to the reference distance, silent past max
+    float3 offset = source.m_position - m_listener->position;
+    float distance = length(offset);
+    if (distance > source.m_maxDistance) {
+        return;
+    }
+    float attenuation = source.m_referenceDistance / std::max(distance, source.m_referenceDistance);
+    float gain = source.m_volume * attenuation;
+    mix.send = source.m_volume * source.m_reverbSend * std::pow(attenuation, SendFalloff);
+    
+    // The listener's frame: right, up and forward
+    float3 right = cross(m_listener->forward, m_listener->up);
+    float rightLength = length(right);
+    float forwardLength = length(m_listener->forward);
+    bool oriented = distance > 1e-4f && rightLength > 1e-4f && forwardLength > 1e-4f;
+    
+    if (isBinaural(source)) {
+        mix.gainLeft = mix.gainRight = gain;
+        if (oriented) {
+            float3 forward = m_listener->forward / forwardLength;
+            right = right / rightLength;
+            float3 up = cross(right, forward);
+            float x = dot(offset, right);
+            float y = dot(offset, up);
+            float z = dot(offset, forward);
+            mix.azimuth = std::atan2(x, z);
+            mix.elevation = std::atan2(y, std::sqrt(x * x + z * z));
+        }
+        return;
+    }
+    
+    // Equal-power pan on the listener's left/right axis
+    float pan = 0.0f;
+    if (oriented) {
+        pan = std::max(-1.0f, std::min(1.0f, dot(offset, right) / (distance * rightLength)));
+    }
+    float angle = (pan + 1.0f) * 0.785398163f;      // 0 hard left, pi/2 hard right
+    
+    mix.gainLeft = gain * std::cos(angle);
+    mix.gainRight = gain * std::sin(angle);
+}
+
+void AudioEngine::sendNotes(AudioSource& source) {
+    if (!source.m_sourceId || !source.isSynth()) return;
+    
+    AudioCommand command;
+    command.voice = source.m_sourceId - 1;
+    for (auto& held : source.m_notes) {
+        if (!held.sent) {
+            // Joins at the note's current age; a release already known rides along
+            command.type = AudioCommandType::NoteOn;
+            command.note = held.note;
+            command.note.age = held.age;
+            if (held.releasedAt >= 0.0f) {
+                command.note.duration = held.releasedAt;
+            }
+            post(command);
+            held.sent = true;
+            held.releaseSent = held.releasedAt >= 0.0f || held.note.duration >= 0.0f;
+        } else if (!held.releaseSent && held.releasedAt >= 0.0f) {
+            command.type = AudioCommandType::NoteOff;
+            command.note.id = held.note.id;
+            post(command);
+            held.releaseSent = true;
+        }
+    }
+}
+
+void AudioEngine::releaseVoice(AudioSource& source) {
+    uint32_t voice = source.m_sourceId - 1;
+    source.m_sourceId = 0;
+    for (auto& held : source.m_notes) {
+        held.sent = false;      // Replayed on the next voice
+    }
+    
+    // The slot stays reserved until the mixer reports the voice ended
+    VoiceSlot& slot = m_voices[voice];
+    slot.state = VoiceSlot::Stopping;
+    slot.source = nullptr;
+    post(AudioCommand{ AudioCommandType::Stop, voice });
 }
 
 void AudioEngine::playSound2D(const std::string& clipName, float volume) {
     auto clip = getAudioClip(clipName);
     if (!clip) return;
     
-    auto source = createSource();
+    auto source = acquireOneShot();
+    if (!source) return;
     source->setClip(clip);
-    source->setVolume(volume * m_masterVolume);
+    source->setSpatial(false);
+    source->setVolume(volume);
     source->play();
 }
 
@@ -139,10 +635,11 @@ void AudioEngine::playSound3D(const std::string& clipName, const float3& positio
     auto clip = getAudioClip(clipName);
     if (!clip) return;
     
-    auto source = createSource();
+    auto source = acquireOneShot();
+    if (!source) return;
     source->setClip(clip);
     source->setPosition(position);
-    source->setVolume(volume * m_masterVolume);
+    source->setVolume(volume);
     source->play();
 }
 
@@ -154,9 +651,17 @@ AudioSource::AudioSource()
     , m_pitch(1.0f)
     , m_looping(false)
     , m_playing(false)
+    , m_paused(false)
+    , m_spatial(true)
+    , m_oneShot(false)
+    , m_priority(1.0f)
+    , m_playTime(0.0)
     , m_referenceDistance(1.0f)
     , m_maxDistance(100.0f)
+    , m_reverbSend(1.0f)
     , m_sourceId(0)
+    , m_playGeneration(0)
+    , m_nextNoteId(1)
 {
 }
 
@@ -196,20 +701,55 @@ void AudioSource::setMaxDistance(float distance) {
     m_maxDistance = std::max(m_referenceDistance, distance);
 }
 
+// The engine picks these state changes up in its next update()
 void AudioSource::play() {
-    if (!m_clip) return;
+    if (!m_clip && m_notes.empty()) return;
+    if (!m_playing && !m_paused) {
+        m_playGeneration++;     // A fresh start, not a resume
+        m_playTime = 0.0;
+    }
     m_playing = true;
-    // Platform-specific play implementation
+    m_paused = false;
 }
 
 void AudioSource::pause() {
+    if (!m_playing) return;
     m_playing = false;
-    // Platform-specific pause implementation
+    m_paused = true;
 }
 
 void AudioSource::stop() {
     m_playing = false;
-    // Platform-specific stop implementation
+    m_paused = false;
+    m_notes.clear();
+}
+
+uint32_t AudioSource::playNote(const SynthNote& note) {
+    HeldNote held;
+    held.note = note;
+    held.note.id = m_nextNoteId++;
+    held.note.age = 0.0f;
+    m_notes.push_back(held);
+    if (!m_playing && !m_paused) {
+        play();
+    }
+    return held.note.id;
+}
+
+void AudioSource::playChord(const std::vector<float>& frequencies, const SynthNote& patch) {
+    SynthNote note = patch;
+    for (float frequency : frequencies) {
+        note.frequency = frequency;
+        playNote(note);
+    }
+}
+
+void AudioSource::stopNote(uint32_t id) {
+    for (auto& held : m_notes) {
+        if (held.note.id == id && held.releasedAt < 0.0f) {
+            held.releasedAt = held.age;
+        }
+    }
 }
 
 bool AudioSource::isPlaying() const {
@@ -7,11 +7,19 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <vector>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include "Core/Math/Math.h"
+#include "Core/Audio/AudioBufferCache.h"
+#include "Core/Audio/AudioMixer.h"
+#include "Core/Audio/AudioOutput.h"
+#include "Core/Audio/AudioStream.h"
+#include "Core/Audio/SpectrumAnalyzer.h"
 
 namespace FinalStorm {
 
@@ -27,27 +35,69 @@ enum class AudioFormat {
     Float32
 };
 
+// How loadAudioClip keeps a clip's audio
+enum class AudioLoadMode {
+    Auto,       // Stream when longer than Settings::streamThresholdSeconds
+    Decode,     // Whole clip in memory, shared through the PCM cache
+    Stream      // Read from disk while it plays
+};
+
 struct AudioClip {
     std::string name;
-    std::shared_ptr<AudioBuffer> buffer;
+    std::shared_ptr<AudioBuffer> buffer;    // Null for streamed clips
     AudioFormat format;
     uint32_t sampleRate;
     float duration;
+    
+    // Streamed clips: each voice opens its own reader on path
+    std::string path;
+    uint32_t channels = 0;
+    bool streaming = false;
+    
+    bool isPlayable() const { return buffer || streaming; }
 };
 
 class AudioEngine {
 public:
+    struct Settings {
+        uint32_t sampleRate = 48000;
+        uint32_t maxVoices = 64;        // Real voices: sources mixed at once
+        uint32_t maxOneShots = 256;     // Fire-and-forget sources alive at once
+        bool offline = false;           // No audio thread; the caller drives renderOffline()
+        float streamThresholdSeconds = 10.0f;       // Longer clips stream by default
+        size_t pcmCacheBytes = 32 * 1024 * 1024;    // Decoded clips kept for reuse
+        uint32_t maxSynthPartials = 256;            // Per synth voice
+        bool binaural = true;           // Mono spatial sources through the HRTF, for headphones
+        std::shared_ptr<const HrtfSet> hrtf;        // Measured set; null uses the spherical-head model
+    };
+    
     AudioEngine();
     ~AudioEngine();
     
-    // Initialize audio system
+    // Initialize audio system. Without an output, mixes on the audio thread
+    // into a NullAudioOutput at real-time pace.
     bool initialize();
+    bool initialize(const Settings& settings, std::unique_ptr<AudioOutput> output);
     void shutdown();
     
-    // Audio clip management
-    bool loadAudioClip(const std::string& filename, const std::string& name);
+    // Offline mode only: mixes frames into the output on the calling thread.
+    // Call update() between renders to move sources, as a game loop would.
+    void renderOffline(size_t frames);
+    
+    // Audio clip management. Short clips are decoded once and shared by path;
+    // long ones (ambience, narration) stream in chunks on a background thread.
+    bool loadAudioClip(const std::string& filename, const std::string& name,
+                       AudioLoadMode mode = AudioLoadMode::Auto);
+    void unloadAudioClip(const std::string& name);
     std::shared_ptr<AudioClip> getAudioClip(const std::string& name) const;
     
+    const AudioBufferCache& getBufferCache() const { return m_bufferCache; }
+    uint32_t getStreamUnderrunCount() const { return m_mixer ? m_mixer->getUnderrunCount() : 0; }
+    
+    // Clip from PCM already in memory (interleaved float, mono or stereo)
+    std::shared_ptr<AudioClip> createClip(const std::string& name, std::vector<float> samples,
+                                          uint32_t channels, uint32_t sampleRate);
+    
     // 3D audio sources
     std::shared_ptr<AudioSource> createSource();
     void removeSource(std::shared_ptr<AudioSource> source);
@@ -61,23 +111,107 @@ public:
     void setMasterVolume(float volume);
     float getMasterVolume() const { return m_masterVolume; }
     
-    // Update audio system
+    // The room every spatial source sends to (see AudioSource::setReverbSend)
+    void setReverb(const ReverbParams& params);
+    const ReverbParams& getReverb() const { return m_reverb; }
+    
+    // Update audio system: applies source changes and listener movement to
+    // the mixer. Game thread only; the mixer is reached through its command queue.
     void update(float deltaTime);
     
+    // Every playing source is ranked by audible gain times priority each
+    // update; the best maxVoices get real voices, the rest are virtual:
+    // tracked and kept in time, but not mixed
+    struct VoiceStats {
+        uint32_t real = 0;
+        uint32_t virtualized = 0;
+        uint32_t oneShots = 0;          // Fire-and-forget sources in flight
+        uint32_t droppedOneShots = 0;   // Over maxOneShots, since initialize
+    };
+    
+    const VoiceStats& getVoiceStats() const { return m_voiceStats; }
+    uint32_t getActiveVoiceCount() const { return m_mixer ? m_mixer->getActiveVoiceCount() : 0; }
+    
+    // Band levels of the master mix as of the last update(). Subscriptions
+    // read the same snapshot, so visuals can react without touching the mixer.
+    const SpectrumSnapshot& getSpectrum() const { return *m_spectrum; }
+    SpectrumSubscription subscribeSpectrum(SpectrumBand first, SpectrumBand last) const;
+    
     // Play sounds
     void playSound2D(const std::string& clipName, float volume = 1.0f);
     void playSound3D(const std::string& clipName, const float3& position, float volume = 1.0f);
     
 private:
+    // Game-side view of a mixer voice
+    struct VoiceSlot {
+        enum State : uint8_t { Free, Playing, Stopping };
+        
+        State state = Free;
+        uint32_t generation = 0;            // Source play generation this voice started
+        AudioSource* source = nullptr;
+        std::shared_ptr<AudioClip> clip;    // Keeps the buffer alive until the mixer lets go
+        std::shared_ptr<AudioStream> stream;
+        std::shared_ptr<OscillatorBank> synth;
+        bool binaural = false;
+    };
+    
+    void post(const AudioCommand& command);
+    void flushCommands();
+    void handleMixerEvents();
+    // What the mixer needs to place a source: binaural voices use gainLeft
+    // for both ears and take their image from the direction
+    struct VoiceMix {
+        float gainLeft = 0.0f;
+        float gainRight = 0.0f;
+        float azimuth = 0.0f;
+        float elevation = 0.0f;
+        float send = 0.0f;
+    };
+    
+    struct Candidate {
+        AudioSource* source;
+        VoiceMix mix;
+        float score;
+    };
+    
+    void advanceSource(AudioSource& source, float deltaTime);
+    bool isBinaural(const AudioSource& source) const;
+    void computeMix(const AudioSource& source, VoiceMix& mix) const;
+    void startVoice(AudioSource& source, const VoiceMix& mix);
+    void releaseVoice(AudioSource& source);
+    void sendNotes(AudioSource& source);
+    std::shared_ptr<AudioSource> acquireOneShot();
+    void reclaimOneShots();
+    void audioThreadMain();
+    
     bool m_initialized;
     float m_masterVolume;
+    ReverbParams m_reverb;
+    std::shared_ptr<const HrtfSet> m_hrtf;     // Null when binaural rendering is off
     
     std::unique_ptr<AudioListener> m_listener;
     std::vector<std::shared_ptr<AudioSource>> m_sources;
     std::unordered_map<std::string, std::shared_ptr<AudioClip>> m_audioClips;
+    AudioBufferCache m_bufferCache;
+    std::unique_ptr<AudioStreamer> m_streamer;
+    
+    // Mixer and the thread that drives it
+    Settings m_settings;
+    std::unique_ptr<AudioMixer> m_mixer;
+    std::unique_ptr<AudioOutput> m_output;
+    std::thread m_audioThread;
+    std::atomic<bool> m_running;
+    std::vector<VoiceSlot> m_voices;
+    std::vector<uint32_t> m_freeVoices;
+    std::vector<AudioCommand> m_commandBacklog;    // Posted while the queue was full
     
-    // Platform-specific audio context
-    void* m_audioContext;
+    // Voice allocation
+    std::vector<Candidate> m_candidates;
+    std::vector<std::shared_ptr<AudioSource>> m_oneShotPool;   // Finished one-shots for reuse
+    uint32_t m_oneShotCount;
+    VoiceStats m_voiceStats;
+    
+    std::shared_ptr<SpectrumSnapshot> m_spectrum;
 };
 
 class AudioSource {
@@ -94,6 +228,30 @@ public:
     void setReferenceDistance(float distance);
     void setMaxDistance(float distance);
     
+    // Level into the shared reverb for spatial sources; it falls off more
+    // slowly with distance than the direct sound, so far sources sound far
+    void setReverbSend(float send) { m_reverbSend = std::max(0.0f, std::min(1.0f, send)); }
+    float getReverbSend() const { return m_reverbSend; }
+    
+    // Non-spatial sources play at their volume on both channels
+    void setSpatial(bool spatial) { m_spatial = spatial; }
+    bool isSpatial() const { return m_spatial; }
+    
+    // Weight on audible gain when voices are handed out; 1 is normal
+    void setPriority(float priority) { m_priority = std::max(0.0f, priority); }
+    float getPriority() const { return m_priority; }
+    
+    // Real while mixed, virtual while waiting for a voice
+    bool isVirtual() const { return m_playing && m_sourceId == 0; }
+    
+    // Procedural notes, synthesized instead of the clip while any are held.
+    // Playing a note starts the source; notes keep time while it is virtual.
+    uint32_t playNote(const SynthNote& note);
+    void playChord(const std::vector<float>& frequencies, const SynthNote& patch);
+    void stopNote(uint32_t id);
+    bool isSynth() const { return !m_notes.empty(); }
+    size_t getNoteCount() const { return m_notes.size(); }
+    
     void play();
     void pause();
     void stop();
@@ -101,8 +259,19 @@ public:
     
     const float3& getPosition() const { return m_position; }
     float getVolume() const { return m_volume; }
+    float getMaxDistance() const { return m_maxDistance; }
     
 private:
+    friend class AudioEngine;
+    
+    struct HeldNote {
+        SynthNote note;
+        float age = 0.0f;
+        float releasedAt = -1.0f;   // Age the release began, or -1
+        bool sent = false;          // Playing on the current voice
+        bool releaseSent = false;   // The voice knows when it releases
+    };
+    
     std::shared_ptr<AudioClip> m_clip;
     float3 m_position;
     float3 m_velocity;
@@ -110,11 +279,21 @@ private:
     float m_pitch;
     bool m_looping;
     bool m_playing;
+    bool m_paused;
+    bool m_spatial;
+    bool m_oneShot;             // Owned by the engine, recycled when it stops
+    float m_priority;
+    double m_playTime;          // Seconds into the clip, kept while virtual
     float m_referenceDistance;
     float m_maxDistance;
+    float m_reverbSend;
     
-    // Platform-specific source handle
+    // Mixer voice + 1, or 0 when the source has none
     uint32_t m_sourceId;
+    uint32_t m_playGeneration;  // Bumped by play() from stopped
+    
+    std::vector<HeldNote> m_notes;
+    uint32_t m_nextNoteId;
 };
 
 } // namespace FinalStorm
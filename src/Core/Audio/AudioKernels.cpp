@@ -0,0 +1,309 @@
+// src/Core/Audio/AudioKernels.cpp
+// Mixer inner loops over a small four-lane vector wrapper
+
+#include "Core/Audio/AudioKernels.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define FINALSTORM_AUDIO_SSE 1
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define FINALSTORM_AUDIO_NEON 1
+#endif
+
+namespace FinalStorm {
+namespace AudioKernels {
+
+namespace {
+
+// Four floats per operation; only what the kernels below need
+#if defined(FINALSTORM_AUDIO_SSE)
+using f4 = __m128;
+inline f4 load(const float* p) { return _mm_loadu_ps(p); }
+inline void store(float* p, f4 v) { _mm_storeu_ps(p, v); }
+inline f4 splat(float v) { return _mm_set1_ps(v); }
+inline f4 make(float a, float b, float c, float d) { return _mm_setr_ps(a, b, c, d); }
+inline f4 add(f4 a, f4 b) { return _mm_add_ps(a, b); }
+inline f4 sub(f4 a, f4 b) { return _mm_sub_ps(a, b); }
+inline f4 mul(f4 a, f4 b) { return _mm_mul_ps(a, b); }
+inline f4 min(f4 a, f4 b) { return _mm_min_ps(a, b); }
+inline f4 max(f4 a, f4 b) { return _mm_max_ps(a, b); }
+inline f4 zipLow(f4 a, f4 b) { return _mm_unpacklo_ps(a, b); }     // a0 b0 a1 b1
+inline f4 zipHigh(f4 a, f4 b) { return _mm_unpackhi_ps(a, b); }    // a2 b2 a3 b3
+#elif defined(FINALSTORM_AUDIO_NEON)
+using f4 = float32x4_t;
+inline f4 load(const float* p) { return vld1q_f32(p); }
+inline void store(float* p, f4 v) { vst1q_f32(p, v); }
+inline f4 splat(float v) { return vdupq_n_f32(v); }
+inline f4 make(float a, float b, float c, float d) { const float v[4] = { a, b, c, d }; return vld1q_f32(v); }
+inline f4 add(f4 a, f4 b) { return vaddq_f32(a, b); }
+inline f4 sub(f4 a, f4 b) { return vsubq_f32(a, b); }
+inline f4 mul(f4 a, f4 b) { return vmulq_f32(a, b); }
+inline f4 min(f4 a, f4 b) { return vminq_f32(a, b); }
+inline f4 max(f4 a, f4 b) { return vmaxq_f32(a, b); }
+inline f4 zipLow(f4 a, f4 b) { return vzipq_f32(a, b).val[0]; }
+inline f4 zipHigh(f4 a, f4 b) { return vzipq_f32(a, b).val[1]; }
+#else
+struct f4 { float v[4]; };
+inline f4 load(const float* p) { return f4{ { p[0], p[1], p[2], p[3] } }; }
+inline void store(float* p, f4 a) { std::copy(a.v, a.v + 4, p); }
+inline f4 splat(float v) { return f4{ { v, v, v, v } }; }
+inline f4 make(float a, float b, float c, float d) { return f4{ { a, b, c, d } }; }
+inline f4 add(f4 a, f4 b) { return f4{ { a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3] } }; }
+inline f4 sub(f4 a, f4 b) { return f4{ { a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3] } }; }
+inline f4 mul(f4 a, f4 b) { return f4{ { a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3] } }; }
+inline f4 min(f4 a, f4 b) { return f4{ { std::min(a.v[0], b.v[0]), std::min(a.v[1], b.v[1]), std::min(a.v[2], b.v[2]), std::min(a.v[3], b.v[3]) } }; }
+inline f4 max(f4 a, f4 b) { return f4{ { std::max(a.v[0], b.v[0]), std::max(a.v[1], b.v[1]), std::max(a.v[2], b.v[2]), std::max(a.v[3], b.v[3]) } }; }
+inline f4 zipLow(f4 a, f4 b) { return f4{ { a.v[0], b.v[0], a.v[1], b.v[1] } }; }
+inline f4 zipHigh(f4 a, f4 b) { return f4{ { a.v[2], b.v[2], a.v[3], b.v[3] } }; }
+#endif
+
+inline f4 lerp(f4 a, f4 b, f4 t) { return add(a, mul(sub(b, a), t)); }
+
+} // namespace
+
+void clear(float* buffer, size_t count) {
+    std::fill(buffer, buffer + count, 0.0f);
+}
+
+void resampleLinear(const float* src, size_t srcFrames, size_t channels,
+                    double position, double step, float* out, size_t frames) {
+    // Guards the successor read against rounding at the very end
+    const size_t lastBase = srcFrames >= 2 ? srcFrames - 2 : 0;
+    auto base = [lastBase](double at) { return std::min(static_cast<size_t>(at), lastBase); };
+
+    size_t i = 0;
+    if (channels == 1) {
+        for (; i + 4 <= frames; i += 4) {
+            double p0 = position + step * i, p1 = p0 + step, p2 = p1 + step, p3 = p2 + step;
+            size_t i0 = base(p0), i1 = base(p1), i2 = base(p2), i3 = base(p3);
+            f4 a = make(src[i0], src[i1], src[i2], src[i3]);
+            f4 b = make(src[i0 + 1], src[i1 + 1], src[i2 + 1], src[i3 + 1]);
+            f4 t = make(static_cast<float>(p0 - i0), static_cast<float>(p1 - i1),
+                        static_cast<float>(p2 - i2), static_cast<float>(p3 - i3));
+            store(out + i, lerp(a, b, t));
+        }
+        for (; i < frames; ++i) {
+            double p = position + step * i;
+            size_t index = base(p);
+            float t = static_cast<float>(p - index);
+            out[i] = src[index] + (src[index + 1] - src[index]) * t;
+        }
+        return;
+    }
+
+    // Stereo: two frames per vector
+    for (; i + 2 <= frames; i += 2) {
+        double p0 = position + step * i, p1 = p0 + step;
+        size_t i0 = base(p0), i1 = base(p1);
+        const float* a0 = src + i0 * 2;
+        const float* a1 = src + i1 * 2;
+        f4 a = make(a0[0], a0[1], a1[0], a1[1]);
+        f4 b = make(a0[2], a0[3], a1[2], a1[3]);
+        float t0 = static_cast<float>(p0 - i0);
+        float t1 = static_cast<float>(p1 - i1);
+        store(out + i * 2, lerp(a, b, make(t0, t0, t1, t1)));
+    }
+    for (; i < frames; ++i) {
+        double p = position + step * i;
+        size_t index = base(p);
+        float t = static_cast<float>(p - index);
+        const float* a = src + index * 2;
+        out[i * 2] = a[0] + (a[2] - a[0]) * t;
+        out[i * 2 + 1] = a[1] + (a[3] - a[1]) * t;
+    }
+}
+
+void mixMonoToStereo(float* out, const float* in, size_t frames,
+                     float gainLeft, float gainRight, float stepLeft, float stepRight) {
+    size_t i = 0;
+    // Four mono frames fill two stereo vectors
+    f4 gainLow = make(gainLeft, gainRight, gainLeft + stepLeft, gainRight + stepRight);
+    f4 gainHigh = add(gainLow, make(2 * stepLeft, 2 * stepRight, 2 * stepLeft, 2 * stepRight));
+    const f4 advance = make(4 * stepLeft, 4 * stepRight, 4 * stepLeft, 4 * stepRight);
+    for (; i + 4 <= frames; i += 4) {
+        f4 mono = load(in + i);
+        f4 low = zipLow(mono, mono);
+        f4 high = zipHigh(mono, mono);
+        store(out + i * 2, add(load(out + i * 2), mul(low, gainLow)));
+        store(out + i * 2 + 4, add(load(out + i * 2 + 4), mul(high, gainHigh)));
+        gainLow = add(gainLow, advance);
+        gainHigh = add(gainHigh, advance);
+    }
+    for (; i < frames; ++i) {
+        float left = gainLeft + stepLeft * i;
+        float right = gainRight + stepRight * i;
+        out[i * 2] += in[i] * left;
+        out[i * 2 + 1] += in[i] * right;
+    }
+}
+
+void mixStereo(float* out, const float* in, size_t frames,
+               float gainLeft, float gainRight, float stepLeft, float stepRight) {
+    size_t i = 0;
+    f4 gain = make(gainLeft, gainRight, gainLeft + stepLeft, gainRight + stepRight);
+    const f4 advance = make(2 * stepLeft, 2 * stepRight, 2 * stepLeft, 2 * stepRight);
+    for (; i + 2 <= frames; i += 2) {
+        store(out + i * 2, add(load(out + i * 2), mul(load(in + i * 2), gain)));
+        gain = add(gain, advance);
+    }
+    for (; i < frames; ++i) {
+        out[i * 2] += in[i * 2] * (gainLeft + stepLeft * i);
+        out[i * 2 + 1] += in[i * 2 + 1] * (gainRight + stepRight * i);
+    }
+}
+
+void scaleStereoClamped(float* buffer, size_t frames, float gain, float step) {
+    size_t i = 0;
+    f4 gains = make(gain, gain, gain + step, gain + step);
+    const f4 advance = splat(2 * step);
+    const f4 low = splat(-1.0f);
+    const f4 high = splat(1.0f);
+    for (; i + 2 <= frames; i += 2) {
+        f4 scaled = mul(load(buffer + i * 2), gains);
+        store(buffer + i * 2, min(max(scaled, low), high));
+        gains = add(gains, advance);
+    }
+    for (; i < frames; ++i) {
+        float g = gain + step * i;
+        buffer[i * 2] = std::min(1.0f, std::max(-1.0f, buffer[i * 2] * g));
+        buffer[i * 2 + 1] = std::min(1.0f, std::max(-1.0f, buffer[i * 2 + 1] * g));
+    }
+}
+
+void scale(float* buffer, size_t count, float gain, float step) {
+    size_t i = 0;
+    f4 gains = make(gain, gain + step, gain + 2 * step, gain + 3 * step);
+    const f4 advance = splat(4 * step);
+    for (; i + 4 <= count; i += 4) {
+        store(buffer + i, mul(load(buffer + i), gains));
+        gains = add(gains, advance);
+    }
+    for (; i < count; ++i) {
+        buffer[i] *= gain + step * i;
+    }
+}
+
+void mixDown(float* out, const float* in, size_t frames, size_t channels, float gain, float step) {
+    if (channels == 1) {
+        size_t i = 0;
+        f4 gains = make(gain, gain + step, gain + 2 * step, gain + 3 * step);
+        const f4 advance = splat(4 * step);
+        for (; i + 4 <= frames; i += 4) {
+            store(out + i, add(load(out + i), mul(load(in + i), gains)));
+            gains = add(gains, advance);
+        }
+        for (; i < frames; ++i) {
+            out[i] += in[i] * (gain + step * i);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < frames; ++i) {
+        out[i] += 0.5f * (in[i * 2] + in[i * 2 + 1]) * (gain + step * i);
+    }
+}
+
+void renderOscillators(float* cosState, float* sinState, const float* rotCos, const float* rotSin,
+                       float* gain, const float* gainStep, size_t count, float* out, size_t frames) {
+    // Oscillators four at a time with their state in registers for a whole
+    // run of frames; each frame's four lanes land in a small buffer that is
+    // summed once at the end rather than per group
+    constexpr size_t RunFrames = 256;
+    float lanes[RunFrames * 4];
+    const f4 three = splat(3.0f);
+    const f4 half = splat(0.5f);
+
+    for (size_t start = 0; start < frames; start += RunFrames) {
+        const size_t run = std::min(RunFrames, frames - start);
+        std::fill(lanes, lanes + run * 4, 0.0f);
+
+        for (size_t g = 0; g < count; g += 4) {
+            f4 c = load(cosState + g);
+            f4 s = load(sinState + g);
+            f4 a = load(gain + g);
+            const f4 rc = load(rotCos + g);
+            const f4 rs = load(rotSin + g);
+            const f4 da = load(gainStep + g);
+            for (size_t i = 0; i < run; ++i) {
+                store(lanes + i * 4, add(load(lanes + i * 4), mul(s, a)));
+                f4 next = sub(mul(c, rc), mul(s, rs));
+                s = add(mul(c, rs), mul(s, rc));
+                c = next;
+                a = add(a, da);
+            }
+
+            // Rounding slowly changes the amplitude; one Newton step on
+            // 1 / |(c, s)| pulls it back to the unit circle
+            f4 scale = mul(half, sub(three, add(mul(c, c), mul(s, s))));
+            store(cosState + g, mul(c, scale));
+            store(sinState + g, mul(s, scale));
+            store(gain + g, a);
+        }
+
+        for (size_t i = 0; i < run; ++i) {
+            const float* lane = lanes + i * 4;
+            out[start + i] += (lane[0] + lane[1]) + (lane[2] + lane[3]);
+        }
+    }
+}
+
+void fft(float* re, float* im, size_t n, const float* twiddleRe, const float* twiddleIm) {
+    // The first two stages have spans under four; they run scalar
+    for (size_t half = 1; half < n; half <<= 1) {
+        const float* wr = twiddleRe + half - 1;
+        const float* wi = twiddleIm + half - 1;
+        for (size_t start = 0; start < n; start += half * 2) {
+            float* ar = re + start;
+            float* ai = im + start;
+            float* br = ar + half;
+            float* bi = ai + half;
+
+            size_t j = 0;
+            for (; j + 4 <= half; j += 4) {
+                f4 cr = load(wr + j);
+                f4 ci = load(wi + j);
+                f4 xr = load(br + j);
+                f4 xi = load(bi + j);
+                f4 tr = sub(mul(xr, cr), mul(xi, ci));
+                f4 ti = add(mul(xr, ci), mul(xi, cr));
+                f4 ur = load(ar + j);
+                f4 ui = load(ai + j);
+                store(ar + j, add(ur, tr));
+                store(ai + j, add(ui, ti));
+                store(br + j, sub(ur, tr));
+                store(bi + j, sub(ui, ti));
+            }
+            for (; j < half; ++j) {
+                float tr = br[j] * wr[j] - bi[j] * wi[j];
+                float ti = br[j] * wi[j] + bi[j] * wr[j];
+                br[j] = ar[j] - tr;
+                bi[j] = ai[j] - ti;
+                ar[j] += tr;
+                ai[j] += ti;
+            }
+        }
+    }
+}
+
+void multiplyAccumulate(float* accRe, float* accIm, const float* aRe, const float* aIm,
+                        const float* bRe, const float* bIm, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        f4 ar = load(aRe + i);
+        f4 ai = load(aIm + i);
+        f4 br = load(bRe + i);
+        f4 bi = load(bIm + i);
+        store(accRe + i, add(load(accRe + i), sub(mul(ar, br), mul(ai, bi))));
+        store(accIm + i, add(load(accIm + i), add(mul(ar, bi), mul(ai, br))));
+    }
+    for (; i < count; ++i) {
+        accRe[i] += aRe[i] * bRe[i] - aIm[i] * bIm[i];
+        accIm[i] += aRe[i] * bIm[i] + aIm[i] * bRe[i];
+    }
+}
+
+} // namespace AudioKernels
+} // namespace FinalStorm
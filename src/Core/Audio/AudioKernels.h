@@ -0,0 +1,55 @@
+// src/Core/Audio/AudioKernels.h
+// Inner loops of the software mixer, four lanes at a time
+// SSE on x86, NEON on ARM, plain C++ elsewhere; all buffers are unaligned-safe
+
+#pragma once
+#include <cstddef>
+
+namespace FinalStorm {
+namespace AudioKernels {
+
+void clear(float* buffer, size_t count);
+
+// Linear-interpolating resampler. Reads frames at position, position + step,
+// ... from src (channels 1 or 2, interleaved) into frames output frames.
+// Every frame read must have a successor: position + (frames - 1) * step
+// must stay below srcFrames - 1.
+void resampleLinear(const float* src, size_t srcFrames, size_t channels,
+                    double position, double step, float* out, size_t frames);
+
+// out (stereo, interleaved) += in * gain, with each gain moving by its step
+// per frame, so parameter changes ramp instead of clicking
+void mixMonoToStereo(float* out, const float* in, size_t frames,
+                     float gainLeft, float gainRight, float stepLeft, float stepRight);
+void mixStereo(float* out, const float* in, size_t frames,
+               float gainLeft, float gainRight, float stepLeft, float stepRight);
+
+// Stereo buffer *= gain (ramped the same way), then clamped to [-1, 1]
+void scaleStereoClamped(float* buffer, size_t frames, float gain, float step);
+
+// Mono buffer *= gain, ramped the same way
+void scale(float* buffer, size_t count, float gain, float step);
+
+// out (mono) += the mean of in's channels (1 or 2, interleaved) * gain, ramped
+void mixDown(float* out, const float* in, size_t frames, size_t channels, float gain, float step);
+
+// Sine oscillators kept as (cos, sin) pairs and advanced each frame by
+// multiplying with their rotation (cos, sin of the phase step). out (mono)
+// += the sum of sin * gain, each gain moving by its step per frame. State and
+// gains are written back, so the next call continues seamlessly. count must
+// be a multiple of four; pad with zero gain.
+void renderOscillators(float* cosState, float* sinState, const float* rotCos, const float* rotSin,
+                       float* gain, const float* gainStep, size_t count, float* out, size_t frames);
+
+// In-place radix-2 complex FFT of n (a power of two, at least 4) points held
+// as separate real and imaginary arrays, input in bit-reversed order.
+// twiddles holds n - 1 (cos, -sin) pairs as two arrays: stage h (1, 2, 4 ...)
+// starts at h - 1 and lists exp(-i pi j / h) for j < h.
+void fft(float* re, float* im, size_t n, const float* twiddleRe, const float* twiddleIm);
+
+// acc += a * b over count complex values in split real/imaginary arrays
+void multiplyAccumulate(float* accRe, float* accIm, const float* aRe, const float* aIm,
+                        const float* bRe, const float* bIm, size_t count);
+
+} // namespace AudioKernels
+} // namespace FinalStorm
@@ -0,0 +1,306 @@
+// src/Core/Audio/AudioMixer.cpp
+// Software mixer implementation
+
+#include "Core/Audio/AudioMixer.h"
+#include "Core/Audio/AudioKernels.h"
+#include <algorithm>
+#include <cmath>
+
+namespace FinalStorm {
+
+namespace {
+
+constexpr size_t CommandCapacity = 4096;
+
+// Keeps the resampler moving forward
+constexpr float MinPitch = 0.01f;
+
+} // namespace
+
+AudioMixer::AudioMixer(uint32_t sampleRate, uint32_t maxVoices, std::shared_ptr<const HrtfSet> hrtf)
+    : m_sampleRate(sampleRate)
+    , m_voices(maxVoices)
+    , m_scratch(BlockSize * Channels)
+    , m_binaural(BlockSize * Channels)
+    , m_sendBus(BlockSize)
+    , m_masterGain(1.0f)
+    , m_masterTarget(1.0f)
+    , m_commands(CommandCapacity)
+    // Each Play ends in exactly one VoiceEnded and a slot is not reused until
+    // the game has seen it, so at most maxVoices events are ever outstanding
+    , m_events(std::max<size_t>(maxVoices, 1))
+    , m_reverb(sampleRate)
+    , m_analyzer(sampleRate)
+    , m_activeVoices(0)
+    , m_underruns(0) {
+    if (hrtf && hrtf->getSampleRate() == sampleRate) {
+        m_convolvers.reserve(maxVoices);
+        for (uint32_t i = 0; i < maxVoices; ++i) {
+            m_convolvers.emplace_back(hrtf);
+        }
+    }
+}
+
+bool AudioMixer::post(const AudioCommand& command) {
+    return m_commands.push(command);
+}
+
+bool AudioMixer::pollEvent(AudioEvent& event) {
+    return m_events.pop(event);
+}
+
+void AudioMixer::render(float* output, size_t frames) {
+    applyCommands();
+    for (size_t offset = 0; offset < frames; offset += BlockSize) {
+        mixBlock(output + offset * Channels, std::min(BlockSize, frames - offset));
+    }
+}
+
+void AudioMixer::applyCommands() {
+    AudioCommand command;
+    while (m_commands.pop(command)) {
+        if (command.type == AudioCommandType::SetMasterGain) {
+            m_masterTarget = command.gainLeft;
+            continue;
+        }
+        if (command.type == AudioCommandType::SetReverb) {
+            m_reverb.setParams(command.reverb);
+            continue;
+        }
+        if (command.voice >= m_voices.size()) continue;
+
+        Voice& voice = m_voices[command.voice];
+        switch (command.type) {
+            case AudioCommandType::Play:
+                voice = Voice();
+                voice.buffer = command.buffer;
+                voice.stream = command.buffer ? nullptr : command.stream;
+                voice.synth = command.buffer || command.stream ? nullptr : command.synth;
+                voice.position = std::max(0.0, command.position);
+                voice.pitch = std::max(MinPitch, command.pitch);
+                voice.gainLeft = voice.targetLeft = command.gainLeft;
+                voice.gainRight = voice.targetRight = command.gainRight;
+                voice.send = voice.targetSend = command.send;
+                voice.looping = command.looping;
+                if (!voice.isActive() || (voice.buffer && voice.buffer->getChannels() > Channels) ||
+                    (voice.stream && voice.stream->getChannels() > Channels)) {
+                    endVoice(command.voice);
+                    break;
+                }
+                // Stereo sources already carry their own image
+                voice.binaural = command.binaural && !m_convolvers.empty() &&
+                                 !(voice.buffer && voice.buffer->getChannels() != 1) &&
+                                 !(voice.stream && voice.stream->getChannels() != 1);
+                voice.azimuth = command.azimuth;
+                voice.elevation = command.elevation;
+                if (voice.binaural) {
+                    m_convolvers[command.voice].reset(voice.azimuth, voice.elevation);
+                }
+                break;
+            case AudioCommandType::Stop:
+                if (voice.isActive()) {
+                    voice.stopping = true;
+                    voice.paused = false;
+                    voice.targetLeft = voice.targetRight = 0.0f;
+                }
+                break;
+            case AudioCommandType::SetParams:
+                voice.targetLeft = command.gainLeft;
+                voice.targetRight = command.gainRight;
+                voice.targetSend = command.send;
+                voice.azimuth = command.azimuth;
+                voice.elevation = command.elevation;
+                voice.pitch = std::max(MinPitch, command.pitch);
+                break;
+            case AudioCommandType::SetPaused:
+                if (!voice.stopping) voice.paused = command.paused;
+                break;
+            case AudioCommandType::NoteOn:
+                if (voice.synth) voice.synth->noteOn(command.note);
+                break;
+            case AudioCommandType::NoteOff:
+                if (voice.synth) voice.synth->noteOff(command.note.id);
+                break;
+            case AudioCommandType::SetMasterGain:
+            case AudioCommandType::SetReverb:
+                break;
+        }
+    }
+}
+
+void AudioMixer::mixBlock(float* output, size_t frames) {
+    AudioKernels::clear(output, frames * Channels);
+    AudioKernels::clear(m_sendBus.data(), frames);
+
+    uint32_t active = 0;
+    for (uint32_t i = 0; i < m_voices.size(); ++i) {
+        Voice& voice = m_voices[i];
+        if (!voice.isActive() || voice.paused) continue;
+
+        active++;
+        if (!mixVoice(voice, i, output, frames)) {
+            endVoice(i);
+        }
+    }
+
+    // One reverb for every voice, however many send to it
+    m_reverb.process(m_sendBus.data(), output, frames);
+
+    AudioKernels::scaleStereoClamped(output, frames, m_masterGain, (m_masterTarget - m_masterGain) / frames);
+    m_masterGain = m_masterTarget;
+    m_analyzer.process(output, frames);
+    m_activeVoices.store(active, std::memory_order_relaxed);
+}
+
+bool AudioMixer::mixVoice(Voice& voice, uint32_t index, float* output, size_t frames) {
+    bool ended = false;
+    size_t written = 0;
+    size_t channels = 1;
+    if (voice.tail > 0) {
+        // The source is done; only the convolver's tail is left to play
+    } else if (voice.synth) {
+        written = readSynth(voice, frames);
+    } else if (voice.stream) {
+        written = readStream(voice, frames, ended);
+        channels = voice.stream->getChannels();
+    } else {
+        written = readBuffer(voice, frames, ended);
+        channels = voice.buffer->getChannels();
+    }
+
+    // Gains ramp across the whole block even if the clip ended partway
+    float stepLeft = (voice.targetLeft - voice.gainLeft) / frames;
+    float stepRight = (voice.targetRight - voice.gainRight) / frames;
+    float stepSend = (voice.targetSend - voice.send) / frames;
+    AudioKernels::mixDown(m_sendBus.data(), m_scratch.data(), written, channels, voice.send, stepSend);
+    if (voice.binaural) {
+        // Gain goes on before the convolution, so the tail carries a stop's fade
+        AudioKernels::clear(m_scratch.data() + written, frames - written);
+        AudioKernels::scale(m_scratch.data(), frames, voice.gainLeft, stepLeft);
+        HrtfConvolver& convolver = m_convolvers[index];
+        convolver.setDirection(voice.azimuth, voice.elevation);
+        convolver.process(m_scratch.data(), m_binaural.data(), frames);
+        AudioKernels::mixStereo(output, m_binaural.data(), frames, 1.0f, 1.0f, 0.0f, 0.0f);
+    } else if (channels == 1) {
+        AudioKernels::mixMonoToStereo(output, m_scratch.data(), written, voice.gainLeft, voice.gainRight, stepLeft, stepRight);
+    } else {
+        AudioKernels::mixStereo(output, m_scratch.data(), written, voice.gainLeft, voice.gainRight, stepLeft, stepRight);
+    }
+    voice.gainLeft = voice.targetLeft;
+    voice.gainRight = voice.targetRight;
+    voice.send = voice.targetSend;
+
+    if (!voice.binaural) {
+        return !ended && !voice.stopping;
+    }
+    if (voice.tail > 0) {
+        voice.tail -= std::min(voice.tail, frames);
+        return voice.tail > 0;
+    }
+    if (ended || voice.stopping) {
+        voice.tail = m_convolvers[index].getTailFrames();
+    }
+    return true;
+}
+
+size_t AudioMixer::readBuffer(Voice& voice, size_t frames, bool& ended) {
+    const AudioBuffer& buffer = *voice.buffer;
+    const float* src = buffer.getSamples();
+    const size_t srcFrames = buffer.getFrameCount();
+    const size_t channels = buffer.getChannels();
+    const double step = static_cast<double>(voice.pitch) * buffer.getSampleRate() / m_sampleRate;
+
+    float* resampled = m_scratch.data();
+    size_t written = 0;
+    while (written < frames) {
+        if (srcFrames == 0) {
+            ended = true;
+            break;
+        }
+
+        // Bulk of the clip: every frame has a successor to interpolate toward
+        const double limit = static_cast<double>(srcFrames - 1);
+        if (voice.position < limit) {
+            size_t count = static_cast<size_t>(std::ceil((limit - voice.position) / step));
+            count = std::max<size_t>(1, std::min(count, frames - written));
+            AudioKernels::resampleLinear(src, srcFrames, channels, voice.position, step, resampled + written * channels, count);
+            voice.position += step * count;
+            written += count;
+            continue;
+        }
+
+        if (voice.position >= static_cast<double>(srcFrames)) {
+            if (!voice.looping) {
+                ended = true;
+                break;
+            }
+            voice.position = std::fmod(voice.position, static_cast<double>(srcFrames));
+            continue;
+        }
+
+        // Past the last frame: interpolate toward the loop start, or silence
+        float t = static_cast<float>(voice.position - limit);
+        for (size_t c = 0; c < channels; ++c) {
+            float a = src[(srcFrames - 1) * channels + c];
+            float b = voice.looping ? src[c] : 0.0f;
+            resampled[written * channels + c] = a + (b - a) * t;
+        }
+        voice.position += step;
+        written++;
+    }
+    return written;
+}
+
+size_t AudioMixer::readStream(Voice& voice, size_t frames, bool& ended) {
+    AudioStream& stream = *voice.stream;
+    const size_t channels = stream.getChannels();
+    const double step = static_cast<double>(voice.pitch) * stream.getSampleRate() / m_sampleRate;
+
+    float* resampled = m_scratch.data();
+    size_t written = 0;
+    while (written < frames) {
+        const AudioStream::Chunk* chunk = stream.front();
+        if (!chunk) {
+            // Not decoded yet: silence, and the voice waits where it is
+            if (voice.started) {
+                stream.countUnderrun();
+                m_underruns.fetch_add(1, std::memory_order_relaxed);
+            }
+            break;
+        }
+        voice.started = true;
+
+        // Chunks hold one extra frame, so every frame before it has a successor
+        if (voice.position < static_cast<double>(chunk->frames)) {
+            size_t count = static_cast<size_t>(std::ceil((chunk->frames - voice.position) / step));
+            count = std::max<size_t>(1, std::min(count, frames - written));
+            AudioKernels::resampleLinear(chunk->samples.data(), chunk->frames + 1, channels,
+                                         voice.position, step, resampled + written * channels, count);
+            voice.position += step * count;
+            written += count;
+            continue;
+        }
+
+        voice.position -= static_cast<double>(chunk->frames);
+        bool last = chunk->endOfStream;
+        stream.releaseFront();
+        if (last) {
+            ended = true;
+            break;
+        }
+    }
+    return written;
+}
+
+size_t AudioMixer::readSynth(Voice& voice, size_t frames) {
+    // Pitch does not apply: notes carry their own frequencies
+    voice.synth->render(m_scratch.data(), frames);
+    return frames;
+}
+
+void AudioMixer::endVoice(uint32_t index) {
+    m_voices[index] = Voice();
+    m_events.push(AudioEvent{ AudioEvent::VoiceEnded, index });
+}
+
+} // namespace FinalStorm
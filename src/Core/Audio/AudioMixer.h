@@ -0,0 +1,151 @@
+// src/Core/Audio/AudioMixer.h
+// Real-time software mixer: fixed voice slots mixed to stereo float in fixed blocks,
+// mono voices optionally rendered binaurally, all of them sending to one reverb
+// The game thread only posts commands and polls events; render() runs on the
+// audio thread and never locks or allocates
+
+#pragma once
+
+#include "Core/Audio/AudioBuffer.h"
+#include "Core/Audio/AudioReverb.h"
+#include "Core/Audio/AudioStream.h"
+#include "Core/Audio/Hrtf.h"
+#include "Core/Audio/OscillatorBank.h"
+#include "Core/Audio/SpectrumAnalyzer.h"
+#include "Core/SPSCQueue.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace FinalStorm {
+
+enum class AudioCommandType : uint8_t {
+    Play,           // Start buffer on voice at position
+    Stop,           // Fade out over one block, then end
+    SetParams,      // Gains and pitch, ramped over the next block
+    SetPaused,
+    SetMasterGain,
+    NoteOn,         // Synth voices: add note
+    NoteOff,        // Synth voices: release note.id
+    SetReverb       // Shared reverb bus parameters
+};
+
+struct AudioCommand {
+    AudioCommandType type = AudioCommandType::Play;
+    uint32_t voice = 0;
+    const AudioBuffer* buffer = nullptr;    // Play; must stay alive until the voice ends
+    float gainLeft = 1.0f;                  // Also the master gain for SetMasterGain
+    float gainRight = 1.0f;
+    float pitch = 1.0f;
+    double position = 0.0;                  // Play: start, in source frames
+    bool looping = false;                   // Play
+    bool paused = false;                    // SetPaused
+    AudioStream* stream = nullptr;          // Play, instead of buffer; same lifetime rule
+    OscillatorBank* synth = nullptr;        // Play, instead of buffer; same lifetime rule
+    SynthNote note;                         // NoteOn, NoteOff
+    float azimuth = 0.0f;                   // Play, SetParams: binaural direction, radians
+    float elevation = 0.0f;
+    float send = 0.0f;                      // Play, SetParams: level into the reverb bus
+    bool binaural = false;                  // Play: through the HRTF; gainLeft is the gain
+    ReverbParams reverb;                    // SetReverb
+};
+
+struct AudioEvent {
+    enum Type : uint8_t {
+        VoiceEnded      // The voice is free and no longer reads its buffer
+    };
+
+    Type type;
+    uint32_t voice;
+};
+
+class AudioMixer {
+public:
+    static constexpr size_t BlockSize = 256;    // Frames per mix pass
+    static constexpr uint32_t Channels = 2;
+
+    // Without an HRTF set (or with one at another rate), binaural voices
+    // play centred. The convolvers are allocated here, never on the audio thread.
+    AudioMixer(uint32_t sampleRate, uint32_t maxVoices, std::shared_ptr<const HrtfSet> hrtf = nullptr);
+
+    AudioMixer(const AudioMixer&) = delete;
+    AudioMixer& operator=(const AudioMixer&) = delete;
+
+    // Game thread. Returns false when the queue is full; retry later.
+    bool post(const AudioCommand& command);
+    bool pollEvent(AudioEvent& event);
+
+    // Audio thread. Applies pending commands, then mixes frames of
+    // interleaved stereo into output, BlockSize frames at a time.
+    void render(float* output, size_t frames);
+
+    uint32_t getSampleRate() const { return m_sampleRate; }
+    uint32_t getMaxVoices() const { return static_cast<uint32_t>(m_voices.size()); }
+
+    // Voices mixed in the last block; readable from any thread
+    uint32_t getActiveVoiceCount() const { return m_activeVoices.load(std::memory_order_relaxed); }
+
+    // Blocks in which a streaming voice ran out of decoded audio
+    uint32_t getUnderrunCount() const { return m_underruns.load(std::memory_order_relaxed); }
+
+    // Band levels of the final mix; readable from any thread
+    SpectrumSnapshot readSpectrum() const { return m_analyzer.read(); }
+
+private:
+    struct Voice {
+        const AudioBuffer* buffer = nullptr;
+        AudioStream* stream = nullptr;
+        OscillatorBank* synth = nullptr;    // Plays until stopped, even with no notes
+        double position = 0.0;      // In source frames; within the front chunk for streams
+        float pitch = 1.0f;
+        float gainLeft = 0.0f;      // Current, ramping toward target each block
+        float gainRight = 0.0f;
+        float targetLeft = 0.0f;
+        float targetRight = 0.0f;
+        float send = 0.0f;          // Reverb send, ramping like the gains
+        float targetSend = 0.0f;
+        float azimuth = 0.0f;
+        float elevation = 0.0f;
+        size_t tail = 0;            // Binaural: convolver output still due after the source finished
+        bool binaural = false;
+        bool looping = false;
+        bool paused = false;
+        bool stopping = false;      // Fading to silence; ends after this block
+        bool started = false;       // Streams: first chunk arrived, so later gaps are underruns
+        
+        bool isActive() const { return buffer || stream || synth; }
+    };
+
+    void applyCommands();
+    void mixBlock(float* output, size_t frames);
+
+    // Mixes one voice into output; returns false once it has ended
+    bool mixVoice(Voice& voice, uint32_t index, float* output, size_t frames);
+
+    // Resample into m_scratch; return frames written and set ended at the end of the audio
+    size_t readBuffer(Voice& voice, size_t frames, bool& ended);
+    size_t readStream(Voice& voice, size_t frames, bool& ended);
+    size_t readSynth(Voice& voice, size_t frames);
+    void endVoice(uint32_t index);
+
+    uint32_t m_sampleRate;
+    std::vector<Voice> m_voices;
+    std::vector<float> m_scratch;       // One block of resampled source audio
+    std::vector<float> m_binaural;      // One block of convolver output, stereo
+    std::vector<float> m_sendBus;       // One block of reverb send, mono
+    std::vector<HrtfConvolver> m_convolvers;    // One per voice, or none
+
+    float m_masterGain;
+    float m_masterTarget;
+
+    SPSCQueue<AudioCommand> m_commands;
+    SPSCQueue<AudioEvent> m_events;
+    AudioReverb m_reverb;
+    SpectrumAnalyzer m_analyzer;
+    std::atomic<uint32_t> m_activeVoices;
+    std::atomic<uint32_t> m_underruns;
+};
+
+} // namespace FinalStorm
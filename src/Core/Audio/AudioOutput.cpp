@@ -0,0 +1,117 @@
+// src/Core/Audio/AudioOutput.cpp
+// Null and WAV file audio outputs
+
+#include "Core/Audio/AudioOutput.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace FinalStorm {
+
+namespace {
+
+void writeU16(std::FILE* file, uint16_t value) {
+    unsigned char bytes[2] = { static_cast<unsigned char>(value), static_cast<unsigned char>(value >> 8) };
+    std::fwrite(bytes, 1, 2, file);
+}
+
+void writeU32(std::FILE* file, uint32_t value) {
+    unsigned char bytes[4] = { static_cast<unsigned char>(value), static_cast<unsigned char>(value >> 8),
+                               static_cast<unsigned char>(value >> 16), static_cast<unsigned char>(value >> 24) };
+    std::fwrite(bytes, 1, 4, file);
+}
+
+} // namespace
+
+// NullAudioOutput implementation
+NullAudioOutput::NullAudioOutput()
+    : m_sampleRate(48000)
+    , m_framesWritten(0) {
+}
+
+bool NullAudioOutput::open(uint32_t sampleRate, uint32_t /*channels*/) {
+    m_sampleRate = sampleRate;
+    m_framesWritten = 0;
+    m_start = std::chrono::steady_clock::now();
+    return true;
+}
+
+void NullAudioOutput::write(const float* /*samples*/, size_t frames) {
+    // Sleep until the device would have played everything before this block,
+    // so the mixer stays one block ahead like it would with real hardware
+    auto due = m_start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(static_cast<double>(m_framesWritten) / m_sampleRate));
+    std::this_thread::sleep_until(due);
+    m_framesWritten += frames;
+}
+
+// WavFileOutput implementation
+WavFileOutput::WavFileOutput(const std::string& path)
+    : m_path(path)
+    , m_file(nullptr)
+    , m_sampleRate(0)
+    , m_channels(0)
+    , m_framesWritten(0) {
+}
+
+WavFileOutput::~WavFileOutput() {
+    close();
+}
+
+bool WavFileOutput::open(uint32_t sampleRate, uint32_t channels) {
+    close();
+    m_file = std::fopen(m_path.c_str(), "wb");
+    if (!m_file) return false;
+
+    m_sampleRate = sampleRate;
+    m_channels = channels;
+    m_framesWritten = 0;
+    writeHeader();
+    return true;
+}
+
+void WavFileOutput::write(const float* samples, size_t frames) {
+    if (!m_file) return;
+
+    std::vector<unsigned char> bytes(frames * m_channels * 2);
+    for (size_t i = 0; i < frames * m_channels; ++i) {
+        float clamped = std::max(-1.0f, std::min(1.0f, samples[i]));
+        int16_t value = static_cast<int16_t>(std::lrint(clamped * 32767.0f));
+        bytes[i * 2] = static_cast<unsigned char>(value & 0xFF);
+        bytes[i * 2 + 1] = static_cast<unsigned char>((value >> 8) & 0xFF);
+    }
+    std::fwrite(bytes.data(), 1, bytes.size(), m_file);
+    m_framesWritten += frames;
+}
+
+void WavFileOutput::close() {
+    if (!m_file) return;
+
+    std::fseek(m_file, 0, SEEK_SET);
+    writeHeader();
+    std::fclose(m_file);
+    m_file = nullptr;
+}
+
+void WavFileOutput::writeHeader() {
+    uint32_t dataBytes = static_cast<uint32_t>(m_framesWritten * m_channels * 2);
+
+    std::fwrite("RIFF", 1, 4, m_file);
+    writeU32(m_file, 36 + dataBytes);
+    std::fwrite("WAVE", 1, 4, m_file);
+
+    std::fwrite("fmt ", 1, 4, m_file);
+    writeU32(m_file, 16);
+    writeU16(m_file, 1);                                // PCM
+    writeU16(m_file, static_cast<uint16_t>(m_channels));
+    writeU32(m_file, m_sampleRate);
+    writeU32(m_file, m_sampleRate * m_channels * 2);    // Byte rate
+    writeU16(m_file, static_cast<uint16_t>(m_channels * 2));
+    writeU16(m_file, 16);                               // Bits per sample
+
+    std::fwrite("data", 1, 4, m_file);
+    writeU32(m_file, dataBytes);
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,64 @@
+// src/Core/Audio/AudioOutput.h
+// Destinations for mixed audio blocks
+// A device output blocks in write() until it can take more, which paces the
+// audio thread; file outputs never block
+
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace FinalStorm {
+
+class AudioOutput {
+public:
+    virtual ~AudioOutput() = default;
+
+    virtual bool open(uint32_t sampleRate, uint32_t channels) = 0;
+
+    // Interleaved float frames in [-1, 1]
+    virtual void write(const float* samples, size_t frames) = 0;
+
+    virtual void close() {}
+};
+
+// Discards audio at real-time pace; stands in for a device on machines without one
+class NullAudioOutput : public AudioOutput {
+public:
+    NullAudioOutput();
+
+    bool open(uint32_t sampleRate, uint32_t channels) override;
+    void write(const float* samples, size_t frames) override;
+
+private:
+    uint32_t m_sampleRate;
+    uint64_t m_framesWritten;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+// 16-bit PCM WAV file, for offline renders
+class WavFileOutput : public AudioOutput {
+public:
+    explicit WavFileOutput(const std::string& path);
+    ~WavFileOutput() override;
+
+    bool open(uint32_t sampleRate, uint32_t channels) override;
+    void write(const float* samples, size_t frames) override;
+
+    // Patches the header sizes and closes the file
+    void close() override;
+
+    uint64_t getFramesWritten() const { return m_framesWritten; }
+
+private:
+    void writeHeader();
+
+    std::string m_path;
+    std::FILE* m_file;
+    uint32_t m_sampleRate;
+    uint32_t m_channels;
+    uint64_t m_framesWritten;
+};
+
+} // namespace FinalStorm
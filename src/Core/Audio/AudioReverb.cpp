@@ -0,0 +1,98 @@
+// src/Core/Audio/AudioReverb.cpp
+// Feedback delay network reverb implementation
+
+#include "Core/Audio/AudioReverb.h"
+#include <algorithm>
+#include <cmath>
+
+namespace FinalStorm {
+
+namespace {
+
+// Mutually prime line lengths at 48 kHz, 30 to 58 ms, so echoes never line up
+constexpr size_t BaseLengths[AudioReverb::LineCount] = { 1433, 1601, 1867, 2053, 2251, 2399, 2617, 2797 };
+
+// Added and removed again to flush decaying values to zero before they go denormal
+constexpr float DenormalGuard = 1e-18f;
+
+} // namespace
+
+AudioReverb::AudioReverb(uint32_t sampleRate)
+    : m_sampleRate(sampleRate == 0 ? 48000 : sampleRate)
+    , m_wet(0.0f)
+    , m_normalize(1.0f) {
+    for (size_t i = 0; i < LineCount; ++i) {
+        size_t length = std::max<size_t>(1, BaseLengths[i] * m_sampleRate / 48000);
+        m_lines[i].assign(length, 0.0f);
+        m_positions[i] = 0;
+        m_lowpass[i] = 0.0f;
+    }
+    setParams(ReverbParams());
+    m_wet = m_params.wet;
+}
+
+void AudioReverb::setParams(const ReverbParams& params) {
+    m_params.decaySeconds = std::max(0.05f, params.decaySeconds);
+    m_params.damping = std::min(0.95f, std::max(0.0f, params.damping));
+    m_params.wet = std::max(0.0f, params.wet);
+
+    // Each pass through a line of n samples loses n / (decay * rate) of 60 dB
+    double meanSquare = 0.0;
+    for (size_t i = 0; i < LineCount; ++i) {
+        double passes = m_params.decaySeconds * m_sampleRate / m_lines[i].size();
+        m_feedback[i] = static_cast<float>(std::pow(10.0, -3.0 / passes));
+        meanSquare += static_cast<double>(m_feedback[i]) * m_feedback[i] / LineCount;
+    }
+
+    // A lossless network builds up 1 / (1 - g^2) in energy; undo that so
+    // changing the decay does not change the loudness
+    m_normalize = static_cast<float>(std::sqrt(std::max(1e-6, 1.0 - meanSquare) / LineCount));
+}
+
+void AudioReverb::process(const float* send, float* stereo, size_t frames) {
+    const float damping = m_params.damping;
+    const float wetStep = frames > 0 ? (m_params.wet - m_wet) / frames : 0.0f;
+    const float mix = 0.35355339f;      // 1 / sqrt(8): keeps the Hadamard matrix lossless
+
+    float v[LineCount];
+    for (size_t n = 0; n < frames; ++n) {
+        for (size_t i = 0; i < LineCount; ++i) {
+            float delayed = m_lines[i][m_positions[i]];
+            float low = delayed + (m_lowpass[i] - delayed) * damping;
+            low += DenormalGuard;
+            low -= DenormalGuard;
+            m_lowpass[i] = low;
+            v[i] = low * m_feedback[i];
+        }
+
+        // Alternate lines feed alternate ears, so the return is wide
+        float left = (v[0] + v[2]) + (v[4] + v[6]);
+        float right = (v[1] + v[3]) + (v[5] + v[7]);
+        float wet = (m_wet + wetStep * n) * m_normalize;
+        stereo[n * 2] += left * wet;
+        stereo[n * 2 + 1] += right * wet;
+
+        // Fast Walsh-Hadamard transform: every line feeds every other
+        for (size_t span = 1; span < LineCount; span <<= 1) {
+            for (size_t start = 0; start < LineCount; start += span * 2) {
+                for (size_t j = start; j < start + span; ++j) {
+                    float a = v[j];
+                    float b = v[j + span];
+                    v[j] = a + b;
+                    v[j + span] = a - b;
+                }
+            }
+        }
+
+        const float in = send[n];
+        for (size_t i = 0; i < LineCount; ++i) {
+            m_lines[i][m_positions[i]] = v[i] * mix + ((i & 1) ? -in : in);
+            if (++m_positions[i] == m_lines[i].size()) {
+                m_positions[i] = 0;
+            }
+        }
+    }
+    m_wet = m_params.wet;
+}
+
+} // namespace FinalStorm
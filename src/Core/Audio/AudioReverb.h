@@ -0,0 +1,52 @@
+// src/Core/Audio/AudioReverb.h
+// Shared room reverb: voices feed one mono send bus, and a single feedback
+// delay network turns it into a stereo return, whatever the voice count
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FinalStorm {
+
+struct ReverbParams {
+    float decaySeconds = 1.6f;      // Time for the tail to fall 60 dB at low frequencies
+    float damping = 0.4f;           // 0 bright; toward 1, highs die away faster
+    float wet = 0.25f;              // Return level
+
+    bool operator==(const ReverbParams& other) const {
+        return decaySeconds == other.decaySeconds && damping == other.damping && wet == other.wet;
+    }
+    bool operator!=(const ReverbParams& other) const { return !(*this == other); }
+};
+
+class AudioReverb {
+public:
+    static constexpr size_t LineCount = 8;
+
+    explicit AudioReverb(uint32_t sampleRate);
+
+    AudioReverb(const AudioReverb&) = delete;
+    AudioReverb& operator=(const AudioReverb&) = delete;
+
+    // Audio thread. Feedback follows at once; the return level ramps over
+    // the next process() call.
+    void setParams(const ReverbParams& params);
+    const ReverbParams& getParams() const { return m_params; }
+
+    // stereo (interleaved) += the reverb of frames of mono send
+    void process(const float* send, float* stereo, size_t frames);
+
+private:
+    uint32_t m_sampleRate;
+    ReverbParams m_params;
+    float m_wet;                            // Return level reached by the last block
+
+    std::vector<float> m_lines[LineCount];
+    size_t m_positions[LineCount];
+    float m_feedback[LineCount];            // Per-pass gain giving decaySeconds for each length
+    float m_lowpass[LineCount];             // Damping filter state
+    float m_normalize;                      // Keeps the return near the send's level
+};
+
+} // namespace FinalStorm
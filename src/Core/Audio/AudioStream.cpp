@@ -0,0 +1,175 @@
+// src/Core/Audio/AudioStream.cpp
+// Chunked disk streaming implementation
+
+#include "Core/Audio/AudioStream.h"
+#include <algorithm>
+#include <chrono>
+
+namespace FinalStorm {
+
+namespace {
+
+// How often the streamer looks for drained chunks. A chunk lasts about
+// 170 ms at 48 kHz, so this leaves plenty of slack.
+constexpr auto PollInterval = std::chrono::milliseconds(10);
+
+} // namespace
+
+AudioStream::AudioStream(const std::string& path, uint32_t channels, uint32_t sampleRate, bool looping, uint64_t startFrame)
+    : m_path(path)
+    , m_channels(channels == 0 ? 1 : channels)
+    , m_sampleRate(sampleRate)
+    , m_looping(looping)
+    , m_startFrame(startFrame)
+    , m_readIndex(0)
+    , m_writeIndex(0)
+    , m_opened(false)
+    , m_decodeFinished(false)
+    , m_underruns(0) {
+    for (Chunk& chunk : m_chunks) {
+        chunk.samples.resize((ChunkFrames + 1) * m_channels);
+    }
+}
+
+const AudioStream::Chunk* AudioStream::front() const {
+    const Chunk& chunk = m_chunks[m_readIndex];
+    return chunk.ready.load(std::memory_order_acquire) ? &chunk : nullptr;
+}
+
+void AudioStream::releaseFront() {
+    m_chunks[m_readIndex].ready.store(false, std::memory_order_release);
+    m_readIndex ^= 1;
+}
+
+size_t AudioStream::readWrapped(float* out, size_t frames) {
+    size_t done = 0;
+    while (done < frames) {
+        size_t got = m_reader.read(out + done * m_channels, frames - done);
+        done += got;
+        if (done == frames) break;
+
+        // End of file: a looping stream carries on from the start
+        if (!m_looping || m_reader.getFrameCount() == 0 || !m_reader.seek(0)) break;
+    }
+    return done;
+}
+
+bool AudioStream::fillNext() {
+    if (m_decodeFinished) return false;
+
+    Chunk& chunk = m_chunks[m_writeIndex];
+    if (chunk.ready.load(std::memory_order_acquire)) return false;      // Both chunks full
+
+    if (!m_opened) {
+        m_opened = true;
+        m_carry.assign(m_channels, 0.0f);
+        if (!m_reader.open(m_path) || m_reader.getChannels() != m_channels) {
+            m_reader.close();
+        } else {
+            uint64_t frameCount = std::max<uint64_t>(1, m_reader.getFrameCount());
+            m_reader.seek(m_looping ? m_startFrame % frameCount : m_startFrame);
+            if (readWrapped(m_carry.data(), 1) == 0) m_reader.close();
+        }
+        if (!m_reader.isOpen()) {
+            // Missing or changed file: end at once
+            chunk.frames = 0;
+            chunk.endOfStream = true;
+            std::fill(chunk.samples.begin(), chunk.samples.end(), 0.0f);
+            m_decodeFinished = true;
+            chunk.ready.store(true, std::memory_order_release);
+            return true;
+        }
+    }
+
+    // The carried frame starts this chunk; the decode runs one frame past it
+    std::copy(m_carry.begin(), m_carry.end(), chunk.samples.begin());
+    size_t decoded = 1 + readWrapped(chunk.samples.data() + m_channels, ChunkFrames);
+
+    if (decoded == ChunkFrames + 1) {
+        chunk.frames = ChunkFrames;
+        chunk.endOfStream = false;
+        std::copy(chunk.samples.end() - m_channels, chunk.samples.end(), m_carry.begin());
+    } else {
+        // Short read: the file is done; a silent frame closes the chunk
+        chunk.frames = decoded;
+        chunk.endOfStream = true;
+        std::fill(chunk.samples.begin() + decoded * m_channels, chunk.samples.end(), 0.0f);
+        m_decodeFinished = true;
+        m_reader.close();
+    }
+
+    chunk.ready.store(true, std::memory_order_release);
+    m_writeIndex ^= 1;
+    return true;
+}
+
+AudioStreamer::AudioStreamer(bool threaded)
+    : m_stopping(false) {
+    if (threaded) {
+        m_thread = std::thread(&AudioStreamer::threadMain, this);
+    }
+}
+
+AudioStreamer::~AudioStreamer() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_one();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void AudioStreamer::add(std::shared_ptr<AudioStream> stream) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_streams.push_back(std::move(stream));
+    }
+    m_wake.notify_one();
+}
+
+size_t AudioStreamer::getStreamCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_streams.size();
+}
+
+void AudioStreamer::collect(std::vector<std::shared_ptr<AudioStream>>& streams) {
+    // Drop streams that are fully decoded or that nobody plays any more
+    m_streams.erase(std::remove_if(m_streams.begin(), m_streams.end(),
+        [](const std::shared_ptr<AudioStream>& stream) {
+            return stream->isDecodeFinished() || stream.use_count() == 1;
+        }), m_streams.end());
+    streams = m_streams;
+}
+
+void AudioStreamer::pump() {
+    std::vector<std::shared_ptr<AudioStream>> streams;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        collect(streams);
+    }
+    for (auto& stream : streams) {
+        while (stream->fillNext()) {}
+    }
+}
+
+void AudioStreamer::threadMain() {
+    std::vector<std::shared_ptr<AudioStream>> streams;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopping) {
+        collect(streams);
+
+        // Decode without the lock so add() never waits on the disk
+        lock.unlock();
+        for (auto& stream : streams) {
+            while (stream->fillNext()) {}
+        }
+        streams.clear();
+        lock.lock();
+
+        m_wake.wait_for(lock, PollInterval);
+    }
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,98 @@
+// src/Core/Audio/AudioStream.h
+// Disk streaming for long clips: each playing stream double-buffers decoded
+// chunks, refilled by one AudioStreamer thread so the mixer never touches the disk
+
+#pragma once
+
+#include "Core/Audio/WavReader.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace FinalStorm {
+
+class AudioStream {
+public:
+    static constexpr size_t ChunkFrames = 8192;
+
+    // frames decoded frames, plus one more: the first frame of the next chunk
+    // (or silence at the end), so the resampler can interpolate past the last
+    struct Chunk {
+        std::vector<float> samples;
+        size_t frames = 0;
+        bool endOfStream = false;
+        std::atomic<bool> ready{ false };
+    };
+
+    AudioStream(const std::string& path, uint32_t channels, uint32_t sampleRate, bool looping, uint64_t startFrame);
+
+    // Mixer side. Null until the next chunk has been decoded.
+    const Chunk* front() const;
+    void releaseFront();
+    void countUnderrun() { m_underruns.fetch_add(1, std::memory_order_relaxed); }
+
+    uint32_t getChannels() const { return m_channels; }
+    uint32_t getSampleRate() const { return m_sampleRate; }
+    uint32_t getUnderrunCount() const { return m_underruns.load(std::memory_order_relaxed); }
+
+    // Streamer side: decodes into the next free chunk; false if there was none
+    bool fillNext();
+    bool isDecodeFinished() const { return m_decodeFinished; }
+
+private:
+    size_t readWrapped(float* out, size_t frames);
+
+    std::string m_path;
+    uint32_t m_channels;
+    uint32_t m_sampleRate;
+    bool m_looping;
+    uint64_t m_startFrame;
+
+    Chunk m_chunks[2];
+    size_t m_readIndex;         // Mixer only
+    size_t m_writeIndex;        // Streamer only
+
+    // Streamer only
+    WavReader m_reader;
+    std::vector<float> m_carry;     // Decoded ahead: the next chunk's first frame
+    bool m_opened;
+    bool m_decodeFinished;
+
+    std::atomic<uint32_t> m_underruns;
+};
+
+// Background thread that keeps every registered stream's chunks full
+class AudioStreamer {
+public:
+    // Without a thread the owner calls pump() itself, as offline renders do
+    explicit AudioStreamer(bool threaded = true);
+    ~AudioStreamer();
+
+    AudioStreamer(const AudioStreamer&) = delete;
+    AudioStreamer& operator=(const AudioStreamer&) = delete;
+
+    // The streamer keeps the stream until it is decoded to the end or nobody
+    // else holds it
+    void add(std::shared_ptr<AudioStream> stream);
+
+    // One pass: drops finished streams and fills every free chunk
+    void pump();
+
+    size_t getStreamCount() const;
+
+private:
+    void threadMain();
+    void collect(std::vector<std::shared_ptr<AudioStream>>& streams);
+
+    std::vector<std::shared_ptr<AudioStream>> m_streams;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wake;
+    bool m_stopping;
+    std::thread m_thread;
+};
+
+} // namespace FinalStorm
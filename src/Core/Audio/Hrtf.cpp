@@ -0,0 +1,376 @@
+// src/Core/Audio/Hrtf.cpp
+// HRIR sets, the spherical-head model and partitioned convolution
+
+#include "Core/Audio/Hrtf.h"
+#include "Core/Audio/AudioKernels.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+
+namespace FinalStorm {
+
+namespace {
+
+constexpr double Pi = 3.14159265358979323846;
+
+// Direction changes smaller than this (radians, about half a degree) keep the
+// current filter
+constexpr float DirectionTolerance = 0.01f;
+
+// Spherical-head model (Brown and Duda, 1998)
+constexpr double HeadRadius = 0.0875;           // Meters
+constexpr double SpeedOfSound = 343.0;          // Meters per second
+constexpr double EarAngle = 100.0 * Pi / 180.0; // Ears sit a little behind the interaural axis
+constexpr double ShadowMinimum = 0.1;           // Head-shadow zero at its deepest
+constexpr double ShadowAngle = 150.0 * Pi / 180.0;
+constexpr double OnsetSamples = 16.0;           // Room before the earliest arrival for delay ringing
+constexpr size_t ModelLength = 256;
+constexpr size_t ModelFadeTaps = 32;
+constexpr size_t DesignSize = 1024;
+
+// Pinna echoes: gain, and delay A cos(azimuth / 2) sin(D (90 deg - elevation)) + B
+// in samples at 44.1 kHz
+struct PinnaEcho {
+    double gain;
+    double a;
+    double b;
+    double d;
+};
+constexpr PinnaEcho PinnaEchoes[] = {
+    { 0.5, 1.0, 2.0, 1.0 },
+    { -1.0, 5.0, 4.0, 0.5 },
+    { 0.5, 5.0, 7.0, 0.5 },
+    { -0.25, 5.0, 11.0, 0.5 },
+    { 0.25, 5.0, 13.0, 0.5 },
+};
+
+// Bit-reversal order and per-stage twiddles for AudioKernels::fft
+void buildFftTables(size_t n, std::vector<uint32_t>& bitReverse,
+                    std::vector<float>& twiddleRe, std::vector<float>& twiddleIm) {
+    uint32_t bits = 0;
+    while ((size_t(1) << bits) < n) bits++;
+    bitReverse.resize(n);
+    for (uint32_t i = 0; i < n; ++i) {
+        uint32_t reversed = 0;
+        for (uint32_t b = 0; b < bits; ++b) {
+            reversed |= ((i >> b) & 1u) << (bits - 1 - b);
+        }
+        bitReverse[i] = reversed;
+    }
+
+    twiddleRe.resize(n - 1);
+    twiddleIm.resize(n - 1);
+    for (size_t half = 1; half < n; half <<= 1) {
+        for (size_t j = 0; j < half; ++j) {
+            twiddleRe[half - 1 + j] = static_cast<float>(std::cos(Pi * j / half));
+            twiddleIm[half - 1 + j] = static_cast<float>(-std::sin(Pi * j / half));
+        }
+    }
+}
+
+float wrapAngle(float angle) {
+    return static_cast<float>(std::remainder(angle, 2.0 * Pi));
+}
+
+// One ear's response to a plane wave from direction, as a spectrum
+std::complex<double> modelEar(double omega, double sampleRate, double azimuth, double elevation, double side) {
+    double x = std::sin(azimuth) * std::cos(elevation);
+    double y = std::cos(azimuth) * std::cos(elevation);
+    double incidence = std::acos(std::max(-1.0, std::min(1.0, side * x * std::sin(EarAngle) + y * std::cos(EarAngle))));
+
+    // Head shadow: a one-pole, one-zero filter whose zero moves with incidence
+    const double corner = 2.0 * SpeedOfSound / HeadRadius;
+    double alpha = (1.0 + ShadowMinimum / 2.0) + (1.0 - ShadowMinimum / 2.0) * std::cos(incidence / ShadowAngle * Pi);
+    std::complex<double> shadow = std::complex<double>(1.0, alpha * omega / corner) /
+                                  std::complex<double>(1.0, omega / corner);
+
+    // Path around the head (Woodworth), never negative
+    double delay = incidence < Pi / 2.0 ? HeadRadius / SpeedOfSound * (1.0 - std::cos(incidence))
+                                        : HeadRadius / SpeedOfSound * (1.0 + incidence - Pi / 2.0);
+    delay += OnsetSamples / sampleRate;
+
+    // The left ear sees the mirror image
+    double earAzimuth = side * azimuth;
+    std::complex<double> pinna(1.0, 0.0);
+    for (const PinnaEcho& echo : PinnaEchoes) {
+        double samples = echo.a * std::cos(earAzimuth / 2.0) * std::sin(echo.d * (Pi / 2.0 - elevation)) + echo.b;
+        pinna += echo.gain * std::polar(1.0, -omega * samples / 44100.0);
+    }
+
+    return shadow * pinna * std::polar(1.0, -omega * delay);
+}
+
+} // namespace
+
+HrtfSet::HrtfSet(uint32_t sampleRate, size_t length, uint32_t azimuthCount,
+                 uint32_t elevationCount, float minElevation, float maxElevation)
+    : m_sampleRate(sampleRate)
+    , m_partitions(std::max<size_t>(1, (std::min(length, MaxLength) + PartitionSize - 1) / PartitionSize))
+    , m_azimuthCount(std::max<uint32_t>(1, azimuthCount))
+    , m_elevationCount(std::max<uint32_t>(1, elevationCount))
+    , m_minElevation(minElevation)
+    , m_maxElevation(std::max(minElevation, maxElevation)) {
+    size_t size = static_cast<size_t>(m_azimuthCount) * m_elevationCount * m_partitions * FftSize;
+    m_spectraRe.assign(size, 0.0f);
+    m_spectraIm.assign(size, 0.0f);
+    buildFftTables(FftSize, m_bitReverse, m_twiddleRe, m_twiddleIm);
+}
+
+void HrtfSet::setResponse(uint32_t azimuth, uint32_t elevation, const float* left, const float* right, size_t taps) {
+    if (azimuth >= m_azimuthCount || elevation >= m_elevationCount) return;
+
+    taps = std::min(taps, getLength());
+    float re[FftSize];
+    float im[FftSize];
+    size_t offset = spectrumOffset(azimuth, elevation);
+    for (size_t p = 0; p < m_partitions; ++p) {
+        // Each partition zero-padded to a full transform, left + i right
+        for (size_t n = 0; n < FftSize; ++n) {
+            size_t tap = p * PartitionSize + n;
+            bool inside = n < PartitionSize && tap < taps;
+            re[m_bitReverse[n]] = inside ? left[tap] : 0.0f;
+            im[m_bitReverse[n]] = inside ? right[tap] : 0.0f;
+        }
+        AudioKernels::fft(re, im, FftSize, m_twiddleRe.data(), m_twiddleIm.data());
+        std::copy(re, re + FftSize, m_spectraRe.begin() + offset + p * FftSize);
+        std::copy(im, im + FftSize, m_spectraIm.begin() + offset + p * FftSize);
+    }
+}
+
+std::shared_ptr<HrtfSet> HrtfSet::createSphericalHead(uint32_t sampleRate) {
+    constexpr uint32_t AzimuthCount = 24;          // Every 15 degrees
+    constexpr uint32_t ElevationCount = 14;        // -40 to 90 degrees, every 10
+    const float minElevation = static_cast<float>(-40.0 * Pi / 180.0);
+    const float maxElevation = static_cast<float>(Pi / 2.0);
+    auto set = std::make_shared<HrtfSet>(sampleRate, ModelLength, AzimuthCount, ElevationCount, minElevation, maxElevation);
+
+    std::vector<uint32_t> bitReverse;
+    std::vector<float> twiddleRe;
+    std::vector<float> twiddleIm;
+    buildFftTables(DesignSize, bitReverse, twiddleRe, twiddleIm);
+
+    // Both ears in one inverse transform: their spectra are Hermitian, so
+    // left + i right comes back as left and right in the real and imaginary parts
+    std::vector<float> responses(static_cast<size_t>(AzimuthCount) * ElevationCount * 2 * ModelLength);
+    std::vector<float> re(DesignSize);
+    std::vector<float> im(DesignSize);
+    for (uint32_t e = 0; e < ElevationCount; ++e) {
+        double elevation = minElevation + (maxElevation - minElevation) * e / (ElevationCount - 1);
+        for (uint32_t a = 0; a < AzimuthCount; ++a) {
+            double azimuth = 2.0 * Pi * a / AzimuthCount;
+            for (size_t k = 0; k <= DesignSize / 2; ++k) {
+                double omega = 2.0 * Pi * sampleRate * k / DesignSize;
+                std::complex<double> left = modelEar(omega, sampleRate, azimuth, elevation, -1.0);
+                std::complex<double> right = modelEar(omega, sampleRate, azimuth, elevation, 1.0);
+                if (k == 0 || k == DesignSize / 2) {
+                    left = left.real();
+                    right = right.real();
+                }
+
+                // Inverse by forward transform of the conjugate
+                std::complex<double> packed = left + std::complex<double>(0.0, 1.0) * right;
+                re[bitReverse[k]] = static_cast<float>(packed.real());
+                im[bitReverse[k]] = static_cast<float>(-packed.imag());
+                if (k != 0 && k != DesignSize / 2) {
+                    std::complex<double> mirrored = std::conj(left) + std::complex<double>(0.0, 1.0) * std::conj(right);
+                    re[bitReverse[DesignSize - k]] = static_cast<float>(mirrored.real());
+                    im[bitReverse[DesignSize - k]] = static_cast<float>(-mirrored.imag());
+                }
+            }
+            AudioKernels::fft(re.data(), im.data(), DesignSize, twiddleRe.data(), twiddleIm.data());
+
+            float* out = responses.data() + (static_cast<size_t>(e) * AzimuthCount + a) * 2 * ModelLength;
+            for (size_t n = 0; n < ModelLength; ++n) {
+                float fade = n < ModelLength - ModelFadeTaps ? 1.0f :
+                    static_cast<float>(0.5 + 0.5 * std::cos(Pi * (n - (ModelLength - ModelFadeTaps)) / ModelFadeTaps));
+                out[n] = fade * re[n] / DesignSize;
+                out[ModelLength + n] = fade * -im[n] / DesignSize;
+            }
+        }
+    }
+
+    // Straight ahead gets the energy a centre-panned source has in each ear
+    const uint32_t level = static_cast<uint32_t>(std::lround(-minElevation / (maxElevation - minElevation) * (ElevationCount - 1)));
+    const float* front = responses.data() + static_cast<size_t>(level) * AzimuthCount * 2 * ModelLength;
+    double energy = 0.0;
+    for (size_t n = 0; n < 2 * ModelLength; ++n) {
+        energy += static_cast<double>(front[n]) * front[n];
+    }
+    const float scale = static_cast<float>(std::sqrt(1.0 / std::max(energy, 1e-12)));
+    for (float& sample : responses) {
+        sample *= scale;
+    }
+
+    for (uint32_t e = 0; e < ElevationCount; ++e) {
+        for (uint32_t a = 0; a < AzimuthCount; ++a) {
+            const float* pair = responses.data() + (static_cast<size_t>(e) * AzimuthCount + a) * 2 * ModelLength;
+            set->setResponse(a, e, pair, pair + ModelLength, ModelLength);
+        }
+    }
+    return set;
+}
+
+void HrtfSet::interpolate(float azimuth, float elevation, float* re, float* im) const {
+    double turns = azimuth / (2.0 * Pi);
+    turns -= std::floor(turns);
+    float a = static_cast<float>(turns * m_azimuthCount);
+    uint32_t a0 = std::min(static_cast<uint32_t>(a), m_azimuthCount - 1);
+    uint32_t a1 = (a0 + 1) % m_azimuthCount;
+    float ta = a - a0;
+
+    float e = 0.0f;
+    if (m_elevationCount > 1 && m_maxElevation > m_minElevation) {
+        float clamped = std::max(m_minElevation, std::min(m_maxElevation, elevation));
+        e = (clamped - m_minElevation) / (m_maxElevation - m_minElevation) * (m_elevationCount - 1);
+    }
+    uint32_t e0 = std::min(static_cast<uint32_t>(e), m_elevationCount - 1);
+    uint32_t e1 = std::min(e0 + 1, m_elevationCount - 1);
+    float te = e - e0;
+
+    const float w00 = (1.0f - ta) * (1.0f - te);
+    const float w10 = ta * (1.0f - te);
+    const float w01 = (1.0f - ta) * te;
+    const float w11 = ta * te;
+    const size_t size = m_partitions * FftSize;
+    const size_t o00 = spectrumOffset(a0, e0);
+    const size_t o10 = spectrumOffset(a1, e0);
+    const size_t o01 = spectrumOffset(a0, e1);
+    const size_t o11 = spectrumOffset(a1, e1);
+    for (size_t i = 0; i < size; ++i) {
+        re[i] = w00 * m_spectraRe[o00 + i] + w10 * m_spectraRe[o10 + i] + w01 * m_spectraRe[o01 + i] + w11 * m_spectraRe[o11 + i];
+        im[i] = w00 * m_spectraIm[o00 + i] + w10 * m_spectraIm[o10 + i] + w01 * m_spectraIm[o01 + i] + w11 * m_spectraIm[o11 + i];
+    }
+}
+
+HrtfConvolver::HrtfConvolver(std::shared_ptr<const HrtfSet> set)
+    : m_set(std::move(set))
+    , m_partitions(m_set->getPartitionCount())
+    , m_azimuth(0.0f)
+    , m_elevation(0.0f)
+    , m_targetAzimuth(0.0f)
+    , m_targetElevation(0.0f)
+    , m_input(HrtfSet::FftSize)
+    , m_fill(0)
+    , m_output(HrtfSet::PartitionSize * 2)
+    , m_historyRe(m_partitions * HrtfSet::FftSize)
+    , m_historyIm(m_partitions * HrtfSet::FftSize)
+    , m_newest(0)
+    , m_filterRe(m_partitions * HrtfSet::FftSize)
+    , m_filterIm(m_partitions * HrtfSet::FftSize)
+    , m_nextRe(m_partitions * HrtfSet::FftSize)
+    , m_nextIm(m_partitions * HrtfSet::FftSize)
+    , m_re(HrtfSet::FftSize)
+    , m_im(HrtfSet::FftSize)
+    , m_accRe(HrtfSet::FftSize)
+    , m_accIm(HrtfSet::FftSize)
+    , m_fadeRe(HrtfSet::PartitionSize)
+    , m_fadeIm(HrtfSet::PartitionSize) {
+    reset(0.0f, 0.0f);
+}
+
+void HrtfConvolver::reset(float azimuth, float elevation) {
+    std::fill(m_input.begin(), m_input.end(), 0.0f);
+    std::fill(m_output.begin(), m_output.end(), 0.0f);
+    std::fill(m_historyRe.begin(), m_historyRe.end(), 0.0f);
+    std::fill(m_historyIm.begin(), m_historyIm.end(), 0.0f);
+    m_fill = 0;
+    m_newest = 0;
+    m_azimuth = m_targetAzimuth = azimuth;
+    m_elevation = m_targetElevation = elevation;
+    m_set->interpolate(azimuth, elevation, m_filterRe.data(), m_filterIm.data());
+}
+
+void HrtfConvolver::setDirection(float azimuth, float elevation) {
+    m_targetAzimuth = azimuth;
+    m_targetElevation = elevation;
+}
+
+void HrtfConvolver::process(const float* in, float* stereo, size_t frames) {
+    constexpr size_t Hop = HrtfSet::PartitionSize;
+    size_t done = 0;
+    while (done < frames) {
+        size_t count = std::min(frames - done, Hop - m_fill);
+        std::copy(in + done, in + done + count, m_input.begin() + Hop + m_fill);
+        std::copy(m_output.begin() + m_fill * 2, m_output.begin() + (m_fill + count) * 2, stereo + done * 2);
+        m_fill += count;
+        done += count;
+        if (m_fill == Hop) {
+            processHop();
+            m_fill = 0;
+        }
+    }
+}
+
+void HrtfConvolver::processHop() {
+    constexpr size_t Hop = HrtfSet::PartitionSize;
+    constexpr size_t Size = HrtfSet::FftSize;
+    const uint32_t* bitReverse = m_set->getBitReverse();
+
+    // Overlap-save: the spectrum of the last two hops joins the delay line
+    m_newest = (m_newest + 1) % m_partitions;
+    float* newestRe = m_historyRe.data() + m_newest * Size;
+    float* newestIm = m_historyIm.data() + m_newest * Size;
+    for (size_t n = 0; n < Size; ++n) {
+        newestRe[bitReverse[n]] = m_input[n];
+        newestIm[bitReverse[n]] = 0.0f;
+    }
+    AudioKernels::fft(newestRe, newestIm, Size, m_set->getTwiddleRe(), m_set->getTwiddleIm());
+    std::copy(m_input.begin() + Hop, m_input.end(), m_input.begin());
+
+    bool moved = std::fabs(wrapAngle(m_targetAzimuth - m_azimuth)) > DirectionTolerance ||
+                 std::fabs(m_targetElevation - m_elevation) > DirectionTolerance;
+    if (!moved) {
+        convolve(m_filterRe.data(), m_filterIm.data(), m_re.data(), m_im.data());
+        for (size_t n = 0; n < Hop; ++n) {
+            m_output[n * 2] = m_re[Hop + n];
+            m_output[n * 2 + 1] = m_im[Hop + n];
+        }
+        return;
+    }
+
+    // New direction: render the hop through both filters and crossfade
+    convolve(m_filterRe.data(), m_filterIm.data(), m_re.data(), m_im.data());
+    std::copy(m_re.begin() + Hop, m_re.end(), m_fadeRe.begin());
+    std::copy(m_im.begin() + Hop, m_im.end(), m_fadeIm.begin());
+
+    m_set->interpolate(m_targetAzimuth, m_targetElevation, m_nextRe.data(), m_nextIm.data());
+    convolve(m_nextRe.data(), m_nextIm.data(), m_re.data(), m_im.data());
+    for (size_t n = 0; n < Hop; ++n) {
+        float t = static_cast<float>(n + 1) / Hop;
+        m_output[n * 2] = m_fadeRe[n] + (m_re[Hop + n] - m_fadeRe[n]) * t;
+        m_output[n * 2 + 1] = m_fadeIm[n] + (m_im[Hop + n] - m_fadeIm[n]) * t;
+    }
+    m_filterRe.swap(m_nextRe);
+    m_filterIm.swap(m_nextIm);
+    m_azimuth = m_targetAzimuth;
+    m_elevation = m_targetElevation;
+}
+
+void HrtfConvolver::convolve(const float* filterRe, const float* filterIm, float* outRe, float* outIm) {
+    constexpr size_t Size = HrtfSet::FftSize;
+    std::fill(m_accRe.begin(), m_accRe.end(), 0.0f);
+    std::fill(m_accIm.begin(), m_accIm.end(), 0.0f);
+    for (size_t p = 0; p < m_partitions; ++p) {
+        size_t slot = (m_newest + m_partitions - p) % m_partitions;
+        AudioKernels::multiplyAccumulate(m_accRe.data(), m_accIm.data(),
+                                         m_historyRe.data() + slot * Size, m_historyIm.data() + slot * Size,
+                                         filterRe + p * Size, filterIm + p * Size, Size);
+    }
+
+    // Inverse by forward transform of the conjugate; left lands in the real
+    // part and right in the imaginary part
+    const uint32_t* bitReverse = m_set->getBitReverse();
+    for (size_t k = 0; k < Size; ++k) {
+        outRe[bitReverse[k]] = m_accRe[k];
+        outIm[bitReverse[k]] = -m_accIm[k];
+    }
+    AudioKernels::fft(outRe, outIm, Size, m_set->getTwiddleRe(), m_set->getTwiddleIm());
+    // Only the second half is free of wrap-around, and only it is used
+    const float scale = 1.0f / Size;
+    for (size_t n = HrtfSet::PartitionSize; n < Size; ++n) {
+        outRe[n] *= scale;
+        outIm[n] *= -scale;
+    }
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,122 @@
+// src/Core/Audio/Hrtf.h
+// Binaural rendering: head-related impulse responses on a direction grid,
+// stored as partition spectra, and the per-voice uniformly partitioned
+// convolver that turns a mono voice into a stereo headphone signal
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace FinalStorm {
+
+// Directions are radians in the listener's frame: azimuth 0 straight ahead,
+// positive to the right; elevation 0 level, positive up
+class HrtfSet {
+public:
+    static constexpr size_t PartitionSize = 128;            // Frames per partition and per convolver hop
+    static constexpr size_t FftSize = PartitionSize * 2;
+    static constexpr size_t MaxLength = PartitionSize * 4;  // Longest response kept, in taps
+
+    // Empty (silent) set: azimuthCount directions around, elevationCount rows
+    // from minElevation to maxElevation, responses of length taps
+    HrtfSet(uint32_t sampleRate, size_t length, uint32_t azimuthCount,
+            uint32_t elevationCount, float minElevation, float maxElevation);
+
+    // Impulse responses for one grid point; shorter ones are zero-padded
+    void setResponse(uint32_t azimuth, uint32_t elevation, const float* left, const float* right, size_t taps);
+
+    // Rigid spherical head with pinna echoes (Brown and Duda): interaural
+    // delay, head shadow and elevation cues without measured data. Normalized
+    // so a source straight ahead plays at about its panned loudness.
+    static std::shared_ptr<HrtfSet> createSphericalHead(uint32_t sampleRate);
+
+    // Bilinear blend of the four grid points around a direction. re and im
+    // receive getPartitionCount() spectra of FftSize bins, left ear in the
+    // real part of the response and right ear in the imaginary part.
+    void interpolate(float azimuth, float elevation, float* re, float* im) const;
+
+    uint32_t getSampleRate() const { return m_sampleRate; }
+    size_t getPartitionCount() const { return m_partitions; }
+    size_t getLength() const { return m_partitions * PartitionSize; }
+
+    // FFT tables shared by every convolver using this set
+    const uint32_t* getBitReverse() const { return m_bitReverse.data(); }
+    const float* getTwiddleRe() const { return m_twiddleRe.data(); }
+    const float* getTwiddleIm() const { return m_twiddleIm.data(); }
+
+private:
+    size_t spectrumOffset(uint32_t azimuth, uint32_t elevation) const {
+        return (static_cast<size_t>(elevation) * m_azimuthCount + azimuth) * m_partitions * FftSize;
+    }
+
+    uint32_t m_sampleRate;
+    size_t m_partitions;
+    uint32_t m_azimuthCount;
+    uint32_t m_elevationCount;
+    float m_minElevation;
+    float m_maxElevation;
+
+    std::vector<float> m_spectraRe;     // Per grid point, per partition, FftSize bins
+    std::vector<float> m_spectraIm;
+    std::vector<uint32_t> m_bitReverse;
+    std::vector<float> m_twiddleRe;
+    std::vector<float> m_twiddleIm;
+};
+
+// One voice's convolution state. Both ears come out of a single complex
+// transform per hop: the input is real and each filter packs left + i right.
+// Output trails input by one partition.
+class HrtfConvolver {
+public:
+    explicit HrtfConvolver(std::shared_ptr<const HrtfSet> set);
+
+    // Forget all history, as for a freshly started voice
+    void reset(float azimuth, float elevation);
+
+    // The filter follows on the next hop, crossfading from the old one
+    void setDirection(float azimuth, float elevation);
+
+    // Mono in, stereo (interleaved) out; any frame count
+    void process(const float* in, float* stereo, size_t frames);
+
+    // Frames of output still to come once the input falls silent
+    size_t getTailFrames() const { return HrtfSet::PartitionSize + m_set->getLength(); }
+
+private:
+    void processHop();
+    void convolve(const float* filterRe, const float* filterIm, float* outRe, float* outIm);
+
+    std::shared_ptr<const HrtfSet> m_set;
+    size_t m_partitions;
+
+    float m_azimuth;                // Direction of the current filter
+    float m_elevation;
+    float m_targetAzimuth;
+    float m_targetElevation;
+
+    std::vector<float> m_input;     // Previous hop, then the hop being filled
+    size_t m_fill;
+    std::vector<float> m_output;    // Last hop's result, stereo, read while the next fills
+
+    // Frequency-domain delay line: the spectra of the last m_partitions hops
+    std::vector<float> m_historyRe;
+    std::vector<float> m_historyIm;
+    size_t m_newest;
+
+    std::vector<float> m_filterRe;  // Current filter, then the one it fades to
+    std::vector<float> m_filterIm;
+    std::vector<float> m_nextRe;
+    std::vector<float> m_nextIm;
+
+    // Transform scratch
+    std::vector<float> m_re;
+    std::vector<float> m_im;
+    std::vector<float> m_accRe;
+    std::vector<float> m_accIm;
+    std::vector<float> m_fadeRe;
+    std::vector<float> m_fadeIm;
+};
+
+} // namespace FinalStorm
@@ -0,0 +1,179 @@
+// src/Core/Audio/OscillatorBank.cpp
+// Additive synth voice implementation
+
+#include "Core/Audio/OscillatorBank.h"
+#include "Core/Audio/AudioKernels.h"
+#include <algorithm>
+#include <cmath>
+
+namespace FinalStorm {
+
+namespace {
+
+constexpr double Pi = 3.14159265358979323846;
+
+// Partials stop short of Nyquist, where they would alias
+constexpr double PartialLimit = 0.45;
+
+// Fourier series weight of harmonic k, scaled so the full series peaks near 1
+float seriesWeight(SynthWaveform waveform, uint32_t k) {
+    switch (waveform) {
+        case SynthWaveform::Sine:
+            return k == 1 ? 1.0f : 0.0f;
+        case SynthWaveform::Triangle:
+            if (k % 2 == 0) return 0.0f;
+            return static_cast<float>((((k - 1) / 2) % 2 ? -8.0 : 8.0) / (Pi * Pi * k * k));
+        case SynthWaveform::Square:
+            return k % 2 ? static_cast<float>(4.0 / (Pi * k)) : 0.0f;
+        case SynthWaveform::Saw:
+            return static_cast<float>(2.0 / (Pi * k));
+    }
+    return 0.0f;
+}
+
+size_t padded(size_t count) {
+    return (count + 3) & ~size_t(3);
+}
+
+} // namespace
+
+OscillatorBank::OscillatorBank(uint32_t sampleRate, uint32_t maxPartials)
+    : m_sampleRate(sampleRate == 0 ? 48000 : sampleRate)
+    , m_partialCount(0) {
+    size_t capacity = padded(std::max<uint32_t>(maxPartials, 4));
+    m_notes.reserve(capacity);
+    m_cos.assign(capacity, 0.0f);
+    m_sin.assign(capacity, 0.0f);
+    m_rotCos.assign(capacity, 0.0f);
+    m_rotSin.assign(capacity, 0.0f);
+    m_amplitude.assign(capacity, 0.0f);
+    m_gain.assign(capacity, 0.0f);
+    m_gainStep.assign(capacity, 0.0f);
+}
+
+bool OscillatorBank::noteOn(const SynthNote& desc) {
+    if (desc.frequency <= 0.0f) return false;
+
+    // Band limit: only harmonics below the partial limit are synthesized
+    const uint32_t limit = std::min<uint32_t>(std::max<uint8_t>(desc.harmonics, 1), MaxHarmonics);
+    const double nyquistHarmonic = PartialLimit * m_sampleRate / desc.frequency;
+    uint32_t count = 0;
+    for (uint32_t k = 1; k <= limit && k < nyquistHarmonic; ++k) {
+        if (seriesWeight(desc.waveform, k) != 0.0f) count++;
+    }
+    if (count == 0 || m_partialCount + count > m_cos.size() || m_notes.size() == m_notes.capacity()) return false;
+
+    Note note;
+    note.desc = desc;
+    note.firstPartial = static_cast<uint32_t>(m_partialCount);
+    note.partialCount = count;
+    note.age = static_cast<uint64_t>(std::max(0.0f, desc.age) * m_sampleRate);
+    note.releaseAt = desc.duration >= 0.0f ? static_cast<int64_t>(desc.duration * m_sampleRate) : -1;
+    note.level = 0.0f;      // Ramps up over the first block even when joining late
+
+    size_t p = m_partialCount;
+    for (uint32_t k = 1; k <= limit && k < nyquistHarmonic; ++k) {
+        float weight = seriesWeight(desc.waveform, k);
+        if (weight == 0.0f) continue;
+
+        double step = 2.0 * Pi * desc.frequency * k / m_sampleRate;
+        m_cos[p] = 1.0f;
+        m_sin[p] = 0.0f;
+        m_rotCos[p] = static_cast<float>(std::cos(step));
+        m_rotSin[p] = static_cast<float>(std::sin(step));
+        m_amplitude[p] = weight * desc.amplitude;
+        m_gain[p] = 0.0f;
+        m_gainStep[p] = 0.0f;
+        p++;
+    }
+    m_partialCount = p;
+    m_notes.push_back(note);
+    return true;
+}
+
+void OscillatorBank::noteOff(uint32_t id) {
+    for (Note& note : m_notes) {
+        if (note.desc.id == id && (note.releaseAt < 0 || note.releaseAt > static_cast<int64_t>(note.age))) {
+            note.releaseAt = static_cast<int64_t>(note.age);
+        }
+    }
+}
+
+float OscillatorBank::envelopeAt(const Note& note, uint64_t frame) const {
+    const SynthEnvelope& envelope = note.desc.envelope;
+    auto held = [&](double t) {
+        if (t < envelope.attack) return t / envelope.attack;
+        t -= envelope.attack;
+        if (t < envelope.decay) return 1.0 + (envelope.sustain - 1.0) * t / envelope.decay;
+        return static_cast<double>(envelope.sustain);
+    };
+
+    double t = static_cast<double>(frame) / m_sampleRate;
+    if (note.releaseAt < 0 || static_cast<int64_t>(frame) < note.releaseAt) {
+        return static_cast<float>(held(t));
+    }
+    double releaseStart = static_cast<double>(note.releaseAt) / m_sampleRate;
+    double since = t - releaseStart;
+    if (since >= envelope.release) return 0.0f;
+    return static_cast<float>(held(releaseStart) * (1.0 - since / envelope.release));
+}
+
+void OscillatorBank::render(float* out, size_t frames) {
+    std::fill(out, out + frames, 0.0f);
+    if (m_notes.empty() || frames == 0) return;
+
+    // Envelopes are evaluated once per block and ramped linearly across it
+    bool finished = false;
+    for (Note& note : m_notes) {
+        float end = envelopeAt(note, note.age + frames);
+        float step = (end - note.level) / frames;
+        for (uint32_t p = note.firstPartial; p < note.firstPartial + note.partialCount; ++p) {
+            m_gain[p] = m_amplitude[p] * note.level;
+            m_gainStep[p] = m_amplitude[p] * step;
+        }
+        note.level = end;
+        note.age += frames;
+        finished |= note.releaseAt >= 0 && end == 0.0f &&
+                    note.age >= static_cast<uint64_t>(note.releaseAt);
+    }
+    std::fill(m_gain.begin() + m_partialCount, m_gain.begin() + padded(m_partialCount), 0.0f);
+    std::fill(m_gainStep.begin() + m_partialCount, m_gainStep.begin() + padded(m_partialCount), 0.0f);
+
+    AudioKernels::renderOscillators(m_cos.data(), m_sin.data(), m_rotCos.data(), m_rotSin.data(),
+                                    m_gain.data(), m_gainStep.data(), padded(m_partialCount), out, frames);
+
+    if (finished) {
+        removeFinished();
+    }
+}
+
+void OscillatorBank::removeFinished() {
+    // Slides the surviving notes' partials down so they stay contiguous
+    size_t writeNote = 0;
+    size_t writePartial = 0;
+    for (size_t i = 0; i < m_notes.size(); ++i) {
+        Note note = m_notes[i];
+        bool done = note.releaseAt >= 0 && note.level == 0.0f &&
+                    note.age >= static_cast<uint64_t>(note.releaseAt);
+        if (done) continue;
+
+        if (note.firstPartial != writePartial) {
+            for (uint32_t k = 0; k < note.partialCount; ++k) {
+                size_t from = note.firstPartial + k;
+                size_t to = writePartial + k;
+                m_cos[to] = m_cos[from];
+                m_sin[to] = m_sin[from];
+                m_rotCos[to] = m_rotCos[from];
+                m_rotSin[to] = m_rotSin[from];
+                m_amplitude[to] = m_amplitude[from];
+            }
+            note.firstPartial = static_cast<uint32_t>(writePartial);
+        }
+        writePartial += note.partialCount;
+        m_notes[writeNote++] = note;
+    }
+    m_notes.resize(writeNote);
+    m_partialCount = writePartial;
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,82 @@
+// src/Core/Audio/OscillatorBank.h
+// Procedural synth voice: notes built from band-limited sine partials with
+// ADSR envelopes, rendered four partials at a time on the audio thread
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FinalStorm {
+
+enum class SynthWaveform : uint8_t {
+    Sine,
+    Triangle,   // Odd harmonics at 1/k^2: soft
+    Square,     // Odd harmonics at 1/k: hollow
+    Saw         // Every harmonic at 1/k: bright
+};
+
+// Times in seconds; sustain is a level in [0, 1]
+struct SynthEnvelope {
+    float attack = 0.02f;
+    float decay = 0.3f;
+    float sustain = 0.6f;
+    float release = 0.8f;
+};
+
+struct SynthNote {
+    uint32_t id = 0;
+    float frequency = 440.0f;
+    float amplitude = 0.25f;
+    SynthWaveform waveform = SynthWaveform::Sine;
+    uint8_t harmonics = 8;      // Partials at most; fewer near Nyquist
+    SynthEnvelope envelope;
+    float duration = -1.0f;     // Released after this long; < 0 holds until noteOff
+    float age = 0.0f;           // Starts this far into its envelope
+};
+
+class OscillatorBank {
+public:
+    static constexpr uint32_t MaxHarmonics = 32;
+
+    OscillatorBank(uint32_t sampleRate, uint32_t maxPartials);
+
+    // Audio thread only, like every call below. False when the partials do not
+    // fit; nothing allocates after construction.
+    bool noteOn(const SynthNote& note);
+    void noteOff(uint32_t id);
+
+    // Overwrites frames of mono output and retires notes whose release ended
+    void render(float* out, size_t frames);
+
+    size_t getNoteCount() const { return m_notes.size(); }
+    size_t getPartialCount() const { return m_partialCount; }
+
+private:
+    struct Note {
+        SynthNote desc;
+        uint32_t firstPartial;
+        uint32_t partialCount;
+        uint64_t age;               // Frames
+        int64_t releaseAt;          // Frame the release starts, or -1
+        float level;                // Envelope at age
+    };
+
+    float envelopeAt(const Note& note, uint64_t frame) const;
+    void removeFinished();
+
+    uint32_t m_sampleRate;
+    std::vector<Note> m_notes;
+    size_t m_partialCount;
+
+    // One entry per partial, padded to a multiple of four
+    std::vector<float> m_cos;
+    std::vector<float> m_sin;
+    std::vector<float> m_rotCos;
+    std::vector<float> m_rotSin;
+    std::vector<float> m_amplitude;     // Series weight times note amplitude
+    std::vector<float> m_gain;
+    std::vector<float> m_gainStep;
+};
+
+} // namespace FinalStorm
@@ -1,9 +1,40 @@
 #include "Core/Audio/SpatialAudioSystem.h"
+#include <algorithm>
 
 namespace FinalStorm {
 
+namespace {
+
+constexpr float AmbientPriority = 4.0f;
+
+// Small enough that nobody hears a source lag its node
+constexpr float DefaultMoveThreshold = 0.05f;
+
+// Registered services checked for a destroyed node each update
+constexpr size_t SweepPerUpdate = 8;
+
+// The room follows the environment: a harmonious world rings longer and
+// wetter, an energetic one brighter
+ReverbParams reverbFor(const EnvironmentState& state)
+{
+    float harmony = std::min(1.0f, std::max(0.0f, state.harmonyLevel));
+    float energy = std::min(1.0f, std::max(0.0f, state.energyLevel));
+    ReverbParams params;
+    params.decaySeconds = 1.2f + 2.3f * harmony;
+    params.damping = 0.7f - 0.45f * energy;
+    params.wet = 0.15f + 0.15f * harmony;
+    return params;
+}
+
+} // namespace
+
 SpatialAudioSystem::SpatialAudioSystem(std::shared_ptr<AudioEngine> engine)
     : m_audioEngine(std::move(engine))
+    , m_nextServiceId(1)
+    , m_sweepCursor(0)
+    , m_moveThreshold(DefaultMoveThreshold)
+    , m_listenerPosition{0.f, 0.f, 0.f}
+    , m_listenerKnown(false)
 {
     if (!m_audioEngine)
         return;
@@ -12,7 +43,10 @@ SpatialAudioSystem::SpatialAudioSystem(std::shared_ptr<AudioEngine> engine)
     // Create ambient looping source
     m_ambientSource = m_audioEngine->createSource();
     if (m_ambientSource) {
+        // The bed under everything: never the one virtualized for a service loop
         m_ambientSource->setLooping(true);
+        m_ambientSource->setSpatial(false);
+        m_ambientSource->setPriority(AmbientPriority);
         if (auto clip = m_audioEngine->getAudioClip("ambient")) {
             m_ambientSource->setClip(clip);
         }
@@ -20,20 +54,57 @@ SpatialAudioSystem::SpatialAudioSystem(std::shared_ptr<AudioEngine> engine)
     }
 }
 
+SpatialAudioSystem::~SpatialAudioSystem()
+{
+    // Listeners capture this system; live nodes must not call them later
+    while (!m_services.empty()) {
+        removeService(m_services.size() - 1);
+    }
+}
+
 void SpatialAudioSystem::registerService(const std::shared_ptr<ServiceNode>& service)
 {
     if (!service || !m_audioEngine)
         return;
 
+    for (const auto& entry : m_services) {
+        if (entry.node.lock() == service)
+            return;
+    }
+
     auto source = m_audioEngine->createSource();
-    if (source) {
-        source->setLooping(true);
-        if (auto clip = m_audioEngine->getAudioClip("service")) {
-            source->setClip(clip);
-        }
-        source->play();
-        m_serviceSources[service.get()] = source;
+    if (!source)
+        return;
+
+    source->setLooping(true);
+    if (auto clip = m_audioEngine->getAudioClip("service")) {
+        source->setClip(clip);
     }
+
+    ServiceEntry entry;
+    entry.id = m_nextServiceId++;
+    entry.node = service;
+    entry.source = source;
+    entry.position = service->getWorldPosition();
+    entry.audible = isAudible(entry, entry.position);
+    source->setPosition(entry.position);
+    source->play();
+
+    // Reading the position above cleaned the world matrix, so the next move notifies
+    uint32_t id = entry.id;
+    entry.listenerId = service->addTransformListener([this, id](SceneNode&) {
+        auto it = m_serviceIndex.find(id);
+        if (it == m_serviceIndex.end())
+            return;
+        ServiceEntry& moved = m_services[it->second];
+        if (!moved.moved) {
+            moved.moved = true;
+            m_movedServices.push_back(id);
+        }
+    });
+
+    m_serviceIndex[entry.id] = m_services.size();
+    m_services.push_back(std::move(entry));
 }
 
 void SpatialAudioSystem::unregisterService(const std::shared_ptr<ServiceNode>& service)
@@ -41,10 +112,49 @@ void SpatialAudioSystem::unregisterService(const std::shared_ptr<ServiceNode>& s
     if (!service || !m_audioEngine)
         return;
 
-    auto it = m_serviceSources.find(service.get());
-    if (it != m_serviceSources.end()) {
-        m_audioEngine->removeSource(it->second);
-        m_serviceSources.erase(it);
+    for (size_t i = 0; i < m_services.size(); ++i) {
+        if (m_services[i].node.lock() == service) {
+            removeService(i);
+            return;
+        }
+    }
+}
+
+void SpatialAudioSystem::removeService(size_t index)
+{
+    ServiceEntry& entry = m_services[index];
+    if (auto node = entry.node.lock()) {
+        node->removeTransformListener(entry.listenerId);
+    }
+    if (m_audioEngine) {
+        m_audioEngine->removeSource(entry.source);
+    }
+    m_serviceIndex.erase(entry.id);
+
+    // Swap with the last entry; queued ids for the removed one find nothing
+    if (index + 1 != m_services.size()) {
+        entry = std::move(m_services.back());
+        m_serviceIndex[entry.id] = index;
+    }
+    m_services.pop_back();
+}
+
+bool SpatialAudioSystem::isAudible(const ServiceEntry& entry, const float3& position) const
+{
+    if (!entry.source->isSpatial())
+        return true;
+    return length(position - m_listenerPosition) <= entry.source->getMaxDistance();
+}
+
+void SpatialAudioSystem::refreshService(ServiceEntry& entry)
+{
+    // The source keeps the last position sent, so moves add up until one is
+    // big enough to send; crossing the audible range always sends
+    bool audible = isAudible(entry, entry.position);
+    if (audible != entry.audible ||
+        length(entry.position - entry.source->getPosition()) > m_moveThreshold) {
+        entry.source->setPosition(entry.position);
+        entry.audible = audible;
     }
 }
 
@@ -60,17 +170,48 @@ void SpatialAudioSystem::update(float deltaTime,
     m_audioEngine->setListenerPosition(listenerPos);
     m_audioEngine->setListenerOrientation(listenerForward, float3{0.f, 1.f, 0.f});
 
-    // Update service source positions
-    for (auto it = m_serviceSources.begin(); it != m_serviceSources.end(); ) {
-        ServiceNode* node = it->first;
-        auto& source = it->second;
+    // A listener that moved far enough can bring still sources in or out of range
+    if (!m_listenerKnown || length(listenerPos - m_listenerPosition) > m_moveThreshold) {
+        m_listenerPosition = listenerPos;
+        m_listenerKnown = true;
+        for (auto& entry : m_services) {
+            refreshService(entry);
+        }
+    }
+
+    // Only services whose nodes reported a transform change read a world position
+    for (uint32_t id : m_movedServices) {
+        auto it = m_serviceIndex.find(id);
+        if (it == m_serviceIndex.end())
+            continue;
+
+        ServiceEntry& entry = m_services[it->second];
+        entry.moved = false;
+        auto node = entry.node.lock();
         if (!node) {
-            it = m_serviceSources.erase(it);
+            removeService(it->second);
             continue;
         }
-        source->setPosition(node->getWorldPosition());
-        ++it;
+        entry.position = node->getWorldPosition();
+        refreshService(entry);
     }
+    m_movedServices.clear();
+
+    // Destroyed nodes take their listeners with them, so a few entries are
+    // checked each update to release their sources
+    for (size_t checked = 0; checked < SweepPerUpdate && !m_services.empty(); ++checked) {
+        if (m_sweepCursor >= m_services.size()) {
+            m_sweepCursor = 0;
+        }
+        if (m_services[m_sweepCursor].node.expired()) {
+            removeService(m_sweepCursor);
+        } else {
+            m_sweepCursor++;
+        }
+    }
+
+    // Only sent on when it changes
+    m_audioEngine->setReverb(reverbFor(env.getState()));
 
     // Ambient volume reacts to environment state
     if (m_ambientSource) {
@@ -5,18 +5,32 @@
 #include "Environment/EnvironmentController.h"
 #include <unordered_map>
 #include <memory>
+#include <vector>
 
 namespace FinalStorm {
 
 // Simple manager that provides positional audio for services and ambient state.
+// Service positions are pushed only when a node reports a transform change, so
+// static services cost nothing per frame.
 class SpatialAudioSystem {
 public:
     explicit SpatialAudioSystem(std::shared_ptr<AudioEngine> engine);
+    ~SpatialAudioSystem();
 
-    // Register/unregister a service node to emit positional sound
+    SpatialAudioSystem(const SpatialAudioSystem&) = delete;
+    SpatialAudioSystem& operator=(const SpatialAudioSystem&) = delete;
+
+    // Register/unregister a service node to emit positional sound. The system
+    // holds the node weakly; destroyed nodes lose their source on their own.
     void registerService(const std::shared_ptr<ServiceNode>& service);
     void unregisterService(const std::shared_ptr<ServiceNode>& service);
 
+    // Moves shorter than this (world units) are not sent to the source
+    void setMoveThreshold(float threshold) { m_moveThreshold = threshold; }
+    float getMoveThreshold() const { return m_moveThreshold; }
+
+    size_t getServiceCount() const { return m_services.size(); }
+
     // Update all audio sources and listener
     void update(float deltaTime,
                 const EnvironmentController& env,
@@ -24,8 +38,29 @@ public:
                 const float3& listenerForward);
 
 private:
+    struct ServiceEntry {
+        uint32_t id = 0;
+        std::weak_ptr<ServiceNode> node;
+        std::shared_ptr<AudioSource> source;
+        uint32_t listenerId = 0;
+        float3 position;            // Last world position read from the node
+        bool moved = false;         // Queued in m_movedServices
+        bool audible = false;       // Within the source's max distance when last checked
+    };
+
+    void refreshService(ServiceEntry& entry);
+    bool isAudible(const ServiceEntry& entry, const float3& position) const;
+    void removeService(size_t index);
+
     std::shared_ptr<AudioEngine> m_audioEngine;
-    std::unordered_map<ServiceNode*, std::shared_ptr<AudioSource>> m_serviceSources;
+    std::vector<ServiceEntry> m_services;
+    std::unordered_map<uint32_t, size_t> m_serviceIndex;   // Entry id to m_services slot
+    std::vector<uint32_t> m_movedServices;                  // Filled by transform listeners
+    uint32_t m_nextServiceId;
+    size_t m_sweepCursor;           // Next entry checked for a destroyed node
+    float m_moveThreshold;
+    float3 m_listenerPosition;      // As of the last audibility pass
+    bool m_listenerKnown;
     std::shared_ptr<AudioSource> m_ambientSource;
 };
 
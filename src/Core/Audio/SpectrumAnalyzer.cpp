@@ -0,0 +1,178 @@
+// src/Core/Audio/SpectrumAnalyzer.cpp
+// Master-mix spectrum analysis implementation
+
+#include "Core/Audio/SpectrumAnalyzer.h"
+#include "Core/Audio/AudioKernels.h"
+#include <algorithm>
+#include <cmath>
+
+namespace FinalStorm {
+
+namespace {
+
+constexpr double Pi = 3.14159265358979323846;
+constexpr float LowestHz = 40.0f;
+constexpr float HighestHz = 16000.0f;
+
+// Visual scale: -60 dBFS maps to 0, 0 dBFS to 1
+constexpr float FloorDb = -60.0f;
+
+// Levels fall by about two thirds in this long; they rise immediately
+constexpr float ReleaseSeconds = 0.25f;
+
+float toUnit(double meanSquare) {
+    // A full-scale sine has mean square 1/2: that is 0 dBFS
+    double db = 10.0 * std::log10(std::max(meanSquare * 2.0, 1e-12));
+    return std::min(1.0f, std::max(0.0f, static_cast<float>((db - FloorDb) / -FloorDb)));
+}
+
+} // namespace
+
+SpectrumAnalyzer::SpectrumAnalyzer(uint32_t sampleRate)
+    : m_sampleRate(sampleRate == 0 ? 48000 : sampleRate)
+    , m_history(FftSize, 0.0f)
+    , m_writeIndex(0)
+    , m_sinceAnalysis(0)
+    , m_window(FftSize)
+    , m_bitReverse(FftSize)
+    , m_twiddleRe(FftSize - 1)
+    , m_twiddleIm(FftSize - 1)
+    , m_re(FftSize)
+    , m_im(FftSize)
+    , m_sequence(0)
+    , m_publishedLevel(0.0f)
+    , m_publishedFrame(0) {
+    m_release = static_cast<float>(std::exp(-static_cast<double>(HopSize) / (m_sampleRate * ReleaseSeconds)));
+
+    for (size_t i = 0; i < FftSize; ++i) {
+        m_window[i] = static_cast<float>(0.5 - 0.5 * std::cos(2.0 * Pi * i / FftSize));
+    }
+
+    uint32_t bits = 0;
+    while ((size_t(1) << bits) < FftSize) bits++;
+    for (uint32_t i = 0; i < FftSize; ++i) {
+        uint32_t reversed = 0;
+        for (uint32_t b = 0; b < bits; ++b) {
+            reversed |= ((i >> b) & 1u) << (bits - 1 - b);
+        }
+        m_bitReverse[i] = reversed;
+    }
+
+    for (size_t half = 1; half < FftSize; half <<= 1) {
+        for (size_t j = 0; j < half; ++j) {
+            m_twiddleRe[half - 1 + j] = static_cast<float>(std::cos(Pi * j / half));
+            m_twiddleIm[half - 1 + j] = static_cast<float>(-std::sin(Pi * j / half));
+        }
+    }
+
+    // Band edges in bins; every band keeps at least one bin of its own
+    const double binHz = static_cast<double>(m_sampleRate) / FftSize;
+    uint32_t previous = 0;
+    for (uint32_t band = 0; band <= SpectrumSnapshot::BandCount; ++band) {
+        uint32_t bin = static_cast<uint32_t>(std::lround(getBandLowHz(band) / binHz));
+        bin = std::min<uint32_t>(std::max(bin, band == 0 ? 1u : previous + 1), FftSize / 2);
+        m_bandFirstBin[band] = bin;
+        previous = bin;
+    }
+
+    for (auto& band : m_publishedBands) {
+        band.store(0.0f, std::memory_order_relaxed);
+    }
+}
+
+float SpectrumAnalyzer::getBandLowHz(uint32_t band) {
+    return LowestHz * std::pow(HighestHz / LowestHz, static_cast<float>(band) / SpectrumSnapshot::BandCount);
+}
+
+void SpectrumAnalyzer::process(const float* stereo, size_t frames) {
+    for (size_t i = 0; i < frames; ++i) {
+        m_history[m_writeIndex] = 0.5f * (stereo[i * 2] + stereo[i * 2 + 1]);
+        m_writeIndex = (m_writeIndex + 1) % FftSize;
+        if (++m_sinceAnalysis == HopSize) {
+            m_sinceAnalysis = 0;
+            analyze();
+        }
+    }
+}
+
+void SpectrumAnalyzer::analyze() {
+    // Oldest sample first, windowed, straight into bit-reversed order
+    double sumSquares = 0.0;
+    for (size_t i = 0; i < FftSize; ++i) {
+        float sample = m_history[(m_writeIndex + i) % FftSize];
+        sumSquares += static_cast<double>(sample) * sample;
+        m_re[m_bitReverse[i]] = sample * m_window[i];
+        m_im[m_bitReverse[i]] = 0.0f;
+    }
+    AudioKernels::fft(m_re.data(), m_im.data(), FftSize, m_twiddleRe.data(), m_twiddleIm.data());
+
+    // A sine's power lands in a few Hann bins; over the positive half their
+    // sum is N^2 * 3/32 * amplitude^2, so this turns band power into the mean
+    // square of the signal in the band
+    const double scale = 16.0 / (3.0 * FftSize * FftSize);
+    for (uint32_t band = 0; band < SpectrumSnapshot::BandCount; ++band) {
+        double power = 0.0;
+        for (uint32_t bin = m_bandFirstBin[band]; bin < m_bandFirstBin[band + 1]; ++bin) {
+            power += static_cast<double>(m_re[bin]) * m_re[bin] + static_cast<double>(m_im[bin]) * m_im[bin];
+        }
+        float target = toUnit(power * scale);
+        float& value = m_current.bands[band];
+        value = target > value ? target : target + (value - target) * m_release;
+    }
+
+    float level = toUnit(sumSquares / FftSize);
+    m_current.level = level > m_current.level ? level : level + (m_current.level - level) * m_release;
+    m_current.frame++;
+    publish();
+}
+
+void SpectrumAnalyzer::publish() {
+    uint32_t sequence = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (uint32_t band = 0; band < SpectrumSnapshot::BandCount; ++band) {
+        m_publishedBands[band].store(m_current.bands[band], std::memory_order_relaxed);
+    }
+    m_publishedLevel.store(m_current.level, std::memory_order_relaxed);
+    m_publishedFrame.store(m_current.frame, std::memory_order_relaxed);
+
+    m_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+SpectrumSnapshot SpectrumAnalyzer::read() const {
+    SpectrumSnapshot snapshot;
+    for (;;) {
+        uint32_t before = m_sequence.load(std::memory_order_acquire);
+        if (before & 1) continue;
+
+        for (uint32_t band = 0; band < SpectrumSnapshot::BandCount; ++band) {
+            snapshot.bands[band] = m_publishedBands[band].load(std::memory_order_relaxed);
+        }
+        snapshot.level = m_publishedLevel.load(std::memory_order_relaxed);
+        snapshot.frame = m_publishedFrame.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_sequence.load(std::memory_order_relaxed) == before) return snapshot;
+    }
+}
+
+SpectrumSubscription::SpectrumSubscription(std::shared_ptr<const SpectrumSnapshot> snapshot,
+                                           SpectrumBand first, SpectrumBand last)
+    : m_snapshot(std::move(snapshot))
+    , m_first(std::min(static_cast<uint32_t>(first), static_cast<uint32_t>(last)))
+    , m_last(std::min(std::max(static_cast<uint32_t>(first), static_cast<uint32_t>(last)),
+                      SpectrumSnapshot::BandCount - 1)) {
+}
+
+float SpectrumSubscription::getLevel() const {
+    if (!m_snapshot) return 0.0f;
+
+    float sum = 0.0f;
+    for (uint32_t band = m_first; band <= m_last; ++band) {
+        sum += m_snapshot->bands[band];
+    }
+    return sum / (m_last - m_first + 1);
+}
+
+} // namespace FinalStorm
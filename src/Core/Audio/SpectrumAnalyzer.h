@@ -0,0 +1,100 @@
+// src/Core/Audio/SpectrumAnalyzer.h
+// Analysis tap on the master mix: a Hann-windowed FFT on the audio thread,
+// reduced to log-spaced band levels and published through a seqlock, so
+// readers take a snapshot without ever holding up the mixer
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace FinalStorm {
+
+// Octave-ish bands from 40 Hz to 16 kHz
+enum class SpectrumBand : uint32_t {
+    Sub,            // 40-85 Hz
+    Bass,           // 85-180 Hz
+    LowMid,         // 180-380 Hz
+    Mid,            // 380-800 Hz
+    UpperMid,       // 800-1700 Hz
+    Presence,       // 1.7-3.6 kHz
+    Brilliance,     // 3.6-7.6 kHz
+    Air             // 7.6-16 kHz
+};
+
+struct SpectrumSnapshot {
+    static constexpr uint32_t BandCount = 8;
+
+    // 0 at -60 dBFS or below, 1 for a full-scale sine; rises at once and
+    // falls smoothly, ready to drive visuals directly
+    float bands[BandCount] = {};
+    float level = 0.0f;         // Whole mix, same scale
+    uint64_t frame = 0;         // Analyses so far; unchanged means nothing new
+};
+
+class SpectrumAnalyzer {
+public:
+    static constexpr size_t FftSize = 1024;     // 21 ms at 48 kHz
+    static constexpr size_t HopSize = 512;      // About 94 analyses a second
+
+    explicit SpectrumAnalyzer(uint32_t sampleRate);
+
+    SpectrumAnalyzer(const SpectrumAnalyzer&) = delete;
+    SpectrumAnalyzer& operator=(const SpectrumAnalyzer&) = delete;
+
+    // Audio thread: the final stereo mix, after master gain
+    void process(const float* stereo, size_t frames);
+
+    // Any thread; retries only while a publish is in progress
+    SpectrumSnapshot read() const;
+
+    static float getBandLowHz(uint32_t band);
+    static float getBandHighHz(uint32_t band) { return getBandLowHz(band + 1); }
+
+private:
+    void analyze();
+    void publish();
+
+    uint32_t m_sampleRate;
+    float m_release;                    // Per-analysis fall factor
+
+    // Audio thread only
+    std::vector<float> m_history;       // Last FftSize mono samples, circular
+    size_t m_writeIndex;
+    size_t m_sinceAnalysis;
+    std::vector<float> m_window;
+    std::vector<uint32_t> m_bitReverse;
+    std::vector<float> m_twiddleRe;
+    std::vector<float> m_twiddleIm;
+    std::vector<float> m_re;
+    std::vector<float> m_im;
+    uint32_t m_bandFirstBin[SpectrumSnapshot::BandCount + 1];
+    SpectrumSnapshot m_current;
+
+    // Seqlock: odd while the audio thread is writing
+    std::atomic<uint32_t> m_sequence;
+    std::atomic<float> m_publishedBands[SpectrumSnapshot::BandCount];
+    std::atomic<float> m_publishedLevel;
+    std::atomic<uint64_t> m_publishedFrame;
+};
+
+// A node's view of the bands it reacts to. Reads the engine's per-update
+// snapshot, so any number of subscribers cost one snapshot copy per update.
+class SpectrumSubscription {
+public:
+    SpectrumSubscription() = default;
+    SpectrumSubscription(std::shared_ptr<const SpectrumSnapshot> snapshot, SpectrumBand first, SpectrumBand last);
+
+    // Mean of the subscribed bands; 0 when not subscribed
+    float getLevel() const;
+    explicit operator bool() const { return m_snapshot != nullptr; }
+
+private:
+    std::shared_ptr<const SpectrumSnapshot> m_snapshot;
+    uint32_t m_first = 0;
+    uint32_t m_last = 0;
+};
+
+} // namespace FinalStorm
@@ -0,0 +1,187 @@
+// src/Core/Audio/WavReader.cpp
+// WAV decoder implementation
+
+#include "Core/Audio/WavReader.h"
+#include <algorithm>
+#include <cstring>
+
+namespace FinalStorm {
+
+namespace {
+
+constexpr uint16_t FormatPcm = 1;
+constexpr uint16_t FormatFloat = 3;
+constexpr uint16_t FormatExtensible = 0xFFFE;
+
+// Frames converted per fread
+constexpr size_t ReadBlockFrames = 4096;
+
+uint16_t readU16(const unsigned char* bytes) {
+    return static_cast<uint16_t>(bytes[0] | (bytes[1] << 8));
+}
+
+uint32_t readU32(const unsigned char* bytes) {
+    return static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+           (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+} // namespace
+
+WavReader::WavReader()
+    : m_file(nullptr)
+    , m_fileChannels(0)
+    , m_sampleRate(0)
+    , m_bitsPerSample(0)
+    , m_float(false)
+    , m_frameCount(0)
+    , m_dataOffset(0)
+    , m_position(0) {
+}
+
+WavReader::~WavReader() {
+    close();
+}
+
+bool WavReader::open(const std::string& path) {
+    close();
+    m_file = std::fopen(path.c_str(), "rb");
+    if (!m_file) return false;
+
+    unsigned char header[12];
+    if (std::fread(header, 1, 12, m_file) != 12 ||
+        std::memcmp(header, "RIFF", 4) != 0 || std::memcmp(header + 8, "WAVE", 4) != 0) {
+        close();
+        return false;
+    }
+
+    // Walk the chunks for fmt and data; anything else is skipped
+    bool haveFormat = false;
+    unsigned char chunk[8];
+    while (std::fread(chunk, 1, 8, m_file) == 8) {
+        uint32_t size = readU32(chunk + 4);
+        long next = std::ftell(m_file) + static_cast<long>(size + (size & 1));
+
+        if (std::memcmp(chunk, "fmt ", 4) == 0 && size >= 16) {
+            unsigned char format[40] = {};
+            size_t wanted = std::min<size_t>(size, sizeof(format));
+            if (std::fread(format, 1, wanted, m_file) != wanted) break;
+
+            uint16_t tag = readU16(format);
+            if (tag == FormatExtensible && size >= 26) {
+                tag = readU16(format + 24);     // First two bytes of the subformat GUID
+            }
+            m_fileChannels = readU16(format + 2);
+            m_sampleRate = readU32(format + 4);
+            m_bitsPerSample = readU16(format + 14);
+            m_float = tag == FormatFloat;
+            haveFormat = (tag == FormatPcm && (m_bitsPerSample == 8 || m_bitsPerSample == 16 ||
+                                               m_bitsPerSample == 24 || m_bitsPerSample == 32)) ||
+                         (tag == FormatFloat && m_bitsPerSample == 32);
+            if (!haveFormat || m_fileChannels == 0) break;
+        } else if (std::memcmp(chunk, "data", 4) == 0 && haveFormat) {
+            m_dataOffset = static_cast<uint64_t>(std::ftell(m_file));
+            m_frameCount = size / (m_fileChannels * (m_bitsPerSample / 8));
+            m_position = 0;
+            return true;
+        }
+        if (std::fseek(m_file, next, SEEK_SET) != 0) break;
+    }
+
+    close();
+    return false;
+}
+
+void WavReader::close() {
+    if (m_file) {
+        std::fclose(m_file);
+        m_file = nullptr;
+    }
+    m_frameCount = 0;
+    m_position = 0;
+}
+
+float WavReader::sampleAt(const unsigned char* bytes) const {
+    switch (m_bitsPerSample) {
+        case 8:
+            return (static_cast<float>(bytes[0]) - 128.0f) / 128.0f;
+        case 16:
+            return static_cast<float>(static_cast<int16_t>(readU16(bytes))) / 32768.0f;
+        case 24: {
+            int32_t value = static_cast<int32_t>((bytes[0] << 8) | (bytes[1] << 16) | (static_cast<uint32_t>(bytes[2]) << 24)) >> 8;
+            return static_cast<float>(value) / 8388608.0f;
+        }
+        case 32:
+            if (m_float) {
+                uint32_t bits = readU32(bytes);
+                float value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+            return static_cast<float>(static_cast<int32_t>(readU32(bytes))) / 2147483648.0f;
+    }
+    return 0.0f;
+}
+
+size_t WavReader::read(float* out, size_t frames) {
+    if (!m_file) return 0;
+
+    frames = static_cast<size_t>(std::min<uint64_t>(frames, m_frameCount - m_position));
+    const size_t sampleBytes = m_bitsPerSample / 8;
+    const size_t frameBytes = sampleBytes * m_fileChannels;
+    const uint32_t outChannels = getChannels();
+
+    size_t done = 0;
+    while (done < frames) {
+        size_t count = std::min(ReadBlockFrames, frames - done);
+        m_raw.resize(count * frameBytes);
+        size_t got = std::fread(m_raw.data(), frameBytes, count, m_file);
+
+        for (size_t i = 0; i < got; ++i) {
+            const unsigned char* frame = m_raw.data() + i * frameBytes;
+            float* target = out + (done + i) * outChannels;
+            if (m_fileChannels <= 2) {
+                for (uint32_t c = 0; c < m_fileChannels; ++c) {
+                    target[c] = sampleAt(frame + c * sampleBytes);
+                }
+            } else {
+                // Even channels to the left, odd to the right
+                float left = 0.0f, right = 0.0f;
+                for (uint32_t c = 0; c < m_fileChannels; ++c) {
+                    ((c & 1) ? right : left) += sampleAt(frame + c * sampleBytes);
+                }
+                float scale = 2.0f / m_fileChannels;
+                target[0] = left * scale;
+                target[1] = right * scale;
+            }
+        }
+
+        done += got;
+        m_position += got;
+        if (got < count) break;     // Truncated file
+    }
+    return done;
+}
+
+bool WavReader::seek(uint64_t frame) {
+    if (!m_file) return false;
+
+    frame = std::min(frame, m_frameCount);
+    uint64_t offset = m_dataOffset + frame * (m_bitsPerSample / 8) * m_fileChannels;
+    if (std::fseek(m_file, static_cast<long>(offset), SEEK_SET) != 0) return false;
+    m_position = frame;
+    return true;
+}
+
+bool WavReader::decode(const std::string& path, std::vector<float>& samples, uint32_t& channels, uint32_t& sampleRate) {
+    WavReader reader;
+    if (!reader.open(path)) return false;
+
+    channels = reader.getChannels();
+    sampleRate = reader.getSampleRate();
+    samples.resize(static_cast<size_t>(reader.getFrameCount()) * channels);
+    size_t frames = reader.read(samples.data(), static_cast<size_t>(reader.getFrameCount()));
+    samples.resize(frames * channels);
+    return true;
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,53 @@
+// src/Core/Audio/WavReader.h
+// Incremental WAV decoder: PCM 8/16/24/32-bit and float, any channel count
+// Output is interleaved float with more than two channels folded to stereo
+
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace FinalStorm {
+
+class WavReader {
+public:
+    WavReader();
+    ~WavReader();
+
+    WavReader(const WavReader&) = delete;
+    WavReader& operator=(const WavReader&) = delete;
+
+    // Parses the header and leaves the reader at the first frame
+    bool open(const std::string& path);
+    void close();
+
+    // Reads up to frames frames into out (getChannels() floats per frame);
+    // returns the number read, short only at the end of the file
+    size_t read(float* out, size_t frames);
+    bool seek(uint64_t frame);
+
+    bool isOpen() const { return m_file != nullptr; }
+    uint32_t getChannels() const { return m_fileChannels > 2 ? 2 : m_fileChannels; }
+    uint32_t getSampleRate() const { return m_sampleRate; }
+    uint64_t getFrameCount() const { return m_frameCount; }
+    double getDuration() const { return m_sampleRate ? static_cast<double>(m_frameCount) / m_sampleRate : 0.0; }
+
+    // Whole file in one call
+    static bool decode(const std::string& path, std::vector<float>& samples, uint32_t& channels, uint32_t& sampleRate);
+
+private:
+    float sampleAt(const unsigned char* bytes) const;
+
+    std::FILE* m_file;
+    uint32_t m_fileChannels;
+    uint32_t m_sampleRate;
+    uint32_t m_bitsPerSample;
+    bool m_float;
+    uint64_t m_frameCount;
+    uint64_t m_dataOffset;
+    uint64_t m_position;        // Next frame read
+    std::vector<unsigned char> m_raw;
+};
+
+} // namespace FinalStorm
@@ -0,0 +1,136 @@
+// src/Core/Input/InputQueue.cpp
+// Timestamped input queue implementation
+
+#include "Core/Input/InputQueue.h"
+#include <algorithm>
+#include <chrono>
+
+#if defined(__APPLE__)
+#include <time.h>
+#endif
+
+namespace FinalStorm {
+
+namespace {
+
+// Weight of each frame in the running latency average
+constexpr float LatencyAveraging = 0.05f;
+
+// Events whose later copies supersede earlier ones: only the newest position
+// matters to a frame, and deltas and gesture changes accumulate
+bool isContinuous(const InputEvent& event) {
+    switch (event.type) {
+        case InputEventType::MouseMove:
+        case InputEventType::MouseScroll:
+        case InputEventType::TouchMove:
+            return true;
+        case InputEventType::Gesture:
+            return event.gesture == GestureType::Pinch || event.gesture == GestureType::Rotate;
+        default:
+            return false;
+    }
+}
+
+bool canFold(const InputEvent& earlier, const InputEvent& later) {
+    return earlier.type == later.type && isContinuous(later) &&
+           earlier.mouseButton == later.mouseButton && earlier.gesture == later.gesture &&
+           earlier.shift == later.shift && earlier.control == later.control &&
+           earlier.alt == later.alt && earlier.command == later.command;
+}
+
+bool isPointerMove(const InputEvent& event) {
+    return event.type == InputEventType::MouseMove || event.type == InputEventType::TouchMove;
+}
+
+} // namespace
+
+InputQueue::InputQueue()
+    : m_historyHead(0)
+    , m_historyCount(0) {
+}
+
+double InputQueue::now() {
+#if defined(__APPLE__)
+    // System uptime, which stops while asleep: the clock behind
+    // NSEvent.timestamp and UITouch.timestamp. steady_clock counts sleep
+    // there, so the two drift apart after the first sleep.
+    return clock_gettime_nsec_np(CLOCK_UPTIME_RAW) / 1e9;
+#else
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void InputQueue::push(const InputEvent& event) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pending.push_back(event);
+    if (m_pending.back().timestamp <= 0.0) m_pending.back().timestamp = now();
+}
+
+size_t InputQueue::drain(std::vector<InputEvent>& events) {
+    events.clear();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pending.empty()) return 0;
+        m_pending.swap(m_draining);
+    }
+
+    double oldest = m_draining.front().timestamp;
+    for (const InputEvent& event : m_draining) {
+        oldest = std::min(oldest, event.timestamp);
+        if (isPointerMove(event)) recordSample(event);
+
+        if (!events.empty() && canFold(events.back(), event)) {
+            InputEvent& folded = events.back();
+            float2 delta = folded.delta + event.delta;
+            float gestureValue = folded.gesture == GestureType::Pinch ? folded.gestureValue * event.gestureValue
+                                                                      : folded.gestureValue + event.gestureValue;
+            folded = event;
+            folded.delta = delta;
+            folded.gestureValue = gestureValue;
+        } else {
+            events.push_back(event);
+        }
+    }
+
+    m_stats.received += m_draining.size();
+    m_stats.dispatched += events.size();
+    m_draining.clear();
+
+    float latencyMs = static_cast<float>(std::max(0.0, now() - oldest) * 1000.0);
+    m_stats.lastMs = latencyMs;
+    m_stats.averageMs = m_stats.frames == 0 ? latencyMs
+                                            : m_stats.averageMs + (latencyMs - m_stats.averageMs) * LatencyAveraging;
+    m_stats.worstMs = std::max(m_stats.worstMs, latencyMs);
+    ++m_stats.frames;
+
+    return events.size();
+}
+
+void InputQueue::recordSample(const InputEvent& event) {
+    PointerSample& sample = m_history[m_historyHead];
+    sample.timestamp = event.timestamp;
+    sample.position = event.position;
+    m_historyHead = (m_historyHead + 1) % HistorySize;
+    m_historyCount = std::min(m_historyCount + 1, HistorySize);
+}
+
+const PointerSample& InputQueue::getPointerSample(size_t index) const {
+    size_t oldest = (m_historyHead + HistorySize - m_historyCount) % HistorySize;
+    return m_history[(oldest + index) % HistorySize];
+}
+
+float2 InputQueue::getPointerVelocity(double window) const {
+    float2 velocity = {0.0f, 0.0f};
+    if (m_historyCount < 2) return velocity;
+
+    const PointerSample& newest = getPointerSample(m_historyCount - 1);
+    size_t first = m_historyCount - 2;
+    while (first > 0 && newest.timestamp - getPointerSample(first - 1).timestamp <= window) --first;
+
+    const PointerSample& start = getPointerSample(first);
+    double elapsed = newest.timestamp - start.timestamp;
+    if (elapsed <= 0.0) return velocity;
+    return (newest.position - start.position) / static_cast<float>(elapsed);
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,78 @@
+// src/Core/Input/InputQueue.h
+// Timestamped input queue between the platform layer and the frame loop
+// Platforms push events as they arrive; the frame drains them once, with
+// runs of pointer moves folded into one event per frame
+
+#pragma once
+#include "Core/Input/InputTypes.h"
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace FinalStorm {
+
+// One raw pointer position, kept even when its event was folded away
+struct PointerSample {
+    double timestamp = 0.0;
+    float2 position;
+};
+
+struct InputLatencyStats {
+    uint64_t frames = 0;            // Frames that drained at least one event
+    uint64_t received = 0;          // Events pushed by the platform
+    uint64_t dispatched = 0;        // Events left after folding
+    float lastMs = 0.0f;            // Age of the oldest event at the last drain
+    float averageMs = 0.0f;         // Running average of lastMs
+    float worstMs = 0.0f;
+};
+
+class InputQueue {
+public:
+    // Pointer samples kept for gestures: about a quarter second at 1 kHz
+    static constexpr size_t HistorySize = 256;
+
+    InputQueue();
+
+    InputQueue(const InputQueue&) = delete;
+    InputQueue& operator=(const InputQueue&) = delete;
+
+    // Any thread. Events without a timestamp are stamped here.
+    void push(const InputEvent& event);
+
+    // Frame thread, once per frame. Replaces events with everything pushed
+    // since the last drain, in order, with each run of consecutive moves (or
+    // continuous gestures) of one kind folded into its last event and the
+    // run's deltas summed. Returns the number of events.
+    size_t drain(std::vector<InputEvent>& events);
+
+    // Frame thread. Pointer positions of every move drained, folded or not,
+    // oldest first.
+    size_t getPointerSampleCount() const { return m_historyCount; }
+    const PointerSample& getPointerSample(size_t index) const;
+
+    // Pointer velocity in points per second over the newest window seconds of
+    // samples; zero with fewer than two
+    float2 getPointerVelocity(double window = 0.05) const;
+
+    const InputLatencyStats& getLatencyStats() const { return m_stats; }
+    void resetLatencyStats() { m_stats = InputLatencyStats(); }
+
+    // The clock timestamps are read against
+    static double now();
+
+private:
+    void recordSample(const InputEvent& event);
+
+    std::mutex m_mutex;
+    std::vector<InputEvent> m_pending;      // Filled by push()
+    std::vector<InputEvent> m_draining;     // Swapped with m_pending by drain(), keeps its capacity
+
+    PointerSample m_history[HistorySize];
+    size_t m_historyHead;                   // Next slot written
+    size_t m_historyCount;
+
+    InputLatencyStats m_stats;
+};
+
+} // namespace FinalStorm
@@ -40,6 +40,11 @@ enum class GestureType {
 struct InputEvent {
     InputEventType type = InputEventType::None;
     
+    // Seconds on InputQueue::now() when the platform saw the event. On Apple
+    // that is system uptime, so NSEvent.timestamp and UITouch.timestamp fit
+    // as they are; 0 lets InputQueue stamp it
+    double timestamp = 0.0;
+    
     // Mouse/Touch
     float2 position;
     float2 delta;
@@ -54,7 +59,7 @@ struct InputEvent {
     
     // Gesture
     GestureType gesture = GestureType::None;
-    float gestureValue = 0.0f;
+    float gestureValue = 0.0f;      // Change since the previous event: scale factor for Pinch, radians for Rotate
 };
 
 } // namespace FinalStorm
\ No newline at end of file
@@ -4,21 +4,54 @@
 
 #include "Core/Input/InteractionManager.h"
 #include "Core/Math/Math.h"
+#include "Core/Math/Camera.h"
+#include <cmath>
+#include <limits>
 
 namespace FinalStorm {
 
+namespace {
+
+// Seconds between hover re-picks while the pointer rests and pickables move
+constexpr float HoverRecheckInterval = 0.1f;
+
+// Camera travel per unit of log pinch scale, so a run of pinch steps zooms
+// the same whether applied one by one or folded into their product
+constexpr float PinchZoomSpeed = 10.0f;
+
+} // namespace
+
 InteractionManager::InteractionManager()
-    : mousePosition(0, 0)
-    , lastMousePosition(0, 0)
-    , isDragging(false) {
+    : m_pickLayers(PickLayer::All)
+    , m_viewport{1.0f, 1.0f}
+    , m_mousePosition{0.0f, 0.0f}
+    , m_lastMousePosition{0.0f, 0.0f}
+    , m_isDragging(false)
+    , m_pointerMoved(false)
+    , m_hoverVersion(0)
+    , m_hoverRecheckTimer(0.0f) {
 }
 
 InteractionManager::~InteractionManager() = default;
 
+void InteractionManager::setPickingSystem(std::shared_ptr<PickingSystem> picking) {
+    m_picking = std::move(picking);
+    m_pointerMoved = true;
+}
+
 void InteractionManager::update(float deltaTime) {
-    // Update interaction state
-    if (hoveredObject) {
-        // Update hover effects
+    if (!m_picking) return;
+
+    // Pointer events only record the position; however many arrived since
+    // the last frame, hover costs one pick
+    if (m_pointerMoved) {
+        updateHover();
+        return;
+    }
+
+    m_hoverRecheckTimer += deltaTime;
+    if (m_hoverRecheckTimer >= HoverRecheckInterval && m_picking->getVersion() != m_hoverVersion) {
+        updateHover();
     }
 }
 
@@ -39,34 +72,45 @@ void InteractionManager::handleEvent(const InputEvent& event) {
         case InputEventType::KeyUp:
             handleKeyUp(event);
             break;
+        case InputEventType::TouchBegin:
+            handleMouseDown(event);
+            break;
+        case InputEventType::TouchMove:
+            handleMouseMove(event);
+            break;
+        case InputEventType::TouchEnd:
+            handleMouseUp(event);
+            break;
+        case InputEventType::Gesture:
+            if (event.gesture == GestureType::Pinch) handlePinch(event.gestureValue);
+            break;
         default:
             break;
     }
 }
 
 void InteractionManager::handleMouseDown(const InputEvent& event) {
-    mousePosition = event.position;
-    lastMousePosition = mousePosition;
-    isDragging = true;
-    
-    // TODO: Implement ray casting for object selection
+    m_mousePosition = event.position;
+    m_lastMousePosition = m_mousePosition;
+    m_isDragging = true;
+
+    PickHit hit;
+    pickAt(m_mousePosition, hit);
+    select(hit);
 }
 
 void InteractionManager::handleMouseUp(const InputEvent& event) {
-    isDragging = false;
-    
-    if (selectedObject) {
-        // Handle object click
-    }
+    m_isDragging = false;
 }
 
 void InteractionManager::handleMouseMove(const InputEvent& event) {
-    lastMousePosition = mousePosition;
-    mousePosition = event.position;
-    
-    if (isDragging) {
+    m_lastMousePosition = m_mousePosition;
+    m_mousePosition = event.position;
+    m_pointerMoved = true;
+
+    if (m_isDragging) {
         // Handle camera rotation or object manipulation
-        float2 delta = mousePosition - lastMousePosition;
+        float2 delta = m_mousePosition - m_lastMousePosition;
         // TODO: Apply delta to camera or selected object
     }
 }
@@ -76,7 +120,7 @@ void InteractionManager::handleKeyDown(const InputEvent& event) {
     switch (event.keyCode) {
         case 53: // ESC key
             // Deselect object
-            selectedObject.reset();
+            select(PickHit());
             break;
         default:
             break;
@@ -87,4 +131,80 @@ void InteractionManager::handleKeyUp(const InputEvent& event) {
     // Handle key release
 }
 
-} // namespace FinalStorm
\ No newline at end of file
+void InteractionManager::handleTouchBegan(const float2& point, const float2& viewport) {
+    m_viewport = viewport;
+    InputEvent event;
+    event.type = InputEventType::MouseDown;
+    event.position = point;
+    handleMouseDown(event);
+}
+
+void InteractionManager::handleTouchMoved(const float2& point, const float2& viewport) {
+    m_viewport = viewport;
+    InputEvent event;
+    event.type = InputEventType::MouseMove;
+    event.position = point;
+    handleMouseMove(event);
+}
+
+void InteractionManager::handleTouchEnded(const float2& point, const float2& viewport) {
+    m_viewport = viewport;
+    InputEvent event;
+    event.type = InputEventType::MouseUp;
+    event.position = point;
+    handleMouseUp(event);
+}
+
+void InteractionManager::handlePinch(float scale) {
+    if (m_camera && scale > 0.0f) {
+        m_camera->zoom(std::log(scale) * PinchZoomSpeed);
+        m_pointerMoved = true;
+    }
+}
+
+Ray InteractionManager::screenPointToRay(const float2& point, const float2& viewport) const {
+    if (!m_camera || viewport.x <= 0.0f || viewport.y <= 0.0f) {
+        return Ray(vec3_zero(), make_vec3(0.0f, 0.0f, -1.0f));
+    }
+
+    // To normalized device coordinates, flipping Y as CameraController does
+    float x = (2.0f * point.x) / viewport.x - 1.0f;
+    float y = 1.0f - (2.0f * point.y) / viewport.y;
+
+    // Unproject a point on the far plane and aim at it from the eye
+    vec4 farPoint = inverse(m_camera->getViewProjectionMatrix()) * make_vec4(x, y, 1.0f, 1.0f);
+    vec3 target = make_vec3(farPoint.x, farPoint.y, farPoint.z) / farPoint.w;
+    vec3 origin = m_camera->getPosition();
+    return Ray(origin, target - origin);
+}
+
+bool InteractionManager::pickAt(const float2& point, PickHit& hit) {
+    hit = PickHit();
+    if (!m_picking || !m_camera) return false;
+    return m_picking->pick(screenPointToRay(point, m_viewport),
+                           std::numeric_limits<float>::max(), m_pickLayers, hit);
+}
+
+void InteractionManager::updateHover() {
+    m_pointerMoved = false;
+    m_hoverRecheckTimer = 0.0f;
+    m_hoverVersion = m_picking->getVersion();
+
+    PickHit hit;
+    pickAt(m_mousePosition, hit);
+    if (hit.handle == m_hovered.handle) {
+        m_hovered = hit;
+        return;
+    }
+
+    m_hovered = hit;
+    if (m_onHover) m_onHover(m_hovered);
+}
+
+void InteractionManager::select(const PickHit& hit) {
+    if (hit.handle == m_selected.handle) return;
+    m_selected = hit;
+    if (m_onSelect) m_onSelect(m_selected);
+}
+
+} // namespace FinalStorm
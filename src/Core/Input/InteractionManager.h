@@ -1,6 +1,14 @@
+// src/Core/Input/InteractionManager.h
+// Input and interaction handling
+// Turns pointer input into picks against the scene's PickingSystem
+
 #pragma once
 
 #include "Core/Math/Math.h"
+#include "Core/Input/InputTypes.h"
+#include "Scene/PickingSystem.h"
+#include <cstdint>
+#include <functional>
 #include <memory>
 
 namespace FinalStorm {
@@ -10,23 +18,68 @@ class SceneNode;
 
 class InteractionManager {
 public:
+    using PickCallback = std::function<void(const PickHit&)>;
+
     InteractionManager();
+    ~InteractionManager();
 
     void setCamera(std::shared_ptr<Camera> camera) { m_camera = camera; }
     void setSceneRoot(std::shared_ptr<SceneNode> root) { m_sceneRoot = root; }
+    void setViewport(const float2& viewport) { m_viewport = viewport; }
+
+    // Picks go through this system, limited to the layers in the mask
+    void setPickingSystem(std::shared_ptr<PickingSystem> picking);
+    void setPickLayers(uint32_t layerMask) { m_pickLayers = layerMask; }
+
+    // Hover fires when the pickable under the pointer changes (with an empty
+    // hit when it leaves everything), select fires on click
+    void setHoverCallback(PickCallback callback) { m_onHover = std::move(callback); }
+    void setSelectCallback(PickCallback callback) { m_onSelect = std::move(callback); }
+    const PickHit& getHovered() const { return m_hovered; }
+    const PickHit& getSelected() const { return m_selected; }
+
+    void update(float deltaTime);
+    void handleEvent(const InputEvent& event);
 
     void handleTouchBegan(const float2& point, const float2& viewport);
     void handleTouchMoved(const float2& point, const float2& viewport);
     void handleTouchEnded(const float2& point, const float2& viewport);
-    void handlePinch(float scale);
+    void handlePinch(float scale);      // Scale factor since the previous pinch event
 
-    struct Ray { float3 origin; float3 direction; };
+    // World-space ray through a point in view coordinates (origin top left)
     Ray screenPointToRay(const float2& point, const float2& viewport) const;
 
 private:
+    void handleMouseDown(const InputEvent& event);
+    void handleMouseUp(const InputEvent& event);
+    void handleMouseMove(const InputEvent& event);
+    void handleKeyDown(const InputEvent& event);
+    void handleKeyUp(const InputEvent& event);
+
+    bool pickAt(const float2& point, PickHit& hit);
+    void updateHover();
+    void select(const PickHit& hit);
+
     std::shared_ptr<Camera> m_camera;
     std::shared_ptr<SceneNode> m_sceneRoot;
-    float2 m_lastPoint;
+    std::shared_ptr<PickingSystem> m_picking;
+    uint32_t m_pickLayers;
+    float2 m_viewport;
+
+    float2 m_mousePosition;
+    float2 m_lastMousePosition;
+    bool m_isDragging;
+
+    PickHit m_hovered;
+    PickHit m_selected;
+    PickCallback m_onHover;
+    PickCallback m_onSelect;
+
+    // Hover is picked at most once per update: after the pointer moved, or
+    // now and then under a still pointer when pickables have moved
+    bool m_pointerMoved;
+    uint64_t m_hoverVersion;
+    float m_hoverRecheckTimer;
 };
 
 } // namespace FinalStorm
@@ -0,0 +1,94 @@
+// src/Core/JobSystem.h
+// Worker thread pool for background jobs and parallel loops
+// Jobs run in submission order on a fixed set of worker threads
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace FinalStorm {
+
+class JobSystem {
+public:
+    using Job = std::function<void()>;
+
+    // 0 picks one worker per hardware thread, leaving one for the main thread
+    explicit JobSystem(size_t workerCount = 0);
+
+    // Runs every job already submitted, then joins the workers
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    void submit(Job job);
+
+    // Calls fn(begin, end) over [0, count) in chunks of grainSize across the
+    // workers and the calling thread, and returns when every chunk is done
+    template<typename Fn>
+    void parallelFor(size_t count, size_t grainSize, Fn&& fn);
+
+    size_t getWorkerCount() const { return m_workers.size(); }
+    size_t getPendingCount() const;
+
+    static size_t defaultWorkerCount();
+
+private:
+    void workerMain();
+
+    std::vector<std::thread> m_workers;
+    std::deque<Job> m_queue;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_available;
+    bool m_stopping;
+};
+
+template<typename Fn>
+void JobSystem::parallelFor(size_t count, size_t grainSize, Fn&& fn) {
+    if (count == 0) return;
+    grainSize = std::max<size_t>(1, grainSize);
+    const size_t chunkCount = (count + grainSize - 1) / grainSize;
+
+    // Helpers that start after the last chunk was claimed only touch this
+    // shared state, never fn, so returning before they run is safe
+    struct State {
+        std::atomic<size_t> nextChunk{0};
+        size_t completedChunks = 0;
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+    auto state = std::make_shared<State>();
+
+    auto runChunks = [state, chunkCount, grainSize, count, &fn]() {
+        size_t finished = 0;
+        for (size_t chunk = state->nextChunk++; chunk < chunkCount; chunk = state->nextChunk++) {
+            size_t begin = chunk * grainSize;
+            fn(begin, std::min(count, begin + grainSize));
+            ++finished;
+        }
+        if (finished > 0) {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->completedChunks += finished;
+            if (state->completedChunks == chunkCount) state->done.notify_all();
+        }
+    };
+
+    size_t helpers = std::min(m_workers.size(), chunkCount - 1);
+    for (size_t i = 0; i < helpers; ++i) {
+        submit(runChunks);
+    }
+    runChunks();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(lock, [&]() { return state->completedChunks == chunkCount; });
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,73 @@
+// src/Core/RingBuffer.h
+// Fixed-capacity ring buffer
+// Overwrites the oldest element once full; never reallocates after construction
+
+#pragma once
+#include <cstddef>
+#include <vector>
+
+namespace FinalStorm {
+
+template<typename T>
+class RingBuffer {
+public:
+    explicit RingBuffer(size_t capacity = 0)
+        : m_storage(capacity)
+        , m_head(0)
+        , m_size(0) {}
+
+    // Append an element. Returns true if the oldest element was overwritten,
+    // in which case it is copied to evicted (if provided) before being replaced.
+    bool push(const T& value, T* evicted = nullptr) {
+        if (m_storage.empty()) return false;
+
+        size_t tail = (m_head + m_size) % m_storage.size();
+        if (m_size == m_storage.size()) {
+            if (evicted) *evicted = m_storage[m_head];
+            m_storage[m_head] = value;
+            m_head = (m_head + 1) % m_storage.size();
+            return true;
+        }
+
+        m_storage[tail] = value;
+        ++m_size;
+        return false;
+    }
+
+    void popFront() {
+        if (m_size == 0) return;
+        m_head = (m_head + 1) % m_storage.size();
+        --m_size;
+    }
+
+    void clear() {
+        m_head = 0;
+        m_size = 0;
+    }
+
+    void reset(size_t capacity) {
+        m_storage.assign(capacity, T());
+        clear();
+    }
+
+    // Index 0 is the oldest element, size() - 1 the newest
+    T& operator[](size_t index) { return m_storage[(m_head + index) % m_storage.size()]; }
+    const T& operator[](size_t index) const { return m_storage[(m_head + index) % m_storage.size()]; }
+
+    T& front() { return (*this)[0]; }
+    const T& front() const { return (*this)[0]; }
+    T& back() { return (*this)[m_size - 1]; }
+    const T& back() const { return (*this)[m_size - 1]; }
+
+    size_t size() const { return m_size; }
+    size_t capacity() const { return m_storage.size(); }
+    bool empty() const { return m_size == 0; }
+    bool full() const { return m_size == m_storage.size(); }
+
+private:
+    std::vector<T> m_storage;
+    size_t m_head;
+    size_t m_size;
+};
+
+} // namespace FinalStorm
@@ -0,0 +1,62 @@
+// src/Core/SPSCQueue.h
+// Bounded lock-free queue for exactly one producer thread and one consumer thread
+// Neither side blocks or allocates after construction
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace FinalStorm {
+
+template<typename T>
+class SPSCQueue {
+public:
+    // Capacity is rounded up to a power of two
+    explicit SPSCQueue(size_t capacity)
+        : m_storage(roundUp(capacity))
+        , m_mask(m_storage.size() - 1)
+        , m_head(0)
+        , m_tail(0) {}
+
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    // Producer only. Returns false if the queue is full.
+    bool push(const T& value) {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head.load(std::memory_order_acquire) == m_storage.size()) return false;
+        m_storage[tail & m_mask] = value;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only. Returns false if the queue is empty.
+    bool pop(T& value) {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire)) return false;
+        value = m_storage[head & m_mask];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate when called while the other side is active
+    size_t size() const { return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire); }
+    size_t capacity() const { return m_storage.size(); }
+
+private:
+    static size_t roundUp(size_t value) {
+        size_t result = 1;
+        while (result < value) result <<= 1;
+        return result;
+    }
+
+    std::vector<T> m_storage;
+    const size_t m_mask;
+
+    // Separate cache lines so the two threads do not share one
+    alignas(64) std::atomic<size_t> m_head;
+    alignas(64) std::atomic<size_t> m_tail;
+};
+
+} // namespace FinalStorm
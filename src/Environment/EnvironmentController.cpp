@@ -4,6 +4,7 @@
 
 #include "Environment/EnvironmentController.h"
 #include "Rendering/RenderContext.h"
+#include "Scene/SceneSnapshot.h"
 #include "Core/Math/Math.h"
 
 namespace FinalStorm {
@@ -86,6 +87,24 @@ void EnvironmentController::setHarmonyLevel(float level) {
     m_state.harmonyLevel = m_harmonyLevel;
 }
 
+void EnvironmentController::writeSnapshot(SnapshotParams& params) const {
+    params.set("skyboxTheme", m_skyboxTheme);
+    params.set("groundGridStyle", m_groundGridStyle);
+    params.set("ambientParticles", m_ambientParticles);
+    params.set("quantumFluctuations", m_quantumFluctuations);
+    params.set("energyLevel", m_energyLevel);
+    params.set("harmonyLevel", m_harmonyLevel);
+}
+
+void EnvironmentController::readSnapshot(const SnapshotParamReader& params) {
+    setSkyboxTheme(params.getString("skyboxTheme", m_skyboxTheme));
+    setGroundGridStyle(params.getString("groundGridStyle", m_groundGridStyle));
+    setAmbientParticles(params.getBool("ambientParticles", m_ambientParticles));
+    setQuantumFluctuations(params.getFloat("quantumFluctuations", m_quantumFluctuations));
+    setEnergyLevel(params.getFloat("energyLevel", m_energyLevel));
+    setHarmonyLevel(params.getFloat("harmonyLevel", m_harmonyLevel));
+}
+
 void EnvironmentController::updateFromHealth(float healthScore) {
     float h = Math::clamp(healthScore, 0.0f, 1.0f);
     setEnergyLevel(h);
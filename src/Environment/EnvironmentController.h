@@ -34,6 +34,11 @@ public:
     void setEnergyLevel(float level);
     void setHarmonyLevel(float level);
 
+    // Snapshots: theme, grid style and levels
+    const char* getSnapshotType() const override { return "EnvironmentController"; }
+    void writeSnapshot(SnapshotParams& params) const override;
+    void readSnapshot(const SnapshotParamReader& params) override;
+
 private:
     EnvironmentState m_state;
     std::string m_skyboxTheme;
@@ -5,8 +5,11 @@
 #include "FinalStormApp.h"
 #include "Scene/Scene.h"
 #include "Scene/SceneLoader.h"
+#include "Scene/Scenes/FirstScene.h"
 #include "World/WorldManager.h"
 #include "Rendering/Metal/MetalRenderer.h"
+#include "Core/Input/InteractionManager.h"
+#include "Core/Input/InputQueue.h"
 #include <iostream>
 
 namespace FinalStorm {
@@ -48,8 +51,18 @@ bool FinalStormApp::initialize(std::shared_ptr<Renderer> rend) {
     // Create scene manager
     sceneManager = std::make_unique<SceneManager>(scene, renderer);
 
-    // Create input manager
+    // Create input manager; clicks pick through the scene's own picking
+    // system, against the camera the scene renders with
     inputManager = std::make_unique<InteractionManager>();
+    inputQueue = std::make_unique<InputQueue>();
+    if (auto* nexus = dynamic_cast<FirstScene*>(scene.get())) {
+        inputManager->setPickingSystem(nexus->getPickingSystem());
+        inputManager->setPickLayers(PickLayer::Services);
+        inputManager->setCamera(nexus->getCamera());
+        inputManager->setSelectCallback([nexus](const PickHit& hit) {
+            if (hit) nexus->selectService(hit.id);
+        });
+    }
     
     isRunning = true;
     return true;
@@ -66,6 +79,7 @@ void FinalStormApp::shutdown() {
     sceneManager.reset();
     networkClient.reset();
     inputManager.reset();
+    inputQueue.reset();
     renderer.reset();
 }
 
@@ -78,6 +92,14 @@ void FinalStormApp::update(float currentTimeSeconds) {
     // Clamp delta time to prevent large jumps
     deltaTime = std::min(deltaTime, 0.1f);
     
+    // Input first, so this frame simulates and renders against it. Pointer
+    // moves arrive folded to one per frame; hover picks once in update().
+    if (inputQueue && inputQueue->drain(frameEvents) > 0 && inputManager) {
+        for (const InputEvent& event : frameEvents) {
+            inputManager->handleEvent(event);
+        }
+    }
+    
     // Update subsystems
     if (scene) {
         scene->update(deltaTime);
@@ -87,7 +109,8 @@ void FinalStormApp::update(float currentTimeSeconds) {
         sceneManager->update(deltaTime);
     }
     
-    if (networkClient && networkClient->isConnected()) {
+    // Runs while connected or replaying a capture, and returns at once otherwise
+    if (networkClient) {
         networkClient->update();
     }
     
@@ -112,8 +135,8 @@ void FinalStormApp::render() {
 }
 
 void FinalStormApp::handleInput(const InputEvent& event) {
-    if (inputManager) {
-        inputManager->handleEvent(event);
+    if (inputQueue) {
+        inputQueue->push(event);
     }
 }
 
@@ -127,6 +150,12 @@ void FinalStormApp::resize(uint32_t width, uint32_t height) {
     }
 }
 
+void FinalStormApp::setViewSize(float width, float height) {
+    if (inputManager) {
+        inputManager->setViewport(float2{width, height});
+    }
+}
+
 bool FinalStormApp::connectToServer(const std::string& url) {
     if (!networkClient) {
         return false;
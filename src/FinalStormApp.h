@@ -5,6 +5,7 @@
 #pragma once
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace FinalStorm {
 
@@ -13,6 +14,7 @@ class SceneManager;
 class Renderer;
 class FinalverseClient;
 class InteractionManager;
+class InputQueue;
 class WorldManager;
 class SceneLoader;
 struct InputEvent;
@@ -28,12 +30,18 @@ public:
     void update(float currentTime);
     void render();
     
+    // Queues the event; it is handled at the start of the next update()
     void handleInput(const InputEvent& event);
     void resize(uint32_t width, uint32_t height);
     
+    // View size in the units input positions use (points, not pixels), so
+    // clicks map to the right picking ray on high-density displays
+    void setViewSize(float width, float height);
+    
     bool connectToServer(const std::string& url);
     
     bool isRunning() const { return isRunning; }
+    InputQueue* getInputQueue() const { return inputQueue.get(); }
     
 private:
 
@@ -45,6 +53,8 @@ private:
     std::unique_ptr<SceneManager> sceneManager;
     std::unique_ptr<FinalverseClient> networkClient;
     std::unique_ptr<InteractionManager> inputManager;
+    std::unique_ptr<InputQueue> inputQueue;
+    std::vector<InputEvent> frameEvents;
     
     bool isRunning;
     float currentTime;
@@ -0,0 +1,58 @@
+// src/Network/ClockSync.cpp
+// Server clock offset estimation implementation
+
+#include "Network/ClockSync.h"
+#include <cmath>
+
+namespace FinalStorm {
+
+ClockSync::ClockSync()
+    : ClockSync(Config()) {
+}
+
+ClockSync::ClockSync(const Config& config)
+    : m_config(config)
+    , m_samples(config.window)
+    , m_offset(0.0)
+    , m_roundTripTime(0.0)
+    , m_hasEstimate(false) {
+}
+
+void ClockSync::addSample(double localSendTime, double serverTime, double localReceiveTime) {
+    double roundTripTime = localReceiveTime - localSendTime;
+    if (roundTripTime < 0.0) return;
+
+    // Assume the server answered halfway through the round trip
+    Sample sample;
+    sample.roundTripTime = roundTripTime;
+    sample.offset = serverTime - (localSendTime + roundTripTime * 0.5);
+    m_samples.push(sample);
+
+    // The fastest recent round trip had the least queueing, so its
+    // midpoint assumption is the most trustworthy
+    const Sample* best = &m_samples[0];
+    for (size_t i = 1; i < m_samples.size(); ++i) {
+        if (m_samples[i].roundTripTime < best->roundTripTime) {
+            best = &m_samples[i];
+        }
+    }
+    m_roundTripTime = best->roundTripTime;
+
+    // Slew small corrections so playback driven by this clock does not jump
+    double correction = best->offset - m_offset;
+    if (!m_hasEstimate || std::fabs(correction) > m_config.snapThreshold) {
+        m_offset = best->offset;
+    } else {
+        m_offset += correction * m_config.slewRate;
+    }
+    m_hasEstimate = true;
+}
+
+void ClockSync::reset() {
+    m_samples.clear();
+    m_offset = 0.0;
+    m_roundTripTime = 0.0;
+    m_hasEstimate = false;
+}
+
+} // namespace FinalStorm
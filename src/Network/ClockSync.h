@@ -0,0 +1,45 @@
+// src/Network/ClockSync.h
+// Server clock offset estimation from Ping/Pong round trips
+// Maps local time onto the sender timestamps carried by server messages
+
+#pragma once
+#include "Core/RingBuffer.h"
+#include <cstddef>
+
+namespace FinalStorm {
+
+class ClockSync {
+public:
+    struct Config {
+        size_t window = 8;              // Recent round trips considered
+        double slewRate = 0.1;          // Fraction of a small correction applied per sample
+        double snapThreshold = 0.25;    // Corrections larger than this (seconds) apply at once
+    };
+
+    ClockSync();
+    explicit ClockSync(const Config& config);
+
+    // One round trip, all in seconds: local send time, the server's clock
+    // when it answered, and local receive time
+    void addSample(double localSendTime, double serverTime, double localReceiveTime);
+    void reset();
+
+    bool hasEstimate() const { return m_hasEstimate; }
+    double getOffset() const { return m_offset; }               // serverTime - localTime
+    double getRoundTripTime() const { return m_roundTripTime; }
+    double toServerTime(double localTime) const { return localTime + m_offset; }
+
+private:
+    struct Sample {
+        double offset = 0.0;
+        double roundTripTime = 0.0;
+    };
+
+    Config m_config;
+    RingBuffer<Sample> m_samples;
+    double m_offset;
+    double m_roundTripTime;
+    bool m_hasEstimate;
+};
+
+} // namespace FinalStorm
@@ -0,0 +1,193 @@
+// src/Network/EventPoller.cpp
+// Readiness-based event loop primitive implementation
+
+#include "Network/EventPoller.h"
+#include <cerrno>
+#include <cstdint>
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(__APPLE__)
+#include <sys/event.h>
+#include <sys/time.h>
+#elif defined(__linux__)
+#include <sys/epoll.h>
+#else
+#error "EventPoller requires kqueue or epoll"
+#endif
+
+namespace FinalStorm {
+
+namespace {
+
+constexpr int kMaxEventsPerWait = 64;
+
+void setNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags >= 0) fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+}
+
+} // namespace
+
+EventPoller::EventPoller()
+    : m_pollFd(-1)
+    , m_wakeRead(-1)
+    , m_wakeWrite(-1) {
+#if defined(__APPLE__)
+    m_pollFd = kqueue();
+#else
+    m_pollFd = epoll_create1(EPOLL_CLOEXEC);
+#endif
+    if (m_pollFd < 0) return;
+
+    int fds[2];
+    if (pipe(fds) != 0) {
+        close(m_pollFd);
+        m_pollFd = -1;
+        return;
+    }
+    m_wakeRead = fds[0];
+    m_wakeWrite = fds[1];
+    setNonBlocking(m_wakeRead);
+    setNonBlocking(m_wakeWrite);
+    add(m_wakeRead, true, false);
+}
+
+EventPoller::~EventPoller() {
+    if (m_wakeRead >= 0) close(m_wakeRead);
+    if (m_wakeWrite >= 0) close(m_wakeWrite);
+    if (m_pollFd >= 0) close(m_pollFd);
+}
+
+#if defined(__APPLE__)
+
+bool EventPoller::add(int fd, bool readable, bool writable) {
+    return modify(fd, readable, writable);
+}
+
+bool EventPoller::modify(int fd, bool readable, bool writable) {
+    // Both filters stay registered; interest changes only toggle them
+    struct kevent changes[2];
+    EV_SET(&changes[0], fd, EVFILT_READ, EV_ADD | (readable ? EV_ENABLE : EV_DISABLE), 0, 0, nullptr);
+    EV_SET(&changes[1], fd, EVFILT_WRITE, EV_ADD | (writable ? EV_ENABLE : EV_DISABLE), 0, 0, nullptr);
+    return kevent(m_pollFd, changes, 2, nullptr, 0, nullptr) == 0;
+}
+
+void EventPoller::remove(int fd) {
+    struct kevent changes[2];
+    EV_SET(&changes[0], fd, EVFILT_READ, EV_DELETE, 0, 0, nullptr);
+    EV_SET(&changes[1], fd, EVFILT_WRITE, EV_DELETE, 0, 0, nullptr);
+    kevent(m_pollFd, changes, 2, nullptr, 0, nullptr);
+}
+
+int EventPoller::wait(std::vector<PollEvent>& events, int timeoutMs) {
+    events.clear();
+
+    struct kevent ready[kMaxEventsPerWait];
+    struct timespec timeout;
+    timeout.tv_sec = timeoutMs / 1000;
+    timeout.tv_nsec = (timeoutMs % 1000) * 1000000L;
+
+    int count = kevent(m_pollFd, nullptr, 0, ready, kMaxEventsPerWait, timeoutMs < 0 ? nullptr : &timeout);
+    if (count < 0) {
+        return errno == EINTR ? 0 : -1;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        int fd = static_cast<int>(ready[i].ident);
+        if (fd == m_wakeRead) {
+            drainWakeup();
+            continue;
+        }
+
+        // kqueue reports each filter separately; merge them per descriptor
+        PollEvent* event = nullptr;
+        for (auto& existing : events) {
+            if (existing.fd == fd) event = &existing;
+        }
+        if (!event) {
+            events.push_back(PollEvent{});
+            event = &events.back();
+            event->fd = fd;
+        }
+
+        if (ready[i].filter == EVFILT_READ) event->readable = true;
+        if (ready[i].filter == EVFILT_WRITE) event->writable = true;
+        if (ready[i].flags & (EV_EOF | EV_ERROR)) event->hangup = true;
+    }
+    return static_cast<int>(events.size());
+}
+
+#else
+
+namespace {
+
+uint32_t epollMask(bool readable, bool writable) {
+    uint32_t mask = EPOLLRDHUP;
+    if (readable) mask |= EPOLLIN;
+    if (writable) mask |= EPOLLOUT;
+    return mask;
+}
+
+} // namespace
+
+bool EventPoller::add(int fd, bool readable, bool writable) {
+    epoll_event event{};
+    event.events = epollMask(readable, writable);
+    event.data.fd = fd;
+    return epoll_ctl(m_pollFd, EPOLL_CTL_ADD, fd, &event) == 0;
+}
+
+bool EventPoller::modify(int fd, bool readable, bool writable) {
+    epoll_event event{};
+    event.events = epollMask(readable, writable);
+    event.data.fd = fd;
+    return epoll_ctl(m_pollFd, EPOLL_CTL_MOD, fd, &event) == 0;
+}
+
+void EventPoller::remove(int fd) {
+    epoll_ctl(m_pollFd, EPOLL_CTL_DEL, fd, nullptr);
+}
+
+int EventPoller::wait(std::vector<PollEvent>& events, int timeoutMs) {
+    events.clear();
+
+    epoll_event ready[kMaxEventsPerWait];
+    int count = epoll_wait(m_pollFd, ready, kMaxEventsPerWait, timeoutMs);
+    if (count < 0) {
+        return errno == EINTR ? 0 : -1;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        if (ready[i].data.fd == m_wakeRead) {
+            drainWakeup();
+            continue;
+        }
+
+        PollEvent event;
+        event.fd = ready[i].data.fd;
+        event.readable = (ready[i].events & EPOLLIN) != 0;
+        event.writable = (ready[i].events & EPOLLOUT) != 0;
+        event.hangup = (ready[i].events & (EPOLLHUP | EPOLLERR | EPOLLRDHUP)) != 0;
+        events.push_back(event);
+    }
+    return static_cast<int>(events.size());
+}
+
+#endif
+
+void EventPoller::wakeup() {
+    // A full pipe already guarantees a pending wakeup, so EAGAIN is fine
+    uint8_t byte = 1;
+    ssize_t result = write(m_wakeWrite, &byte, 1);
+    (void)result;
+}
+
+void EventPoller::drainWakeup() {
+    uint8_t buffer[64];
+    while (read(m_wakeRead, buffer, sizeof(buffer)) > 0) {
+    }
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,47 @@
+// src/Network/EventPoller.h
+// Readiness-based event loop primitive
+// kqueue on Apple platforms, epoll on Linux; wakeup() may be called from any thread
+
+#pragma once
+#include <vector>
+
+namespace FinalStorm {
+
+struct PollEvent {
+    int fd = -1;
+    bool readable = false;
+    bool writable = false;
+    bool hangup = false;    // Peer closed or socket error; a final read reports which
+};
+
+class EventPoller {
+public:
+    EventPoller();
+    ~EventPoller();
+
+    EventPoller(const EventPoller&) = delete;
+    EventPoller& operator=(const EventPoller&) = delete;
+
+    bool isValid() const { return m_pollFd >= 0; }
+
+    // Interest is level-triggered on both backends
+    bool add(int fd, bool readable, bool writable);
+    bool modify(int fd, bool readable, bool writable);
+    void remove(int fd);
+
+    // Blocks up to timeoutMs (-1 waits forever). Wakeups are consumed
+    // internally and never reported; returns the number of events.
+    int wait(std::vector<PollEvent>& events, int timeoutMs);
+
+    // Interrupts a blocked wait()
+    void wakeup();
+
+private:
+    void drainWakeup();
+
+    int m_pollFd;
+    int m_wakeRead;
+    int m_wakeWrite;
+};
+
+} // namespace FinalStorm
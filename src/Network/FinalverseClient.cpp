@@ -3,12 +3,40 @@
 // Handles connection to Finalverse server
 
 #include "Network/FinalverseClient.h"
+#include "Network/WebSocketClient.h"
+#include "Services/MetricsJitterBuffer.h"
+#include <chrono>
+#include <cstring>
 #include <iostream>
 
 namespace FinalStorm {
 
+namespace {
+
+// How often partially filled archive blocks are written out for readers
+constexpr double kArchiveFlushInterval = 5.0;
+
+// Metrics playback trails the server clock by one 1 Hz update plus jitter
+constexpr double kMetricsPlaybackDelay = 1.25;
+
+// Servers may burst a service's metrics well above 1 Hz (50 Hz under load);
+// playback keeps the full delay's worth of samples up to this rate
+constexpr double kMetricsMaxUpdateRate = 60.0;
+
+} // namespace
+
 FinalverseClient::FinalverseClient()
-    : connected(false) {
+    : connected(false)
+    , closedSinceUpdate(false)
+    , running(false)
+    , outboundBatch(MessageType::Batch)
+    , pingInterval(2.0)
+    , nextPingTime(0.0)
+    , nextArchiveFlushTime(0.0) {
+    MetricsJitterBuffer::Config playbackConfig;
+    playbackConfig.playbackDelay = kMetricsPlaybackDelay;
+    playbackConfig.maxUpdateRate = kMetricsMaxUpdateRate;
+    metricsPlayback = std::make_unique<MetricsJitterBuffer>(playbackConfig);
 }
 
 FinalverseClient::~FinalverseClient() {
@@ -16,37 +44,403 @@ FinalverseClient::~FinalverseClient() {
 }
 
 bool FinalverseClient::connect(const std::string& url) {
-    std::cout << "Connecting to Finalverse server: " << url << std::endl;
+    if (webSocket) {
+        return false;
+    }
     
-    // TODO: Implement WebSocket connection
-    // For now, just mark as connected for testing
+    std::cout << "Connecting to Finalverse server: " << url << std::endl;
     serverUrl = url;
-    connected = true;
+    
+    webSocket = std::make_unique<WebSocketClient>();
+    webSocket->setOpenCallback([this]() {
+        std::cout << "Connected to Finalverse server" << std::endl;
+        connected = true;
+    });
+    webSocket->setMessageCallback([this](WebSocket::Opcode opcode, const uint8_t* data, size_t size) {
+        if (opcode == WebSocket::Opcode::Binary) {
+            receive(data, size);
+        }
+    });
+    webSocket->setCloseCallback([this](const std::string& reason) {
+        std::cout << "Finalverse connection closed: " << reason << std::endl;
+        connected = false;
+        closedSinceUpdate = true;
+    });
+    
+    // The connection is established asynchronously on the network thread
+    running = true;
+    networkThread = std::thread([this]() {
+        if (webSocket->connect(serverUrl)) {
+            webSocket->run(running);
+        }
+    });
     
     return true;
 }
 
 void FinalverseClient::disconnect() {
-    if (connected) {
-        std::cout << "Disconnecting from Finalverse server" << std::endl;
-        connected = false;
+    if (!webSocket) {
+        return;
+    }
+    
+    std::cout << "Disconnecting from Finalverse server" << std::endl;
+    running = false;
+    webSocket->close();
+    if (networkThread.joinable()) {
+        networkThread.join();
     }
+    webSocket.reset();
+    connected = false;
+    
+    std::lock_guard<std::mutex> lock(clockMutex);
+    clockSync.reset();
+    nextPingTime = 0.0;
 }
 
 void FinalverseClient::update() {
-    if (!connected) {
+    // Reported from here so the callback runs on the main thread
+    if (closedSinceUpdate.exchange(false) && disconnectedCallback) {
+        disconnectedCallback();
+    }
+    
+    if (replay) {
+        // Replayed traffic goes through the same queue as live traffic
+        replay->advanceFrame();
+    } else if (!connected) {
+        return;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(receiveMutex);
+        receiveQueue.takeAll(inboundDelivery);
+    }
+    for (const auto& message : inboundDelivery) {
+        handleServiceMessage(message);
+        if (messageCallback) messageCallback(message);
+    }
+    inboundDelivery.clear();
+    
+    if (serviceRecordCallback) {
+        for (uint32_t index : services.getChanged()) {
+            serviceRecordCallback(services.getRecords()[index]);
+        }
+    }
+    services.clearChanged();
+    
+    double now = getLocalTime();
+    if (connected && now >= nextPingTime) {
+        sendPing(now);
+        nextPingTime = now + pingInterval;
+    }
+    
+    if (now >= nextArchiveFlushTime) {
+        std::lock_guard<std::mutex> lock(archiveMutex);
+        if (metricsArchive.isOpen()) metricsArchive.flush();
+        nextArchiveFlushTime = now + kArchiveFlushInterval;
+    }
+    
+    // Anything the callbacks or the scene queued this frame goes out now
+    flushOutbound();
+}
+
+void FinalverseClient::receive(const uint8_t* frame, size_t size) {
+    Message message(MessageType::Ping);
+    if (!message.deserialize(frame, size)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(captureMutex);
+        if (capture) capture->record(message);
+    }
+    // Archived before conflation so history keeps every sample, not one per frame
+    archiveMetrics(message);
+    if (message.getType() == MessageType::Pong) {
+        // Timed here on the network thread so frame time does not skew the round trip
+        handlePong(message, getLocalTime());
+    }
+    enqueue(std::move(message));
+}
+
+void FinalverseClient::handleServiceMessage(const Message& message) {
+    switch (message.getType()) {
+        case MessageType::ServiceList: {
+            if (message.data.empty()) {
+                break;
+            }
+            uint8_t flags = message.data[0];
+            if (flags & ServiceListFirst) {
+                serviceListParser.begin(&services);
+            }
+            if (!serviceListParser.isActive()) {
+                break; // Joined mid-list; wait for the next one
+            }
+            auto result = serviceListParser.feed(message.data.data() + 1, message.data.size() - 1);
+            if (result == ServiceListParser::Result::Error) {
+                std::cerr << "[Network] malformed service list after "
+                          << serviceListParser.getServicesParsed() << " services" << std::endl;
+                serviceListParser.abandon();
+            } else if ((flags & ServiceListLast) && result != ServiceListParser::Result::Complete) {
+                // The server is done with this list; waiting on would leave
+                // the directory mid-list until the next one starts
+                std::cerr << "[Network] service list ended after "
+                          << serviceListParser.getServicesParsed() << " of "
+                          << serviceListParser.getServiceCount() << " services" << std::endl;
+                serviceListParser.abandon();
+            }
+            break;
+        }
+        case MessageType::ServiceUpdate:
+            readServiceStatus(message, services);
+            break;
+        case MessageType::ServiceMetrics:
+            // The directory record holds the fields just parsed in place
+            if (readServiceMetrics(message, services) &&
+                services.getLastCommitted() != ServiceDirectory::NoRecord) {
+                uint32_t index = services.getLastCommitted();
+                const ServiceRecord& record = services.getRecords()[index];
+                ServiceMetrics metrics;
+                metrics.cpuUsage = record.cpuUsage;
+                metrics.memoryUsage = record.memoryUsage;
+                metrics.requestsPerSecond = record.requestsPerSecond;
+                metrics.averageLatency = record.averageLatency;
+                metrics.errorRate = record.errorRate;
+                metrics.activeConnections = record.activeConnections;
+                metricsPlayback->push(index, message.getTimestamp() / 1000.0, metrics);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+bool FinalverseClient::sampleServiceMetrics(const std::string& serviceId, ServiceRecord& out) {
+    const ServiceRecord* record = services.find(serviceId);
+    return record != nullptr && sampleServiceMetrics(services.indexOf(record), out);
+}
+
+bool FinalverseClient::sampleServiceMetrics(uint32_t serviceIndex, ServiceRecord& out) {
+    ServiceMetrics metrics;
+    bool found = hasClockEstimate()
+        ? metricsPlayback->sample(serviceIndex, getServerTime(), metrics)
+        : metricsPlayback->latest(serviceIndex, metrics);
+    if (!found) {
+        return false;
+    }
+    
+    out.cpuUsage = metrics.cpuUsage;
+    out.memoryUsage = metrics.memoryUsage;
+    out.averageLatency = metrics.averageLatency;
+    out.errorRate = metrics.errorRate;
+    out.requestsPerSecond = metrics.requestsPerSecond;
+    out.activeConnections = metrics.activeConnections;
+    return true;
+}
+
+void FinalverseClient::setMetricsPlaybackDelay(double seconds) {
+    metricsPlayback->setPlaybackDelay(seconds);
+}
+
+void FinalverseClient::archiveMetrics(const Message& message) {
+    if (message.getType() != MessageType::ServiceMetrics) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(archiveMutex);
+    if (!metricsArchive.isOpen()) {
+        return;
+    }
+    ServiceMetricsPayload payload;
+    if (!readPayload(message, payload)) {
+        return;
+    }
+    
+    // The archive needs non-decreasing timestamps per series; a sample
+    // older than one already written is dropped
+    int64_t timestamp = static_cast<int64_t>(message.getTimestamp());
+    auto it = archivedUntil.find(payload.serviceId);
+    if (it != archivedUntil.end() && timestamp < it->second) {
+        return;
+    }
+    archivedUntil[payload.serviceId] = timestamp;
+    
+    metricsArchive.append(payload.serviceId, "cpuUsage", timestamp, payload.cpuUsage);
+    metricsArchive.append(payload.serviceId, "memoryUsage", timestamp, payload.memoryUsage);
+    metricsArchive.append(payload.serviceId, "requestsPerSecond", timestamp, static_cast<float>(payload.requestsPerSecond));
+    metricsArchive.append(payload.serviceId, "averageLatency", timestamp, payload.averageLatency);
+    metricsArchive.append(payload.serviceId, "errorRate", timestamp, payload.errorRate);
+    metricsArchive.append(payload.serviceId, "activeConnections", timestamp, static_cast<float>(payload.activeConnections));
+}
+
+void FinalverseClient::enqueue(Message message) {
+    std::lock_guard<std::mutex> lock(receiveMutex);
+    receiveQueue.push(std::move(message));
+}
+
+double FinalverseClient::getServerTime() const {
+    std::lock_guard<std::mutex> lock(clockMutex);
+    return clockSync.toServerTime(getLocalTime());
+}
+
+bool FinalverseClient::hasClockEstimate() const {
+    std::lock_guard<std::mutex> lock(clockMutex);
+    return clockSync.hasEstimate();
+}
+
+double FinalverseClient::getRoundTripTime() const {
+    std::lock_guard<std::mutex> lock(clockMutex);
+    return clockSync.getRoundTripTime();
+}
+
+void FinalverseClient::sendPing(double now) {
+    // The server echoes the payload, so the Pong carries our send time back
+    Message ping(MessageType::Ping);
+    uint64_t sendMicros = static_cast<uint64_t>(now * 1e6);
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&sendMicros);
+    ping.data.assign(bytes, bytes + sizeof(sendMicros));
+    sendMessage(ping);
+}
+
+void FinalverseClient::handlePong(const Message& message, double receiveTime) {
+    uint64_t sendMicros = 0;
+    if (message.data.size() != sizeof(sendMicros)) {
         return;
     }
+    std::memcpy(&sendMicros, message.data.data(), sizeof(sendMicros));
+    
+    std::lock_guard<std::mutex> lock(clockMutex);
+    clockSync.addSample(sendMicros / 1e6, message.getTimestamp() / 1000.0, receiveTime);
+}
+
+double FinalverseClient::getLocalTime() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+InboundConflator::Stats FinalverseClient::getInboundStats() const {
+    std::lock_guard<std::mutex> lock(receiveMutex);
+    return receiveQueue.getStats();
+}
+
+bool FinalverseClient::startCapture(const std::string& path) {
+    auto writer = std::make_unique<NetworkCaptureWriter>();
+    if (!writer->open(path)) return false;
     
-    // TODO: Process incoming messages
+    // Any previous writer is closed outside the lock, off the receive path
+    std::unique_ptr<NetworkCaptureWriter> previous;
+    {
+        std::lock_guard<std::mutex> lock(captureMutex);
+        previous = std::move(capture);
+        capture = std::move(writer);
+    }
+    return true;
+}
+
+void FinalverseClient::stopCapture() {
+    std::unique_ptr<NetworkCaptureWriter> previous;
+    {
+        std::lock_guard<std::mutex> lock(captureMutex);
+        previous = std::move(capture);
+    }
+}
+
+bool FinalverseClient::startReplay(const std::string& path, ReplayMode mode) {
+    auto source = std::make_unique<NetworkReplaySource>();
+    if (!source->open(path, mode)) return false;
+    source->setProtocolMessageSink([this](const Message& message) {
+        archiveMetrics(message);
+        enqueue(message);
+    });
+    replay = std::move(source);
+    return true;
+}
+
+void FinalverseClient::stopReplay() {
+    replay.reset();
+}
+
+ReplayStats FinalverseClient::getReplayStats() const {
+    return replay ? replay->getStats() : ReplayStats{};
+}
+
+bool FinalverseClient::startMetricsArchive(const MetricsArchiveConfig& config) {
+    std::lock_guard<std::mutex> lock(archiveMutex);
+    if (!metricsArchive.open(config)) return false;
+    archivedUntil.clear();
+    nextArchiveFlushTime = getLocalTime() + kArchiveFlushInterval;
+    return true;
+}
+
+void FinalverseClient::stopMetricsArchive() {
+    std::lock_guard<std::mutex> lock(archiveMutex);
+    metricsArchive.close();
+}
+
+bool FinalverseClient::isArchivingMetrics() const {
+    std::lock_guard<std::mutex> lock(archiveMutex);
+    return metricsArchive.isOpen();
 }
 
 void FinalverseClient::sendMessage(const Message& message) {
-    if (!connected) {
+    message.serialize(outboundScratch);
+    outbound.queue(outboundScratch.data(), outboundScratch.size());
+}
+
+void FinalverseClient::sendLatest(const Message& message) {
+    message.serialize(outboundScratch);
+    outbound.queueLatest(std::to_string(static_cast<uint16_t>(message.getType())), outboundScratch.data(), outboundScratch.size());
+}
+
+void FinalverseClient::requestServiceList() {
+    sendLatest(Message(MessageType::ServiceListRequest));
+}
+
+void FinalverseClient::subscribeToService(const std::string& serviceId) {
+    queueSubscription(serviceId, true);
+}
+
+void FinalverseClient::unsubscribeFromService(const std::string& serviceId) {
+    queueSubscription(serviceId, false);
+}
+
+void FinalverseClient::updateSubscriptionTiers(const std::vector<TierUpdateEntry>& changes) {
+    if (changes.empty()) {
+        return;
+    }
+    
+    // Deltas, so they stay ordered rather than coalescing
+    SubscriptionTierPayload payload;
+    payload.entries = changes;
+    Message message(MessageType::SubscriptionTiers);
+    writePayload(message, payload);
+    sendMessage(message);
+}
+
+void FinalverseClient::queueSubscription(const std::string& serviceId, bool subscribe) {
+    Message message(subscribe ? MessageType::Subscribe : MessageType::Unsubscribe);
+    SubscriptionPayload payload;
+    payload.serviceId = serviceId;
+    writePayload(message, payload);
+    
+    message.serialize(outboundScratch);
+    outbound.queueSubscription(serviceId, subscribe, outboundScratch.data(), outboundScratch.size());
+}
+
+void FinalverseClient::flushOutbound() {
+    if (!webSocket || !connected || outbound.empty()) {
         return;
     }
     
-    // TODO: Send message via WebSocket
+    // A lone message goes out as itself; several share one Batch frame
+    outboundBatch.data.clear();
+    size_t count = outbound.flush([this](const uint8_t* data, size_t size) {
+        appendBatchEntry(outboundBatch, data, size);
+    });
+    
+    if (count == 1) {
+        const size_t prefix = sizeof(uint32_t);
+        webSocket->sendBinary(outboundBatch.data.data() + prefix, outboundBatch.data.size() - prefix);
+    } else if (count > 1) {
+        outboundBatch.serialize(outboundFrame);
+        webSocket->sendBinary(outboundFrame.data(), outboundFrame.size());
+    }
 }
 
 } // namespace FinalStorm
\ No newline at end of file
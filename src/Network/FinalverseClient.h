@@ -3,16 +3,34 @@
 // Manages connection to Finalverse server
 
 #pragma once
+#include "Network/MessageProtocol.h"
+#include "Network/ClockSync.h"
+#include "Network/InboundConflator.h"
+#include "Network/NetworkCapture.h"
+#include "Network/OutboundBatcher.h"
+#include "Network/ServiceDirectory.h"
+#include "Network/ServiceListParser.h"
+#include "Services/MetricsArchive.h"
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <unordered_map>
 
 namespace FinalStorm {
 
-class Message;
+class WebSocketClient;
+class MetricsJitterBuffer;
 
 class FinalverseClient {
 public:
+    using MessageCallback = std::function<void(const Message&)>;
+    using ServiceRecordCallback = std::function<void(const ServiceRecord&)>;
+    using DisconnectedCallback = std::function<void()>;
+    
     FinalverseClient();
     ~FinalverseClient();
     
@@ -21,11 +39,116 @@ public:
     bool isConnected() const { return connected; }
     
     void update();
+    
+    // Outbound messages are queued during the frame and flushed as one
+    // batched frame at the end of update(); call from the main thread
     void sendMessage(const Message& message);
+    void sendLatest(const Message& message);    // Replaces an unsent message of the same type
+    void requestServiceList();
+    void subscribeToService(const std::string& serviceId);
+    void unsubscribeFromService(const std::string& serviceId);
+    void updateSubscriptionTiers(const std::vector<TierUpdateEntry>& changes);
+    void setOutboundByteBudget(size_t bytes) { outbound.setByteBudget(bytes); }
+    const OutboundBatcher::Stats& getOutboundStats() const { return outbound.getStats(); }
+    void setMessageCallback(MessageCallback callback) { messageCallback = callback; }
+    
+    // Runs from the next update() after the connection closes. The server
+    // forgets per-connection state such as subscription tiers with it.
+    void setDisconnectedCallback(DisconnectedCallback callback) { disconnectedCallback = callback; }
+    
+    // Services known from ServiceList, ServiceUpdate and ServiceMetrics
+    // messages. The callback runs once per changed service per update().
+    const ServiceDirectory& getServiceDirectory() const { return services; }
+    void setServiceRecordCallback(ServiceRecordCallback callback) { serviceRecordCallback = callback; }
+    
+    // Inbound ServiceMetrics are also buffered for smooth playback. Fills the
+    // metric fields of out as of getServerTime() minus the playback delay,
+    // interpolated between the samples around it; before the first clock
+    // estimate, the newest sample. Sample each frame, not on arrival.
+    bool sampleServiceMetrics(const std::string& serviceId, ServiceRecord& out);
+    bool sampleServiceMetrics(uint32_t serviceIndex, ServiceRecord& out);     // ServiceDirectory record index
+    void setMetricsPlaybackDelay(double seconds);
+    
+    // Called by the transport for every inbound frame (any thread). The
+    // frame is read in place; only the payload is copied, into the queued Message.
+    void receive(const uint8_t* frame, size_t size);
+    
+    // Inbound metrics are conflated per service between updates
+    InboundConflator::Stats getInboundStats() const;
+    
+    // Server clock, estimated from periodic Ping/Pong round trips. Message
+    // timestamps are server milliseconds, so getServerTime() * 1000 is
+    // directly comparable to them.
+    double getServerTime() const;
+    bool hasClockEstimate() const;
+    double getRoundTripTime() const;
+    void setPingInterval(double seconds) { pingInterval = seconds; }
+    
+    // Capture and replay of the inbound stream
+    bool startCapture(const std::string& path);
+    void stopCapture();
+    bool startReplay(const std::string& path, ReplayMode mode = ReplayMode::RecordedSpeed);
+    void stopReplay();
+    bool isReplaying() const { return replay != nullptr; }
+    ReplayStats getReplayStats() const;
+    
+    // While open, every inbound ServiceMetrics message is appended to the
+    // archive under the server timestamp. Partial blocks are flushed every
+    // few seconds, so a MetricsArchiveReader on the same directory lags
+    // live data by at most that much.
+    bool startMetricsArchive(const MetricsArchiveConfig& config);
+    void stopMetricsArchive();
+    bool isArchivingMetrics() const;
     
 private:
+    void enqueue(Message message);
+    void handleServiceMessage(const Message& message);
+    void queueSubscription(const std::string& serviceId, bool subscribe);
+    void flushOutbound();
+    void sendPing(double now);
+    void handlePong(const Message& message, double receiveTime);
+    void archiveMetrics(const Message& message);
+    static double getLocalTime();
+    
     std::string serverUrl;
-    bool connected;
+    std::atomic<bool> connected;
+    std::atomic<bool> closedSinceUpdate;    // Set by the close callback on the network thread
+    
+    std::unique_ptr<WebSocketClient> webSocket;
+    std::thread networkThread;
+    std::atomic<bool> running;
+    
+    MessageCallback messageCallback;
+    ServiceRecordCallback serviceRecordCallback;
+    DisconnectedCallback disconnectedCallback;
+    InboundConflator receiveQueue;
+    std::vector<Message> inboundDelivery;   // Reused each update
+    mutable std::mutex receiveMutex;
+    
+    OutboundBatcher outbound;
+    std::vector<uint8_t> outboundScratch;   // One queued message, serialized before the batcher copies it
+    Message outboundBatch;
+    std::vector<uint8_t> outboundFrame;     // The Batch frame, rewritten each flush
+    
+    ClockSync clockSync;
+    mutable std::mutex clockMutex;
+    double pingInterval;
+    double nextPingTime;
+    
+    ServiceDirectory services;
+    ServiceListParser serviceListParser;
+    std::unique_ptr<MetricsJitterBuffer> metricsPlayback;
+    
+    // Recorded on the network thread, started and stopped on the main thread
+    std::unique_ptr<NetworkCaptureWriter> capture;
+    std::mutex captureMutex;
+    std::unique_ptr<NetworkReplaySource> replay;
+    
+    // Appended on the network thread, flushed, opened and closed on the main thread
+    MetricsArchiveWriter metricsArchive;
+    mutable std::mutex archiveMutex;
+    std::unordered_map<std::string, int64_t> archivedUntil;    // Newest archived timestamp per service
+    double nextArchiveFlushTime;
 };
 
 } // namespace FinalStorm
\ No newline at end of file
@@ -0,0 +1,81 @@
+// src/Network/InboundConflator.cpp
+// Inbound conflation queue implementation
+
+#include "Network/InboundConflator.h"
+#include <cstring>
+
+namespace FinalStorm {
+
+InboundConflator::InboundConflator()
+    : m_frontPosition(0)
+    , m_liveCount(0) {
+}
+
+void InboundConflator::push(Message&& message) {
+    m_stats.received++;
+    uint64_t position = m_frontPosition + m_entries.size();
+
+    if (message.getType() == MessageType::ServiceMetrics && peekServiceId(message, m_keyScratch)) {
+        auto it = m_latestMetrics.find(m_keyScratch);
+        if (it != m_latestMetrics.end()) {
+            Entry& previous = m_entries[static_cast<size_t>(it->second - m_frontPosition)];
+            mergeMetrics(message, previous.message);
+            previous.live = false;
+            previous.message.data.clear();
+            m_liveCount--;
+            m_stats.conflated++;
+            it->second = position;
+        } else {
+            m_latestMetrics.emplace(m_keyScratch, position);
+        }
+    }
+
+    m_entries.push_back(Entry{ std::move(message), true });
+    m_liveCount++;
+}
+
+void InboundConflator::takeAll(std::vector<Message>& out) {
+    for (auto& entry : m_entries) {
+        if (entry.live) {
+            out.push_back(std::move(entry.message));
+            m_stats.delivered++;
+        }
+    }
+    clear();
+}
+
+void InboundConflator::clear() {
+    m_frontPosition += m_entries.size();
+    m_entries.clear();
+    m_latestMetrics.clear();
+    m_liveCount = 0;
+}
+
+bool InboundConflator::peekServiceId(const Message& message, std::string& serviceId) {
+    // ServiceMetricsPayload starts with its u16 length-prefixed service id
+    uint16_t length = 0;
+    if (message.data.size() < sizeof(length)) return false;
+    std::memcpy(&length, message.data.data(), sizeof(length));
+    if (message.data.size() < sizeof(length) + length) return false;
+    serviceId.assign(reinterpret_cast<const char*>(message.data.data() + sizeof(length)), length);
+    return true;
+}
+
+void InboundConflator::mergeMetrics(Message& newer, const Message& older) {
+    // Same service, so the id and every field offset match; errorRate follows
+    // cpuUsage, memoryUsage, requestsPerSecond and averageLatency
+    uint16_t idLength = 0;
+    std::memcpy(&idLength, newer.data.data(), sizeof(idLength));
+    size_t offset = sizeof(idLength) + idLength + 4 * sizeof(float);
+    if (newer.data.size() < offset + sizeof(float) || older.data.size() < offset + sizeof(float)) return;
+
+    float newerRate = 0.0f;
+    float olderRate = 0.0f;
+    std::memcpy(&newerRate, newer.data.data() + offset, sizeof(float));
+    std::memcpy(&olderRate, older.data.data() + offset, sizeof(float));
+    if (olderRate > newerRate) {
+        std::memcpy(newer.data.data() + offset, &olderRate, sizeof(float));
+    }
+}
+
+} // namespace FinalStorm
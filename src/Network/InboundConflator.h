@@ -0,0 +1,58 @@
+// src/Network/InboundConflator.h
+// Inbound message queue with latest-value conflation
+// Keeps only the newest metrics per service; discrete messages stay in order
+
+#pragma once
+#include "Network/MessageProtocol.h"
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace FinalStorm {
+
+class InboundConflator {
+public:
+    struct Stats {
+        uint64_t received = 0;
+        uint64_t conflated = 0;     // Superseded before delivery
+        uint64_t delivered = 0;
+    };
+
+    InboundConflator();
+
+    // ServiceMetrics replace any undelivered metrics for the same service and
+    // move to the back of the queue, so the newest value still follows every
+    // message that arrived before it. errorRate keeps the peak of the
+    // replaced values so a short spike is not lost. Everything else,
+    // including status changes and connects, is delivered in arrival order.
+    void push(Message&& message);
+
+    // Moves every live message, in order, to the end of out and empties the queue
+    void takeAll(std::vector<Message>& out);
+
+    bool empty() const { return m_liveCount == 0; }
+    size_t size() const { return m_liveCount; }
+    void clear();
+
+    const Stats& getStats() const { return m_stats; }
+
+private:
+    struct Entry {
+        Message message;
+        bool live;
+    };
+
+    static bool peekServiceId(const Message& message, std::string& serviceId);
+    static void mergeMetrics(Message& newer, const Message& older);
+
+    std::deque<Entry> m_entries;
+    std::unordered_map<std::string, uint64_t> m_latestMetrics;   // Service id -> position
+    uint64_t m_frontPosition;   // Position of m_entries.front()
+    size_t m_liveCount;
+    std::string m_keyScratch;
+    Stats m_stats;
+};
+
+} // namespace FinalStorm
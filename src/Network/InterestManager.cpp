@@ -0,0 +1,177 @@
+// src/Network/InterestManager.cpp
+// Camera-driven interest management implementation
+
+#include "Network/InterestManager.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace FinalStorm {
+
+InterestManager::InterestManager()
+    : InterestManager(Config()) {
+}
+
+InterestManager::InterestManager(const Config& config)
+    : m_config(config)
+    , m_frame(0) {
+}
+
+void InterestManager::update(const InterestView& view, const std::vector<InterestCandidate>& candidates, float deltaTime) {
+    m_changes.clear();
+    ++m_frame;
+
+    // Pass 1: the tier each service would like based on this frame's view
+    for (const auto& candidate : candidates) {
+        ServiceInterest& interest = m_services[candidate.serviceId];
+        interest.lastSeenFrame = m_frame;
+
+        bool onScreen = false;
+        interest.screenSize = projectedSize(view, candidate, onScreen);
+        interest.desired = classify(interest.screenSize, interest.tier);
+        if (!onScreen && interest.desired > m_config.offscreenTier) {
+            interest.desired = m_config.offscreenTier;
+        }
+    }
+
+    limitFullTier();
+
+    // Pass 2: apply promotions immediately, demotions once they have persisted
+    for (auto it = m_services.begin(); it != m_services.end();) {
+        ServiceInterest& interest = it->second;
+
+        if (interest.lastSeenFrame != m_frame) {
+            // No longer on any ring
+            setTier(it->first, interest, SubscriptionTier::None);
+            it = m_services.erase(it);
+            continue;
+        }
+
+        if (!interest.announced) {
+            // Until told otherwise the server sends Full, so the first tier
+            // goes out at once, even when it is None
+            setTier(it->first, interest, interest.desired);
+        } else if (interest.desired > interest.tier) {
+            setTier(it->first, interest, interest.desired);
+        } else if (interest.desired < interest.tier) {
+            if (interest.pending != interest.desired) {
+                interest.pending = interest.desired;
+                interest.pendingTime = 0.0f;
+            }
+            interest.pendingTime += deltaTime;
+            if (interest.pendingTime >= m_config.demotionDelay) {
+                setTier(it->first, interest, interest.desired);
+            }
+        } else {
+            interest.pending = interest.tier;
+            interest.pendingTime = 0.0f;
+        }
+        ++it;
+    }
+}
+
+SubscriptionTier InterestManager::getTier(const std::string& serviceId) const {
+    auto it = m_services.find(serviceId);
+    return it != m_services.end() ? it->second.tier : SubscriptionTier::None;
+}
+
+size_t InterestManager::getTierCount(SubscriptionTier tier) const {
+    size_t count = 0;
+    for (const auto& entry : m_services) {
+        if (entry.second.tier == tier) count++;
+    }
+    return count;
+}
+
+void InterestManager::reset() {
+    m_services.clear();
+    m_changes.clear();
+}
+
+float InterestManager::projectedSize(const InterestView& view, const InterestCandidate& candidate, bool& onScreen) const {
+    vec3 offset = candidate.position - view.cameraPosition;
+    float distance = length(offset);
+    if (distance <= candidate.radius) {
+        onScreen = true;
+        return 1.0f; // Camera is inside the service's bounds
+    }
+
+    // Clip-space test, padded by the radius so partially visible services count
+    vec4 clip = view.viewProjection * make_vec4(candidate.position, 1.0f);
+    float pad = candidate.radius * 2.0f;
+    onScreen = clip.w > -candidate.radius &&
+               std::fabs(clip.x) <= clip.w + pad &&
+               std::fabs(clip.y) <= clip.w + pad;
+
+    float halfHeight = distance * std::tan(view.fieldOfViewY * 0.5f);
+    return halfHeight > 0.0f ? candidate.radius / halfHeight : 0.0f;
+}
+
+SubscriptionTier InterestManager::classify(float screenSize, SubscriptionTier current) const {
+    static const SubscriptionTier tiers[] = {
+        SubscriptionTier::Full, SubscriptionTier::Reduced, SubscriptionTier::Summary
+    };
+
+    for (SubscriptionTier tier : tiers) {
+        float threshold = entryThreshold(tier);
+        if (tier <= current) {
+            threshold *= 1.0f - m_config.hysteresis;
+        }
+        if (screenSize >= threshold) {
+            return tier;
+        }
+    }
+    return SubscriptionTier::None;
+}
+
+float InterestManager::entryThreshold(SubscriptionTier tier) const {
+    switch (tier) {
+        case SubscriptionTier::Full: return m_config.fullThreshold;
+        case SubscriptionTier::Reduced: return m_config.reducedThreshold;
+        case SubscriptionTier::Summary: return m_config.summaryThreshold;
+        case SubscriptionTier::None: break;
+    }
+    return 0.0f;
+}
+
+void InterestManager::limitFullTier() {
+    m_fullSizes.clear();
+    for (const auto& entry : m_services) {
+        if (entry.second.lastSeenFrame == m_frame && entry.second.desired == SubscriptionTier::Full) {
+            m_fullSizes.push_back(entry.second.screenSize);
+        }
+    }
+    if (m_fullSizes.size() <= m_config.maxFullTier) return;
+
+    if (m_config.maxFullTier == 0) {
+        for (auto& entry : m_services) {
+            if (entry.second.desired == SubscriptionTier::Full) entry.second.desired = SubscriptionTier::Reduced;
+        }
+        return;
+    }
+
+    // Keep the largest maxFullTier; ties at the cutoff all stay Full
+    auto cutoff = m_fullSizes.begin() + (m_config.maxFullTier - 1);
+    std::nth_element(m_fullSizes.begin(), cutoff, m_fullSizes.end(), std::greater<float>());
+    float minimumSize = *cutoff;
+
+    for (auto& entry : m_services) {
+        ServiceInterest& interest = entry.second;
+        if (interest.lastSeenFrame == m_frame && interest.desired == SubscriptionTier::Full &&
+            interest.screenSize < minimumSize) {
+            interest.desired = SubscriptionTier::Reduced;
+        }
+    }
+}
+
+void InterestManager::setTier(const std::string& serviceId, ServiceInterest& interest, SubscriptionTier tier) {
+    interest.pending = tier;
+    interest.pendingTime = 0.0f;
+    if (interest.announced && interest.tier == tier) return;
+
+    interest.tier = tier;
+    interest.announced = true;
+    m_changes.push_back(TierUpdateEntry{ serviceId, tier });
+}
+
+} // namespace FinalStorm
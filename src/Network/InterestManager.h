@@ -0,0 +1,89 @@
+// src/Network/InterestManager.h
+// Camera-driven interest management for service metric subscriptions
+// Maps each service's on-screen size to a subscription tier with hysteresis
+
+#pragma once
+#include "Core/Math/MathTypes.h"
+#include "Network/MessageProtocol.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace FinalStorm {
+
+struct InterestCandidate {
+    std::string serviceId;
+    vec3 position;      // World space
+    float radius;       // Bounding radius in world units
+};
+
+struct InterestView {
+    vec3 cameraPosition;
+    mat4 viewProjection;
+    float fieldOfViewY;     // Radians
+};
+
+class InterestManager {
+public:
+    struct Config {
+        // Projected diameter, as a fraction of viewport height, needed to enter each tier
+        float fullThreshold = 0.10f;
+        float reducedThreshold = 0.04f;
+        float summaryThreshold = 0.01f;
+
+        // Keeping a tier only needs (1 - hysteresis) of its entry threshold
+        float hysteresis = 0.3f;
+
+        // Promotions apply at once; a lower tier must persist this long first
+        float demotionDelay = 0.75f;
+
+        // Highest tier for services outside the view frustum
+        SubscriptionTier offscreenTier = SubscriptionTier::Summary;
+
+        // When more services qualify for Full, the largest on screen win
+        size_t maxFullTier = 32;
+    };
+
+    InterestManager();
+    explicit InterestManager(const Config& config);
+
+    // Reclassifies every candidate; services missing from candidates drop to None.
+    // Changes from this call are available from getChanges() until the next one.
+    void update(const InterestView& view, const std::vector<InterestCandidate>& candidates, float deltaTime);
+
+    const std::vector<TierUpdateEntry>& getChanges() const { return m_changes; }
+    SubscriptionTier getTier(const std::string& serviceId) const;
+    size_t getTierCount(SubscriptionTier tier) const;
+
+    // Forget all tiers (e.g. after reconnecting) so the next update re-announces
+    // them. A service's first classification is always announced, None included.
+    void reset();
+
+    void setConfig(const Config& config) { m_config = config; }
+    const Config& getConfig() const { return m_config; }
+
+private:
+    struct ServiceInterest {
+        SubscriptionTier tier = SubscriptionTier::None;
+        SubscriptionTier desired = SubscriptionTier::None;
+        SubscriptionTier pending = SubscriptionTier::None;
+        float pendingTime = 0.0f;
+        float screenSize = 0.0f;
+        uint64_t lastSeenFrame = 0;
+        bool announced = false;     // The server treats a service it has no tier for as Full
+    };
+
+    float projectedSize(const InterestView& view, const InterestCandidate& candidate, bool& onScreen) const;
+    SubscriptionTier classify(float screenSize, SubscriptionTier current) const;
+    float entryThreshold(SubscriptionTier tier) const;
+    void limitFullTier();
+    void setTier(const std::string& serviceId, ServiceInterest& interest, SubscriptionTier tier);
+
+    Config m_config;
+    std::unordered_map<std::string, ServiceInterest> m_services;
+    std::vector<TierUpdateEntry> m_changes;
+    std::vector<float> m_fullSizes;
+    uint64_t m_frame;
+};
+
+} // namespace FinalStorm
@@ -14,7 +14,11 @@ Message::Message(MessageType t)
 
 std::vector<uint8_t> Message::serialize() const {
     std::vector<uint8_t> buffer;
-    
+    serialize(buffer);
+    return buffer;
+}
+
+void Message::serialize(std::vector<uint8_t>& buffer) const {
     // Simple serialization - in production use protobuf or similar
     buffer.resize(sizeof(MessageType) + sizeof(uint64_t) + data.size());
     
@@ -28,29 +32,234 @@ std::vector<uint8_t> Message::serialize() const {
     if (!data.empty()) {
         memcpy(buffer.data() + offset, data.data(), data.size());
     }
-    
-    return buffer;
 }
 
-bool Message::deserialize(const std::vector<uint8_t>& buffer) {
-    if (buffer.size() < sizeof(MessageType) + sizeof(uint64_t)) {
+bool Message::deserialize(const uint8_t* bytes, size_t size) {
+    if (size < sizeof(MessageType) + sizeof(uint64_t)) {
         return false;
     }
     
     size_t offset = 0;
-    memcpy(&type, buffer.data() + offset, sizeof(MessageType));
+    memcpy(&type, bytes + offset, sizeof(MessageType));
     offset += sizeof(MessageType);
     
-    memcpy(&timestamp, buffer.data() + offset, sizeof(uint64_t));
+    memcpy(&timestamp, bytes + offset, sizeof(uint64_t));
     offset += sizeof(uint64_t);
     
-    size_t dataSize = buffer.size() - offset;
-    if (dataSize > 0) {
-        data.resize(dataSize);
-        memcpy(data.data(), buffer.data() + offset, dataSize);
-    }
+    data.assign(bytes + offset, bytes + size);
     
     return true;
 }
 
+// ============================================================================
+// Typed payloads
+// ============================================================================
+
+namespace {
+
+class PayloadWriter {
+public:
+    explicit PayloadWriter(std::vector<uint8_t>& out) : m_out(out) { m_out.clear(); }
+
+    template<typename T>
+    void write(const T& value) {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+        m_out.insert(m_out.end(), bytes, bytes + sizeof(T));
+    }
+
+    void writeString(const std::string& value) {
+        uint16_t length = static_cast<uint16_t>(value.size() > 0xFFFF ? 0xFFFF : value.size());
+        write(length);
+        m_out.insert(m_out.end(), value.begin(), value.begin() + length);
+    }
+
+private:
+    std::vector<uint8_t>& m_out;
+};
+
+class PayloadReader {
+public:
+    explicit PayloadReader(const std::vector<uint8_t>& in) : m_in(in), m_offset(0), m_ok(true) {}
+
+    template<typename T>
+    void read(T& value) {
+        if (!m_ok || m_offset + sizeof(T) > m_in.size()) {
+            m_ok = false;
+            return;
+        }
+        memcpy(&value, m_in.data() + m_offset, sizeof(T));
+        m_offset += sizeof(T);
+    }
+
+    void readString(std::string& value) {
+        uint16_t length = 0;
+        read(length);
+        if (!m_ok || m_offset + length > m_in.size()) {
+            m_ok = false;
+            return;
+        }
+        value.assign(reinterpret_cast<const char*>(m_in.data() + m_offset), length);
+        m_offset += length;
+    }
+
+    bool ok() const { return m_ok; }
+
+private:
+    const std::vector<uint8_t>& m_in;
+    size_t m_offset;
+    bool m_ok;
+};
+
+} // namespace
+
+void writePayload(Message& message, const ServiceMetricsPayload& payload) {
+    PayloadWriter writer(message.data);
+    writer.writeString(payload.serviceId);
+    writer.write(payload.cpuUsage);
+    writer.write(payload.memoryUsage);
+    writer.write(payload.requestsPerSecond);
+    writer.write(payload.averageLatency);
+    writer.write(payload.errorRate);
+    writer.write(payload.activeConnections);
+}
+
+void writePayload(Message& message, const ServiceStatusPayload& payload) {
+    PayloadWriter writer(message.data);
+    writer.writeString(payload.serviceId);
+    writer.writeString(payload.serviceName);
+    writer.writeString(payload.serviceType);
+    writer.write(static_cast<uint8_t>(payload.status));
+}
+
+void writePayload(Message& message, const EntityUpdatePayload& payload) {
+    PayloadWriter writer(message.data);
+    writer.write(payload.entityId);
+    writer.write(payload.position);
+    writer.write(payload.rotation);
+    writer.write(payload.velocity);
+}
+
+void writePayload(Message& message, const SubscriptionPayload& payload) {
+    PayloadWriter writer(message.data);
+    writer.writeString(payload.serviceId);
+}
+
+void writePayload(Message& message, const ClientStatusPayload& payload) {
+    PayloadWriter writer(message.data);
+    writer.writeString(payload.sceneType);
+    writer.write(payload.activeServices);
+    writer.write(payload.systemActivity);
+    writer.write(payload.harmonyLevel);
+}
+
+void writePayload(Message& message, const SubscriptionTierPayload& payload) {
+    PayloadWriter writer(message.data);
+    writer.write(static_cast<uint16_t>(payload.entries.size()));
+    for (const auto& entry : payload.entries) {
+        writer.writeString(entry.serviceId);
+        writer.write(static_cast<uint8_t>(entry.tier));
+    }
+}
+
+bool readPayload(const Message& message, ServiceMetricsPayload& payload) {
+    if (message.getType() != MessageType::ServiceMetrics) return false;
+    PayloadReader reader(message.data);
+    reader.readString(payload.serviceId);
+    reader.read(payload.cpuUsage);
+    reader.read(payload.memoryUsage);
+    reader.read(payload.requestsPerSecond);
+    reader.read(payload.averageLatency);
+    reader.read(payload.errorRate);
+    reader.read(payload.activeConnections);
+    return reader.ok();
+}
+
+bool readPayload(const Message& message, ServiceStatusPayload& payload) {
+    if (message.getType() != MessageType::ServiceUpdate) return false;
+    PayloadReader reader(message.data);
+    uint8_t status = 0;
+    reader.readString(payload.serviceId);
+    reader.readString(payload.serviceName);
+    reader.readString(payload.serviceType);
+    reader.read(status);
+    payload.status = static_cast<ServiceStatus>(status);
+    return reader.ok();
+}
+
+bool readPayload(const Message& message, EntityUpdatePayload& payload) {
+    if (message.getType() != MessageType::EntityUpdate) return false;
+    PayloadReader reader(message.data);
+    reader.read(payload.entityId);
+    reader.read(payload.position);
+    reader.read(payload.rotation);
+    reader.read(payload.velocity);
+    return reader.ok();
+}
+
+bool readPayload(const Message& message, SubscriptionPayload& payload) {
+    if (message.getType() != MessageType::Subscribe &&
+        message.getType() != MessageType::Unsubscribe) return false;
+    PayloadReader reader(message.data);
+    reader.readString(payload.serviceId);
+    return reader.ok();
+}
+
+bool readPayload(const Message& message, ClientStatusPayload& payload) {
+    if (message.getType() != MessageType::ClientStatus) return false;
+    PayloadReader reader(message.data);
+    reader.readString(payload.sceneType);
+    reader.read(payload.activeServices);
+    reader.read(payload.systemActivity);
+    reader.read(payload.harmonyLevel);
+    return reader.ok();
+}
+
+bool readPayload(const Message& message, SubscriptionTierPayload& payload) {
+    if (message.getType() != MessageType::SubscriptionTiers) return false;
+    PayloadReader reader(message.data);
+    uint16_t count = 0;
+    reader.read(count);
+    payload.entries.resize(count);
+    for (auto& entry : payload.entries) {
+        uint8_t tier = 0;
+        reader.readString(entry.serviceId);
+        reader.read(tier);
+        entry.tier = static_cast<SubscriptionTier>(tier);
+    }
+    return reader.ok();
+}
+
+// ============================================================================
+// Batches
+// ============================================================================
+
+void appendBatchEntry(Message& batch, const uint8_t* data, size_t size) {
+    uint32_t length = static_cast<uint32_t>(size);
+    size_t offset = batch.data.size();
+    batch.data.resize(offset + sizeof(length) + size);
+    memcpy(batch.data.data() + offset, &length, sizeof(length));
+    if (size > 0) {
+        memcpy(batch.data.data() + offset + sizeof(length), data, size);
+    }
+}
+
+bool readBatch(const Message& batch, std::vector<Message>& messages) {
+    if (batch.getType() != MessageType::Batch) return false;
+
+    size_t offset = 0;
+    while (offset < batch.data.size()) {
+        uint32_t length = 0;
+        if (batch.data.size() - offset < sizeof(length)) return false;
+        memcpy(&length, batch.data.data() + offset, sizeof(length));
+        offset += sizeof(length);
+        if (batch.data.size() - offset < length) return false;
+
+        Message message(MessageType::Ping);
+        if (!message.deserialize(batch.data.data() + offset, length)) return false;
+        offset += length;
+        messages.push_back(std::move(message));
+    }
+    return true;
+}
+
 } // namespace FinalStorm
\ No newline at end of file
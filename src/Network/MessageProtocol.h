@@ -5,6 +5,7 @@
 #pragma once
 #include <vector>
 #include <cstdint>
+#include <string>
 
 namespace FinalStorm {
 
@@ -17,8 +18,15 @@ enum class MessageType : uint16_t {
     EntityUpdate = 11,
     ServiceUpdate = 20,
     ServiceMetrics = 21,
+    ServiceListRequest = 22,
+    Subscribe = 23,
+    Unsubscribe = 24,
+    ClientStatus = 25,
+    SubscriptionTiers = 26,
+    ServiceList = 27,       // Chunked service list stream, see ServiceListParser.h
     WorldData = 30,
-    ChatMessage = 40
+    ChatMessage = 40,
+    Batch = 50
 };
 
 class Message {
@@ -30,7 +38,9 @@ public:
     uint64_t getTimestamp() const { return timestamp; }
     
     std::vector<uint8_t> serialize() const;
-    bool deserialize(const std::vector<uint8_t>& buffer);
+    void serialize(std::vector<uint8_t>& out) const;    // Replaces out's contents, keeping its capacity
+    bool deserialize(const std::vector<uint8_t>& buffer) { return deserialize(buffer.data(), buffer.size()); }
+    bool deserialize(const uint8_t* bytes, size_t size);    // Copies the payload once, into data
     
     std::vector<uint8_t> data;
     
@@ -39,4 +49,87 @@ private:
     uint64_t timestamp;
 };
 
+// ============================================================================
+// Typed payloads carried in Message::data
+// Little-endian fields; strings are u16 length-prefixed.
+// ============================================================================
+
+enum class ServiceStatus : uint8_t {
+    Offline = 0,
+    Online = 1,
+    Degraded = 2
+};
+
+struct ServiceMetricsPayload {
+    std::string serviceId;
+    float cpuUsage = 0.0f;          // 0-100%
+    float memoryUsage = 0.0f;       // 0-100%
+    uint32_t requestsPerSecond = 0;
+    float averageLatency = 0.0f;    // milliseconds
+    float errorRate = 0.0f;         // 0-100%
+    uint32_t activeConnections = 0;
+};
+
+struct ServiceStatusPayload {
+    std::string serviceId;
+    std::string serviceName;
+    std::string serviceType;
+    ServiceStatus status = ServiceStatus::Online;
+};
+
+struct EntityUpdatePayload {
+    uint32_t entityId = 0;
+    float position[3] = { 0.0f, 0.0f, 0.0f };
+    float rotation[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    float velocity[3] = { 0.0f, 0.0f, 0.0f };
+};
+
+struct SubscriptionPayload {
+    std::string serviceId;
+};
+
+// Metric delivery level requested per service, lowest to highest rate
+enum class SubscriptionTier : uint8_t {
+    None = 0,
+    Summary = 1,
+    Reduced = 2,
+    Full = 3
+};
+
+struct TierUpdateEntry {
+    std::string serviceId;
+    SubscriptionTier tier = SubscriptionTier::None;
+};
+
+// Only services whose tier changed are listed
+struct SubscriptionTierPayload {
+    std::vector<TierUpdateEntry> entries;
+};
+
+struct ClientStatusPayload {
+    std::string sceneType;
+    uint32_t activeServices = 0;
+    float systemActivity = 0.0f;
+    float harmonyLevel = 0.0f;
+};
+
+void writePayload(Message& message, const ServiceMetricsPayload& payload);
+void writePayload(Message& message, const ServiceStatusPayload& payload);
+void writePayload(Message& message, const EntityUpdatePayload& payload);
+void writePayload(Message& message, const SubscriptionPayload& payload);
+void writePayload(Message& message, const ClientStatusPayload& payload);
+void writePayload(Message& message, const SubscriptionTierPayload& payload);
+
+bool readPayload(const Message& message, ServiceMetricsPayload& payload);
+bool readPayload(const Message& message, ServiceStatusPayload& payload);
+bool readPayload(const Message& message, EntityUpdatePayload& payload);
+bool readPayload(const Message& message, SubscriptionPayload& payload);
+bool readPayload(const Message& message, ClientStatusPayload& payload);
+bool readPayload(const Message& message, SubscriptionTierPayload& payload);
+
+// Batch messages carry several serialized messages in one frame:
+// data is a sequence of [u32 length][Message::serialize() bytes]
+void appendBatchEntry(Message& batch, const uint8_t* data, size_t size);
+bool readBatch(const Message& batch, std::vector<Message>& messages);
+
 } // namespace FinalStorm
\ No newline at end of file
@@ -0,0 +1,133 @@
+// src/Network/NetworkCapture.h
+// Inbound network stream capture and replay
+// Records arriving messages with arrival times and feeds them back for load testing
+
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <chrono>
+
+namespace FinalStorm {
+
+struct NetworkMessage;
+class Message;
+
+enum class ReplayMode {
+    RecordedSpeed,      // Deliver messages when their recorded arrival time is reached
+    AsFastAsPossible    // Advance the replay clock one frame interval per update
+};
+
+struct ReplayStats {
+    uint64_t frames = 0;
+    uint64_t messages = 0;
+    uint64_t bytes = 0;
+    double recordedSeconds = 0.0;
+    double wallSeconds = 0.0;
+
+    // Wall-clock time between consecutive replay frames, in milliseconds
+    double minFrameMs = 0.0;
+    double maxFrameMs = 0.0;
+    double averageFrameMs = 0.0;
+    double p50FrameMs = 0.0;
+    double p95FrameMs = 0.0;
+    double p99FrameMs = 0.0;
+
+    std::string toString() const;
+};
+
+// ============================================================================
+// NetworkCaptureWriter - appends inbound messages to a compact binary log.
+// Safe to call from the network thread.
+// ============================================================================
+
+class NetworkCaptureWriter {
+public:
+    NetworkCaptureWriter();
+    ~NetworkCaptureWriter();
+
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return m_stream.is_open(); }
+
+    void record(const NetworkMessage& message);
+    void record(const Message& message);
+
+    uint64_t getRecordCount() const { return m_recordCount; }
+
+private:
+    void writeRecordHeader(uint8_t kind);
+
+    std::ofstream m_stream;
+    std::mutex m_mutex;
+    std::chrono::steady_clock::time_point m_startTime;
+    uint64_t m_lastArrival;
+    uint64_t m_recordCount;
+    std::vector<uint8_t> m_scratch;
+};
+
+// ============================================================================
+// NetworkReplaySource - reads a capture log back frame by frame
+// ============================================================================
+
+class NetworkReplaySource {
+public:
+    using NetworkMessageSink = std::function<void(const NetworkMessage&)>;
+    using ProtocolMessageSink = std::function<void(const Message&)>;
+
+    NetworkReplaySource();
+    ~NetworkReplaySource();
+
+    bool open(const std::string& path, ReplayMode mode, double frameInterval = 1.0 / 60.0);
+    void close();
+    bool isOpen() const { return m_stream.is_open(); }
+    bool isFinished() const { return m_finished; }
+
+    void setNetworkMessageSink(NetworkMessageSink sink) { m_networkSink = sink; }
+    void setProtocolMessageSink(ProtocolMessageSink sink) { m_protocolSink = sink; }
+
+    // Call once per frame. Delivers every record due by the replay clock and
+    // returns the number delivered.
+    size_t advanceFrame();
+
+    ReplayStats getStats() const;
+
+private:
+    bool readNextRecord();
+    bool readLength(uint64_t& size);    // False past kMaxRecordBytes or the end of the file
+    void deliverPending();
+
+    std::ifstream m_stream;
+    uint64_t m_fileSize;
+    ReplayMode m_mode;
+    double m_frameInterval;
+    bool m_finished;
+
+    NetworkMessageSink m_networkSink;
+    ProtocolMessageSink m_protocolSink;
+
+    // Lookahead record
+    bool m_hasPending;
+    uint8_t m_pendingKind;
+    uint64_t m_pendingArrival;
+    std::string m_pendingType;
+    std::string m_pendingPayload;
+    double m_pendingTimestamp;
+    std::vector<uint8_t> m_pendingBytes;
+
+    // Clocks
+    uint64_t m_replayClock;       // microseconds into the capture
+    std::chrono::steady_clock::time_point m_wallStart;
+    std::chrono::steady_clock::time_point m_lastFrame;
+    bool m_started;
+
+    // Statistics
+    std::vector<float> m_frameTimes;
+    uint64_t m_messageCount;
+    uint64_t m_byteCount;
+};
+
+} // namespace FinalStorm
@@ -1,24 +1,12 @@
 #include "Network/NetworkClient.h"
+#include "Network/WebSocketClient.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 
 namespace FinalStorm {
 
-namespace {
-// Simple placeholder WebSocket client used for compiling the sample project.
-class WebSocketClient {
-public:
-    void connect(const std::string& url) {
-        std::cout << "[Network] connect " << url << std::endl;
-    }
-    void disconnect() {
-        std::cout << "[Network] disconnect" << std::endl;
-    }
-    void send(const std::string& msg) {
-        std::cout << "[Network] send: " << msg << std::endl;
-    }
-};
-} // namespace
-
 NetworkClient::NetworkClient() = default;
 
 NetworkClient::~NetworkClient() {
@@ -28,44 +16,169 @@ NetworkClient::~NetworkClient() {
 void NetworkClient::connect(const std::string& serverUrl) {
     if (m_state != ConnectionState::Disconnected) return;
     m_state = ConnectionState::Connecting;
+    dispatchStateChange();
+
     m_webSocket = std::make_unique<WebSocketClient>();
-    m_webSocket->connect(serverUrl);
-    m_state = ConnectionState::Connected;
+    m_webSocket->setOpenCallback([this]() {
+        m_state = ConnectionState::Connected;
+    });
+    m_webSocket->setMessageCallback([this](WebSocket::Opcode, const uint8_t* data, size_t size) {
+        handleMessage(std::string(reinterpret_cast<const char*>(data), size));
+    });
+    m_webSocket->setCloseCallback([this](const std::string& reason) {
+        if (m_state != ConnectionState::Disconnecting) {
+            std::cerr << "[Network] connection lost: " << reason << std::endl;
+            m_state = ConnectionState::Error;
+        }
+    });
+
     m_running = true;
-    if (m_connectionCallback) m_connectionCallback(m_state);
+    m_networkThread = std::thread(&NetworkClient::networkThreadMain, this, serverUrl);
 }
 
 void NetworkClient::disconnect() {
     if (m_state == ConnectionState::Disconnected) return;
     m_state = ConnectionState::Disconnecting;
+
+    m_running = false;
     if (m_webSocket) {
-        m_webSocket->disconnect();
+        m_webSocket->close();
+    }
+    if (m_networkThread.joinable()) {
+        m_networkThread.join();
     }
+    m_webSocket.reset();
+
     m_state = ConnectionState::Disconnected;
-    m_running = false;
-    if (m_connectionCallback) m_connectionCallback(m_state);
+    dispatchStateChange();
+}
+
+void NetworkClient::networkThreadMain(const std::string& serverUrl) {
+    // DNS and connect run here so the main thread never blocks on the network
+    if (!m_webSocket->connect(serverUrl)) {
+        m_state = ConnectionState::Error;
+        return;
+    }
+    m_webSocket->run(m_running);
+}
+
+void NetworkClient::dispatchStateChange() {
+    // Connection callbacks always fire on the main thread
+    ConnectionState state = m_state;
+    if (state == m_reportedState) return;
+    m_reportedState = state;
+    if (m_connectionCallback) m_connectionCallback(state);
 }
 
 void NetworkClient::sendMessage(const std::string& type, const std::string& payload) {
-    if (!m_webSocket) return;
-    m_webSocket->send(type + ":" + payload);
+    const std::string& line = encodeMessage(type, payload);
+    m_outbound.queue(reinterpret_cast<const uint8_t*>(line.data()), line.size());
 }
 
 void NetworkClient::requestServiceList() {
-    sendMessage("requestServiceList", "");
+    // Only one outstanding request is useful per flush
+    const std::string& line = encodeMessage("requestServiceList", "");
+    m_outbound.queueLatest("requestServiceList", reinterpret_cast<const uint8_t*>(line.data()), line.size());
 }
 
 void NetworkClient::subscribeToService(const std::string& serviceId) {
-    sendMessage("subscribe", serviceId);
+    const std::string& line = encodeMessage("subscribe", serviceId);
+    m_outbound.queueSubscription(serviceId, true, reinterpret_cast<const uint8_t*>(line.data()), line.size());
 }
 
 void NetworkClient::unsubscribeFromService(const std::string& serviceId) {
-    sendMessage("unsubscribe", serviceId);
+    const std::string& line = encodeMessage("unsubscribe", serviceId);
+    m_outbound.queueSubscription(serviceId, false, reinterpret_cast<const uint8_t*>(line.data()), line.size());
+}
+
+void NetworkClient::updateSubscriptionTiers(const std::vector<TierUpdateEntry>& changes) {
+    if (changes.empty()) return;
+
+    // "tiers:serviceId=tier,serviceId=tier" with tier 0 (none) to 3 (full)
+    m_encodeScratch.assign("tiers:");
+    for (size_t i = 0; i < changes.size(); ++i) {
+        if (i > 0) m_encodeScratch += ',';
+        m_encodeScratch += changes[i].serviceId;
+        m_encodeScratch += '=';
+        m_encodeScratch += static_cast<char>('0' + static_cast<int>(changes[i].tier));
+    }
+    m_outbound.queue(reinterpret_cast<const uint8_t*>(m_encodeScratch.data()), m_encodeScratch.size());
+}
+
+const std::string& NetworkClient::encodeMessage(const std::string& type, const std::string& payload) {
+    m_encodeScratch.assign(type);
+    m_encodeScratch += ':';
+    m_encodeScratch += payload;
+    return m_encodeScratch;
+}
+
+void NetworkClient::flushOutbound() {
+    if (!m_webSocket || m_state != ConnectionState::Connected || m_outbound.empty()) return;
+
+    m_batchScratch.clear();
+    m_outbound.flush([this](const uint8_t* data, size_t size) {
+        if (!m_batchScratch.empty()) m_batchScratch += '\n';
+        m_batchScratch.append(reinterpret_cast<const char*>(data), size);
+    });
+    m_webSocket->sendText(m_batchScratch);
+}
+
+bool NetworkClient::startCapture(const std::string& path) {
+    auto capture = std::make_unique<NetworkCaptureWriter>();
+    if (!capture->open(path)) return false;
+    
+    // Any previous writer is closed outside the lock, off the receive path
+    std::unique_ptr<NetworkCaptureWriter> previous;
+    {
+        std::lock_guard<std::mutex> lock(m_captureMutex);
+        previous = std::move(m_capture);
+        m_capture = std::move(capture);
+    }
+    return true;
+}
+
+void NetworkClient::stopCapture() {
+    std::unique_ptr<NetworkCaptureWriter> previous;
+    {
+        std::lock_guard<std::mutex> lock(m_captureMutex);
+        previous = std::move(m_capture);
+    }
+}
+
+bool NetworkClient::isCapturing() const {
+    std::lock_guard<std::mutex> lock(m_captureMutex);
+    return m_capture != nullptr;
+}
+
+bool NetworkClient::startReplay(const std::string& path, ReplayMode mode) {
+    auto replay = std::make_unique<NetworkReplaySource>();
+    if (!replay->open(path, mode)) return false;
+    replay->setNetworkMessageSink([this](const NetworkMessage& msg) {
+        enqueueMessage(msg);
+    });
+    m_replay = std::move(replay);
+    return true;
+}
+
+void NetworkClient::stopReplay() {
+    m_replay.reset();
+}
+
+ReplayStats NetworkClient::getReplayStats() const {
+    return m_replay ? m_replay->getStats() : ReplayStats{};
 }
 
 void NetworkClient::update() {
-    if (!m_running) return;
+    dispatchStateChange();
+    
+    if (m_replay) {
+        // Replayed traffic goes through the same queue as live traffic
+        m_replay->advanceFrame();
+    } else if (!m_running) {
+        return;
+    }
     processMessageQueue();
+    flushOutbound();
 }
 
 void NetworkClient::processMessageQueue() {
@@ -75,21 +188,81 @@ void NetworkClient::processMessageQueue() {
         std::swap(local, m_messageQueue);
     }
     while (!local.empty()) {
-        if (m_messageCallback) m_messageCallback(local.front());
+        const NetworkMessage& message = local.front();
+        if (message.type == "serviceList" || message.type == "serviceUpdate") {
+            parseServiceList(message.payload);
+        }
+        if (m_messageCallback) m_messageCallback(message);
         local.pop();
     }
 }
 
 void NetworkClient::handleMessage(const std::string& message) {
-    NetworkMessage msg{ "generic", message, 0.0 };
+    // Frames mirror sendMessage: "type:payload"
+    size_t separator = message.find(':');
+    NetworkMessage msg = separator == std::string::npos
+        ? NetworkMessage{ "generic", message, 0.0 }
+        : NetworkMessage{ message.substr(0, separator), message.substr(separator + 1), 0.0 };
+    {
+        std::lock_guard<std::mutex> lock(m_captureMutex);
+        if (m_capture) m_capture->record(msg);
+    }
+    enqueueMessage(msg);
+}
+
+void NetworkClient::enqueueMessage(const NetworkMessage& message) {
     std::lock_guard<std::mutex> lock(m_queueMutex);
-    m_messageQueue.push(msg);
+    m_messageQueue.push(message);
 }
 
-void NetworkClient::parseServiceUpdate(const std::string& payload) {
-    ServiceInfo info{};
-    info.id = payload;
-    m_services[info.id] = info;
+void NetworkClient::parseServiceList(const std::string& payload) {
+    // Records separated by ';', each "id|name|type|url|healthy|cpu|memory|connections".
+    // Fields are scanned in place and written into the existing record, so a
+    // known service costs no allocation unless a string outgrows its capacity.
+    const char* cursor = payload.data();
+    const char* end = cursor + payload.size();
+    while (cursor < end) {
+        const char* recordEnd = std::find(cursor, end, ';');
+        parseServiceRecord(cursor, recordEnd);
+        cursor = recordEnd + (recordEnd < end ? 1 : 0);
+    }
+}
+
+void NetworkClient::parseServiceRecord(const char* begin, const char* end) {
+    const char* fields[8];
+    size_t lengths[8] = {};
+    size_t count = 0;
+    const char* cursor = begin;
+    while (count < 8) {
+        const char* fieldEnd = std::find(cursor, end, '|');
+        fields[count] = cursor;
+        lengths[count] = static_cast<size_t>(fieldEnd - cursor);
+        count++;
+        if (fieldEnd == end) break;
+        cursor = fieldEnd + 1;
+    }
+    if (count == 0 || lengths[0] == 0) return;
+
+    m_lookupScratch.assign(fields[0], lengths[0]);
+    ServiceInfo& info = m_services[m_lookupScratch];
+    info.id.assign(fields[0], lengths[0]);
+
+    auto parseFloat = [](const char* text, size_t length) {
+        char buffer[32];
+        length = std::min(length, sizeof(buffer) - 1);
+        std::memcpy(buffer, text, length);
+        buffer[length] = '\0';
+        return std::strtof(buffer, nullptr);
+    };
+
+    if (count > 1) info.name.assign(fields[1], lengths[1]);
+    if (count > 2) info.type.assign(fields[2], lengths[2]);
+    if (count > 3) info.url.assign(fields[3], lengths[3]);
+    if (count > 4) info.isHealthy = lengths[4] > 0 && fields[4][0] == '1';
+    if (count > 5) info.cpuUsage = parseFloat(fields[5], lengths[5]);
+    if (count > 6) info.memoryUsage = parseFloat(fields[6], lengths[6]);
+    if (count > 7) info.activeConnections = static_cast<int>(parseFloat(fields[7], lengths[7]));
+
     if (m_serviceCallback) m_serviceCallback(info);
 }
 
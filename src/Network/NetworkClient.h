@@ -9,6 +9,9 @@
 #include <thread>
 #include <atomic>
 #include <unordered_map>
+#include "Network/NetworkCapture.h"
+#include "Network/OutboundBatcher.h"
+#include "Network/MessageProtocol.h"
 
 namespace FinalStorm {
 
@@ -55,7 +58,8 @@ public:
     bool isConnected() const { return m_state == ConnectionState::Connected; }
     ConnectionState getState() const { return m_state; }
     
-    // Message handling
+    // Message handling. Outbound messages are queued and flushed once per
+    // update() as a single text frame of newline-separated "type:payload" lines
     void sendMessage(const std::string& type, const std::string& payload);
     void setMessageCallback(MessageCallback callback) { m_messageCallback = callback; }
     
@@ -63,21 +67,42 @@ public:
     void requestServiceList();
     void subscribeToService(const std::string& serviceId);
     void unsubscribeFromService(const std::string& serviceId);
+    void updateSubscriptionTiers(const std::vector<TierUpdateEntry>& changes);
     void setServiceCallback(ServiceCallback callback) { m_serviceCallback = callback; }
     
+    // Outbound batching
+    void setOutboundByteBudget(size_t bytes) { m_outbound.setByteBudget(bytes); }
+    const OutboundBatcher::Stats& getOutboundStats() const { return m_outbound.getStats(); }
+    
     // Connection callbacks
     void setConnectionCallback(ConnectionCallback callback) { m_connectionCallback = callback; }
     
+    // Capture and replay of the inbound stream
+    bool startCapture(const std::string& path);
+    void stopCapture();
+    bool isCapturing() const;
+    bool startReplay(const std::string& path, ReplayMode mode = ReplayMode::RecordedSpeed);
+    void stopReplay();
+    bool isReplaying() const { return m_replay != nullptr; }
+    ReplayStats getReplayStats() const;
+    
     // Update (call from main thread)
     void update();
     
 private:
+    void networkThreadMain(const std::string& serverUrl);
+    void dispatchStateChange();
     void processMessageQueue();
+    const std::string& encodeMessage(const std::string& type, const std::string& payload);
+    void flushOutbound();
     void handleMessage(const std::string& message);
-    void parseServiceUpdate(const std::string& payload);
+    void enqueueMessage(const NetworkMessage& message);
+    void parseServiceList(const std::string& payload);
+    void parseServiceRecord(const char* begin, const char* end);
     
     std::unique_ptr<WebSocketClient> m_webSocket;
-    ConnectionState m_state = ConnectionState::Disconnected;
+    std::atomic<ConnectionState> m_state{ConnectionState::Disconnected};
+    ConnectionState m_reportedState = ConnectionState::Disconnected;
     
     // Callbacks
     ConnectionCallback m_connectionCallback;
@@ -88,8 +113,20 @@ private:
     std::queue<NetworkMessage> m_messageQueue;
     mutable std::mutex m_queueMutex;
     
+    // Outbound queue and reused encode buffers
+    OutboundBatcher m_outbound;
+    std::string m_encodeScratch;
+    std::string m_batchScratch;
+    
     // Service tracking
     std::unordered_map<std::string, ServiceInfo> m_services;
+    std::string m_lookupScratch;
+    
+    // Capture/replay. The network thread records while the main thread
+    // starts and stops capture, so m_capture is only touched under the lock.
+    std::unique_ptr<NetworkCaptureWriter> m_capture;
+    mutable std::mutex m_captureMutex;
+    std::unique_ptr<NetworkReplaySource> m_replay;
     
     // Threading
     std::thread m_networkThread;
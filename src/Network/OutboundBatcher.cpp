@@ -0,0 +1,126 @@
+// src/Network/OutboundBatcher.cpp
+// Per-tick outbound message queue implementation
+
+#include "Network/OutboundBatcher.h"
+#include <cstring>
+
+namespace FinalStorm {
+
+OutboundBatcher::OutboundBatcher()
+    : OutboundBatcher(Config()) {
+}
+
+OutboundBatcher::OutboundBatcher(const Config& config)
+    : m_config(config)
+    , m_nextSequence(0)
+    , m_liveCount(0)
+    , m_liveBytes(0) {
+}
+
+void OutboundBatcher::queue(const uint8_t* data, size_t size) {
+    append(data, size);
+}
+
+void OutboundBatcher::queueLatest(const std::string& key, const uint8_t* data, size_t size) {
+    auto it = m_latest.find(key);
+    if (it != m_latest.end()) {
+        // Drop the stale copy; the new one goes to the back so it stays
+        // ordered after anything queued in between
+        if (Entry* previous = findLive(it->second)) {
+            retire(*previous);
+            m_stats.coalesced++;
+        }
+    }
+    m_latest[key] = append(data, size);
+}
+
+void OutboundBatcher::queueSubscription(const std::string& serviceId, bool subscribe,
+                                        const uint8_t* data, size_t size) {
+    auto it = m_subscriptions.find(serviceId);
+    if (it != m_subscriptions.end()) {
+        Entry* pending = findLive(it->second.sequence);
+        if (pending) {
+            if (it->second.subscribe == subscribe) {
+                m_stats.coalesced++;
+                return;
+            }
+            // The server never saw the first request, so its state is
+            // already what the second one asks for
+            retire(*pending);
+            m_subscriptions.erase(it);
+            m_stats.cancelled += 2;
+            return;
+        }
+    }
+    m_subscriptions[serviceId] = PendingSubscription{ append(data, size), subscribe };
+}
+
+void OutboundBatcher::clear() {
+    m_arena.clear();
+    m_entries.clear();
+    m_latest.clear();
+    m_subscriptions.clear();
+    m_liveCount = 0;
+    m_liveBytes = 0;
+}
+
+uint64_t OutboundBatcher::append(const uint8_t* data, size_t size) {
+    Entry entry;
+    entry.sequence = m_nextSequence++;
+    entry.offset = m_arena.size();
+    entry.size = size;
+    entry.live = true;
+
+    m_arena.resize(entry.offset + size);
+    if (size > 0) {
+        std::memcpy(m_arena.data() + entry.offset, data, size);
+    }
+    m_entries.push_back(entry);
+
+    m_liveCount++;
+    m_liveBytes += size;
+    m_stats.queued++;
+    return entry.sequence;
+}
+
+OutboundBatcher::Entry* OutboundBatcher::findLive(uint64_t sequence) {
+    // Sequences are contiguous from the front, so lookup is an index
+    if (m_entries.empty() || sequence < m_entries.front().sequence) {
+        return nullptr; // Already flushed
+    }
+    size_t index = static_cast<size_t>(sequence - m_entries.front().sequence);
+    if (index >= m_entries.size() || !m_entries[index].live) {
+        return nullptr;
+    }
+    return &m_entries[index];
+}
+
+void OutboundBatcher::retire(Entry& entry) {
+    entry.live = false;
+    m_liveCount--;
+    m_liveBytes -= entry.size;
+}
+
+void OutboundBatcher::compact(size_t consumedEntries) {
+    m_entries.erase(m_entries.begin(), m_entries.begin() + consumedEntries);
+
+    if (m_liveCount == 0) {
+        // Everything went out; the key maps only point at flushed entries now
+        m_entries.clear();
+        m_arena.clear();
+        m_latest.clear();
+        m_subscriptions.clear();
+        return;
+    }
+
+    size_t start = m_entries.front().offset;
+    if (start == 0) return;
+
+    std::memmove(m_arena.data(), m_arena.data() + start, m_arena.size() - start);
+    m_arena.resize(m_arena.size() - start);
+    for (auto& entry : m_entries) {
+        entry.offset -= start;
+    }
+}
+
+} // namespace FinalStorm
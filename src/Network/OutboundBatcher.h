@@ -0,0 +1,118 @@
+// src/Network/OutboundBatcher.h
+// Per-tick outbound message queue
+// Collects messages during a frame, coalesces redundant ones, and flushes
+// them in order under a byte budget so the owner can send one batched frame
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace FinalStorm {
+
+class OutboundBatcher {
+public:
+    struct Config {
+        size_t tickByteBudget = 16 * 1024;  // Bytes flushed per tick; the rest carries over
+    };
+
+    struct Stats {
+        uint64_t queued = 0;
+        uint64_t coalesced = 0;     // Replaced by a newer message with the same key
+        uint64_t cancelled = 0;     // Subscribe/unsubscribe pairs that cancelled out (counts both)
+        uint64_t flushedMessages = 0;
+        uint64_t flushedBytes = 0;
+        uint64_t flushes = 0;
+        uint64_t deferred = 0;      // Messages carried over because the budget ran out
+    };
+
+    OutboundBatcher();
+    explicit OutboundBatcher(const Config& config);
+
+    // Ordered message, always delivered
+    void queue(const uint8_t* data, size_t size);
+
+    // Replaces any unsent message with the same key (periodic status, service list requests)
+    void queueLatest(const std::string& key, const uint8_t* data, size_t size);
+
+    // Subscribe or unsubscribe for one service. An unsent request in the
+    // opposite direction cancels out and neither is sent; a duplicate is dropped.
+    void queueSubscription(const std::string& serviceId, bool subscribe, const uint8_t* data, size_t size);
+
+    // Calls emit(const uint8_t* data, size_t size) for pending messages in
+    // order until the tick budget is spent. The first message is always
+    // emitted so an oversized one cannot stall the queue. Returns the count.
+    template<typename Emit>
+    size_t flush(Emit&& emit);
+
+    bool empty() const { return m_liveCount == 0; }
+    size_t pendingBytes() const { return m_liveBytes; }
+    void clear();
+
+    void setByteBudget(size_t bytes) { m_config.tickByteBudget = bytes; }
+    const Stats& getStats() const { return m_stats; }
+
+private:
+    struct Entry {
+        uint64_t sequence;
+        size_t offset;      // Into m_arena
+        size_t size;
+        bool live;
+    };
+
+    struct PendingSubscription {
+        uint64_t sequence;
+        bool subscribe;
+    };
+
+    uint64_t append(const uint8_t* data, size_t size);
+    Entry* findLive(uint64_t sequence);
+    void retire(Entry& entry);
+    void compact(size_t consumedEntries);
+
+    Config m_config;
+    Stats m_stats;
+
+    // All pending bytes live in one arena that keeps its capacity across ticks
+    std::vector<uint8_t> m_arena;
+    std::deque<Entry> m_entries;
+    uint64_t m_nextSequence;
+    size_t m_liveCount;
+    size_t m_liveBytes;
+
+    std::unordered_map<std::string, uint64_t> m_latest;
+    std::unordered_map<std::string, PendingSubscription> m_subscriptions;
+};
+
+template<typename Emit>
+size_t OutboundBatcher::flush(Emit&& emit) {
+    size_t emitted = 0;
+    size_t bytes = 0;
+    size_t consumed = 0;
+
+    for (auto& entry : m_entries) {
+        if (entry.live) {
+            if (emitted > 0 && bytes + entry.size > m_config.tickByteBudget) {
+                break;
+            }
+            emit(m_arena.data() + entry.offset, entry.size);
+            bytes += entry.size;
+            ++emitted;
+            retire(entry);
+        }
+        ++consumed;
+    }
+
+    m_stats.flushedMessages += emitted;
+    m_stats.flushedBytes += bytes;
+    if (emitted > 0) m_stats.flushes++;
+    m_stats.deferred += m_liveCount;
+
+    compact(consumed);
+    return emitted;
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,223 @@
+// src/Network/ServiceDirectory.cpp
+// Preallocated service table implementation
+
+#include "Network/ServiceDirectory.h"
+#include <iostream>
+
+namespace FinalStorm {
+
+namespace {
+
+uint32_t hashId(const char* id, size_t length) {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<uint8_t>(id[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+} // namespace
+
+ServiceDirectory::ServiceDirectory()
+    : m_stagedFields(0)
+    , m_lastCommitted(NoRecord)
+    , m_listGeneration(0)
+    , m_inList(false)
+    , m_rejected(0) {
+}
+
+void ServiceDirectory::reserve(size_t serviceCount) {
+    if (serviceCount > m_records.capacity()) {
+        m_records.reserve(serviceCount);
+        m_changed.reserve(serviceCount);
+    }
+
+    // Keep the index at most half full
+    size_t slotCount = 16;
+    while (slotCount < serviceCount * 2) slotCount *= 2;
+    if (slotCount > m_slots.size()) {
+        rebuildIndex(slotCount);
+    }
+}
+
+void ServiceDirectory::clear() {
+    m_records.clear();
+    m_changed.clear();
+    m_lastCommitted = NoRecord;
+    std::fill(m_slots.begin(), m_slots.end(), 0u);
+    m_inList = false;
+}
+
+const ServiceRecord* ServiceDirectory::find(const char* id, size_t length) const {
+    if (m_slots.empty()) return nullptr;
+    uint32_t slot = m_slots[findSlot(id, length)];
+    return slot != 0 ? &m_records[slot - 1] : nullptr;
+}
+
+void ServiceDirectory::clearChanged() {
+    for (uint32_t index : m_changed) {
+        m_records[index].changed = false;
+    }
+    m_changed.clear();
+}
+
+// ============================================================================
+// Parse events
+// ============================================================================
+
+void ServiceDirectory::onListBegin(uint32_t serviceCount) {
+    reserve(serviceCount);
+    m_listGeneration++;
+    m_inList = true;
+}
+
+void ServiceDirectory::onServiceBegin() {
+    m_staged.id.clear();
+    m_staged.name.clear();
+    m_staged.type.clear();
+    m_staged.url.clear();
+    m_stagedFields = 0;
+    m_lastCommitted = NoRecord;
+}
+
+void ServiceDirectory::onString(ServiceField field, const char* data, size_t size, bool) {
+    switch (field) {
+        case ServiceField::Id: m_staged.id.append(data, size); break;
+        case ServiceField::Name: m_staged.name.append(data, size); break;
+        case ServiceField::Type: m_staged.type.append(data, size); break;
+        case ServiceField::Url: m_staged.url.append(data, size); break;
+        default: return;
+    }
+    m_stagedFields |= fieldBit(field);
+}
+
+void ServiceDirectory::onU8(ServiceField field, uint8_t value) {
+    if (field != ServiceField::Status) return;
+    m_staged.status = static_cast<ServiceStatus>(value);
+    m_stagedFields |= fieldBit(field);
+}
+
+void ServiceDirectory::onFloat(ServiceField field, float value) {
+    switch (field) {
+        case ServiceField::CpuUsage: m_staged.cpuUsage = value; break;
+        case ServiceField::MemoryUsage: m_staged.memoryUsage = value; break;
+        case ServiceField::AverageLatency: m_staged.averageLatency = value; break;
+        case ServiceField::ErrorRate: m_staged.errorRate = value; break;
+        default: return;
+    }
+    m_stagedFields |= fieldBit(field);
+}
+
+void ServiceDirectory::onU32(ServiceField field, uint32_t value) {
+    switch (field) {
+        case ServiceField::RequestsPerSecond: m_staged.requestsPerSecond = value; break;
+        case ServiceField::ActiveConnections: m_staged.activeConnections = value; break;
+        default: return;
+    }
+    m_stagedFields |= fieldBit(field);
+}
+
+void ServiceDirectory::onServiceEnd() {
+    if (m_staged.id.empty()) return; // Nothing to key the record on
+    if (m_staged.id.truncated) {
+        if (m_rejected++ == 0) {
+            std::cerr << "ServiceDirectory: rejecting service ids longer than "
+                      << decltype(m_staged.id)::capacity << " bytes" << std::endl;
+        }
+        return;
+    }
+    commitStaged();
+}
+
+void ServiceDirectory::onListEnd() {
+    m_inList = false;
+
+    // A full list is authoritative; anything it left out has gone away
+    for (uint32_t i = 0; i < m_records.size(); ++i) {
+        ServiceRecord& record = m_records[i];
+        if (record.listGeneration != m_listGeneration && record.status != ServiceStatus::Offline) {
+            record.status = ServiceStatus::Offline;
+            markChanged(i);
+        }
+    }
+}
+
+void ServiceDirectory::onListAbandoned() {
+    // An incomplete list says nothing about the services it did not reach
+    m_inList = false;
+}
+
+// ============================================================================
+// Storage
+// ============================================================================
+
+uint32_t ServiceDirectory::fieldBit(ServiceField field) {
+    // Eight tags per value kind
+    uint8_t tag = static_cast<uint8_t>(field);
+    return 1u << ((tag >> 6) * 8 + (tag & 0x07));
+}
+
+void ServiceDirectory::commitStaged() {
+    if (m_records.size() * 2 >= m_slots.size()) {
+        reserve(std::max<size_t>(m_records.size() * 2, 16));
+    }
+
+    uint32_t slot = findSlot(m_staged.id.data, m_staged.id.length);
+    uint32_t index;
+    if (m_slots[slot] == 0) {
+        index = static_cast<uint32_t>(m_records.size());
+        m_records.push_back(ServiceRecord());
+        m_records.back().id = m_staged.id;
+        m_slots[slot] = index + 1;
+    } else {
+        index = m_slots[slot] - 1;
+    }
+
+    // Only fields the message carried overwrite what we already know
+    ServiceRecord& record = m_records[index];
+    const uint32_t fields = m_stagedFields;
+    if (fields & fieldBit(ServiceField::Name)) record.name = m_staged.name;
+    if (fields & fieldBit(ServiceField::Type)) record.type = m_staged.type;
+    if (fields & fieldBit(ServiceField::Url)) record.url = m_staged.url;
+    if (fields & fieldBit(ServiceField::Status)) record.status = m_staged.status;
+    if (fields & fieldBit(ServiceField::CpuUsage)) record.cpuUsage = m_staged.cpuUsage;
+    if (fields & fieldBit(ServiceField::MemoryUsage)) record.memoryUsage = m_staged.memoryUsage;
+    if (fields & fieldBit(ServiceField::AverageLatency)) record.averageLatency = m_staged.averageLatency;
+    if (fields & fieldBit(ServiceField::ErrorRate)) record.errorRate = m_staged.errorRate;
+    if (fields & fieldBit(ServiceField::RequestsPerSecond)) record.requestsPerSecond = m_staged.requestsPerSecond;
+    if (fields & fieldBit(ServiceField::ActiveConnections)) record.activeConnections = m_staged.activeConnections;
+    if (m_inList) record.listGeneration = m_listGeneration;
+
+    markChanged(index);
+    m_lastCommitted = index;
+}
+
+uint32_t ServiceDirectory::findSlot(const char* id, size_t length) const {
+    // Linear probing; the table is never more than half full
+    uint32_t mask = static_cast<uint32_t>(m_slots.size() - 1);
+    uint32_t slot = hashId(id, length) & mask;
+    while (m_slots[slot] != 0 && !m_records[m_slots[slot] - 1].id.equals(id, length)) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+void ServiceDirectory::rebuildIndex(size_t slotCount) {
+    m_slots.assign(slotCount, 0u);
+    for (uint32_t i = 0; i < m_records.size(); ++i) {
+        const FixedString<63>& id = m_records[i].id;
+        m_slots[findSlot(id.data, id.length)] = i + 1;
+    }
+}
+
+void ServiceDirectory::markChanged(uint32_t index) {
+    ServiceRecord& record = m_records[index];
+    if (!record.changed) {
+        record.changed = true;
+        m_changed.push_back(index);
+    }
+}
+
+} // namespace FinalStorm
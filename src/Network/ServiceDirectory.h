@@ -0,0 +1,121 @@
+// src/Network/ServiceDirectory.h
+// Preallocated table of known services
+// Filled straight from ServiceListParser events; records hold fixed-size strings
+
+#pragma once
+#include "Network/ServiceListParser.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace FinalStorm {
+
+// Inline string with a fixed capacity; longer values are truncated and
+// flagged, so callers that key on the value can refuse it
+template<size_t Capacity>
+struct FixedString {
+    static constexpr size_t capacity = Capacity;
+
+    char data[Capacity + 1] = {};
+    uint16_t length = 0;
+    bool truncated = false;
+
+    void clear() { length = 0; data[0] = '\0'; truncated = false; }
+
+    void append(const char* text, size_t size) {
+        size_t take = std::min(size, Capacity - length);
+        std::memcpy(data + length, text, take);
+        length = static_cast<uint16_t>(length + take);
+        data[length] = '\0';
+        if (take < size) truncated = true;
+    }
+
+    bool equals(const char* text, size_t size) const {
+        return size == length && std::memcmp(data, text, size) == 0;
+    }
+
+    const char* c_str() const { return data; }
+    std::string str() const { return std::string(data, length); }
+    bool empty() const { return length == 0; }
+};
+
+struct ServiceRecord {
+    FixedString<63> id;             // Longer ids are rejected rather than truncated
+    FixedString<63> name;
+    FixedString<31> type;
+    FixedString<127> url;
+    ServiceStatus status = ServiceStatus::Online;
+
+    float cpuUsage = 0.0f;
+    float memoryUsage = 0.0f;
+    float averageLatency = 0.0f;
+    float errorRate = 0.0f;
+    uint32_t requestsPerSecond = 0;
+    uint32_t activeConnections = 0;
+
+    uint32_t listGeneration = 0;    // Last full list that included this service
+    bool changed = false;
+};
+
+class ServiceDirectory : public ServiceListHandler {
+public:
+    static constexpr uint32_t NoRecord = ~0u;
+
+    ServiceDirectory();
+
+    // Grows storage once up front; a list header calls this with its count
+    void reserve(size_t serviceCount);
+    void clear();
+
+    const ServiceRecord* find(const char* id, size_t length) const;
+    const ServiceRecord* find(const std::string& id) const { return find(id.data(), id.size()); }
+    const std::vector<ServiceRecord>& getRecords() const { return m_records; }
+    // Record indices are stable until clear()
+    uint32_t indexOf(const ServiceRecord* record) const { return static_cast<uint32_t>(record - m_records.data()); }
+
+    // Record written by the last service parsed, NoRecord if it was dropped
+    uint32_t getLastCommitted() const { return m_lastCommitted; }
+    size_t size() const { return m_records.size(); }
+
+    // Services dropped because their id did not fit ServiceRecord::id.
+    // Truncating would merge ids sharing a prefix into one record.
+    uint64_t getRejectedCount() const { return m_rejected; }
+
+    // Indices of records changed since the last clearChanged(), each listed once
+    const std::vector<uint32_t>& getChanged() const { return m_changed; }
+    void clearChanged();
+
+    // ServiceListHandler
+    void onListBegin(uint32_t serviceCount) override;
+    void onServiceBegin() override;
+    void onString(ServiceField field, const char* data, size_t size, bool last) override;
+    void onU8(ServiceField field, uint8_t value) override;
+    void onFloat(ServiceField field, float value) override;
+    void onU32(ServiceField field, uint32_t value) override;
+    void onServiceEnd() override;
+    void onListEnd() override;
+    void onListAbandoned() override;
+
+private:
+    static uint32_t fieldBit(ServiceField field);
+    void commitStaged();
+    uint32_t findSlot(const char* id, size_t length) const;
+    void rebuildIndex(size_t slotCount);
+    void markChanged(uint32_t index);
+
+    std::vector<ServiceRecord> m_records;
+    std::vector<uint32_t> m_slots;      // Open addressing; record index + 1, 0 when empty
+    std::vector<uint32_t> m_changed;
+
+    // The record being parsed and which of its fields were present
+    ServiceRecord m_staged;
+    uint32_t m_stagedFields;
+
+    uint32_t m_lastCommitted;
+    uint32_t m_listGeneration;
+    bool m_inList;
+    uint64_t m_rejected;
+};
+
+} // namespace FinalStorm
@@ -0,0 +1,318 @@
+// src/Network/ServiceListParser.cpp
+// Streaming service list parser implementation
+
+#include "Network/ServiceListParser.h"
+#include <algorithm>
+#include <cstring>
+
+namespace FinalStorm {
+
+ServiceListParser::ServiceListParser()
+    : m_handler(nullptr)
+    , m_state(State::Done)
+    , m_field(ServiceField::End)
+    , m_scratchSize(0)
+    , m_stringRemaining(0)
+    , m_serviceCount(0)
+    , m_servicesParsed(0)
+    , m_inService(false)
+    , m_listOpen(false) {
+}
+
+void ServiceListParser::begin(ServiceListHandler* handler) {
+    abandon();
+    m_handler = handler;
+    m_state = State::ListCount;
+    m_field = ServiceField::End;
+    m_scratchSize = 0;
+    m_stringRemaining = 0;
+    m_serviceCount = 0;
+    m_servicesParsed = 0;
+    m_inService = false;
+}
+
+void ServiceListParser::abandon() {
+    if (m_handler && m_listOpen) {
+        m_handler->onListAbandoned();
+    }
+    m_listOpen = false;
+    m_handler = nullptr;
+    m_state = State::Done;
+}
+
+ServiceListParser::Result ServiceListParser::feed(const uint8_t* data, size_t size) {
+    if (!m_handler || m_state == State::Failed) {
+        return Result::Error;
+    }
+
+    const uint8_t* cursor = data;
+    const uint8_t* end = data + size;
+
+    while (cursor < end) {
+        switch (m_state) {
+            case State::ListCount: {
+                if (!gather(cursor, end, sizeof(uint32_t))) return Result::NeedMore;
+                std::memcpy(&m_serviceCount, m_scratch, sizeof(uint32_t));
+                m_scratchSize = 0;
+                m_handler->onListBegin(m_serviceCount);
+                m_listOpen = true;
+                if (m_serviceCount == 0) {
+                    m_state = State::Done;
+                    m_listOpen = false;
+                    m_handler->onListEnd();
+                } else {
+                    m_state = State::Tag;
+                }
+                break;
+            }
+
+            case State::Tag: {
+                ServiceField field = static_cast<ServiceField>(*cursor++);
+                if (!m_inService) {
+                    m_inService = true;
+                    m_handler->onServiceBegin();
+                }
+                if (field == ServiceField::End) {
+                    endService();
+                    break;
+                }
+                m_field = field;
+                m_state = getFieldKind(field) == ServiceFieldKind::String ? State::StringLength : State::Scalar;
+                break;
+            }
+
+            case State::Scalar: {
+                size_t needed = getFieldKind(m_field) == ServiceFieldKind::U8 ? 1 : 4;
+                if (!gather(cursor, end, needed)) return Result::NeedMore;
+                emitScalar();
+                m_scratchSize = 0;
+                m_state = State::Tag;
+                break;
+            }
+
+            case State::StringLength: {
+                if (!gather(cursor, end, sizeof(uint16_t))) return Result::NeedMore;
+                uint16_t length = 0;
+                std::memcpy(&length, m_scratch, sizeof(uint16_t));
+                m_scratchSize = 0;
+                m_stringRemaining = length;
+                if (length == 0) {
+                    m_handler->onString(m_field, "", 0, true);
+                    m_state = State::Tag;
+                } else {
+                    m_state = State::StringBody;
+                }
+                break;
+            }
+
+            case State::StringBody: {
+                // Hand out the bytes where they lie; no copy even when split
+                size_t available = std::min(m_stringRemaining, static_cast<size_t>(end - cursor));
+                m_stringRemaining -= available;
+                m_handler->onString(m_field, reinterpret_cast<const char*>(cursor), available, m_stringRemaining == 0);
+                cursor += available;
+                if (m_stringRemaining == 0) {
+                    m_state = State::Tag;
+                }
+                break;
+            }
+
+            case State::Done:
+                // Bytes past the last record
+                m_state = State::Failed;
+                return Result::Error;
+
+            case State::Failed:
+                return Result::Error;
+        }
+    }
+
+    return m_state == State::Done ? Result::Complete : Result::NeedMore;
+}
+
+bool ServiceListParser::gather(const uint8_t*& cursor, const uint8_t* end, size_t needed) {
+    size_t take = std::min(needed - m_scratchSize, static_cast<size_t>(end - cursor));
+    std::memcpy(m_scratch + m_scratchSize, cursor, take);
+    m_scratchSize += take;
+    cursor += take;
+    return m_scratchSize == needed;
+}
+
+void ServiceListParser::emitScalar() {
+    switch (getFieldKind(m_field)) {
+        case ServiceFieldKind::U8:
+            m_handler->onU8(m_field, m_scratch[0]);
+            break;
+        case ServiceFieldKind::Float: {
+            float value = 0.0f;
+            std::memcpy(&value, m_scratch, sizeof(float));
+            m_handler->onFloat(m_field, value);
+            break;
+        }
+        case ServiceFieldKind::U32: {
+            uint32_t value = 0;
+            std::memcpy(&value, m_scratch, sizeof(uint32_t));
+            m_handler->onU32(m_field, value);
+            break;
+        }
+        case ServiceFieldKind::String:
+            break;
+    }
+}
+
+void ServiceListParser::endService() {
+    m_inService = false;
+    m_servicesParsed++;
+    m_handler->onServiceEnd();
+
+    if (m_servicesParsed == m_serviceCount) {
+        m_state = State::Done;
+        m_listOpen = false;
+        m_handler->onListEnd();
+    }
+}
+
+// ============================================================================
+// Single-service messages
+// ============================================================================
+
+namespace {
+
+class InPlaceReader {
+public:
+    explicit InPlaceReader(const std::vector<uint8_t>& in)
+        : m_cursor(in.data()), m_end(in.data() + in.size()), m_ok(true) {}
+
+    template<typename T>
+    void read(T& value) {
+        if (!m_ok || static_cast<size_t>(m_end - m_cursor) < sizeof(T)) {
+            m_ok = false;
+            return;
+        }
+        std::memcpy(&value, m_cursor, sizeof(T));
+        m_cursor += sizeof(T);
+    }
+
+    // Points into the payload instead of copying
+    void readString(const char*& data, uint16_t& length) {
+        length = 0;
+        read(length);
+        if (!m_ok || static_cast<size_t>(m_end - m_cursor) < length) {
+            m_ok = false;
+            return;
+        }
+        data = reinterpret_cast<const char*>(m_cursor);
+        m_cursor += length;
+    }
+
+    bool ok() const { return m_ok; }
+
+private:
+    const uint8_t* m_cursor;
+    const uint8_t* m_end;
+    bool m_ok;
+};
+
+void appendTag(std::vector<uint8_t>& stream, ServiceField field) {
+    stream.push_back(static_cast<uint8_t>(field));
+}
+
+template<typename T>
+void appendValue(std::vector<uint8_t>& stream, ServiceField field, const T& value) {
+    appendTag(stream, field);
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+    stream.insert(stream.end(), bytes, bytes + sizeof(T));
+}
+
+void appendString(std::vector<uint8_t>& stream, ServiceField field, const std::string& value) {
+    uint16_t length = static_cast<uint16_t>(value.size() > 0xFFFF ? 0xFFFF : value.size());
+    appendValue(stream, field, length);
+    stream.insert(stream.end(), value.begin(), value.begin() + length);
+}
+
+} // namespace
+
+bool readServiceStatus(const Message& message, ServiceListHandler& handler) {
+    if (message.getType() != MessageType::ServiceUpdate) return false;
+
+    // Same layout as ServiceStatusPayload; validated before any event fires
+    InPlaceReader reader(message.data);
+    const char* id = nullptr;
+    const char* name = nullptr;
+    const char* type = nullptr;
+    uint16_t idLength = 0, nameLength = 0, typeLength = 0;
+    uint8_t status = 0;
+    reader.readString(id, idLength);
+    reader.readString(name, nameLength);
+    reader.readString(type, typeLength);
+    reader.read(status);
+    if (!reader.ok()) return false;
+
+    handler.onServiceBegin();
+    handler.onString(ServiceField::Id, id, idLength, true);
+    handler.onString(ServiceField::Name, name, nameLength, true);
+    handler.onString(ServiceField::Type, type, typeLength, true);
+    handler.onU8(ServiceField::Status, status);
+    handler.onServiceEnd();
+    return true;
+}
+
+bool readServiceMetrics(const Message& message, ServiceListHandler& handler) {
+    if (message.getType() != MessageType::ServiceMetrics) return false;
+
+    // Same layout as ServiceMetricsPayload
+    InPlaceReader reader(message.data);
+    const char* id = nullptr;
+    uint16_t idLength = 0;
+    float cpuUsage = 0.0f, memoryUsage = 0.0f, averageLatency = 0.0f, errorRate = 0.0f;
+    uint32_t requestsPerSecond = 0, activeConnections = 0;
+    reader.readString(id, idLength);
+    reader.read(cpuUsage);
+    reader.read(memoryUsage);
+    reader.read(requestsPerSecond);
+    reader.read(averageLatency);
+    reader.read(errorRate);
+    reader.read(activeConnections);
+    if (!reader.ok()) return false;
+
+    handler.onServiceBegin();
+    handler.onString(ServiceField::Id, id, idLength, true);
+    handler.onFloat(ServiceField::CpuUsage, cpuUsage);
+    handler.onFloat(ServiceField::MemoryUsage, memoryUsage);
+    handler.onU32(ServiceField::RequestsPerSecond, requestsPerSecond);
+    handler.onFloat(ServiceField::AverageLatency, averageLatency);
+    handler.onFloat(ServiceField::ErrorRate, errorRate);
+    handler.onU32(ServiceField::ActiveConnections, activeConnections);
+    handler.onServiceEnd();
+    return true;
+}
+
+// ============================================================================
+// Encoding
+// ============================================================================
+
+void appendServiceListHeader(std::vector<uint8_t>& stream, uint32_t serviceCount) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&serviceCount);
+    stream.insert(stream.end(), bytes, bytes + sizeof(serviceCount));
+}
+
+void appendServiceRecord(std::vector<uint8_t>& stream, const ServiceStatusPayload& status,
+                         const ServiceMetricsPayload* metrics) {
+    appendString(stream, ServiceField::Id, status.serviceId);
+    appendString(stream, ServiceField::Name, status.serviceName);
+    appendString(stream, ServiceField::Type, status.serviceType);
+    appendValue(stream, ServiceField::Status, static_cast<uint8_t>(status.status));
+
+    if (metrics) {
+        appendValue(stream, ServiceField::CpuUsage, metrics->cpuUsage);
+        appendValue(stream, ServiceField::MemoryUsage, metrics->memoryUsage);
+        appendValue(stream, ServiceField::AverageLatency, metrics->averageLatency);
+        appendValue(stream, ServiceField::ErrorRate, metrics->errorRate);
+        appendValue(stream, ServiceField::RequestsPerSecond, metrics->requestsPerSecond);
+        appendValue(stream, ServiceField::ActiveConnections, metrics->activeConnections);
+    }
+
+    appendTag(stream, ServiceField::End);
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,145 @@
+// src/Network/ServiceListParser.h
+// Streaming SAX-style parser for service list and service update payloads
+// Reads payload bytes in place and reports typed field events to a handler
+
+#pragma once
+#include "Network/MessageProtocol.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FinalStorm {
+
+// ============================================================================
+// Service list wire format
+//
+// A ServiceList message carries one chunk of a longer stream:
+//   [u8 chunk flags][stream bytes...]
+// The stream is [u32 service count] followed by that many records, and a
+// record may be split across any number of chunks. Each record is a run of
+// tagged fields ended by ServiceField::End. The top two bits of a tag give
+// its value kind, so readers can skip tags they do not know:
+//   String  [u8 tag][u16 length][bytes]
+//   U8      [u8 tag][u8]
+//   Float   [u8 tag][f32]
+//   U32     [u8 tag][u32]
+// ============================================================================
+
+enum class ServiceFieldKind : uint8_t {
+    String = 0x00,
+    U8 = 0x40,
+    Float = 0x80,
+    U32 = 0xC0
+};
+
+enum class ServiceField : uint8_t {
+    End = 0x00,
+
+    Id = 0x01,
+    Name = 0x02,
+    Type = 0x03,
+    Url = 0x04,
+
+    Status = 0x41,
+
+    CpuUsage = 0x81,
+    MemoryUsage = 0x82,
+    AverageLatency = 0x83,
+    ErrorRate = 0x84,
+
+    RequestsPerSecond = 0xC1,
+    ActiveConnections = 0xC2
+};
+
+inline ServiceFieldKind getFieldKind(ServiceField field) {
+    return static_cast<ServiceFieldKind>(static_cast<uint8_t>(field) & 0xC0);
+}
+
+enum ServiceListChunkFlags : uint8_t {
+    ServiceListFirst = 0x01,    // Starts a new list; resets the parser
+    ServiceListLast = 0x02      // Ends the list; it must be complete by the end of this chunk
+};
+
+// Receives parse events. String values may arrive in several pieces when
+// they straddle chunks; the piece with last == true completes the value.
+// Data pointers are only valid for the duration of the call. A list either
+// ends with onListEnd or, when it is cut short or malformed, with
+// onListAbandoned.
+class ServiceListHandler {
+public:
+    virtual ~ServiceListHandler() = default;
+
+    virtual void onListBegin(uint32_t) {}
+    virtual void onServiceBegin() {}
+    virtual void onString(ServiceField, const char*, size_t, bool) {}
+    virtual void onU8(ServiceField, uint8_t) {}
+    virtual void onFloat(ServiceField, float) {}
+    virtual void onU32(ServiceField, uint32_t) {}
+    virtual void onServiceEnd() {}
+    virtual void onListEnd() {}
+    virtual void onListAbandoned() {}
+};
+
+class ServiceListParser {
+public:
+    enum class Result {
+        NeedMore,
+        Complete,
+        Error
+    };
+
+    ServiceListParser();
+
+    // Starts a new list; any list in progress is abandoned
+    void begin(ServiceListHandler* handler);
+
+    // Drops the list in progress. A handler that saw onListBegin and no
+    // onListEnd hears onListAbandoned.
+    void abandon();
+
+    // Consumes a chunk of the stream. Keeps at most a few bytes of a split
+    // scalar between calls and never allocates.
+    Result feed(const uint8_t* data, size_t size);
+
+    bool isActive() const { return m_handler != nullptr && m_state != State::Done && m_state != State::Failed; }
+    uint32_t getServiceCount() const { return m_serviceCount; }
+    uint32_t getServicesParsed() const { return m_servicesParsed; }
+
+private:
+    enum class State {
+        ListCount,
+        Tag,
+        Scalar,
+        StringLength,
+        StringBody,
+        Done,
+        Failed
+    };
+
+    bool gather(const uint8_t*& cursor, const uint8_t* end, size_t needed);
+    void emitScalar();
+    void endService();
+
+    ServiceListHandler* m_handler;
+    State m_state;
+    ServiceField m_field;
+    uint8_t m_scratch[4];
+    size_t m_scratchSize;
+    size_t m_stringRemaining;
+    uint32_t m_serviceCount;
+    uint32_t m_servicesParsed;
+    bool m_inService;
+    bool m_listOpen;        // onListBegin seen, onListEnd not yet
+};
+
+// Report single-service messages through the same events, reading the
+// payload in place (onServiceBegin, fields, onServiceEnd; no list events)
+bool readServiceStatus(const Message& message, ServiceListHandler& handler);
+bool readServiceMetrics(const Message& message, ServiceListHandler& handler);
+
+// Encoding, for servers and tools
+void appendServiceListHeader(std::vector<uint8_t>& stream, uint32_t serviceCount);
+void appendServiceRecord(std::vector<uint8_t>& stream, const ServiceStatusPayload& status,
+                         const ServiceMetricsPayload* metrics = nullptr);
+
+} // namespace FinalStorm
@@ -0,0 +1,700 @@
+// src/Network/WebSocketClient.cpp
+// Non-blocking RFC 6455 client implementation
+
+#include "Network/WebSocketClient.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace FinalStorm {
+
+namespace {
+
+constexpr size_t kMaxUpgradeResponse = 16 * 1024;
+constexpr size_t kMinReadSpace = 4096;
+constexpr size_t kMaxSpareBuffers = 64;
+constexpr int kMaxReadsPerEvent = 8;
+
+std::mutex g_tlsFactoryMutex;
+WebSocketClient::TlsTransportFactory g_tlsFactory;
+
+class PlainTransport : public WebSocketTransport {
+public:
+    explicit PlainTransport(int fd) : m_fd(fd) {}
+
+    TransportResult read(uint8_t* buffer, size_t capacity, size_t& bytesRead) override {
+        ssize_t n = ::recv(m_fd, buffer, capacity, 0);
+        if (n > 0) {
+            bytesRead = static_cast<size_t>(n);
+            return TransportResult::Done;
+        }
+        bytesRead = 0;
+        if (n == 0) return TransportResult::Closed;
+        return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+            ? TransportResult::WouldBlock : TransportResult::Failed;
+    }
+
+    TransportResult writev(const iovec* iov, int count, size_t& bytesWritten) override {
+#ifdef MSG_NOSIGNAL
+        // sendmsg is writev with flags; it keeps a dead peer from raising SIGPIPE
+        msghdr message{};
+        message.msg_iov = const_cast<iovec*>(iov);
+        message.msg_iovlen = count;
+        ssize_t n = ::sendmsg(m_fd, &message, MSG_NOSIGNAL);
+#else
+        ssize_t n = ::writev(m_fd, iov, count); // SO_NOSIGPIPE is set on the socket
+#endif
+        if (n >= 0) {
+            bytesWritten = static_cast<size_t>(n);
+            return TransportResult::Done;
+        }
+        bytesWritten = 0;
+        return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+            ? TransportResult::WouldBlock : TransportResult::Failed;
+    }
+
+private:
+    int m_fd;
+};
+
+double secondsBetween(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+    return std::chrono::duration<double>(to - from).count();
+}
+
+} // namespace
+
+WebSocketClient::WebSocketClient()
+    : WebSocketClient(Config()) {
+}
+
+WebSocketClient::WebSocketClient(const Config& config)
+    : m_config(config)
+    , m_state(State::Idle)
+    , m_secure(false)
+    , m_fd(-1)
+    , m_wantWrite(false)
+    , m_readLength(0)
+    , m_fragmentOpcode(WebSocket::Opcode::Binary)
+    , m_inFragment(false)
+    , m_maskRng(std::random_device{}())
+    , m_outgoingOffset(0)
+    , m_closeQueued(false) {
+    m_readBuffer.resize(m_config.readChunkSize);
+    m_iov.resize(static_cast<size_t>(m_config.maxFramesPerWrite) * 2);
+}
+
+WebSocketClient::~WebSocketClient() {
+    if (m_fd >= 0) {
+        ::close(m_fd);
+    }
+}
+
+void WebSocketClient::setTlsTransportFactory(TlsTransportFactory factory) {
+    std::lock_guard<std::mutex> lock(g_tlsFactoryMutex);
+    g_tlsFactory = factory;
+}
+
+// ============================================================================
+// Connection setup
+// ============================================================================
+
+bool WebSocketClient::parseUrl(const std::string& url) {
+    size_t schemeEnd = url.find("://");
+    if (schemeEnd == std::string::npos) return false;
+
+    std::string scheme = url.substr(0, schemeEnd);
+    if (scheme == "ws") {
+        m_secure = false;
+    } else if (scheme == "wss") {
+        m_secure = true;
+    } else {
+        return false;
+    }
+
+    size_t authorityStart = schemeEnd + 3;
+    size_t pathStart = url.find('/', authorityStart);
+    std::string authority = url.substr(authorityStart, pathStart == std::string::npos ? std::string::npos : pathStart - authorityStart);
+    m_path = pathStart == std::string::npos ? "/" : url.substr(pathStart);
+
+    m_port = m_secure ? "443" : "80";
+    if (!authority.empty() && authority[0] == '[') {
+        // IPv6 literal: [::1]:3000
+        size_t close = authority.find(']');
+        if (close == std::string::npos) return false;
+        m_host = authority.substr(1, close - 1);
+        if (close + 1 < authority.size() && authority[close + 1] == ':') {
+            m_port = authority.substr(close + 2);
+        }
+    } else {
+        size_t colon = authority.rfind(':');
+        m_host = authority.substr(0, colon);
+        if (colon != std::string::npos) {
+            m_port = authority.substr(colon + 1);
+        }
+    }
+    return !m_host.empty() && !m_port.empty();
+}
+
+bool WebSocketClient::connect(const std::string& url) {
+    if (m_state != State::Idle) return false;
+
+    if (!parseUrl(url)) {
+        std::cerr << "[Network] Invalid WebSocket URL: " << url << std::endl;
+        m_state = State::Closed;
+        return false;
+    }
+    if (!m_poller.isValid()) {
+        fail("event poller unavailable");
+        return false;
+    }
+
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* addresses = nullptr;
+    if (getaddrinfo(m_host.c_str(), m_port.c_str(), &hints, &addresses) != 0 || !addresses) {
+        fail("cannot resolve " + m_host);
+        return false;
+    }
+
+    for (addrinfo* address = addresses; address; address = address->ai_next) {
+        int fd = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (fd < 0) continue;
+
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+        int enable = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+#ifdef SO_NOSIGPIPE
+        setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable));
+#endif
+
+        if (::connect(fd, address->ai_addr, address->ai_addrlen) == 0 || errno == EINPROGRESS) {
+            m_fd = fd;
+            break;
+        }
+        ::close(fd);
+    }
+    freeaddrinfo(addresses);
+
+    if (m_fd < 0) {
+        fail("cannot connect to " + m_host + ":" + m_port);
+        return false;
+    }
+
+    m_state = State::Connecting;
+    m_lastReceive = std::chrono::steady_clock::now();
+    m_wantWrite = true;
+    m_poller.add(m_fd, true, true);
+    return true;
+}
+
+void WebSocketClient::onConnected() {
+    int error = 0;
+    socklen_t length = sizeof(error);
+    if (getsockopt(m_fd, SOL_SOCKET, SO_ERROR, &error, &length) != 0 || error != 0) {
+        fail(std::string("connect failed: ") + std::strerror(error));
+        return;
+    }
+
+    if (m_secure) {
+        TlsTransportFactory factory;
+        {
+            std::lock_guard<std::mutex> lock(g_tlsFactoryMutex);
+            factory = g_tlsFactory;
+        }
+        if (factory) m_transport = factory(m_fd, m_host);
+        if (!m_transport) {
+            fail("wss:// requested but no TLS transport is installed");
+            return;
+        }
+        m_state = State::Securing;
+        onWritable();
+    } else {
+        m_transport = std::make_unique<PlainTransport>(m_fd);
+        sendUpgradeRequest();
+    }
+}
+
+void WebSocketClient::sendUpgradeRequest() {
+    uint8_t nonce[16];
+    {
+        std::lock_guard<std::mutex> lock(m_sendMutex);
+        for (auto& byte : nonce) {
+            byte = static_cast<uint8_t>(m_maskRng());
+        }
+    }
+    m_handshakeKey = WebSocket::base64Encode(nonce, sizeof(nonce));
+
+    bool defaultPort = m_port == (m_secure ? "443" : "80");
+    std::string hostHeader = m_host.find(':') != std::string::npos ? "[" + m_host + "]" : m_host;
+    if (!defaultPort) hostHeader += ":" + m_port;
+
+    std::string request =
+        "GET " + m_path + " HTTP/1.1\r\n"
+        "Host: " + hostHeader + "\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        "Sec-WebSocket-Key: " + m_handshakeKey + "\r\n"
+        "Sec-WebSocket-Version: 13\r\n\r\n";
+
+    OutgoingFrame frame;
+    frame.payload.assign(request.begin(), request.end());
+    m_outgoing.push_back(std::move(frame));
+
+    m_state = State::Upgrading;
+    onWritable();
+}
+
+bool WebSocketClient::processUpgradeResponse() {
+    static const char terminator[] = "\r\n\r\n";
+    uint8_t* begin = m_readBuffer.data();
+    uint8_t* end = std::search(begin, begin + m_readLength, terminator, terminator + 4);
+    if (end == begin + m_readLength) {
+        if (m_readLength > kMaxUpgradeResponse) {
+            fail("oversized upgrade response");
+            return false;
+        }
+        return true;
+    }
+
+    std::string response(begin, end);
+    size_t consumed = static_cast<size_t>(end - begin) + 4;
+    std::memmove(begin, begin + consumed, m_readLength - consumed);
+    m_readLength -= consumed;
+
+    if (response.compare(0, 12, "HTTP/1.1 101") != 0) {
+        fail("upgrade rejected: " + response.substr(0, response.find("\r\n")));
+        return false;
+    }
+
+    std::string accept;
+    size_t lineStart = response.find("\r\n");
+    while (lineStart != std::string::npos && lineStart < response.size()) {
+        lineStart += 2;
+        size_t lineEnd = response.find("\r\n", lineStart);
+        std::string line = response.substr(lineStart, lineEnd == std::string::npos ? std::string::npos : lineEnd - lineStart);
+        size_t colon = line.find(':');
+        if (colon != std::string::npos) {
+            std::string name = line.substr(0, colon);
+            std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+            if (name == "sec-websocket-accept") {
+                size_t valueStart = line.find_first_not_of(' ', colon + 1);
+                size_t valueEnd = line.find_last_not_of(' ');
+                if (valueStart != std::string::npos) accept = line.substr(valueStart, valueEnd - valueStart + 1);
+            }
+        }
+        lineStart = lineEnd;
+    }
+
+    if (accept != WebSocket::computeAcceptKey(m_handshakeKey)) {
+        fail("invalid Sec-WebSocket-Accept");
+        return false;
+    }
+
+    m_state = State::Open;
+    m_lastReceive = m_lastPing = std::chrono::steady_clock::now();
+    if (m_openCallback) m_openCallback();
+
+    // Frames queued before the upgrade completed can go out now
+    drainPending();
+    return true;
+}
+
+// ============================================================================
+// Sending (any thread)
+// ============================================================================
+
+void WebSocketClient::sendText(const std::string& text) {
+    queueFrame(WebSocket::Opcode::Text, reinterpret_cast<const uint8_t*>(text.data()), text.size());
+}
+
+void WebSocketClient::sendBinary(const uint8_t* data, size_t size) {
+    queueFrame(WebSocket::Opcode::Binary, data, size);
+}
+
+void WebSocketClient::close(uint16_t code) {
+    {
+        std::lock_guard<std::mutex> lock(m_sendMutex);
+        if (m_closeQueued || m_state == State::Closed) return;
+        m_closeQueued = true;
+        uint8_t payload[2] = { static_cast<uint8_t>(code >> 8), static_cast<uint8_t>(code) };
+        m_pending.push_back(makeFrame(WebSocket::Opcode::Close, payload, sizeof(payload)));
+    }
+    m_poller.wakeup();
+}
+
+void WebSocketClient::queueFrame(WebSocket::Opcode opcode, const uint8_t* data, size_t size) {
+    {
+        std::lock_guard<std::mutex> lock(m_sendMutex);
+        if (m_closeQueued || m_state == State::Closed) return;
+        m_pending.push_back(makeFrame(opcode, data, size));
+    }
+    m_poller.wakeup();
+}
+
+void WebSocketClient::queueControl(WebSocket::Opcode opcode, const uint8_t* data, size_t size) {
+    // Network thread only; control frames bypass the producer queue
+    std::lock_guard<std::mutex> lock(m_sendMutex);
+    m_outgoing.push_back(makeFrame(opcode, data, size));
+}
+
+WebSocketClient::OutgoingFrame WebSocketClient::makeFrame(WebSocket::Opcode opcode, const uint8_t* data, size_t size) {
+    // Caller holds m_sendMutex (guards the mask RNG and spare buffers)
+    uint8_t maskKey[4];
+    uint32_t random = m_maskRng();
+    std::memcpy(maskKey, &random, sizeof(maskKey));
+
+    OutgoingFrame frame;
+    frame.headerLength = WebSocket::writeFrameHeader(frame.header, opcode, size, true, maskKey);
+    if (!m_spareBuffers.empty()) {
+        frame.payload = std::move(m_spareBuffers.back());
+        m_spareBuffers.pop_back();
+    }
+    frame.payload.assign(data, data + size);
+    WebSocket::applyMask(frame.payload.data(), size, maskKey);
+    return frame;
+}
+
+// ============================================================================
+// Event loop (network thread)
+// ============================================================================
+
+void WebSocketClient::run(const std::atomic<bool>& running) {
+    while (running && m_state != State::Closed) {
+        poll(100);
+    }
+
+    // Best-effort close handshake without holding up the owner
+    if (m_state == State::Open) {
+        close();
+        poll(0);
+    }
+    shutdown("client shutdown");
+}
+
+void WebSocketClient::poll(int timeoutMs) {
+    drainPending();
+    updateInterest();
+
+    if (m_poller.wait(m_events, timeoutMs) < 0) {
+        fail(std::string("poll failed: ") + std::strerror(errno));
+        return;
+    }
+
+    for (const auto& event : m_events) {
+        if (event.fd != m_fd) continue;
+
+        if (m_state == State::Connecting) {
+            if (event.writable || event.hangup) onConnected();
+            continue;
+        }
+        if (event.readable || event.hangup) onReadable();
+        if (m_fd >= 0 && event.writable) onWritable();
+    }
+
+    // Flush whatever was produced during the wait right away rather than
+    // waiting a round trip for a writable event
+    drainPending();
+    if (!m_outgoing.empty()) onWritable();
+
+    checkTimers();
+}
+
+void WebSocketClient::drainPending() {
+    State state = m_state;
+    bool closeQueued;
+    {
+        std::lock_guard<std::mutex> lock(m_sendMutex);
+        closeQueued = m_closeQueued;
+        if (state == State::Open || state == State::Closing) {
+            while (!m_pending.empty()) {
+                m_outgoing.push_back(std::move(m_pending.front()));
+                m_pending.pop_front();
+            }
+        }
+    }
+
+    if (!closeQueued) return;
+    if (state == State::Open) {
+        m_state = State::Closing;
+        m_closeStarted = std::chrono::steady_clock::now();
+    } else if (state != State::Closing && state != State::Closed) {
+        shutdown("closed before open");
+    }
+}
+
+void WebSocketClient::onReadable() {
+    if (m_state == State::Securing) {
+        onWritable();
+        return;
+    }
+
+    bool peerClosed = false;
+    for (int i = 0; i < kMaxReadsPerEvent; ++i) {
+        if (m_readBuffer.size() - m_readLength < kMinReadSpace) {
+            m_readBuffer.resize(std::max(m_readBuffer.size() * 2, m_readLength + kMinReadSpace));
+        }
+
+        size_t bytesRead = 0;
+        TransportResult result = m_transport->read(m_readBuffer.data() + m_readLength,
+                                                   m_readBuffer.size() - m_readLength, bytesRead);
+        if (result == TransportResult::Done) {
+            m_readLength += bytesRead;
+            continue;
+        }
+        if (result == TransportResult::Closed) {
+            peerClosed = true;
+        } else if (result == TransportResult::Failed) {
+            fail(std::string("read failed: ") + std::strerror(errno));
+            return;
+        }
+        break;
+    }
+    m_lastReceive = std::chrono::steady_clock::now();
+
+    bool ok = true;
+    if (m_state == State::Upgrading) ok = processUpgradeResponse();
+    if (ok && (m_state == State::Open || m_state == State::Closing)) ok = processFrames();
+
+    if (ok && peerClosed) {
+        shutdown("connection closed by server");
+    }
+}
+
+bool WebSocketClient::processFrames() {
+    size_t offset = 0;
+    while (offset < m_readLength) {
+        WebSocket::FrameHeader header;
+        auto result = WebSocket::parseFrameHeader(m_readBuffer.data() + offset, m_readLength - offset, header);
+        if (result == WebSocket::ParseResult::NeedMoreData) break;
+        if (result == WebSocket::ParseResult::ProtocolError) {
+            fail("malformed frame");
+            return false;
+        }
+        if (header.payloadLength > m_config.maxMessageSize) {
+            fail("frame exceeds maxMessageSize");
+            return false;
+        }
+        if (header.masked) {
+            // RFC 6455 5.1: a client must close on a masked frame from the server
+            fail("masked frame from server");
+            return false;
+        }
+
+        size_t frameLength = header.headerLength + static_cast<size_t>(header.payloadLength);
+        if (m_readLength - offset < frameLength) {
+            // Make room for the whole frame so it arrives without repeated regrowth
+            if (m_readBuffer.size() < frameLength + kMinReadSpace) {
+                std::memmove(m_readBuffer.data(), m_readBuffer.data() + offset, m_readLength - offset);
+                m_readLength -= offset;
+                offset = 0;
+                m_readBuffer.resize(frameLength + kMinReadSpace);
+            }
+            break;
+        }
+
+        uint8_t* payload = m_readBuffer.data() + offset + header.headerLength;
+        size_t payloadLength = static_cast<size_t>(header.payloadLength);
+        offset += frameLength;
+
+        if (!handleFrame(header, payload, payloadLength)) {
+            return false;
+        }
+    }
+
+    if (offset > 0) {
+        std::memmove(m_readBuffer.data(), m_readBuffer.data() + offset, m_readLength - offset);
+        m_readLength -= offset;
+    }
+    return true;
+}
+
+bool WebSocketClient::handleFrame(const WebSocket::FrameHeader& header, uint8_t* payload, size_t size) {
+    using WebSocket::Opcode;
+
+    switch (header.opcode) {
+        case Opcode::Ping:
+            queueControl(Opcode::Pong, payload, size);
+            return true;
+
+        case Opcode::Pong:
+            return true; // m_lastReceive already refreshed
+
+        case Opcode::Close:
+            if (m_state == State::Open) {
+                // Echo the status code, flush, and drop the connection
+                queueControl(Opcode::Close, payload, std::min<size_t>(size, 2));
+                onWritable();
+            }
+            shutdown(m_state == State::Closing ? "closed" : "closed by server");
+            return false;
+
+        case Opcode::Text:
+        case Opcode::Binary:
+            if (m_inFragment) {
+                fail("new message inside a fragmented message");
+                return false;
+            }
+            if (header.fin) {
+                // Common case: deliver straight from the read buffer
+                if (m_messageCallback) m_messageCallback(header.opcode, payload, size);
+            } else {
+                m_inFragment = true;
+                m_fragmentOpcode = header.opcode;
+                m_fragmentBuffer.assign(payload, payload + size);
+            }
+            return true;
+
+        case Opcode::Continuation:
+            if (!m_inFragment) {
+                fail("unexpected continuation frame");
+                return false;
+            }
+            if (m_fragmentBuffer.size() + size > m_config.maxMessageSize) {
+                fail("message exceeds maxMessageSize");
+                return false;
+            }
+            m_fragmentBuffer.insert(m_fragmentBuffer.end(), payload, payload + size);
+            if (header.fin) {
+                m_inFragment = false;
+                if (m_messageCallback) m_messageCallback(m_fragmentOpcode, m_fragmentBuffer.data(), m_fragmentBuffer.size());
+                m_fragmentBuffer.clear();
+            }
+            return true;
+    }
+
+    fail("unknown opcode");
+    return false;
+}
+
+void WebSocketClient::onWritable() {
+    if (!m_transport) return;
+
+    if (m_state == State::Securing) {
+        TransportResult result = m_transport->handshake();
+        if (result == TransportResult::Done) {
+            sendUpgradeRequest();
+        } else if (result != TransportResult::WouldBlock) {
+            fail("TLS handshake failed");
+        }
+        return;
+    }
+
+    while (!m_outgoing.empty()) {
+        // Gather headers and payloads of queued frames into one vectored write
+        int iovCount = 0;
+        size_t skip = m_outgoingOffset;
+        size_t frameCount = std::min(m_outgoing.size(), static_cast<size_t>(m_config.maxFramesPerWrite));
+        for (size_t i = 0; i < frameCount; ++i) {
+            OutgoingFrame& frame = m_outgoing[i];
+            if (skip < frame.headerLength) {
+                m_iov[iovCount].iov_base = frame.header + skip;
+                m_iov[iovCount].iov_len = frame.headerLength - skip;
+                ++iovCount;
+                skip = 0;
+            } else {
+                skip -= frame.headerLength;
+            }
+            if (skip < frame.payload.size()) {
+                m_iov[iovCount].iov_base = frame.payload.data() + skip;
+                m_iov[iovCount].iov_len = frame.payload.size() - skip;
+                ++iovCount;
+            }
+            skip = 0;
+        }
+
+        size_t written = 0;
+        TransportResult result = m_transport->writev(m_iov.data(), iovCount, written);
+        if (result == TransportResult::WouldBlock) break;
+        if (result != TransportResult::Done) {
+            fail(std::string("write failed: ") + std::strerror(errno));
+            return;
+        }
+
+        // Retire fully written frames and recycle their payload buffers
+        written += m_outgoingOffset;
+        std::lock_guard<std::mutex> lock(m_sendMutex);
+        while (!m_outgoing.empty() && written >= m_outgoing.front().size()) {
+            written -= m_outgoing.front().size();
+            if (m_spareBuffers.size() < kMaxSpareBuffers) {
+                m_outgoing.front().payload.clear();
+                m_spareBuffers.push_back(std::move(m_outgoing.front().payload));
+            }
+            m_outgoing.pop_front();
+        }
+        m_outgoingOffset = written;
+        if (m_outgoingOffset > 0) break; // Socket buffer is full
+    }
+}
+
+void WebSocketClient::checkTimers() {
+    auto now = std::chrono::steady_clock::now();
+    State state = m_state;
+
+    if (state == State::Closing) {
+        if (secondsBetween(m_closeStarted, now) > m_config.closeTimeout) {
+            shutdown("close timed out");
+        }
+        return;
+    }
+    if (state == State::Closed || state == State::Idle) return;
+
+    double silence = secondsBetween(m_lastReceive, now);
+    if (silence > m_config.idleTimeout) {
+        fail(state == State::Open ? "connection timed out" : "handshake timed out");
+        return;
+    }
+    if (state == State::Open && silence > m_config.pingInterval &&
+        secondsBetween(m_lastPing, now) > m_config.pingInterval) {
+        queueControl(WebSocket::Opcode::Ping, nullptr, 0);
+        m_lastPing = now;
+    }
+}
+
+void WebSocketClient::updateInterest() {
+    if (m_fd < 0) return;
+    bool wantWrite = m_state == State::Connecting || !m_outgoing.empty() ||
+                     (m_transport && m_transport->wantsWrite());
+    if (wantWrite != m_wantWrite) {
+        m_poller.modify(m_fd, true, wantWrite);
+        m_wantWrite = wantWrite;
+    }
+}
+
+void WebSocketClient::fail(const std::string& reason) {
+    std::cerr << "[Network] WebSocket error: " << reason << std::endl;
+    shutdown(reason);
+}
+
+void WebSocketClient::shutdown(const std::string& reason) {
+    if (m_fd >= 0) {
+        m_poller.remove(m_fd);
+        m_transport.reset();
+        ::close(m_fd);
+        m_fd = -1;
+    }
+
+    State previous = m_state.exchange(State::Closed);
+    m_outgoing.clear();
+    m_outgoingOffset = 0;
+    m_readLength = 0;
+    m_inFragment = false;
+    {
+        std::lock_guard<std::mutex> lock(m_sendMutex);
+        m_pending.clear();
+    }
+
+    if (previous != State::Closed && m_closeCallback) {
+        m_closeCallback(reason);
+    }
+}
+
+} // namespace FinalStorm
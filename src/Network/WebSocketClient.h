@@ -0,0 +1,169 @@
+// src/Network/WebSocketClient.h
+// Non-blocking RFC 6455 client driven by the owner's network thread
+// Transport is pluggable so TLS can be provided by the platform layer
+
+#pragma once
+#include "Network/EventPoller.h"
+#include "Network/WebSocketProtocol.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+#include <sys/uio.h>
+
+namespace FinalStorm {
+
+enum class TransportResult {
+    Done,
+    WouldBlock,
+    Closed,
+    Failed
+};
+
+// Byte stream under the WebSocket layer. The default is plain TCP; a TLS
+// implementation wraps the connected socket and is installed through
+// WebSocketClient::setTlsTransportFactory.
+class WebSocketTransport {
+public:
+    virtual ~WebSocketTransport() = default;
+
+    // Drives any transport-level negotiation after TCP connects
+    virtual TransportResult handshake() { return TransportResult::Done; }
+
+    virtual TransportResult read(uint8_t* buffer, size_t capacity, size_t& bytesRead) = 0;
+    virtual TransportResult writev(const iovec* iov, int count, size_t& bytesWritten) = 0;
+
+    // TLS may need writable events even with nothing queued (renegotiation)
+    virtual bool wantsWrite() const { return false; }
+};
+
+class WebSocketClient {
+public:
+    enum class State {
+        Idle,
+        Connecting,     // TCP connect in flight
+        Securing,       // Transport handshake (TLS)
+        Upgrading,      // HTTP upgrade sent, waiting for 101
+        Open,
+        Closing,        // Close frame sent, waiting for the peer's
+        Closed
+    };
+
+    struct Config {
+        size_t readChunkSize = 64 * 1024;       // Initial read buffer, grows for larger frames
+        size_t maxMessageSize = 16 * 1024 * 1024;
+        int maxFramesPerWrite = 64;             // Frames gathered into one writev
+        double pingInterval = 15.0;             // Idle seconds before a keepalive ping
+        double idleTimeout = 45.0;              // Silence before the connection is dropped
+        double closeTimeout = 2.0;
+    };
+
+    using OpenCallback = std::function<void()>;
+    using MessageCallback = std::function<void(WebSocket::Opcode opcode, const uint8_t* data, size_t size)>;
+    using CloseCallback = std::function<void(const std::string& reason)>;
+    using TlsTransportFactory = std::function<std::unique_ptr<WebSocketTransport>(int fd, const std::string& host)>;
+
+    WebSocketClient();
+    explicit WebSocketClient(const Config& config);
+    ~WebSocketClient();
+
+    // Callbacks run on the network thread
+    void setOpenCallback(OpenCallback callback) { m_openCallback = callback; }
+    void setMessageCallback(MessageCallback callback) { m_messageCallback = callback; }
+    void setCloseCallback(CloseCallback callback) { m_closeCallback = callback; }
+
+    // Required for wss:// URLs; without it secure connections fail cleanly
+    static void setTlsTransportFactory(TlsTransportFactory factory);
+
+    // Network thread: resolves the host (blocking) and starts a non-blocking connect
+    bool connect(const std::string& url);
+
+    // Network thread: one event loop iteration, or loop until running clears
+    void poll(int timeoutMs);
+    void run(const std::atomic<bool>& running);
+
+    // Any thread: frames are queued and flushed by the network thread
+    void sendText(const std::string& text);
+    void sendBinary(const uint8_t* data, size_t size);
+    void close(uint16_t code = 1000);
+
+    State getState() const { return m_state; }
+    bool isOpen() const { return m_state == State::Open; }
+
+private:
+    struct OutgoingFrame {
+        uint8_t header[WebSocket::MaxFrameHeaderSize];
+        size_t headerLength = 0;
+        std::vector<uint8_t> payload;
+        size_t size() const { return headerLength + payload.size(); }
+    };
+
+    bool parseUrl(const std::string& url);
+    void queueFrame(WebSocket::Opcode opcode, const uint8_t* data, size_t size);
+    void queueControl(WebSocket::Opcode opcode, const uint8_t* data, size_t size);
+    OutgoingFrame makeFrame(WebSocket::Opcode opcode, const uint8_t* data, size_t size);
+
+    void drainPending();
+    void onConnected();
+    void onReadable();
+    void onWritable();
+    void sendUpgradeRequest();
+    bool processUpgradeResponse();
+    bool processFrames();
+    bool handleFrame(const WebSocket::FrameHeader& header, uint8_t* payload, size_t size);
+    void checkTimers();
+    void updateInterest();
+    void fail(const std::string& reason);
+    void shutdown(const std::string& reason);
+
+    Config m_config;
+    std::atomic<State> m_state;
+
+    // Connection target
+    bool m_secure;
+    std::string m_host;
+    std::string m_port;
+    std::string m_path;
+    std::string m_handshakeKey;
+
+    int m_fd;
+    EventPoller m_poller;
+    std::unique_ptr<WebSocketTransport> m_transport;
+    bool m_wantWrite;
+    std::vector<PollEvent> m_events;
+
+    // Inbound: one buffer reused across frames, parsed and unmasked in place
+    std::vector<uint8_t> m_readBuffer;
+    size_t m_readLength;
+    std::vector<uint8_t> m_fragmentBuffer;
+    WebSocket::Opcode m_fragmentOpcode;
+    bool m_inFragment;
+
+    // Outbound: producers append to m_pending, the network thread drains into
+    // m_outgoing and gathers up to maxFramesPerWrite frames per writev
+    std::mutex m_sendMutex;
+    std::deque<OutgoingFrame> m_pending;
+    std::vector<std::vector<uint8_t>> m_spareBuffers;
+    std::mt19937 m_maskRng;
+    std::deque<OutgoingFrame> m_outgoing;
+    size_t m_outgoingOffset;
+    std::vector<iovec> m_iov;
+    bool m_closeQueued;
+
+    // Keepalive
+    std::chrono::steady_clock::time_point m_lastReceive;
+    std::chrono::steady_clock::time_point m_lastPing;
+    std::chrono::steady_clock::time_point m_closeStarted;
+
+    OpenCallback m_openCallback;
+    MessageCallback m_messageCallback;
+    CloseCallback m_closeCallback;
+};
+
+} // namespace FinalStorm
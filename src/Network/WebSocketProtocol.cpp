@@ -0,0 +1,208 @@
+// src/Network/WebSocketProtocol.cpp
+// RFC 6455 framing and handshake helpers implementation
+
+#include "Network/WebSocketProtocol.h"
+#include <cstring>
+
+namespace FinalStorm {
+namespace WebSocket {
+
+namespace {
+
+constexpr const char* kHandshakeGuid = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+inline uint32_t rotl(uint32_t value, int bits) {
+    return (value << bits) | (value >> (32 - bits));
+}
+
+} // namespace
+
+std::string base64Encode(const uint8_t* data, size_t size) {
+    static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string out;
+    out.reserve(((size + 2) / 3) * 4);
+
+    size_t i = 0;
+    while (i + 2 < size) {
+        uint32_t n = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+        out += table[(n >> 18) & 63];
+        out += table[(n >> 12) & 63];
+        out += table[(n >> 6) & 63];
+        out += table[n & 63];
+        i += 3;
+    }
+
+    if (i + 1 == size) {
+        uint32_t n = data[i] << 16;
+        out += table[(n >> 18) & 63];
+        out += table[(n >> 12) & 63];
+        out += "==";
+    } else if (i + 2 == size) {
+        uint32_t n = (data[i] << 16) | (data[i + 1] << 8);
+        out += table[(n >> 18) & 63];
+        out += table[(n >> 12) & 63];
+        out += table[(n >> 6) & 63];
+        out += '=';
+    }
+    return out;
+}
+
+void sha1(const uint8_t* data, size_t size, uint8_t digest[20]) {
+    uint32_t h[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+
+    // Pad: 0x80, zeros, then the 64-bit big-endian bit length
+    std::vector<uint8_t> message(data, data + size);
+    message.push_back(0x80);
+    while (message.size() % 64 != 56) {
+        message.push_back(0);
+    }
+    uint64_t bitLength = static_cast<uint64_t>(size) * 8;
+    for (int i = 7; i >= 0; --i) {
+        message.push_back(static_cast<uint8_t>(bitLength >> (i * 8)));
+    }
+
+    for (size_t chunk = 0; chunk < message.size(); chunk += 64) {
+        uint32_t w[80];
+        for (int i = 0; i < 16; ++i) {
+            const uint8_t* p = &message[chunk + i * 4];
+            w[i] = (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+        }
+        for (int i = 16; i < 80; ++i) {
+            w[i] = rotl(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+        }
+
+        uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+        for (int i = 0; i < 80; ++i) {
+            uint32_t f, k;
+            if (i < 20) {
+                f = (b & c) | (~b & d);
+                k = 0x5A827999;
+            } else if (i < 40) {
+                f = b ^ c ^ d;
+                k = 0x6ED9EBA1;
+            } else if (i < 60) {
+                f = (b & c) | (b & d) | (c & d);
+                k = 0x8F1BBCDC;
+            } else {
+                f = b ^ c ^ d;
+                k = 0xCA62C1D6;
+            }
+            uint32_t temp = rotl(a, 5) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = rotl(b, 30);
+            b = a;
+            a = temp;
+        }
+
+        h[0] += a;
+        h[1] += b;
+        h[2] += c;
+        h[3] += d;
+        h[4] += e;
+    }
+
+    for (int i = 0; i < 5; ++i) {
+        digest[i * 4 + 0] = static_cast<uint8_t>(h[i] >> 24);
+        digest[i * 4 + 1] = static_cast<uint8_t>(h[i] >> 16);
+        digest[i * 4 + 2] = static_cast<uint8_t>(h[i] >> 8);
+        digest[i * 4 + 3] = static_cast<uint8_t>(h[i]);
+    }
+}
+
+std::string computeAcceptKey(const std::string& clientKey) {
+    std::string combined = clientKey + kHandshakeGuid;
+    uint8_t digest[20];
+    sha1(reinterpret_cast<const uint8_t*>(combined.data()), combined.size(), digest);
+    return base64Encode(digest, sizeof(digest));
+}
+
+size_t writeFrameHeader(uint8_t* header, Opcode opcode, uint64_t payloadLength,
+                        bool fin, const uint8_t* maskKey) {
+    size_t length = 0;
+    header[length++] = static_cast<uint8_t>((fin ? 0x80 : 0x00) | static_cast<uint8_t>(opcode));
+
+    uint8_t maskBit = maskKey ? 0x80 : 0x00;
+    if (payloadLength < 126) {
+        header[length++] = maskBit | static_cast<uint8_t>(payloadLength);
+    } else if (payloadLength <= 0xFFFF) {
+        header[length++] = maskBit | 126;
+        header[length++] = static_cast<uint8_t>(payloadLength >> 8);
+        header[length++] = static_cast<uint8_t>(payloadLength);
+    } else {
+        header[length++] = maskBit | 127;
+        for (int i = 7; i >= 0; --i) {
+            header[length++] = static_cast<uint8_t>(payloadLength >> (i * 8));
+        }
+    }
+
+    if (maskKey) {
+        std::memcpy(header + length, maskKey, 4);
+        length += 4;
+    }
+    return length;
+}
+
+void appendFrame(std::vector<uint8_t>& out, Opcode opcode, const uint8_t* payload, size_t size,
+                 bool fin, const uint8_t* maskKey) {
+    uint8_t header[MaxFrameHeaderSize];
+    size_t headerLength = writeFrameHeader(header, opcode, size, fin, maskKey);
+
+    size_t start = out.size();
+    out.resize(start + headerLength + size);
+    std::memcpy(out.data() + start, header, headerLength);
+    if (size > 0) {
+        std::memcpy(out.data() + start + headerLength, payload, size);
+        if (maskKey) {
+            applyMask(out.data() + start + headerLength, size, maskKey);
+        }
+    }
+}
+
+ParseResult parseFrameHeader(const uint8_t* data, size_t size, FrameHeader& header) {
+    if (size < 2) return ParseResult::NeedMoreData;
+
+    header.fin = (data[0] & 0x80) != 0;
+    if ((data[0] & 0x70) != 0) return ParseResult::ProtocolError; // No extensions negotiated
+    header.opcode = static_cast<Opcode>(data[0] & 0x0F);
+    header.masked = (data[1] & 0x80) != 0;
+
+    size_t offset = 2;
+    uint64_t length = data[1] & 0x7F;
+    if (length == 126) {
+        if (size < offset + 2) return ParseResult::NeedMoreData;
+        length = (static_cast<uint64_t>(data[2]) << 8) | data[3];
+        offset += 2;
+    } else if (length == 127) {
+        if (size < offset + 8) return ParseResult::NeedMoreData;
+        length = 0;
+        for (int i = 0; i < 8; ++i) {
+            length = (length << 8) | data[offset + i];
+        }
+        offset += 8;
+    }
+
+    if (isControl(header.opcode) && (length > 125 || !header.fin)) {
+        return ParseResult::ProtocolError;
+    }
+
+    if (header.masked) {
+        if (size < offset + 4) return ParseResult::NeedMoreData;
+        std::memcpy(header.maskKey, data + offset, 4);
+        offset += 4;
+    }
+
+    header.payloadLength = length;
+    header.headerLength = offset;
+    return ParseResult::Complete;
+}
+
+void applyMask(uint8_t* data, size_t size, const uint8_t maskKey[4], size_t offset) {
+    for (size_t i = 0; i < size; ++i) {
+        data[i] ^= maskKey[(i + offset) & 3];
+    }
+}
+
+} // namespace WebSocket
+} // namespace FinalStorm
@@ -0,0 +1,64 @@
+// src/Network/WebSocketProtocol.h
+// RFC 6455 framing and handshake helpers
+// Shared by the client transport and the local synthetic server
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace FinalStorm {
+namespace WebSocket {
+
+enum class Opcode : uint8_t {
+    Continuation = 0x0,
+    Text = 0x1,
+    Binary = 0x2,
+    Close = 0x8,
+    Ping = 0x9,
+    Pong = 0xA
+};
+
+constexpr size_t MaxFrameHeaderSize = 14;
+
+struct FrameHeader {
+    bool fin = true;
+    Opcode opcode = Opcode::Binary;
+    bool masked = false;
+    uint8_t maskKey[4] = { 0, 0, 0, 0 };
+    uint64_t payloadLength = 0;
+    size_t headerLength = 0;
+};
+
+enum class ParseResult {
+    Complete,
+    NeedMoreData,
+    ProtocolError
+};
+
+// Handshake
+std::string base64Encode(const uint8_t* data, size_t size);
+void sha1(const uint8_t* data, size_t size, uint8_t digest[20]);
+std::string computeAcceptKey(const std::string& clientKey);
+
+// Writes a frame header into header (at least MaxFrameHeaderSize bytes)
+// and returns its length. Pass maskKey for client-to-server frames.
+size_t writeFrameHeader(uint8_t* header, Opcode opcode, uint64_t payloadLength,
+                        bool fin = true, const uint8_t* maskKey = nullptr);
+
+// Appends a complete frame to out, masking the payload if maskKey is set
+void appendFrame(std::vector<uint8_t>& out, Opcode opcode, const uint8_t* payload, size_t size,
+                 bool fin = true, const uint8_t* maskKey = nullptr);
+
+ParseResult parseFrameHeader(const uint8_t* data, size_t size, FrameHeader& header);
+
+// XOR payload bytes with the mask; offset is the position within the payload
+void applyMask(uint8_t* data, size_t size, const uint8_t maskKey[4], size_t offset = 0);
+
+inline bool isControl(Opcode opcode) {
+    return (static_cast<uint8_t>(opcode) & 0x8) != 0;
+}
+
+} // namespace WebSocket
+} // namespace FinalStorm
@@ -36,6 +36,7 @@
     if (!self.app->initialize(self.renderer)) {
         NSLog(@"Failed to initialize FinalStorm app!");
     }
+    self.app->setViewSize(self.metalView.bounds.size.width, self.metalView.bounds.size.height);
     
     // Connect to local server
     self.app->connectToServer("ws://localhost:3000/ws");
@@ -76,6 +77,7 @@
 
 - (void)mtkView:(MTKView *)view drawableSizeWillChange:(CGSize)size {
     self.app->resize(size.width, size.height);
+    self.app->setViewSize(view.bounds.size.width, view.bounds.size.height);
 }
 
 #pragma mark - Gesture Handlers
@@ -108,6 +110,9 @@
     event.gesture = FinalStorm::GestureType::Pinch;
     event.gestureValue = gesture.scale;
     
+    // Report the change since the last callback rather than the running total
+    gesture.scale = 1.0;
+    
     self.app->handleInput(event);
 }
 
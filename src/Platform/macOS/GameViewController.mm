@@ -8,6 +8,8 @@
 #import "GameViewController.h"
 #include "Network/FinalverseClient.h"
 #include "Core/Input/InteractionManager.h"
+#include "Core/Input/InputQueue.h"
+#include <vector>
 
 @implementation GameViewController
 {
@@ -15,6 +17,8 @@
     MetalRenderer *_renderer;
     std::unique_ptr<FinalStorm::FinalverseClient> _client;
     std::shared_ptr<FinalStorm::InteractionManager> _interactionManager;
+    std::unique_ptr<FinalStorm::InputQueue> _inputQueue;
+    std::vector<FinalStorm::InputEvent> _frameEvents;
 
     CVDisplayLinkRef _displayLink;
     dispatch_source_t _displaySource;
@@ -48,6 +52,7 @@
     _interactionManager = std::make_shared<FinalStorm::InteractionManager>();
     _interactionManager->setCamera(_renderer.camera);
     _interactionManager->setSceneRoot(_renderer.sceneRoot);
+    _inputQueue = std::make_unique<FinalStorm::InputQueue>();
     
     _view.delegate = _renderer;
     
@@ -105,6 +110,16 @@ static CVReturn displayLinkCallback(CVDisplayLinkRef displayLink,
     dispatch_async(dispatch_get_main_queue(), ^{
         [self->_renderer updateWithDeltaTime:deltaTime];
         
+        // Input queued since the last frame, pointer moves folded to one
+        if (self->_interactionManager && self->_inputQueue) {
+            self->_interactionManager->setViewport(simd_make_float2(self->_view.bounds.size.width, self->_view.bounds.size.height));
+            self->_inputQueue->drain(self->_frameEvents);
+            for (const FinalStorm::InputEvent& inputEvent : self->_frameEvents) {
+                self->_interactionManager->handleEvent(inputEvent);
+            }
+            self->_interactionManager->update(deltaTime);
+        }
+        
         // Update network client
         if (self->_client) {
             self->_client->update();
@@ -120,37 +135,36 @@ static CVReturn displayLinkCallback(CVDisplayLinkRef displayLink,
     });
 }
 
+// Handled on the next frame; positions are flipped to a top-left origin
+- (void)queueEvent:(NSEvent *)event type:(FinalStorm::InputEventType)type location:(NSPoint)locationInView
+{
+    if (!_inputQueue) return;
+    FinalStorm::InputEvent inputEvent;
+    inputEvent.type = type;
+    inputEvent.timestamp = event.timestamp;
+    inputEvent.position = simd_make_float2(locationInView.x, _view.bounds.size.height - locationInView.y);
+    _inputQueue->push(inputEvent);
+}
+
 - (void)mouseDown:(NSEvent *)event
 {
     NSPoint locationInView = [_view convertPoint:[event locationInWindow] fromView:nil];
     [_renderer handleMouseDown:locationInView];
-    if (_interactionManager) {
-        FinalStorm::float2 viewport = simd_make_float2(_view.bounds.size.width, _view.bounds.size.height);
-        FinalStorm::float2 pos = simd_make_float2(locationInView.x, locationInView.y);
-        _interactionManager->handleTouchBegan(pos, viewport);
-    }
+    [self queueEvent:event type:FinalStorm::InputEventType::MouseDown location:locationInView];
 }
 
 - (void)mouseDragged:(NSEvent *)event
 {
     NSPoint locationInView = [_view convertPoint:[event locationInWindow] fromView:nil];
     [_renderer handleMouseDragged:locationInView];
-    if (_interactionManager) {
-        FinalStorm::float2 viewport = simd_make_float2(_view.bounds.size.width, _view.bounds.size.height);
-        FinalStorm::float2 pos = simd_make_float2(locationInView.x, locationInView.y);
-        _interactionManager->handleTouchMoved(pos, viewport);
-    }
+    [self queueEvent:event type:FinalStorm::InputEventType::MouseMove location:locationInView];
 }
 
 - (void)mouseUp:(NSEvent *)event
 {
     NSPoint locationInView = [_view convertPoint:[event locationInWindow] fromView:nil];
     [_renderer handleMouseUp:locationInView];
-    if (_interactionManager) {
-        FinalStorm::float2 viewport = simd_make_float2(_view.bounds.size.width, _view.bounds.size.height);
-        FinalStorm::float2 pos = simd_make_float2(locationInView.x, locationInView.y);
-        _interactionManager->handleTouchEnded(pos, viewport);
-    }
+    [self queueEvent:event type:FinalStorm::InputEventType::MouseUp location:locationInView];
 }
 
 - (void)keyDown:(NSEvent *)event
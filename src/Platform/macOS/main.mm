@@ -38,6 +38,8 @@
         [NSApp terminate:nil];
     }
     
+    self.app->setViewSize(self.metalView.bounds.size.width, self.metalView.bounds.size.height);
+    
     // Connect to local server
     self.app->connectToServer("ws://localhost:3000/ws");
     
@@ -75,6 +77,7 @@
 
 - (void)mtkView:(MTKView *)view drawableSizeWillChange:(CGSize)size {
     self.app->resize(size.width, size.height);
+    self.app->setViewSize(view.bounds.size.width, view.bounds.size.height);
 }
 
 #pragma mark - Input Handling
@@ -83,6 +86,7 @@
     NSPoint locationInView = [self.view convertPoint:event.locationInWindow fromView:nil];
     
     FinalStorm::InputEvent inputEvent;
+    inputEvent.timestamp = event.timestamp;
     inputEvent.type = FinalStorm::InputEventType::MouseDown;
     inputEvent.mouseButton = FinalStorm::MouseButton::Left;
     inputEvent.position = FinalStorm::float2(locationInView.x, self.view.bounds.size.height - locationInView.y);
@@ -94,6 +98,19 @@
     NSPoint locationInView = [self.view convertPoint:event.locationInWindow fromView:nil];
     
     FinalStorm::InputEvent inputEvent;
+    inputEvent.timestamp = event.timestamp;
+    inputEvent.type = FinalStorm::InputEventType::MouseMove;
+    inputEvent.position = FinalStorm::float2(locationInView.x, self.view.bounds.size.height - locationInView.y);
+    inputEvent.delta = FinalStorm::float2(event.deltaX, -event.deltaY);
+    
+    self.app->handleInput(inputEvent);
+}
+
+- (void)mouseMoved:(NSEvent *)event {
+    NSPoint locationInView = [self.view convertPoint:event.locationInWindow fromView:nil];
+    
+    FinalStorm::InputEvent inputEvent;
+    inputEvent.timestamp = event.timestamp;
     inputEvent.type = FinalStorm::InputEventType::MouseMove;
     inputEvent.position = FinalStorm::float2(locationInView.x, self.view.bounds.size.height - locationInView.y);
     inputEvent.delta = FinalStorm::float2(event.deltaX, -event.deltaY);
@@ -105,6 +122,7 @@
     NSPoint locationInView = [self.view convertPoint:event.locationInWindow fromView:nil];
     
     FinalStorm::InputEvent inputEvent;
+    inputEvent.timestamp = event.timestamp;
     inputEvent.type = FinalStorm::InputEventType::MouseUp;
     inputEvent.mouseButton = FinalStorm::MouseButton::Left;
     inputEvent.position = FinalStorm::float2(locationInView.x, self.view.bounds.size.height - locationInView.y);
@@ -114,6 +132,7 @@
 
 - (void)keyDown:(NSEvent *)event {
     FinalStorm::InputEvent inputEvent;
+    inputEvent.timestamp = event.timestamp;
     inputEvent.type = FinalStorm::InputEventType::KeyDown;
     inputEvent.keyCode = event.keyCode;
     
@@ -122,6 +141,7 @@
 
 - (void)keyUp:(NSEvent *)event {
     FinalStorm::InputEvent inputEvent;
+    inputEvent.timestamp = event.timestamp;
     inputEvent.type = FinalStorm::InputEventType::KeyUp;
     inputEvent.keyCode = event.keyCode;
     
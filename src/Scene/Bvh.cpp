@@ -0,0 +1,400 @@
+// src/Scene/Bvh.cpp
+// Bounding volume hierarchy build, refit and triangle ray tests
+
+#include "Scene/Bvh.h"
+#include <limits>
+
+namespace FinalStorm {
+
+namespace {
+
+// Centroid bins per split search; more finds slightly better splits, slower
+constexpr int BinCount = 12;
+
+// Relative cost of visiting a node against testing one primitive
+constexpr float TraversalCost = 1.0f;
+
+// Leaves larger than this are split even when the heuristic would keep them
+constexpr uint32_t MaxLeafFallback = 16;
+
+// Refit trees are rebuilt once their cost grows this much past the build's
+constexpr float RebuildRatio = 1.5f;
+
+// Plain-float box for the build and refit loops, which run over every
+// primitive many times
+struct Box {
+    float lo[3];
+    float hi[3];
+
+    static Box empty() {
+        const float big = std::numeric_limits<float>::max();
+        return Box{ { big, big, big }, { -big, -big, -big } };
+    }
+
+    void grow(const Box& other) {
+        for (int axis = 0; axis < 3; ++axis) {
+            lo[axis] = std::min(lo[axis], other.lo[axis]);
+            hi[axis] = std::max(hi[axis], other.hi[axis]);
+        }
+    }
+
+    void grow(const float point[3]) {
+        for (int axis = 0; axis < 3; ++axis) {
+            lo[axis] = std::min(lo[axis], point[axis]);
+            hi[axis] = std::max(hi[axis], point[axis]);
+        }
+    }
+
+    bool isEmpty() const { return lo[0] > hi[0]; }
+
+    float surfaceArea() const {
+        if (isEmpty()) return 0.0f;
+        float x = hi[0] - lo[0];
+        float y = hi[1] - lo[1];
+        float z = hi[2] - lo[2];
+        return 2.0f * (x * y + y * z + z * x);
+    }
+};
+
+Box toBox(const Aabb& box) {
+    return Box{ { box.min.x, box.min.y, box.min.z }, { box.max.x, box.max.y, box.max.z } };
+}
+
+Box nodeBox(const Bvh::Node& node) {
+    return Box{ { node.min[0], node.min[1], node.min[2] }, { node.max[0], node.max[1], node.max[2] } };
+}
+
+// An empty node (every primitive in it removed) is stored as a point out at
+// the float limit: an inverted box would pass the slab test instead
+constexpr float EmptyNode = std::numeric_limits<float>::max();
+
+bool isEmptyNode(const Bvh::Node& node) {
+    return node.min[0] == EmptyNode;
+}
+
+void setNodeBounds(Bvh::Node& node, const Box& box) {
+    for (int axis = 0; axis < 3; ++axis) {
+        node.min[axis] = box.isEmpty() ? EmptyNode : box.lo[axis];
+        node.max[axis] = box.isEmpty() ? EmptyNode : box.hi[axis];
+    }
+}
+
+bool isFinite(const vec3& v) {
+    return std::isfinite(v.x) && std::isfinite(v.y) && std::isfinite(v.z);
+}
+
+} // namespace
+
+// ============================================================================
+// Aabb
+// ============================================================================
+
+Aabb Aabb::empty() {
+    const float big = std::numeric_limits<float>::max();
+    Aabb box;
+    box.min = make_vec3(big, big, big);
+    box.max = make_vec3(-big, -big, -big);
+    return box;
+}
+
+Aabb Aabb::fromSphere(const vec3& center, float radius) {
+    Aabb box;
+    box.min = center - make_vec3(radius, radius, radius);
+    box.max = center + make_vec3(radius, radius, radius);
+    return box;
+}
+
+void Aabb::grow(const vec3& point) {
+    min = make_vec3(std::min(min.x, point.x), std::min(min.y, point.y), std::min(min.z, point.z));
+    max = make_vec3(std::max(max.x, point.x), std::max(max.y, point.y), std::max(max.z, point.z));
+}
+
+void Aabb::grow(const Aabb& box) {
+    if (box.isEmpty()) return;
+    grow(box.min);
+    grow(box.max);
+}
+
+void Aabb::expand(float margin) {
+    if (isEmpty()) return;
+    min = min - make_vec3(margin, margin, margin);
+    max = max + make_vec3(margin, margin, margin);
+}
+
+float Aabb::surfaceArea() const {
+    if (isEmpty()) return 0.0f;
+    vec3 size = max - min;
+    return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+Aabb Aabb::transformed(const mat4& matrix) const {
+    if (isEmpty()) return *this;
+    Aabb result = empty();
+    for (int corner = 0; corner < 8; ++corner) {
+        vec4 point = make_vec4((corner & 1) ? max.x : min.x,
+                               (corner & 2) ? max.y : min.y,
+                               (corner & 4) ? max.z : min.z, 1.0f);
+        vec4 moved = matrix * point;
+        result.grow(make_vec3(moved.x, moved.y, moved.z));
+    }
+    return result;
+}
+
+// ============================================================================
+// Bvh
+// ============================================================================
+
+struct Bvh::BuildItem {
+    Box box;
+    float center[3];
+    uint32_t primitive;
+};
+
+void Bvh::build(const std::vector<Aabb>& boxes) {
+    m_nodes.clear();
+    m_order.resize(boxes.size());
+    if (boxes.empty()) {
+        m_cost = 0.0f;
+        return;
+    }
+
+    std::vector<BuildItem> items(boxes.size());
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        BuildItem& item = items[i];
+        item.box = toBox(boxes[i]);
+        item.primitive = static_cast<uint32_t>(i);
+        for (int axis = 0; axis < 3; ++axis) {
+            // Removed primitives (empty boxes) sort as if they sat at the origin
+            item.center[axis] = item.box.isEmpty() ? 0.0f : (item.box.lo[axis] + item.box.hi[axis]) * 0.5f;
+        }
+    }
+
+    m_nodes.reserve(boxes.size() * 2);
+    buildNode(items, 0, static_cast<uint32_t>(items.size()), 0);
+    for (size_t i = 0; i < items.size(); ++i) {
+        m_order[i] = items[i].primitive;
+    }
+    m_cost = computeCost();
+}
+
+uint32_t Bvh::buildNode(std::vector<BuildItem>& items, uint32_t first, uint32_t count, uint32_t depth) {
+    const uint32_t index = static_cast<uint32_t>(m_nodes.size());
+    m_nodes.push_back(Node());
+
+    Box bounds = Box::empty();
+    Box centerBounds = Box::empty();
+    for (uint32_t i = first; i < first + count; ++i) {
+        bounds.grow(items[i].box);
+        centerBounds.grow(items[i].center);
+    }
+    setNodeBounds(m_nodes[index], bounds);
+    m_nodes[index].offset = first;
+    m_nodes[index].count = count;
+
+    if (count <= MaxLeafSize || depth >= MaxDepth) {
+        return index;
+    }
+
+    // Split along the axis where the centers spread most
+    int axis = 0;
+    float extent = centerBounds.hi[0] - centerBounds.lo[0];
+    for (int candidate = 1; candidate < 3; ++candidate) {
+        float spread = centerBounds.hi[candidate] - centerBounds.lo[candidate];
+        if (spread > extent) {
+            extent = spread;
+            axis = candidate;
+        }
+    }
+
+    uint32_t split = first + count / 2;
+    if (extent > 0.0f) {
+        const float low = centerBounds.lo[axis];
+        const float scale = BinCount / extent;
+        auto binOf = [&](const BuildItem& item) {
+            return std::min(BinCount - 1, static_cast<int>((item.center[axis] - low) * scale));
+        };
+
+        Box binBounds[BinCount];
+        uint32_t binCounts[BinCount] = {};
+        for (int b = 0; b < BinCount; ++b) binBounds[b] = Box::empty();
+        for (uint32_t i = first; i < first + count; ++i) {
+            int b = binOf(items[i]);
+            binBounds[b].grow(items[i].box);
+            ++binCounts[b];
+        }
+
+        // Sweep from the right for suffix areas, then from the left scoring each plane
+        float rightArea[BinCount];
+        uint32_t rightCount[BinCount];
+        Box accumulated = Box::empty();
+        uint32_t accumulatedCount = 0;
+        for (int b = BinCount - 1; b > 0; --b) {
+            accumulated.grow(binBounds[b]);
+            accumulatedCount += binCounts[b];
+            rightArea[b] = accumulated.surfaceArea();
+            rightCount[b] = accumulatedCount;
+        }
+
+        float bestCost = std::numeric_limits<float>::max();
+        int bestPlane = -1;
+        accumulated = Box::empty();
+        accumulatedCount = 0;
+        for (int b = 0; b < BinCount - 1; ++b) {
+            accumulated.grow(binBounds[b]);
+            accumulatedCount += binCounts[b];
+            if (accumulatedCount == 0 || rightCount[b + 1] == 0) continue;
+            float cost = accumulatedCount * accumulated.surfaceArea() + rightCount[b + 1] * rightArea[b + 1];
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestPlane = b;
+            }
+        }
+
+        float leafCost = count * bounds.surfaceArea();
+        float splitCost = TraversalCost * bounds.surfaceArea() + bestCost;
+        if (bestPlane >= 0 && (splitCost < leafCost || count > MaxLeafFallback)) {
+            auto middle = std::partition(items.begin() + first, items.begin() + first + count,
+                                         [&](const BuildItem& item) { return binOf(item) <= bestPlane; });
+            split = static_cast<uint32_t>(middle - items.begin());
+        } else if (count <= MaxLeafFallback) {
+            return index;
+        }
+    }
+
+    // Coincident centers (or a degenerate plane): split the range in half
+    if (split == first || split == first + count) {
+        split = first + count / 2;
+    }
+
+    m_nodes[index].count = 0;
+    buildNode(items, first, split - first, depth + 1);
+    uint32_t right = buildNode(items, split, first + count - split, depth + 1);
+    m_nodes[index].offset = right;
+    return index;
+}
+
+void Bvh::refit(const std::vector<Aabb>& boxes) {
+    // Children always follow their parent, so one backward pass suffices
+    for (size_t i = m_nodes.size(); i-- > 0;) {
+        Node& node = m_nodes[i];
+        Box bounds = Box::empty();
+        if (node.count > 0) {
+            for (uint32_t slot = node.offset; slot < node.offset + node.count; ++slot) {
+                const Aabb& box = boxes[m_order[slot]];
+                if (!box.isEmpty()) bounds.grow(toBox(box));
+            }
+        } else {
+            const Node& left = m_nodes[i + 1];
+            const Node& right = m_nodes[node.offset];
+            if (!isEmptyNode(left)) bounds.grow(nodeBox(left));
+            if (!isEmptyNode(right)) bounds.grow(nodeBox(right));
+        }
+        setNodeBounds(node, bounds);
+    }
+    m_cost = computeCost();
+}
+
+void Bvh::clear() {
+    m_nodes.clear();
+    m_order.clear();
+    m_cost = 0.0f;
+}
+
+float Bvh::computeCost() const {
+    if (m_nodes.empty()) return 0.0f;
+    float rootArea = nodeBox(m_nodes[0]).surfaceArea();
+    if (isEmptyNode(m_nodes[0]) || !(rootArea > 0.0f)) return 1.0f;
+
+    float total = 0.0f;
+    for (const Node& node : m_nodes) {
+        if (!isEmptyNode(node)) total += nodeBox(node).surfaceArea();
+    }
+    return total / rootArea;
+}
+
+// ============================================================================
+// TriangleBvh
+// ============================================================================
+
+void TriangleBvh::build(const std::vector<vec3>& vertices, const std::vector<uint32_t>& indices) {
+    m_indices.assign(indices.begin(), indices.begin() + indices.size() / 3 * 3);
+    computeTriangles(vertices);
+    m_bvh.build(m_boxes);
+    m_builtCost = m_bvh.getCost();
+}
+
+void TriangleBvh::update(const std::vector<vec3>& vertices, const std::vector<uint32_t>& indices) {
+    if (m_triangles.empty() || indices.size() / 3 * 3 != m_indices.size() ||
+        !std::equal(m_indices.begin(), m_indices.end(), indices.begin())) {
+        build(vertices, indices);
+        return;
+    }
+
+    computeTriangles(vertices);
+    m_bvh.refit(m_boxes);
+    if (m_bvh.getCost() > m_builtCost * RebuildRatio) {
+        m_bvh.build(m_boxes);
+        m_builtCost = m_bvh.getCost();
+    }
+}
+
+void TriangleBvh::computeTriangles(const std::vector<vec3>& vertices) {
+    const size_t count = m_indices.size() / 3;
+    m_triangles.resize(count);
+    m_boxes.resize(count);
+    m_bounds = Aabb::empty();
+
+    const vec3 zero = vec3_zero();
+    for (size_t i = 0; i < count; ++i) {
+        // Out-of-range indices and non-finite vertices collapse to a point
+        // that nothing can hit, rather than poisoning the tree's bounds
+        uint32_t i0 = m_indices[i * 3];
+        uint32_t i1 = m_indices[i * 3 + 1];
+        uint32_t i2 = m_indices[i * 3 + 2];
+        bool valid = i0 < vertices.size() && i1 < vertices.size() && i2 < vertices.size() &&
+                     isFinite(vertices[i0]) && isFinite(vertices[i1]) && isFinite(vertices[i2]);
+        const vec3& v0 = valid ? vertices[i0] : zero;
+        const vec3& v1 = valid ? vertices[i1] : zero;
+        const vec3& v2 = valid ? vertices[i2] : zero;
+
+        m_triangles[i].origin = v0;
+        m_triangles[i].edge1 = v1 - v0;
+        m_triangles[i].edge2 = v2 - v0;
+
+        Aabb box = Aabb::empty();
+        box.grow(v0);
+        box.grow(v1);
+        box.grow(v2);
+        m_boxes[i] = box;
+        m_bounds.grow(box);
+    }
+}
+
+bool TriangleBvh::intersect(const Ray& ray, float maxDistance, float& distance, uint32_t& triangle) const {
+    bool hit = false;
+    m_bvh.traceRay(ray, maxDistance, [&](uint32_t index, float& reach) {
+        // Moller-Trumbore, accepting both faces
+        const Triangle& t = m_triangles[index];
+        vec3 p = cross(ray.direction, t.edge2);
+        float det = dot(t.edge1, p);
+        if (std::fabs(det) < 1e-12f) return;
+        float inverse = 1.0f / det;
+
+        vec3 s = ray.origin - t.origin;
+        float u = dot(s, p) * inverse;
+        if (u < 0.0f || u > 1.0f) return;
+        vec3 q = cross(s, t.edge1);
+        float v = dot(ray.direction, q) * inverse;
+        if (v < 0.0f || u + v > 1.0f) return;
+
+        float d = dot(t.edge2, q) * inverse;
+        if (d < 0.0f || d > reach) return;
+        reach = d;
+        distance = d;
+        triangle = index;
+        hit = true;
+    });
+    return hit;
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,267 @@
+// src/Scene/Bvh.h
+// Bounding volume hierarchies for picking: a tree over arbitrary boxes
+// (pickable bounds, triangles) and a triangle mesh wrapper for exact ray hits
+
+#pragma once
+#include "Core/Math/MathTypes.h"
+#include "Scene/CameraController.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FinalStorm {
+
+struct Aabb {
+    vec3 min;
+    vec3 max;
+
+    // Inverted box: growing it by anything gives that thing's bounds
+    static Aabb empty();
+    static Aabb fromSphere(const vec3& center, float radius);
+
+    void grow(const vec3& point);
+    void grow(const Aabb& box);
+    void expand(float margin);
+
+    bool isEmpty() const { return min.x > max.x; }
+    vec3 center() const { return (min + max) * 0.5f; }
+    float surfaceArea() const;
+
+    // Bounds of this box after an affine transform
+    Aabb transformed(const mat4& matrix) const;
+};
+
+class Bvh {
+public:
+    static constexpr uint32_t MaxLeafSize = 4;
+    static constexpr uint32_t MaxDepth = 48;
+
+    // 32 bytes, two to a cache line. Inner nodes keep their left child
+    // right after them, so only the right child's index is stored.
+    struct Node {
+        float min[3];
+        uint32_t offset;        // Leaf: first slot in getOrder(); inner: right child
+        float max[3];
+        uint32_t count;         // Leaf: primitive count; inner: 0
+    };
+
+    // Binned surface-area-heuristic build over boxes; primitive i is boxes[i]
+    void build(const std::vector<Aabb>& boxes);
+
+    // Same tree shape with bounds recomputed from boxes (same order as the
+    // build). Far cheaper than build(), but the tree loosens as things move.
+    void refit(const std::vector<Aabb>& boxes);
+
+    void clear();
+
+    bool isEmpty() const { return m_nodes.empty(); }
+    size_t getNodeCount() const { return m_nodes.size(); }
+    const std::vector<Node>& getNodes() const { return m_nodes; }
+    const std::vector<uint32_t>& getOrder() const { return m_order; }
+
+    // Sum of node surface areas over the root's: the expected nodes visited
+    // per ray. Compare against the value right after build() to decide when
+    // refitting has degraded the tree enough to rebuild.
+    float getCost() const { return m_cost; }
+
+    // Calls visit(primitive, maxDistance) for the primitives whose boxes the
+    // ray enters within maxDistance, nearest box first. visit may lower
+    // maxDistance (to its own hit) and everything farther is skipped.
+    template <typename Visit>
+    void traceRay(const Ray& ray, float maxDistance, Visit&& visit) const;
+
+    // Same for boxes within maxDistance of point, nearest box first
+    template <typename Visit>
+    void traceNearest(const vec3& point, float maxDistance, Visit&& visit) const;
+
+private:
+    struct BuildItem;
+    uint32_t buildNode(std::vector<BuildItem>& items, uint32_t first, uint32_t count, uint32_t depth);
+    float computeCost() const;
+
+    static bool enterBox(const Node& node, const float origin[3], const float inverse[3],
+                         float maxDistance, float& entry);
+    static float boxDistanceSquared(const Node& node, const float point[3]);
+
+    std::vector<Node> m_nodes;
+    std::vector<uint32_t> m_order;
+    float m_cost = 0.0f;
+};
+
+// Triangle list with its own tree, queried in the mesh's local space
+class TriangleBvh {
+public:
+    // Full rebuild from a triangle list
+    void build(const std::vector<vec3>& vertices, const std::vector<uint32_t>& indices);
+
+    // Refits when the triangles are the ones last built (vertices moved),
+    // rebuilds when the topology changed or refits have loosened the tree
+    void update(const std::vector<vec3>& vertices, const std::vector<uint32_t>& indices);
+
+    // Nearest triangle the ray hits within maxDistance, either face
+    bool intersect(const Ray& ray, float maxDistance, float& distance, uint32_t& triangle) const;
+
+    bool isEmpty() const { return m_triangles.empty(); }
+    size_t getTriangleCount() const { return m_triangles.size(); }
+    const Aabb& getBounds() const { return m_bounds; }
+
+private:
+    // Vertex 0 plus both edges: what the ray test needs, nothing else
+    struct Triangle {
+        vec3 origin;
+        vec3 edge1;
+        vec3 edge2;
+    };
+
+    void computeTriangles(const std::vector<vec3>& vertices);
+
+    std::vector<Triangle> m_triangles;
+    std::vector<uint32_t> m_indices;    // As built, to spot topology changes
+    std::vector<Aabb> m_boxes;          // Per-triangle bounds, kept for refits
+    Bvh m_bvh;
+    Aabb m_bounds = Aabb::empty();
+    float m_builtCost = 0.0f;
+};
+
+// ============================================================================
+// Traversal
+// ============================================================================
+
+inline bool Bvh::enterBox(const Node& node, const float origin[3], const float inverse[3],
+                          float maxDistance, float& entry) {
+    float closer = 0.0f;
+    float farther = maxDistance;
+    for (int axis = 0; axis < 3; ++axis) {
+        float t0 = (node.min[axis] - origin[axis]) * inverse[axis];
+        float t1 = (node.max[axis] - origin[axis]) * inverse[axis];
+        closer = std::max(closer, std::min(t0, t1));
+        farther = std::min(farther, std::max(t0, t1));
+    }
+    entry = closer;
+    return closer <= farther;
+}
+
+inline float Bvh::boxDistanceSquared(const Node& node, const float point[3]) {
+    float total = 0.0f;
+    for (int axis = 0; axis < 3; ++axis) {
+        float d = std::max(std::max(node.min[axis] - point[axis], point[axis] - node.max[axis]), 0.0f);
+        total += d * d;
+    }
+    return total;
+}
+
+template <typename Visit>
+void Bvh::traceRay(const Ray& ray, float maxDistance, Visit&& visit) const {
+    if (m_nodes.empty()) return;
+
+    const float origin[3] = { ray.origin.x, ray.origin.y, ray.origin.z };
+    const float direction[3] = { ray.direction.x, ray.direction.y, ray.direction.z };
+    float inverse[3];
+    for (int axis = 0; axis < 3; ++axis) {
+        // A zero component would make 0 * inf; a tiny one gives the same slabs
+        float d = std::fabs(direction[axis]) > 1e-20f ? direction[axis] : std::copysign(1e-20f, direction[axis]);
+        inverse[axis] = 1.0f / d;
+    }
+
+    float entry;
+    if (!enterBox(m_nodes[0], origin, inverse, maxDistance, entry)) return;
+
+    uint32_t stack[MaxDepth + 2];
+    float stackEntry[MaxDepth + 2];
+    size_t depth = 0;
+    uint32_t index = 0;
+
+    for (;;) {
+        const Node& node = m_nodes[index];
+        if (node.count > 0) {
+            for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+                visit(m_order[i], maxDistance);
+            }
+        } else {
+            uint32_t closer = index + 1;
+            uint32_t farther = node.offset;
+            float closerEntry, fartherEntry;
+            bool hitCloser = enterBox(m_nodes[closer], origin, inverse, maxDistance, closerEntry);
+            bool hitFarther = enterBox(m_nodes[farther], origin, inverse, maxDistance, fartherEntry);
+            if (hitCloser && hitFarther) {
+                if (fartherEntry < closerEntry) {
+                    std::swap(closer, farther);
+                    std::swap(closerEntry, fartherEntry);
+                }
+                stack[depth] = farther;
+                stackEntry[depth] = fartherEntry;
+                ++depth;
+                index = closer;
+                continue;
+            }
+            if (hitCloser || hitFarther) {
+                index = hitCloser ? closer : farther;
+                continue;
+            }
+        }
+
+        // Resume with the nearest deferred subtree still in reach
+        for (;;) {
+            if (depth == 0) return;
+            --depth;
+            if (stackEntry[depth] <= maxDistance) {
+                index = stack[depth];
+                break;
+            }
+        }
+    }
+}
+
+template <typename Visit>
+void Bvh::traceNearest(const vec3& point, float maxDistance, Visit&& visit) const {
+    if (m_nodes.empty()) return;
+
+    const float p[3] = { point.x, point.y, point.z };
+    if (boxDistanceSquared(m_nodes[0], p) > maxDistance * maxDistance) return;
+
+    uint32_t stack[MaxDepth + 2];
+    float stackDistance[MaxDepth + 2];
+    size_t depth = 0;
+    uint32_t index = 0;
+
+    for (;;) {
+        const Node& node = m_nodes[index];
+        if (node.count > 0) {
+            for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+                visit(m_order[i], maxDistance);
+            }
+        } else {
+            uint32_t closer = index + 1;
+            uint32_t farther = node.offset;
+            float closerDistance = boxDistanceSquared(m_nodes[closer], p);
+            float fartherDistance = boxDistanceSquared(m_nodes[farther], p);
+            if (fartherDistance < closerDistance) {
+                std::swap(closer, farther);
+                std::swap(closerDistance, fartherDistance);
+            }
+            float reach = maxDistance * maxDistance;
+            if (closerDistance <= reach) {
+                if (fartherDistance <= reach) {
+                    stack[depth] = farther;
+                    stackDistance[depth] = fartherDistance;
+                    ++depth;
+                }
+                index = closer;
+                continue;
+            }
+        }
+
+        for (;;) {
+            if (depth == 0) return;
+            --depth;
+            if (stackDistance[depth] <= maxDistance * maxDistance) {
+                index = stack[depth];
+                break;
+            }
+        }
+    }
+}
+
+} // namespace FinalStorm
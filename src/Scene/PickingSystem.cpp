@@ -0,0 +1,260 @@
+// src/Scene/PickingSystem.cpp
+// Broadphase BVH over pickable bounds with exact sphere and mesh narrowphase
+
+#include "Scene/PickingSystem.h"
+#include <cmath>
+#include <cstring>
+
+namespace FinalStorm {
+
+namespace {
+
+// The broadphase tree is rebuilt once refits have grown its cost this much
+constexpr float RebuildRatio = 1.5f;
+
+bool sameBounds(const Aabb& a, const Aabb& b) {
+    return a.min.x == b.min.x && a.min.y == b.min.y && a.min.z == b.min.z &&
+           a.max.x == b.max.x && a.max.y == b.max.y && a.max.z == b.max.z;
+}
+
+} // namespace
+
+PickingSystem::PickingSystem()
+    : m_nextHandle(1)
+    , m_version(0)
+    , m_builtCost(0.0f)
+    , m_needsBuild(false)
+    , m_needsRefit(false) {
+}
+
+uint32_t PickingSystem::addSphere(const std::string& id, uint32_t layer, const vec3& center, float radius) {
+    Entry entry;
+    entry.id = id;
+    entry.layer = layer;
+    entry.isMesh = false;
+    entry.center = center;
+    entry.radius = radius;
+    return insert(std::move(entry), Aabb::fromSphere(center, radius));
+}
+
+uint32_t PickingSystem::addMesh(const std::string& id, uint32_t layer, const Aabb& localBounds,
+                                const mat4& worldMatrix, MeshSource mesh) {
+    Entry entry;
+    entry.id = id;
+    entry.layer = layer;
+    entry.isMesh = true;
+    entry.center = vec3_zero();
+    entry.radius = 0.0f;
+    entry.localBounds = localBounds;
+    entry.worldMatrix = worldMatrix;
+    entry.inverseWorld = inverse(worldMatrix);
+    entry.mesh = std::move(mesh);
+    return insert(std::move(entry), localBounds.transformed(worldMatrix));
+}
+
+uint32_t PickingSystem::insert(Entry entry, const Aabb& bounds) {
+    entry.handle = m_nextHandle++;
+    if (m_nextHandle == 0) m_nextHandle = 1;    // 0 means "no hit"
+    uint32_t handle = entry.handle;
+
+    // A freed slot keeps the tree's shape, so reusing one only needs a refit
+    if (!m_freeSlots.empty()) {
+        size_t slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+        m_entries[slot] = std::move(entry);
+        m_bounds[slot] = bounds;
+        m_entryIndex[handle] = slot;
+        m_needsRefit = true;
+    } else {
+        m_entryIndex[handle] = m_entries.size();
+        m_entries.push_back(std::move(entry));
+        m_bounds.push_back(bounds);
+        m_needsBuild = true;
+    }
+    ++m_version;
+    return handle;
+}
+
+void PickingSystem::remove(uint32_t handle) {
+    auto it = m_entryIndex.find(handle);
+    if (it == m_entryIndex.end()) return;
+
+    // The slot stays in the tree with empty bounds and no layer until reused
+    size_t slot = it->second;
+    m_entryIndex.erase(it);
+    Entry& entry = m_entries[slot];
+    entry.handle = 0;
+    entry.layer = 0;
+    entry.id.clear();
+    entry.mesh = nullptr;
+    m_bounds[slot] = Aabb::empty();
+    m_freeSlots.push_back(slot);
+    m_needsRefit = true;
+    ++m_version;
+}
+
+void PickingSystem::clear() {
+    m_entries.clear();
+    m_bounds.clear();
+    m_entryIndex.clear();
+    m_freeSlots.clear();
+    m_bvh.clear();
+    m_needsBuild = false;
+    m_needsRefit = false;
+    ++m_version;
+}
+
+PickingSystem::Entry* PickingSystem::findEntry(uint32_t handle) {
+    auto it = m_entryIndex.find(handle);
+    return it != m_entryIndex.end() ? &m_entries[it->second] : nullptr;
+}
+
+void PickingSystem::setSphere(uint32_t handle, const vec3& center, float radius) {
+    Entry* entry = findEntry(handle);
+    if (!entry || entry->isMesh) return;
+    if (entry->radius == radius && entry->center.x == center.x &&
+        entry->center.y == center.y && entry->center.z == center.z) {
+        return;
+    }
+
+    entry->center = center;
+    entry->radius = radius;
+    m_bounds[m_entryIndex[handle]] = Aabb::fromSphere(center, radius);
+    m_needsRefit = true;
+    ++m_version;
+}
+
+void PickingSystem::setMesh(uint32_t handle, const Aabb& localBounds, const mat4& worldMatrix) {
+    Entry* entry = findEntry(handle);
+    if (!entry || !entry->isMesh) return;
+    if (sameBounds(entry->localBounds, localBounds) &&
+        std::memcmp(&entry->worldMatrix, &worldMatrix, sizeof(mat4)) == 0) {
+        return;
+    }
+
+    entry->localBounds = localBounds;
+    entry->worldMatrix = worldMatrix;
+    entry->inverseWorld = inverse(worldMatrix);
+    m_bounds[m_entryIndex[handle]] = localBounds.transformed(worldMatrix);
+    m_needsRefit = true;
+    ++m_version;
+}
+
+void PickingSystem::refresh() {
+    if (m_needsBuild) {
+        m_bvh.build(m_bounds);
+        m_builtCost = m_bvh.getCost();
+    } else if (m_needsRefit) {
+        m_bvh.refit(m_bounds);
+        if (m_bvh.getCost() > m_builtCost * RebuildRatio) {
+            m_bvh.build(m_bounds);
+            m_builtCost = m_bvh.getCost();
+        }
+    }
+    m_needsBuild = false;
+    m_needsRefit = false;
+}
+
+bool PickingSystem::pick(const Ray& ray, float maxDistance, uint32_t layerMask, PickHit& hit) {
+    hit = PickHit();
+    refresh();
+
+    const Entry* best = nullptr;
+    PickHit candidate;
+    m_bvh.traceRay(ray, maxDistance, [&](uint32_t index, float& reach) {
+        const Entry& entry = m_entries[index];
+        if (!(entry.layer & layerMask)) return;
+        if (hitEntry(entry, ray, reach, candidate)) {
+            reach = candidate.distance;
+            hit = candidate;
+            best = &entry;
+        }
+    });
+
+    if (!best) return false;
+    fillHit(*best, hit);
+    return true;
+}
+
+bool PickingSystem::nearest(const vec3& point, float maxDistance, uint32_t layerMask, PickHit& hit) {
+    hit = PickHit();
+    refresh();
+
+    const Entry* best = nullptr;
+    m_bvh.traceNearest(point, maxDistance, [&](uint32_t index, float& reach) {
+        const Entry& entry = m_entries[index];
+        if (!(entry.layer & layerMask)) return;
+
+        float distance;
+        vec3 closest;
+        if (entry.isMesh) {
+            const Aabb& box = m_bounds[index];
+            closest = make_vec3(std::min(std::max(point.x, box.min.x), box.max.x),
+                                std::min(std::max(point.y, box.min.y), box.max.y),
+                                std::min(std::max(point.z, box.min.z), box.max.z));
+            distance = length(closest - point);
+        } else {
+            vec3 offset = point - entry.center;
+            float centerDistance = length(offset);
+            distance = std::max(0.0f, centerDistance - entry.radius);
+            closest = distance > 0.0f ? entry.center + offset * (entry.radius / centerDistance) : point;
+        }
+
+        if (distance > reach || (best && distance == reach)) return;
+        reach = distance;
+        hit.distance = distance;
+        hit.point = closest;
+        best = &entry;
+    });
+
+    if (!best) return false;
+    fillHit(*best, hit);
+    return true;
+}
+
+bool PickingSystem::hitEntry(const Entry& entry, const Ray& ray, float maxDistance, PickHit& hit) const {
+    if (!entry.isMesh) {
+        vec3 offset = ray.origin - entry.center;
+        float b = dot(offset, ray.direction);
+        float c = dot(offset, offset) - entry.radius * entry.radius;
+        float discriminant = b * b - c;
+        if (discriminant < 0.0f) return false;
+
+        // From inside the sphere the pick is immediate
+        float distance = c <= 0.0f ? 0.0f : -b - std::sqrt(discriminant);
+        if (distance < 0.0f || distance > maxDistance) return false;
+        hit.distance = distance;
+        hit.point = ray.origin + ray.direction * distance;
+        hit.triangle = 0;
+        return true;
+    }
+
+    const TriangleBvh* mesh = entry.mesh ? entry.mesh() : nullptr;
+    if (!mesh || mesh->isEmpty()) return false;
+
+    // Into local space; distances there are scaled by the transform's stretch
+    // along the ray
+    vec4 origin = entry.inverseWorld * make_vec4(ray.origin, 1.0f);
+    vec4 direction = entry.inverseWorld * make_vec4(ray.direction, 0.0f);
+    vec3 localDirection = make_vec3(direction.x, direction.y, direction.z);
+    float stretch = length(localDirection);
+    if (!(stretch > 0.0f)) return false;
+
+    Ray local(make_vec3(origin.x, origin.y, origin.z), localDirection);
+    float localDistance;
+    uint32_t triangle;
+    if (!mesh->intersect(local, maxDistance * stretch, localDistance, triangle)) return false;
+
+    hit.distance = localDistance / stretch;
+    hit.point = ray.origin + ray.direction * hit.distance;
+    hit.triangle = triangle;
+    return true;
+}
+
+void PickingSystem::fillHit(const Entry& entry, PickHit& hit) const {
+    hit.handle = entry.handle;
+    hit.id = entry.id;
+    hit.layer = entry.layer;
+}
+
+} // namespace FinalStorm
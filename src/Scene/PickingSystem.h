@@ -0,0 +1,109 @@
+// src/Scene/PickingSystem.h
+// Ray picking over everything selectable: a BVH of world bounds finds the
+// candidates, spheres are then tested exactly and meshes through their own
+// triangle BVH in local space
+
+#pragma once
+#include "Core/Math/MathTypes.h"
+#include "Scene/Bvh.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace FinalStorm {
+
+// Bits for PickingSystem layers; queries take a mask of them
+namespace PickLayer {
+    constexpr uint32_t Services = 1u << 0;
+    constexpr uint32_t Connections = 1u << 1;
+    constexpr uint32_t Ring = 1u << 2;
+    constexpr uint32_t All = ~0u;
+}
+
+struct PickHit {
+    uint32_t handle = 0;        // 0 when nothing was hit
+    std::string id;
+    uint32_t layer = 0;
+    float distance = 0.0f;      // World units along the ray, or from the query point
+    vec3 point;                 // World space
+    uint32_t triangle = 0;      // Mesh pickables only
+
+    explicit operator bool() const { return handle != 0; }
+};
+
+class PickingSystem {
+public:
+    // Hands back the triangle tree in the pickable's local space, or null.
+    // Only called when a ray reaches the pickable's bounds, so owners can
+    // keep their trees stale until then.
+    using MeshSource = std::function<const TriangleBvh*()>;
+
+    PickingSystem();
+
+    PickingSystem(const PickingSystem&) = delete;
+    PickingSystem& operator=(const PickingSystem&) = delete;
+
+    uint32_t addSphere(const std::string& id, uint32_t layer, const vec3& center, float radius);
+    uint32_t addMesh(const std::string& id, uint32_t layer, const Aabb& localBounds,
+                     const mat4& worldMatrix, MeshSource mesh);
+    void remove(uint32_t handle);
+    void clear();
+
+    // Moving, removing and re-adding are cheap: the tree is refit on the next
+    // query, and only rebuilt when it must grow or refits have loosened it
+    // too far
+    void setSphere(uint32_t handle, const vec3& center, float radius);
+    void setMesh(uint32_t handle, const Aabb& localBounds, const mat4& worldMatrix);
+
+    // Nearest hit along the ray within maxDistance on any layer in layerMask
+    bool pick(const Ray& ray, float maxDistance, uint32_t layerMask, PickHit& hit);
+
+    // Pickable closest to point (surface distance for spheres, bounds for
+    // meshes) within maxDistance
+    bool nearest(const vec3& point, float maxDistance, uint32_t layerMask, PickHit& hit);
+
+    // Changes whenever a pickable is added, removed or moved, so callers can
+    // tell whether a cached pick still stands
+    uint64_t getVersion() const { return m_version; }
+    size_t getCount() const { return m_entryIndex.size(); }
+
+private:
+    struct Entry {
+        uint32_t handle;            // 0 for a freed slot
+        std::string id;
+        uint32_t layer;
+        bool isMesh;
+
+        // Spheres
+        vec3 center;
+        float radius;
+
+        // Meshes
+        Aabb localBounds;
+        mat4 worldMatrix;
+        mat4 inverseWorld;
+        MeshSource mesh;
+    };
+
+    Entry* findEntry(uint32_t handle);
+    uint32_t insert(Entry entry, const Aabb& bounds);
+    void refresh();
+    bool hitEntry(const Entry& entry, const Ray& ray, float maxDistance, PickHit& hit) const;
+    void fillHit(const Entry& entry, PickHit& hit) const;
+
+    std::vector<Entry> m_entries;
+    std::vector<Aabb> m_bounds;                         // World bounds, parallel to m_entries
+    std::unordered_map<uint32_t, size_t> m_entryIndex;  // Handle -> slot in m_entries
+    std::vector<size_t> m_freeSlots;                    // Removed slots, reused before growing
+    uint32_t m_nextHandle;
+    uint64_t m_version;
+
+    Bvh m_bvh;
+    float m_builtCost;
+    bool m_needsBuild;      // Slots were added
+    bool m_needsRefit;      // Bounds moved, or slots were freed or reused
+};
+
+} // namespace FinalStorm
@@ -1,6 +1,7 @@
 // SceneLoader.cpp - Implementation
 
 #include "Scene/SceneLoader.h"
+#include "Scene/SceneSnapshot.h"
 #include "World/WorldManager.h"
 #include "Rendering/Metal/MetalRenderer.h"
 #include "Network/FinalverseClient.h"
@@ -8,6 +9,13 @@
 
 namespace FinalStorm {
 
+namespace {
+
+// Baked by FinalStorm-SceneBake; without it The Nexus is built procedurally
+constexpr const char* kNexusSnapshotPath = "assets/scenes/TheNexus.fssnap";
+
+} // namespace
+
 SceneLoader::SceneLoader(WorldManager* worldManager, 
                         MetalRenderer* renderer,
                         FinalverseClient* networkClient) 
@@ -56,6 +64,7 @@ void SceneLoader::loadFirstScene() {
     // Create the first scene with config
     auto createFirstScene = [config]() -> std::unique_ptr<Scene> {
         auto scene = std::make_unique<FirstScene>();
+        scene->setSnapshot(SceneSnapshot::open(kNexusSnapshotPath));
 
         // Apply configuration
         // TODO: Add config setters to FirstScene
@@ -85,7 +94,8 @@ void SceneLoader::loadSceneFromServer(const std::string& sceneId) {
             // Create scene from server data
             auto scene = std::make_unique<Scene>(data.name);
             
-            // TODO: Populate scene from server data
+            // TODO: Populate scene from server data; a baked payload would
+            // load through SceneSnapshot::fromBuffer()
             
             // Register and load
             registerSceneFactory(data.name, [scene = std::move(scene)]() mutable {
@@ -132,9 +142,13 @@ void SceneLoader::registerSceneFactory(const std::string& name,
 }
 
 void SceneLoader::registerDefaultScenes() {
+    FirstScene::registerSnapshotTypes();
+    
     // Register The Nexus as default first scene
     registerSceneFactory("TheNexus", []() {
-        return std::make_unique<FirstScene>();
+        auto scene = std::make_unique<FirstScene>();
+        scene->setSnapshot(SceneSnapshot::open(kNexusSnapshotPath));
+        return scene;
     });
     
     // Register other built-in scenes
@@ -6,13 +6,15 @@
 #include "Rendering/RenderContext.h"
 #include "Core/Math/Camera.h"
 #include <algorithm>
+#include <typeinfo>
 
 namespace FinalStorm {
 
 SceneNode::SceneNode(const std::string& name)
     : m_name(name)
     , m_visible(true)
-    , m_worldMatrixDirty(true) {
+    , m_worldMatrixDirty(true)
+    , m_nextListenerId(1) {
 }
 
 void SceneNode::addChild(std::shared_ptr<SceneNode> child) {
@@ -33,6 +35,7 @@ void SceneNode::removeChild(std::shared_ptr<SceneNode> child) {
     auto it = std::find(m_children.begin(), m_children.end(), child);
     if (it != m_children.end()) {
         (*it)->m_parent.reset();
+        (*it)->markWorldMatrixDirty();
         m_children.erase(it);
     }
 }
@@ -40,6 +43,7 @@ void SceneNode::removeChild(std::shared_ptr<SceneNode> child) {
 void SceneNode::removeAllChildren() {
     for (auto& child : m_children) {
         child->m_parent.reset();
+        child->markWorldMatrixDirty();
     }
     m_children.clear();
 }
@@ -65,6 +69,10 @@ quat SceneNode::getWorldRotation() const {
     return m_localTransform.rotation;
 }
 
+const char* SceneNode::getSnapshotType() const {
+    return typeid(*this) == typeid(SceneNode) ? "SceneNode" : nullptr;
+}
+
 void SceneNode::update(float deltaTime) {
     if (!m_visible) return;
     
@@ -95,9 +103,30 @@ bool SceneNode::isInFrustum(const Camera& camera) const {
     return camera.isInFrustum(worldPos);
 }
 
+uint32_t SceneNode::addTransformListener(TransformListener listener) {
+    uint32_t id = m_nextListenerId++;
+    m_transformListeners.emplace_back(id, std::move(listener));
+    return id;
+}
+
+void SceneNode::removeTransformListener(uint32_t id) {
+    auto it = std::find_if(m_transformListeners.begin(), m_transformListeners.end(),
+        [id](const std::pair<uint32_t, TransformListener>& entry) { return entry.first == id; });
+    if (it != m_transformListeners.end()) {
+        m_transformListeners.erase(it);
+    }
+}
+
 void SceneNode::markWorldMatrixDirty() {
+    // Reading a world matrix cleans every ancestor first, so a dirty node's
+    // subtree is already dirty and its listeners have already heard
+    if (m_worldMatrixDirty) return;
     m_worldMatrixDirty = true;
     
+    for (auto& entry : m_transformListeners) {
+        entry.second(*this);
+    }
+    
     // Mark all children dirty too
     for (auto& child : m_children) {
         child->markWorldMatrixDirty();
@@ -5,6 +5,7 @@
 #pragma once
 #include "Core/Math/MathTypes.h"
 #include "Core/Math/Transform.h"
+#include <functional>
 #include <string>
 #include <vector>
 #include <memory>
@@ -13,6 +14,8 @@ namespace FinalStorm {
 
 class RenderContext;
 class Camera;
+class SnapshotParams;
+class SnapshotParamReader;
 
 class SceneNode {
 public:
@@ -36,16 +39,25 @@ public:
     quat getWorldRotation() const;
     
     // Convenience transform methods
-    void setPosition(const vec3& position) { m_localTransform.setPosition(position); }
-    void setRotation(const quat& rotation) { m_localTransform.setRotation(rotation); }
-    void setScale(const vec3& scale) { m_localTransform.setScale(scale); }
+    void setPosition(const vec3& position) { m_localTransform.setPosition(position); markWorldMatrixDirty(); }
+    void setRotation(const quat& rotation) { m_localTransform.setRotation(rotation); markWorldMatrixDirty(); }
+    void setScale(const vec3& scale) { m_localTransform.setScale(scale); markWorldMatrixDirty(); }
     
     vec3 getPosition() const { return m_localTransform.position; }
     quat getRotation() const { return m_localTransform.rotation; }
     vec3 getScale() const { return m_localTransform.scale; }
     
-    void translate(const vec3& delta) { m_localTransform.translate(delta); }
-    void rotate(const quat& rotation) { m_localTransform.rotate(rotation); }
+    void translate(const vec3& delta) { m_localTransform.translate(delta); markWorldMatrixDirty(); }
+    void rotate(const quat& rotation) { m_localTransform.rotate(rotation); markWorldMatrixDirty(); }
+    
+    // Called when the world transform goes stale: this node or an ancestor
+    // moved, or the node was reparented. Fires once until the world matrix is
+    // read again, so listeners re-read positions only for nodes that moved.
+    // Edits through getLocalTransform() bypass this. Listeners must not add
+    // or remove listeners on the node that calls them.
+    using TransformListener = std::function<void(SceneNode&)>;
+    uint32_t addTransformListener(TransformListener listener);
+    void removeTransformListener(uint32_t id);
     
     // Properties
     const std::string& getName() const { return m_name; }
@@ -54,6 +66,22 @@ public:
     bool isVisible() const { return m_visible; }
     void setVisible(bool visible) { m_visible = visible; }
     
+    // Snapshots (see Scene/SceneSnapshot.h). A baked type returns its
+    // registered name and writes what its setters need to rebuild it; name,
+    // transform and visibility are stored for every node. The default only
+    // names plain SceneNodes, so subclasses without snapshot support are
+    // skipped along with their children instead of baked half-restored.
+    virtual const char* getSnapshotType() const;
+    virtual void writeSnapshot(SnapshotParams&) const {}
+    virtual void readSnapshot(const SnapshotParamReader&) {}
+    
+    // False for types that create their own children (effects, particles),
+    // which are rebuilt by the type rather than baked
+    virtual bool snapshotsChildren() const { return true; }
+    
+    // Called once the whole snapshot tree is built, children attached
+    virtual void onSnapshotInstantiated() {}
+    
     // Update and render
     virtual void update(float deltaTime);
     virtual void render(RenderContext& context);
@@ -77,6 +105,9 @@ private:
     mutable mat4 m_cachedWorldMatrix;
     mutable bool m_worldMatrixDirty;
     
+    std::vector<std::pair<uint32_t, TransformListener>> m_transformListeners;
+    uint32_t m_nextListenerId;
+    
     void markWorldMatrixDirty();
     void updateWorldMatrix() const;
 };
@@ -0,0 +1,439 @@
+// src/Scene/SceneSnapshot.cpp
+// Binary scene snapshot implementation
+// Layout: header, node records, parameter records, string pool
+
+#include "Scene/SceneSnapshot.h"
+#include "Scene/SceneNode.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace FinalStorm {
+
+namespace {
+
+constexpr char kSnapshotMagic[4] = { 'F', 'S', 'S', 'N' };
+constexpr uint16_t kSnapshotVersion = 1;
+
+// Record alignment inside the file; every record field is 4 bytes wide
+constexpr size_t kSnapshotAlignment = 4;
+
+std::unordered_map<std::string, SceneSnapshot::Factory>& typeRegistry() {
+    static std::unordered_map<std::string, SceneSnapshot::Factory> registry = {
+        { "SceneNode", []() { return std::make_shared<SceneNode>(); } }
+    };
+    return registry;
+}
+
+size_t alignUp(size_t value) {
+    return (value + kSnapshotAlignment - 1) & ~(kSnapshotAlignment - 1);
+}
+
+template<typename T>
+void appendRecords(std::vector<uint8_t>& buffer, const std::vector<T>& records) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(records.data());
+    buffer.insert(buffer.end(), bytes, bytes + records.size() * sizeof(T));
+}
+
+void storeRotation(const quat& rotation, float out[4]) {
+#ifdef __APPLE__
+    out[0] = rotation.vector.x;
+    out[1] = rotation.vector.y;
+    out[2] = rotation.vector.z;
+    out[3] = rotation.vector.w;
+#else
+    out[0] = rotation.x;
+    out[1] = rotation.y;
+    out[2] = rotation.z;
+    out[3] = rotation.w;
+#endif
+}
+
+quat loadRotation(const float in[4]) {
+#ifdef __APPLE__
+    return simd_quaternion(in[0], in[1], in[2], in[3]);
+#else
+    return quat(in[3], in[0], in[1], in[2]);
+#endif
+}
+
+// Whole range [offset, offset + size) lies inside a buffer of total bytes
+bool inBounds(uint64_t offset, uint64_t size, uint64_t total) {
+    return offset <= total && size <= total - offset;
+}
+
+} // namespace
+
+// ============================================================================
+// SnapshotParams
+// ============================================================================
+
+SnapshotParams::Entry& SnapshotParams::add(const char* key, SnapshotParamKind kind) {
+    m_entries.emplace_back();
+    Entry& entry = m_entries.back();
+    entry.key = key;
+    entry.kind = kind;
+    std::memset(entry.values, 0, sizeof(entry.values));
+    entry.integer = 0;
+    return entry;
+}
+
+void SnapshotParams::set(const char* key, float value) {
+    add(key, SnapshotParamKind::Float).values[0] = value;
+}
+
+void SnapshotParams::set(const char* key, int value) {
+    add(key, SnapshotParamKind::Int).integer = value;
+}
+
+void SnapshotParams::set(const char* key, bool value) {
+    add(key, SnapshotParamKind::Bool).integer = value ? 1 : 0;
+}
+
+void SnapshotParams::set(const char* key, const vec3& value) {
+    Entry& entry = add(key, SnapshotParamKind::Vec3);
+    entry.values[0] = value.x;
+    entry.values[1] = value.y;
+    entry.values[2] = value.z;
+}
+
+void SnapshotParams::set(const char* key, const vec4& value) {
+    Entry& entry = add(key, SnapshotParamKind::Vec4);
+    entry.values[0] = value.x;
+    entry.values[1] = value.y;
+    entry.values[2] = value.z;
+    entry.values[3] = value.w;
+}
+
+void SnapshotParams::set(const char* key, const std::string& value) {
+    add(key, SnapshotParamKind::String).text = value;
+}
+
+// ============================================================================
+// SnapshotParamReader
+// ============================================================================
+
+SnapshotParamReader::SnapshotParamReader(const SceneSnapshot& snapshot, const SnapshotNode& node)
+    : m_snapshot(snapshot)
+    , m_begin(snapshot.getParams() + node.firstParam)
+    , m_end(snapshot.getParams() + node.firstParam + node.paramCount) {
+}
+
+const SnapshotParam* SnapshotParamReader::find(const char* key, SnapshotParamKind kind) const {
+    for (const SnapshotParam* param = m_begin; param != m_end; ++param) {
+        if (param->kind == kind && std::strcmp(m_snapshot.getString(param->key), key) == 0) {
+            return param;
+        }
+    }
+    return nullptr;
+}
+
+bool SnapshotParamReader::has(const char* key) const {
+    for (const SnapshotParam* param = m_begin; param != m_end; ++param) {
+        if (std::strcmp(m_snapshot.getString(param->key), key) == 0) return true;
+    }
+    return false;
+}
+
+float SnapshotParamReader::getFloat(const char* key, float fallback) const {
+    const SnapshotParam* param = find(key, SnapshotParamKind::Float);
+    return param ? param->values[0] : fallback;
+}
+
+int SnapshotParamReader::getInt(const char* key, int fallback) const {
+    const SnapshotParam* param = find(key, SnapshotParamKind::Int);
+    return param ? param->integer : fallback;
+}
+
+bool SnapshotParamReader::getBool(const char* key, bool fallback) const {
+    const SnapshotParam* param = find(key, SnapshotParamKind::Bool);
+    return param ? param->integer != 0 : fallback;
+}
+
+vec3 SnapshotParamReader::getVec3(const char* key, const vec3& fallback) const {
+    const SnapshotParam* param = find(key, SnapshotParamKind::Vec3);
+    return param ? make_vec3(param->values[0], param->values[1], param->values[2]) : fallback;
+}
+
+vec4 SnapshotParamReader::getVec4(const char* key, const vec4& fallback) const {
+    const SnapshotParam* param = find(key, SnapshotParamKind::Vec4);
+    return param ? make_vec4(param->values[0], param->values[1], param->values[2], param->values[3]) : fallback;
+}
+
+std::string SnapshotParamReader::getString(const char* key, const std::string& fallback) const {
+    const SnapshotParam* param = find(key, SnapshotParamKind::String);
+    return param ? std::string(m_snapshot.getString(static_cast<uint32_t>(param->integer))) : fallback;
+}
+
+// ============================================================================
+// SceneSnapshot
+// ============================================================================
+
+SceneSnapshot::SceneSnapshot()
+    : m_fd(-1)
+    , m_data(nullptr)
+    , m_size(0)
+    , m_mapped(false)
+    , m_header(nullptr)
+    , m_nodes(nullptr)
+    , m_params(nullptr)
+    , m_strings(nullptr) {
+}
+
+SceneSnapshot::~SceneSnapshot() {
+    if (m_mapped) munmap(const_cast<uint8_t*>(m_data), m_size);
+    if (m_fd >= 0) ::close(m_fd);
+}
+
+std::shared_ptr<SceneSnapshot> SceneSnapshot::open(const std::string& path) {
+    std::shared_ptr<SceneSnapshot> snapshot(new SceneSnapshot());
+    snapshot->m_fd = ::open(path.c_str(), O_RDONLY);
+    if (snapshot->m_fd < 0) return nullptr;
+
+    struct stat st;
+    if (fstat(snapshot->m_fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(SnapshotHeader))) {
+        std::cerr << "SceneSnapshot: " << path << " is too short" << std::endl;
+        return nullptr;
+    }
+
+    snapshot->m_size = static_cast<size_t>(st.st_size);
+    void* mapped = mmap(nullptr, snapshot->m_size, PROT_READ, MAP_PRIVATE, snapshot->m_fd, 0);
+    if (mapped == MAP_FAILED) return nullptr;
+    snapshot->m_data = static_cast<const uint8_t*>(mapped);
+    snapshot->m_mapped = true;
+
+    if (!snapshot->validate(path)) return nullptr;
+    return snapshot;
+}
+
+std::shared_ptr<SceneSnapshot> SceneSnapshot::fromBuffer(std::vector<uint8_t> bytes) {
+    std::shared_ptr<SceneSnapshot> snapshot(new SceneSnapshot());
+    snapshot->m_buffer = std::move(bytes);
+    snapshot->m_data = snapshot->m_buffer.data();
+    snapshot->m_size = snapshot->m_buffer.size();
+
+    if (!snapshot->validate("buffer")) return nullptr;
+    return snapshot;
+}
+
+bool SceneSnapshot::validate(const std::string& source) {
+    if (m_size < sizeof(SnapshotHeader) || reinterpret_cast<uintptr_t>(m_data) % kSnapshotAlignment != 0) {
+        std::cerr << "SceneSnapshot: " << source << " is too short or misaligned" << std::endl;
+        return false;
+    }
+
+    // Every table is bounds-checked once here, so instantiation and parameter
+    // lookups read the records without further checks
+    const SnapshotHeader* header = reinterpret_cast<const SnapshotHeader*>(m_data);
+    if (std::memcmp(header->magic, kSnapshotMagic, sizeof(header->magic)) != 0 ||
+        header->version != kSnapshotVersion || header->headerSize != sizeof(SnapshotHeader)) {
+        std::cerr << "SceneSnapshot: " << source << " is not a version " << kSnapshotVersion << " snapshot" << std::endl;
+        return false;
+    }
+    if (header->fileSize != m_size ||
+        !inBounds(header->nodeOffset, static_cast<uint64_t>(header->nodeCount) * sizeof(SnapshotNode), m_size) ||
+        !inBounds(header->paramOffset, static_cast<uint64_t>(header->paramCount) * sizeof(SnapshotParam), m_size) ||
+        !inBounds(header->stringOffset, header->stringSize, m_size) ||
+        header->nodeOffset % kSnapshotAlignment != 0 || header->paramOffset % kSnapshotAlignment != 0 ||
+        header->stringSize == 0 || m_data[header->stringOffset + header->stringSize - 1] != '\0') {
+        std::cerr << "SceneSnapshot: " << source << " is truncated or corrupt" << std::endl;
+        return false;
+    }
+
+    const SnapshotNode* nodes = reinterpret_cast<const SnapshotNode*>(m_data + header->nodeOffset);
+    const SnapshotParam* params = reinterpret_cast<const SnapshotParam*>(m_data + header->paramOffset);
+    for (uint32_t i = 0; i < header->nodeCount; ++i) {
+        const SnapshotNode& node = nodes[i];
+        if ((node.parent != SnapshotNode::NoParent && node.parent >= i) ||
+            node.name >= header->stringSize || node.type >= header->stringSize ||
+            !inBounds(node.firstParam, node.paramCount, header->paramCount)) {
+            std::cerr << "SceneSnapshot: " << source << " has a bad record for node " << i << std::endl;
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < header->paramCount; ++i) {
+        const SnapshotParam& param = params[i];
+        if (param.key >= header->stringSize ||
+            (param.kind == SnapshotParamKind::String && static_cast<uint32_t>(param.integer) >= header->stringSize)) {
+            std::cerr << "SceneSnapshot: " << source << " has a bad parameter " << i << std::endl;
+            return false;
+        }
+    }
+
+    m_header = header;
+    m_nodes = nodes;
+    m_params = params;
+    m_strings = reinterpret_cast<const char*>(m_data + header->stringOffset);
+    return true;
+}
+
+void SceneSnapshot::registerType(const std::string& type, Factory factory) {
+    typeRegistry()[type] = std::move(factory);
+}
+
+bool SceneSnapshot::isTypeRegistered(const std::string& type) {
+    return typeRegistry().count(type) != 0;
+}
+
+void SceneSnapshot::instantiate(std::vector<std::shared_ptr<SceneNode>>& nodes) const {
+    auto& registry = typeRegistry();
+    nodes.clear();
+    nodes.reserve(m_header->nodeCount);
+
+    for (uint32_t i = 0; i < m_header->nodeCount; ++i) {
+        const SnapshotNode& record = m_nodes[i];
+        const char* type = getString(record.type);
+
+        std::shared_ptr<SceneNode> node;
+        auto factory = registry.find(type);
+        if (factory != registry.end()) node = factory->second();
+        if (!node) {
+            std::cerr << "SceneSnapshot: no factory for type " << type << ", using SceneNode" << std::endl;
+            node = std::make_shared<SceneNode>();
+        }
+
+        // Transform before parameters: types such as floating orbs capture
+        // their resting position when their parameters are applied
+        node->setName(getString(record.name));
+        node->setPosition(make_vec3(record.position[0], record.position[1], record.position[2]));
+        node->setRotation(loadRotation(record.rotation));
+        node->setScale(make_vec3(record.scale[0], record.scale[1], record.scale[2]));
+        node->setVisible((record.flags & SnapshotNode::FlagVisible) != 0);
+        node->readSnapshot(SnapshotParamReader(*this, record));
+
+        if (record.parent != SnapshotNode::NoParent) nodes[record.parent]->addChild(node);
+        nodes.push_back(std::move(node));
+    }
+
+    for (auto& node : nodes) node->onSnapshotInstantiated();
+}
+
+// ============================================================================
+// SceneSnapshotWriter
+// ============================================================================
+
+SceneSnapshotWriter::SceneSnapshotWriter() {
+    // Offset 0 is the empty string
+    m_strings.push_back('\0');
+    m_stringOffsets.emplace(std::string(), 0);
+}
+
+uint32_t SceneSnapshotWriter::intern(const std::string& text) {
+    auto it = m_stringOffsets.find(text);
+    if (it != m_stringOffsets.end()) return it->second;
+
+    uint32_t offset = static_cast<uint32_t>(m_strings.size());
+    m_strings.append(text);
+    m_strings.push_back('\0');
+    m_stringOffsets.emplace(text, offset);
+    return offset;
+}
+
+bool SceneSnapshotWriter::add(const SceneNode& node) {
+    return addNode(node, SnapshotNode::NoParent);
+}
+
+bool SceneSnapshotWriter::addNode(const SceneNode& node, uint32_t parent) {
+    const char* type = node.getSnapshotType();
+    if (!type) return false;
+
+    SnapshotParams params;
+    node.writeSnapshot(params);
+
+    SnapshotNode record;
+    std::memset(&record, 0, sizeof(record));
+    record.parent = parent;
+    record.name = intern(node.getName());
+    record.type = intern(type);
+    record.flags = node.isVisible() ? SnapshotNode::FlagVisible : 0;
+
+    vec3 position = node.getPosition();
+    vec3 scale = node.getScale();
+    record.position[0] = position.x;
+    record.position[1] = position.y;
+    record.position[2] = position.z;
+    storeRotation(node.getRotation(), record.rotation);
+    record.scale[0] = scale.x;
+    record.scale[1] = scale.y;
+    record.scale[2] = scale.z;
+
+    record.firstParam = static_cast<uint32_t>(m_params.size());
+    record.paramCount = static_cast<uint32_t>(params.m_entries.size());
+    for (const SnapshotParams::Entry& entry : params.m_entries) {
+        SnapshotParam param;
+        param.key = intern(entry.key);
+        param.kind = entry.kind;
+        std::memcpy(param.values, entry.values, sizeof(param.values));
+        param.integer = entry.kind == SnapshotParamKind::String ? static_cast<int32_t>(intern(entry.text))
+                                                                : entry.integer;
+        m_params.push_back(param);
+    }
+
+    uint32_t index = static_cast<uint32_t>(m_nodes.size());
+    m_nodes.push_back(record);
+
+    if (node.snapshotsChildren()) {
+        for (const auto& child : node.getChildren()) {
+            if (child) addNode(*child, index);
+        }
+    }
+    return true;
+}
+
+std::vector<uint8_t> SceneSnapshotWriter::build() const {
+    SnapshotHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kSnapshotMagic, sizeof(header.magic));
+    header.version = kSnapshotVersion;
+    header.headerSize = sizeof(SnapshotHeader);
+    header.nodeCount = static_cast<uint32_t>(m_nodes.size());
+    header.nodeOffset = static_cast<uint32_t>(alignUp(sizeof(SnapshotHeader)));
+    header.paramCount = static_cast<uint32_t>(m_params.size());
+    header.paramOffset = static_cast<uint32_t>(alignUp(header.nodeOffset + m_nodes.size() * sizeof(SnapshotNode)));
+    header.stringOffset = static_cast<uint32_t>(alignUp(header.paramOffset + m_params.size() * sizeof(SnapshotParam)));
+    header.stringSize = static_cast<uint32_t>(m_strings.size());
+    header.fileSize = header.stringOffset + header.stringSize;
+
+    std::vector<uint8_t> bytes;
+    bytes.reserve(header.fileSize);
+    const uint8_t* headerBytes = reinterpret_cast<const uint8_t*>(&header);
+    bytes.insert(bytes.end(), headerBytes, headerBytes + sizeof(header));
+    bytes.resize(header.nodeOffset, 0);
+    appendRecords(bytes, m_nodes);
+    bytes.resize(header.paramOffset, 0);
+    appendRecords(bytes, m_params);
+    bytes.resize(header.stringOffset, 0);
+    bytes.insert(bytes.end(), m_strings.begin(), m_strings.end());
+    return bytes;
+}
+
+bool SceneSnapshotWriter::save(const std::string& path) const {
+    std::vector<uint8_t> bytes = build();
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+
+        // Buffered bytes only reach the disk on close, and a failed flush
+        // there must not replace a good snapshot with a short one
+        file.close();
+        if (!file) {
+            std::cerr << "SceneSnapshot: cannot write " << temporary << std::endl;
+            std::remove(temporary.c_str());
+            return false;
+        }
+    }
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::cerr << "SceneSnapshot: cannot replace " << path << std::endl;
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,208 @@
+// src/Scene/SceneSnapshot.h
+// Binary scene snapshots
+// A baked SceneNode tree in one flat, relocatable buffer: fixed-size node and
+// parameter records addressed by offset, plus a pooled string table. Files
+// are mapped read-only and instantiated in a single pass without parsing.
+
+#pragma once
+#include "Core/Math/MathTypes.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace FinalStorm {
+
+class SceneNode;
+
+// ============================================================================
+// On-disk records. Every offset is in bytes from the start of the snapshot,
+// every record is 4-byte aligned, so a mapped file is used in place.
+// ============================================================================
+
+struct SnapshotHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t headerSize;
+    uint32_t fileSize;
+    uint32_t nodeCount;
+    uint32_t nodeOffset;
+    uint32_t paramCount;
+    uint32_t paramOffset;
+    uint32_t stringOffset;
+    uint32_t stringSize;
+};
+
+enum class SnapshotParamKind : uint32_t {
+    Float,
+    Int,
+    Bool,
+    Vec3,
+    Vec4,
+    String
+};
+
+struct SnapshotParam {
+    uint32_t key;               // String offset
+    SnapshotParamKind kind;
+    float values[4];            // Float, Vec3 and Vec4
+    int32_t integer;            // Int, Bool, and the string offset of String
+};
+
+// Nodes are stored depth first, so a parent always precedes its children
+struct SnapshotNode {
+    static constexpr uint32_t NoParent = 0xFFFFFFFFu;
+    static constexpr uint32_t FlagVisible = 1u << 0;
+
+    uint32_t parent;            // Node index, NoParent for top-level nodes
+    uint32_t name;              // String offset
+    uint32_t type;              // String offset, a registered snapshot type
+    uint32_t flags;
+    float position[3];
+    float rotation[4];          // x, y, z, w
+    float scale[3];
+    uint32_t firstParam;
+    uint32_t paramCount;
+};
+
+// ============================================================================
+// SnapshotParams - what a node writes when it is baked
+// ============================================================================
+
+class SnapshotParams {
+public:
+    void set(const char* key, float value);
+    void set(const char* key, int value);
+    void set(const char* key, bool value);
+    void set(const char* key, const vec3& value);
+    void set(const char* key, const vec4& value);
+    void set(const char* key, const std::string& value);
+    void set(const char* key, const char* value) { set(key, std::string(value)); }
+
+private:
+    friend class SceneSnapshotWriter;
+
+    struct Entry {
+        std::string key;
+        SnapshotParamKind kind;
+        float values[4];
+        int32_t integer;
+        std::string text;
+    };
+    Entry& add(const char* key, SnapshotParamKind kind);
+
+    std::vector<Entry> m_entries;
+};
+
+// ============================================================================
+// SnapshotParamReader - a node's parameters as it is instantiated
+// ============================================================================
+
+class SceneSnapshot;
+
+// Getters return the fallback when the key is missing or of another kind, so
+// older snapshots keep loading as types grow new parameters
+class SnapshotParamReader {
+public:
+    SnapshotParamReader(const SceneSnapshot& snapshot, const SnapshotNode& node);
+
+    bool has(const char* key) const;
+    float getFloat(const char* key, float fallback = 0.0f) const;
+    int getInt(const char* key, int fallback = 0) const;
+    bool getBool(const char* key, bool fallback = false) const;
+    vec3 getVec3(const char* key, const vec3& fallback) const;
+    vec4 getVec4(const char* key, const vec4& fallback) const;
+    std::string getString(const char* key, const std::string& fallback = std::string()) const;
+
+private:
+    // Linear: nodes carry a handful of parameters
+    const SnapshotParam* find(const char* key, SnapshotParamKind kind) const;
+
+    const SceneSnapshot& m_snapshot;
+    const SnapshotParam* m_begin;
+    const SnapshotParam* m_end;
+};
+
+// ============================================================================
+// SceneSnapshot - a validated snapshot, mapped from disk or held in memory
+// ============================================================================
+
+class SceneSnapshot {
+public:
+    using Factory = std::function<std::shared_ptr<SceneNode>()>;
+
+    ~SceneSnapshot();
+
+    SceneSnapshot(const SceneSnapshot&) = delete;
+    SceneSnapshot& operator=(const SceneSnapshot&) = delete;
+
+    // Null when the file is missing, truncated or of another version
+    static std::shared_ptr<SceneSnapshot> open(const std::string& path);
+    static std::shared_ptr<SceneSnapshot> fromBuffer(std::vector<uint8_t> bytes);
+
+    // Types are created by name; "SceneNode" is always registered. Register
+    // before instantiating, typically once at startup.
+    static void registerType(const std::string& type, Factory factory);
+    static bool isTypeRegistered(const std::string& type);
+
+    size_t getNodeCount() const { return m_header->nodeCount; }
+    size_t getSize() const { return m_size; }
+    const SnapshotNode& getNode(size_t index) const { return m_nodes[index]; }
+    const SnapshotParam* getParams() const { return m_params; }
+    const char* getString(uint32_t offset) const { return m_strings + offset; }
+
+    // Creates every node, nodes[i] for record i, with each child attached to
+    // its parent. Top-level nodes (parent NoParent) are left for the caller
+    // to attach. Unregistered types come back as plain SceneNodes.
+    void instantiate(std::vector<std::shared_ptr<SceneNode>>& nodes) const;
+
+private:
+    SceneSnapshot();
+    bool validate(const std::string& source);
+
+    std::vector<uint8_t> m_buffer;  // Owned bytes for fromBuffer()
+    int m_fd;
+    const uint8_t* m_data;
+    size_t m_size;
+    bool m_mapped;
+
+    const SnapshotHeader* m_header;
+    const SnapshotNode* m_nodes;
+    const SnapshotParam* m_params;
+    const char* m_strings;
+};
+
+// ============================================================================
+// SceneSnapshotWriter - bakes live scene nodes
+// ============================================================================
+
+class SceneSnapshotWriter {
+public:
+    SceneSnapshotWriter();
+
+    // Adds node and its subtree as a top-level snapshot node. Nodes without a
+    // snapshot type are skipped along with their children. Returns false
+    // when node itself was skipped.
+    bool add(const SceneNode& node);
+
+    size_t getNodeCount() const { return m_nodes.size(); }
+
+    std::vector<uint8_t> build() const;
+
+    // Writes to a temporary file beside path and renames it into place
+    bool save(const std::string& path) const;
+
+private:
+    bool addNode(const SceneNode& node, uint32_t parent);
+    uint32_t intern(const std::string& text);
+
+    std::vector<SnapshotNode> m_nodes;
+    std::vector<SnapshotParam> m_params;
+    std::string m_strings;
+    std::unordered_map<std::string, uint32_t> m_stringOffsets;
+};
+
+} // namespace FinalStorm
@@ -10,6 +10,7 @@
 #include "Services/Components/ParticleEmitter.h"
 #include "Rendering/Material.h"
 #include "Rendering/Mesh.h"
+#include "Core/Audio/AudioEngine.h"
 #include <iostream>
 #include <cmath>
 
@@ -47,6 +48,7 @@ void CentralNexus::update(float deltaTime) {
     updateEnergyFlow(deltaTime);
     updateConnectionEffects(deltaTime);
     updateResonanceField(deltaTime);
+    updateAudioEffects(deltaTime);
 }
 
 void CentralNexus::render(RenderContext& context) {
@@ -173,6 +175,69 @@ void CentralNexus::setResonanceMode(ResonanceMode mode) {
 
 // Private implementation methods
 
+void CentralNexus::setAudioEngine(std::shared_ptr<AudioEngine> audioEngine) {
+    if (m_audioEngine && m_harmonySource) {
+        m_audioEngine->removeSource(m_harmonySource);
+    }
+    m_harmonySource.reset();
+    m_coreSpectrum = SpectrumSubscription();
+    m_audioEngine = audioEngine;
+    if (!m_audioEngine) return;
+    
+    // The nexus is the scene's centrepiece: audible from afar and first in line for a voice
+    m_harmonySource = m_audioEngine->createSource();
+    m_harmonySource->setReferenceDistance(5.0f);
+    m_harmonySource->setMaxDistance(200.0f);
+    m_harmonySource->setPriority(2.0f);
+    m_harmonySource->setPosition(getWorldPosition());
+    
+    // Each ring sings its own chords from where it spins, and each follows
+    // its own slice of the spectrum: low, middle and high
+    for (const auto& ring : { m_primaryRing, m_secondaryRing, m_tertiaryRing }) {
+        if (ring) {
+            ring->setChordSource(m_audioEngine->createSource());
+        }
+    }
+    if (m_primaryRing) {
+        m_primaryRing->setSpectrumSubscription(m_audioEngine->subscribeSpectrum(SpectrumBand::Sub, SpectrumBand::Bass));
+    }
+    if (m_secondaryRing) {
+        m_secondaryRing->setSpectrumSubscription(m_audioEngine->subscribeSpectrum(SpectrumBand::LowMid, SpectrumBand::UpperMid));
+    }
+    if (m_tertiaryRing) {
+        m_tertiaryRing->setSpectrumSubscription(m_audioEngine->subscribeSpectrum(SpectrumBand::Presence, SpectrumBand::Air));
+    }
+    m_coreSpectrum = m_audioEngine->subscribeSpectrum(SpectrumBand::Sub, SpectrumBand::Bass);
+}
+
+void CentralNexus::updateAudioEffects(float /*deltaTime*/) {
+    if (!m_coreSpectrum || !m_nexusCore) return;
+    
+    // The core breathes with the bass instead of a fixed timer
+    float bass = m_coreSpectrum.getLevel();
+    m_nexusCore->setGlowIntensity(m_config.coreGlowIntensity * (1.0f + bass));
+    m_nexusCore->setPulseRate(1.0f + bass * 3.0f);
+}
+
+void CentralNexus::playEchoHarmony(const std::vector<float>& frequencies) {
+    if (!m_harmonySource || frequencies.empty() || !m_config.enableAudio) return;
+    
+    // Slow swell and long tail; brighter as the Song's resonance grows
+    SynthNote patch;
+    patch.waveform = m_songResonance > 0.5f ? SynthWaveform::Square : SynthWaveform::Triangle;
+    patch.harmonics = 12;
+    patch.amplitude = 0.35f * (0.5f + 0.5f * m_harmonyLevel) / std::sqrt(static_cast<float>(frequencies.size()));
+    patch.envelope.attack = 0.4f;
+    patch.envelope.decay = 0.8f;
+    patch.envelope.sustain = 0.7f;
+    patch.envelope.release = 2.5f;
+    patch.duration = 3.0f;
+    
+    m_harmonySource->setVolume(m_config.interactionVolume);
+    m_harmonySource->setPosition(getWorldPosition());
+    m_harmonySource->playChord(frequencies, patch);
+}
+
 void CentralNexus::createCoreStructure() {
     // Central crystalline core - primary octahedron
     m_coreStructure = std::make_shared<MeshNode>("Core Crystal");
@@ -20,6 +20,7 @@ namespace FinalStorm {
 class ParticleEmitter;
 class RenderContext;
 class AudioEngine;
+class AudioSource;
 
 // ============================================================================
 // Nexus State - Represents the current state of the central nexus
@@ -308,6 +309,8 @@ private:
     std::shared_ptr<AudioEngine> m_audioEngine;
     std::string m_ambientAudioId;
     bool m_audioPlaying;
+    std::shared_ptr<AudioSource> m_harmonySource;   // Synth voice for echo harmonies
+    SpectrumSubscription m_coreSpectrum;            // Bass of the master mix
 
     // Callbacks
     StateChangeCallback m_stateChangeCallback;
@@ -15,12 +15,24 @@
 #include "UI/HolographicDisplay.h"
 #include "UI/InteractiveOrb.h"
 #include "Rendering/RenderContext.h"
+#include "Scene/SceneSnapshot.h"
+#include "Scene/PickingSystem.h"
 #include "Network/FinalverseClient.h"
 #include <iostream>
 #include <random>
 
 namespace FinalStorm {
 
+namespace {
+
+// Service history on the info display: the last ten minutes of CPU usage,
+// re-read from the archive about as often as the client flushes it
+constexpr int64_t kHistoryWindowMs = 10 * 60 * 1000;
+constexpr size_t kHistoryBuckets = 60;
+constexpr float kHistoryRefreshInterval = 5.0f;
+
+} // namespace
+
 // ============================================================================
 // FirstScene Implementation - Complete with Component Systems
 // ============================================================================
@@ -40,10 +52,16 @@ FirstScene::FirstScene()
     , m_environmentController(nullptr) {
     
     std::cout << "FirstScene: Initializing the Living Canvas of Finalverse..." << std::endl;
+    
+    // Picks go through a system of its own until the app shares one
+    m_picking = std::make_shared<PickingSystem>();
 }
 
 FirstScene::~FirstScene() {
     std::cout << "FirstScene: Destructor called." << std::endl;
+    
+    // A shared picking system must not keep pointing at this scene's platforms
+    setPickingSystem(nullptr);
 }
 
 void FirstScene::initialize() {
@@ -51,6 +69,23 @@ void FirstScene::initialize() {
     
     std::cout << "FirstScene: Beginning initialization sequence..." << std::endl;
     
+    // Phases 1-5: From the baked snapshot when there is one
+    if (!m_snapshot || !loadWorldFromSnapshot()) {
+        buildWorld();
+    }
+    m_snapshot.reset(); // Unmaps the file; every node holds its own copy
+    
+    // Phase 6: Initialize camera and lighting
+    setupCameraAndLighting();
+    
+    // Phase 7: Connect to Finalverse network
+    initializeNetworking();
+    
+    m_isInitialized = true;
+    std::cout << "FirstScene: Initialization complete!" << std::endl;
+}
+
+void FirstScene::buildWorld() {
     // Phase 1: Create the foundation environment
     createEnvironment();
     
@@ -65,15 +100,133 @@ void FirstScene::initialize() {
     
     // Phase 5: Set up ambient particle systems
     createAmbientEffects();
+}
+
+// ============================================================================
+// Scene Snapshots - The Baked World
+// ============================================================================
+
+void FirstScene::registerSnapshotTypes() {
+    SceneSnapshot::registerType("EnergyRing", []() { return std::make_shared<EnergyRing>(); });
+    SceneSnapshot::registerType("ConnectionBeam", []() { return std::make_shared<ConnectionBeam>(); });
+    SceneSnapshot::registerType("ConnectionManager", []() { return std::make_shared<ConnectionManager>(); });
+    SceneSnapshot::registerType("InteractiveOrb", []() { return std::make_shared<InteractiveOrb>(); });
+    SceneSnapshot::registerType("ParticleEmitter", []() { return std::make_shared<ParticleEmitter>(); });
+    SceneSnapshot::registerType("EnvironmentController", []() { return std::make_shared<EnvironmentController>(); });
+}
+
+void FirstScene::bakeSnapshot(SceneSnapshotWriter& writer) const {
+    // The grid mesh and info display are not scene nodes; they are rebuilt
+    // after loading, as are the camera and lights
+    writer.add(*m_environmentController);
+    writer.add(*m_gridParticles);
+    writer.add(*m_atmosphericParticles);
+    writer.add(*m_centralNexus);
+    for (const auto& platform : m_servicePlatforms) writer.add(*platform);
+    writer.add(*m_connectionManager);
+    writer.add(*m_serviceDiscoveryOrb);
+    for (const auto& orb : m_ambientOrbs) writer.add(*orb);
+    writer.add(*m_energyWisps);
+    writer.add(*m_quantumFluctuations);
+}
+
+bool FirstScene::loadWorldFromSnapshot() {
+    std::vector<std::shared_ptr<SceneNode>> nodes;
+    m_snapshot->instantiate(nodes);
+    
+    // Members are bound by the names buildWorld() gives its nodes
+    for (const auto& node : nodes) {
+        const std::string& name = node->getName();
+        if (name == "Environment Controller") {
+            m_environmentController = std::dynamic_pointer_cast<EnvironmentController>(node);
+        } else if (name == "Grid Particles") {
+            m_gridParticles = std::dynamic_pointer_cast<ParticleEmitter>(node);
+        } else if (name == "Atmospheric Motes") {
+            m_atmosphericParticles = std::dynamic_pointer_cast<ParticleEmitter>(node);
+        } else if (name == "Central Nexus") {
+            m_centralNexus = node;
+        } else if (name == "Primary Ring" || name == "Secondary Ring" || name == "Tertiary Ring") {
+            if (auto ring = std::dynamic_pointer_cast<EnergyRing>(node)) m_nexusRings.push_back(ring);
+        } else if (name == "Nexus Core") {
+            m_nexusCore = std::dynamic_pointer_cast<InteractiveOrb>(node);
+        } else if (name == "Core Particles") {
+            m_coreParticles = std::dynamic_pointer_cast<ParticleEmitter>(node);
+        } else if (name.compare(0, 14, "Energy Pillar ") == 0) {
+            if (auto pillar = std::dynamic_pointer_cast<ConnectionBeam>(node)) m_energyPillars.push_back(pillar);
+        } else if (name.compare(0, 17, "Service Platform ") == 0) {
+            m_servicePlatforms.push_back(node);
+        } else if (name == "Connection Manager") {
+            m_connectionManager = std::dynamic_pointer_cast<ConnectionManager>(node);
+        } else if (name == "Service Discovery") {
+            m_serviceDiscoveryOrb = std::dynamic_pointer_cast<InteractiveOrb>(node);
+        } else if (name == "Discovery Ring") {
+            m_discoveryRing = std::dynamic_pointer_cast<EnergyRing>(node);
+        } else if (name.compare(0, 10, "Light Orb ") == 0) {
+            if (auto orb = std::dynamic_pointer_cast<InteractiveOrb>(node)) m_ambientOrbs.push_back(orb);
+        } else if (name == "Energy Wisps") {
+            m_energyWisps = std::dynamic_pointer_cast<ParticleEmitter>(node);
+        } else if (name == "Quantum Fluctuations") {
+            m_quantumFluctuations = std::dynamic_pointer_cast<ParticleEmitter>(node);
+        }
+    }
     
-    // Phase 6: Initialize camera and lighting
-    setupCameraAndLighting();
+    if (m_connectionManager) {
+        // Nexus connections first, then the ring between neighbouring platforms
+        for (const auto& child : m_connectionManager->getChildren()) {
+            auto connection = std::dynamic_pointer_cast<ConnectionBeam>(child);
+            if (!connection) continue;
+            if (m_platformConnections.size() < m_servicePlatforms.size()) {
+                m_platformConnections.push_back(connection);
+            } else {
+                m_networkConnections.push_back(connection);
+            }
+        }
+    }
     
-    // Phase 7: Connect to Finalverse network
-    initializeNetworking();
+    if (!m_environmentController || !m_gridParticles || !m_atmosphericParticles || !m_centralNexus ||
+        m_nexusRings.size() != 3 || !m_nexusCore || !m_coreParticles || m_servicePlatforms.empty() ||
+        !m_connectionManager || !m_serviceDiscoveryOrb || !m_discoveryRing ||
+        !m_energyWisps || !m_quantumFluctuations) {
+        std::cerr << "FirstScene: Snapshot does not match this scene, building instead." << std::endl;
+        m_environmentController.reset();
+        m_gridParticles.reset();
+        m_atmosphericParticles.reset();
+        m_centralNexus.reset();
+        m_nexusRings.clear();
+        m_nexusCore.reset();
+        m_coreParticles.reset();
+        m_energyPillars.clear();
+        m_servicePlatforms.clear();
+        m_connectionManager.reset();
+        m_platformConnections.clear();
+        m_networkConnections.clear();
+        m_serviceDiscoveryOrb.reset();
+        m_discoveryRing.reset();
+        m_ambientOrbs.clear();
+        m_energyWisps.reset();
+        m_quantumFluctuations.reset();
+        return false;
+    }
+    
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (m_snapshot->getNode(i).parent == SnapshotNode::NoParent) {
+            addChild(nodes[i]);
+        }
+    }
     
-    m_isInitialized = true;
-    std::cout << "FirstScene: Initialization complete!" << std::endl;
+    // Callbacks are code, not data
+    m_nexusCore->setOnActivateCallback([this]() {
+        onNexusCoreActivated();
+    });
+    m_serviceDiscoveryOrb->setOnActivateCallback([this]() {
+        onServiceDiscoveryActivated();
+    });
+    
+    createGridMesh();
+    createServiceInformationDisplay();
+    
+    std::cout << "FirstScene: Loaded " << nodes.size() << " nodes from snapshot." << std::endl;
+    return true;
 }
 
 void FirstScene::update(float deltaTime) {
@@ -90,6 +243,7 @@ void FirstScene::update(float deltaTime) {
     updateCamera(deltaTime);
     updateEnvironment(deltaTime);
     updateServices(deltaTime);
+    updatePickables();
     updateConnections(deltaTime);
     updateParticleEffects(deltaTime);
     updateNetworking(deltaTime);
@@ -159,16 +313,7 @@ void FirstScene::createEnvironment() {
 
 void FirstScene::createEnergyGrid() {
     // Create the iconic ground grid that responds to system activity
-    auto gridMesh = std::make_shared<GridMesh>();
-    gridMesh->setName("Energy Grid");
-    gridMesh->setSize(make_vec3(50.0f, 0.0f, 50.0f));
-    gridMesh->setResolution(100);
-    gridMesh->setGridColor(make_vec3(0.2f, 0.6f, 1.0f));
-    gridMesh->setGlowIntensity(0.5f);
-    gridMesh->enableQuantumDistortion(true);
-    
-    m_energyGrid = gridMesh;
-    addChild(m_energyGrid);
+    createGridMesh();
     
     // Add grid particle effects
     ParticleEmitter::Config gridParticleConfig;
@@ -191,6 +336,19 @@ void FirstScene::createEnergyGrid() {
     m_gridParticles = gridParticles;
 }
 
+void FirstScene::createGridMesh() {
+    auto gridMesh = std::make_shared<GridMesh>();
+    gridMesh->setName("Energy Grid");
+    gridMesh->setSize(make_vec3(50.0f, 0.0f, 50.0f));
+    gridMesh->setResolution(100);
+    gridMesh->setGridColor(make_vec3(0.2f, 0.6f, 1.0f));
+    gridMesh->setGlowIntensity(0.5f);
+    gridMesh->enableQuantumDistortion(true);
+    
+    m_energyGrid = gridMesh;
+    addChild(m_energyGrid);
+}
+
 void FirstScene::createAtmosphericEffects() {
     // Create floating data motes for atmosphere
     ParticleEmitter::Config atmosConfig;
@@ -798,6 +956,12 @@ void FirstScene::updateNetworking(float deltaTime) {
             handleNetworkEvent(event);
         }
         
+        // Keep metric subscriptions in step with the view
+        updateSubscriptionInterest(deltaTime);
+        updateServiceMetrics();
+        
+        m_historyRefreshTimer += deltaTime;
+        
         // Send periodic status updates
         static float statusTimer = 0.0f;
         statusTimer += deltaTime;
@@ -921,6 +1085,30 @@ void FirstScene::onServicePlatformActivated(int platformIndex) {
     }
 }
 
+void FirstScene::selectService(const std::string& serviceName) {
+    auto platform = m_serviceToplatform.find(serviceName);
+    if (platform == m_serviceToplatform.end()) return;
+    
+    m_selectedService = serviceName;
+    onServicePlatformActivated(platform->second);
+    
+    if (m_serviceInfoDisplay) {
+        m_serviceInfoDisplay->setVisible(true);
+        
+        ServiceUpdate update;
+        update.serviceName = serviceName;
+        auto metrics = m_serviceMetrics.find(serviceName);
+        if (metrics != m_serviceMetrics.end()) {
+            update.health = metrics->second.health;
+            update.load = metrics->second.load;
+            update.connections = metrics->second.connections;
+            update.requestsPerSecond = metrics->second.requestsPerSecond;
+            update.responseTime = metrics->second.responseTime;
+        }
+        updateServiceInfoDisplay(update);
+    }
+}
+
 // ============================================================================
 // Service Management - The Dynamic Ecosystem
 // ============================================================================
@@ -1031,7 +1219,7 @@ void FirstScene::initializeNetworking() {
         onNetworkConnected();
     });
     
-    m_finalverseClient->setOnDisconnectedCallback([this]() {
+    m_finalverseClient->setDisconnectedCallback([this]() {
         onNetworkDisconnected();
     });
     
@@ -1043,6 +1231,12 @@ void FirstScene::initializeNetworking() {
         handleNetworkEvent(event);
     });
     
+    // Incoming metrics are archived; the info display charts them back
+    MetricsArchiveConfig archiveConfig;
+    if (m_finalverseClient->startMetricsArchive(archiveConfig)) {
+        m_metricsHistory.open(archiveConfig.directory);
+    }
+    
     // Attempt connection
     try {
         m_finalverseClient->connect("ws://localhost:3000/ws");
@@ -1076,6 +1270,9 @@ void FirstScene::onNetworkConnected() {
 void FirstScene::onNetworkDisconnected() {
     std::cout << "FirstScene: Disconnected from Finalverse network." << std::endl;
     
+    // The server forgets our tiers with the connection; announce them again
+    m_interestManager.reset();
+    
     // Update UI to show disconnected state
     if (m_serviceInfoDisplay) {
         m_serviceInfoDisplay->setText("Disconnected from Finalverse\n\nAttempting reconnection...");
@@ -1107,18 +1304,24 @@ void FirstScene::handleServiceUpdate(const ServiceUpdate& update) {
             createServiceVisualization(platformIndex);
         }
         
-        // Update with new metrics
-        ServiceMetrics metrics;
-        metrics.health = update.health;
-        metrics.load = update.load;
-        metrics.connections = update.connections;
-        metrics.requestsPerSecond = update.requestsPerSecond;
-        metrics.responseTime = update.responseTime;
-        
-        updateServiceVisualization(platformIndex, metrics);
+        // Services with buffered metrics are drawn by updateServiceMetrics
+        // each frame; applying the update here too would snap them ahead
+        ServiceRecord buffered;
+        if (!m_finalverseClient->sampleServiceMetrics(update.serviceName, buffered)) {
+            ServiceMetrics metrics;
+            metrics.health = update.health;
+            metrics.load = update.load;
+            metrics.connections = update.connections;
+            metrics.requestsPerSecond = update.requestsPerSecond;
+            metrics.responseTime = update.responseTime;
+            
+            updateServiceVisualization(platformIndex, metrics);
+        }
         
         // Update service info display if this is the selected service
-        updateServiceInfoDisplay(update);
+        if (m_selectedService.empty() || m_selectedService == update.serviceName) {
+            updateServiceInfoDisplay(update);
+        }
     }
 }
 
@@ -1326,8 +1529,13 @@ int FirstScene::findPlatformForService(const std::string& serviceName) const {
 int FirstScene::assignServiceToPlatform(const std::string& serviceName) {
     // Find first available platform
     for (size_t i = 0; i < m_servicePlatforms.size(); ++i) {
+        int platformIndex = static_cast<int>(i);
+        if (m_platformToService.count(platformIndex) != 0) continue;
         if (i >= m_serviceVisualizations.size() || !m_serviceVisualizations[i]) {
-            return static_cast<int>(i);
+            // Picking, interest and metrics playback all find services through this map
+            m_serviceToplatform[serviceName] = platformIndex;
+            m_platformToService[platformIndex] = serviceName;
+            return platformIndex;
         }
     }
     return -1; // No available platforms
@@ -1468,6 +1676,9 @@ void FirstScene::cleanup() {
     m_nexusRings.clear();
     m_energyPillars.clear();
     m_ambientOrbs.clear();
+    m_serviceToplatform.clear();
+    m_platformToService.clear();
+    updatePickables(); // Drops every platform from the picking system
     
     // Reset shared pointers
     m_connectionManager.reset();
@@ -1788,7 +1999,26 @@ void FirstScene::updateServiceInfoDisplay(const ServiceUpdate& update) {
         infoText += "Response: " + std::to_string(static_cast<int>(update.responseTime)) + "ms";
         
         m_serviceInfoDisplay->setText(infoText);
+        chartServiceHistory(update.serviceName);
+    }
+}
+
+void FirstScene::chartServiceHistory(const std::string& serviceName) {
+    if (!m_finalverseClient || !m_finalverseClient->isArchivingMetrics()) {
+        return;
+    }
+    
+    // Segments only grow when the client flushes, so re-map now and then
+    if (m_historyRefreshTimer >= kHistoryRefreshInterval) {
+        m_metricsHistory.refresh();
+        m_historyRefreshTimer = 0.0f;
     }
+    
+    // Archive timestamps are server milliseconds
+    int64_t endTime = static_cast<int64_t>(m_finalverseClient->getServerTime() * 1000.0);
+    m_metricsHistory.downsample(serviceName, "cpuUsage", endTime - kHistoryWindowMs, endTime,
+                                kHistoryBuckets, m_historyBuckets);
+    m_serviceInfoDisplay->setData(m_historyBuckets);
 }
 
 void FirstScene::fadeOutServices() {
@@ -1838,20 +2068,106 @@ void FirstScene::enableAllInteractions() {
 
 void FirstScene::sendStatusUpdate() {
     if (m_finalverseClient && m_finalverseClient->isConnected()) {
-        // Send client status to server
-        ClientStatus status;
+        // Send client status to server; an older unsent status is replaced
+        ClientStatusPayload status;
         status.sceneType = "FirstScene";
-        status.activeServices = static_cast<int>(m_serviceVisualizations.size());
+        status.activeServices = static_cast<uint32_t>(m_serviceVisualizations.size());
         status.systemActivity = calculateSystemActivity();
         status.harmonyLevel = calculateHarmonyLevel();
-        status.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+        
+        Message message(MessageType::ClientStatus);
+        message.setTimestamp(std::chrono::duration_cast<std::chrono::milliseconds>(
             std::chrono::system_clock::now().time_since_epoch()
-        ).count();
+        ).count());
+        writePayload(message, status);
+        
+        m_finalverseClient->sendLatest(message);
+    }
+}
+
+void FirstScene::updateServiceMetrics() {
+    // Sampled a playback delay behind the server clock, so platforms ease
+    // between metric updates instead of jumping when each one lands
+    ServiceRecord sampled;
+    for (const auto& entry : m_serviceToplatform) {
+        if (!m_finalverseClient->sampleServiceMetrics(entry.first, sampled)) continue;
+        
+        ServiceMetrics& metrics = m_serviceMetrics[entry.first];
+        metrics.health = clamp(1.0f - sampled.errorRate / 100.0f, 0.0f, 1.0f);
+        metrics.load = clamp(sampled.cpuUsage / 100.0f, 0.0f, 1.0f);
+        metrics.connections = static_cast<int>(sampled.activeConnections);
+        metrics.requestsPerSecond = static_cast<float>(sampled.requestsPerSecond);
+        metrics.responseTime = sampled.averageLatency;
         
-        m_finalverseClient->sendStatusUpdate(status);
+        updateServiceVisualization(entry.second, metrics);
     }
 }
 
+void FirstScene::setPickingSystem(std::shared_ptr<PickingSystem> picking) {
+    if (picking == m_picking) return;
+    
+    if (m_picking) {
+        for (const auto& entry : m_servicePickHandles) m_picking->remove(entry.second);
+    }
+    m_servicePickHandles.clear();
+    
+    // Registered again on the next update()
+    m_picking = std::move(picking);
+}
+
+void FirstScene::updatePickables() {
+    if (!m_picking) return;
+    
+    // The same spheres the interest manager sees: a platform plus its visualization
+    for (const auto& entry : m_serviceToplatform) {
+        int platformIndex = entry.second;
+        if (platformIndex < 0 || platformIndex >= static_cast<int>(m_servicePlatforms.size())) continue;
+        
+        const auto& platform = m_servicePlatforms[platformIndex];
+        vec3 center = platform->getWorldPosition();
+        float radius = 1.5f * platform->getScale().x;
+        auto handle = m_servicePickHandles.find(entry.first);
+        if (handle == m_servicePickHandles.end()) {
+            m_servicePickHandles[entry.first] = m_picking->addSphere(entry.first, PickLayer::Services, center, radius);
+        } else {
+            m_picking->setSphere(handle->second, center, radius);
+        }
+    }
+    for (auto it = m_servicePickHandles.begin(); it != m_servicePickHandles.end();) {
+        if (m_serviceToplatform.count(it->first) == 0) {
+            m_picking->remove(it->second);
+            it = m_servicePickHandles.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void FirstScene::updateSubscriptionInterest(float deltaTime) {
+    if (!m_camera) return;
+    
+    m_interestCandidates.clear();
+    for (const auto& entry : m_serviceToplatform) {
+        int platformIndex = entry.second;
+        if (platformIndex < 0 || platformIndex >= static_cast<int>(m_servicePlatforms.size())) continue;
+        
+        const auto& platform = m_servicePlatforms[platformIndex];
+        InterestCandidate candidate;
+        candidate.serviceId = entry.first;
+        candidate.position = platform->getWorldPosition();
+        candidate.radius = 1.5f * platform->getScale().x; // Platform plus its visualization
+        m_interestCandidates.push_back(candidate);
+    }
+    
+    InterestView view;
+    view.cameraPosition = m_camera->getPosition();
+    view.viewProjection = m_camera->getViewProjectionMatrix();
+    view.fieldOfViewY = radians(m_camera->getFieldOfView());
+    
+    m_interestManager.update(view, m_interestCandidates, deltaTime);
+    m_finalverseClient->updateSubscriptionTiers(m_interestManager.getChanges());
+}
+
 // ============================================================================
 // Scheduled Actions - The Temporal Orchestra
 // ============================================================================
@@ -8,6 +8,8 @@
 #include "Scene/Scene.h"
 #include "Core/Math/MathTypes.h"
 #include "Network/ServiceTypes.h"
+#include "Network/InterestManager.h"
+#include "Services/MetricsArchive.h"
 #include <memory>
 #include <vector>
 #include <map>
@@ -31,6 +33,9 @@ class Camera;
 class FinalverseClient;
 class AudioEngine;
 class RenderContext;
+class SceneSnapshot;
+class SceneSnapshotWriter;
+class PickingSystem;
 
 // ============================================================================
 // Service Metrics Structure
@@ -87,19 +92,6 @@ struct ServiceUpdate {
     std::map<std::string, float> metrics;
 };
 
-// ============================================================================
-// Client Status Structure
-// ============================================================================
-
-struct ClientStatus {
-    std::string sceneType;
-    int activeServices = 0;
-    float systemActivity = 0.0f;
-    float harmonyLevel = 0.8f;
-    uint64_t timestamp;
-    std::map<std::string, float> clientMetrics;
-};
-
 // ============================================================================
 // Introduction Phases
 // ============================================================================
@@ -135,6 +127,21 @@ public:
     void render(RenderContext& context) override;
     void cleanup() override;
 
+    // Baked world: with a snapshot set, initialize() instantiates it instead
+    // of building the world, then adds what snapshots cannot hold (grid
+    // mesh, info panel, camera, lights, networking). A snapshot that does not
+    // match this scene falls back to building.
+    void setSnapshot(std::shared_ptr<const SceneSnapshot> snapshot) { m_snapshot = std::move(snapshot); }
+    
+    // Builds the world procedurally (initialization phases 1-5)
+    void buildWorld();
+    
+    // Adds the built world's bakeable nodes to writer
+    void bakeSnapshot(SceneSnapshotWriter& writer) const;
+    
+    // Registers the component types this scene's snapshots contain
+    static void registerSnapshotTypes();
+
     // Scene state
     bool isInitialized() const { return m_isInitialized; }
     IntroductionPhase getIntroductionPhase() const { return m_introductionPhase; }
@@ -144,6 +151,17 @@ public:
     void setCameraDistance(float distance) { m_cameraDistance = distance; }
     void setCameraHeight(float height) { m_cameraHeight = height; }
     void setCameraAutoRotate(bool autoRotate) { m_cameraAutoRotate = autoRotate; }
+    std::shared_ptr<Camera> getCamera() const { return m_camera; }
+
+    // Picking: each service platform is a sphere on PickLayer::Services,
+    // kept in step by update(). The app hands the same system to its
+    // InteractionManager so clicks land on the platforms drawn here.
+    void setPickingSystem(std::shared_ptr<PickingSystem> picking);
+    std::shared_ptr<PickingSystem> getPickingSystem() const { return m_picking; }
+
+    // Activates the service's platform and shows it on the info panel
+    void selectService(const std::string& serviceName);
+    const std::string& getSelectedService() const { return m_selectedService; }
 
     // Network integration
     void setFinalverseClient(std::shared_ptr<FinalverseClient> client) { m_finalverseClient = client; }
@@ -179,8 +197,10 @@ public:
 
 private:
     // Initialization methods
+    bool loadWorldFromSnapshot();
     void createEnvironment();
     void createEnergyGrid();
+    void createGridMesh();
     void createAtmosphericEffects();
     void createCentralNexus();
     void createNexusRings();
@@ -236,6 +256,9 @@ private:
     void handleServiceUpdate(const ServiceUpdate& update);
     void handleNetworkEvent(const NetworkEvent& event);
     void sendStatusUpdate();
+    void updateSubscriptionInterest(float deltaTime);
+    void updateServiceMetrics();
+    void updatePickables();
 
     // Visual effects methods
     void visualizeDataTransfer(const NetworkEvent& event);
@@ -262,6 +285,7 @@ private:
     vec4 lerpColor(const vec4& a, const vec4& b, float t) const;
     void updateNetworkConnections(float deltaTime);
     void updateServiceInfoDisplay(const ServiceUpdate& update);
+    void chartServiceHistory(const std::string& serviceName);
     void fadeOutServices();
     void enableAllInteractions();
 
@@ -278,6 +302,7 @@ private:
 private:
     // Scene state
     bool m_isInitialized;
+    std::shared_ptr<const SceneSnapshot> m_snapshot;
     IntroductionPhase m_introductionPhase;
     float m_transitionProgress;
     float m_environmentTime;
@@ -330,6 +355,21 @@ private:
     std::map<std::string, int> m_serviceToplatform;
     std::map<int, std::string> m_platformToService;
     std::map<std::string, ServiceMetrics> m_serviceMetrics;
+    std::string m_selectedService;
+
+    // Picking handles by service name
+    std::shared_ptr<PickingSystem> m_picking;
+    std::map<std::string, uint32_t> m_servicePickHandles;
+
+    // Metric subscription tiers driven by what the camera can see
+    InterestManager m_interestManager;
+    std::vector<InterestCandidate> m_interestCandidates;
+
+    // Recent history charted on the info display, read back from the
+    // metrics archive the client writes
+    MetricsArchiveReader m_metricsHistory;
+    std::vector<MetricRollupBucket> m_historyBuckets;
+    float m_historyRefreshTimer = 0.0f;
 
     // Scheduled actions
     std::vector<std::shared_ptr<DelayedAction>> m_scheduledActions;
@@ -10,9 +10,13 @@
 #include "Services/Components/ParticleEmitter.h"
 #include "Services/Components/ConnectionBeam.h"
 #include "Rendering/RenderContext.h"
+#include "Network/InterestManager.h"
+#include "Scene/PickingSystem.h"
 #include <iostream>
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <limits>
 
 namespace FinalStorm {
 
@@ -44,6 +48,9 @@ ServiceRing::ServiceRing() : SceneNode("Service Ring") {
     m_serviceSpacing = 1.2f; // Minimum spacing factor
     m_heightVariation = 0.8f;
     
+    // Picks go through a system of its own until the scene shares one
+    m_picking = std::make_shared<PickingSystem>();
+    
     // Create ring visualization
     createRingVisualization();
     createOrbitTrails();
@@ -51,7 +58,10 @@ ServiceRing::ServiceRing() : SceneNode("Service Ring") {
     std::cout << "ServiceRing initialized with orbital positioning system." << std::endl;
 }
 
-ServiceRing::~ServiceRing() = default;
+ServiceRing::~ServiceRing() {
+    // A shared picking system must not keep pointing at this ring's services
+    setPickingSystem(nullptr);
+}
 
 void ServiceRing::addService(std::shared_ptr<ServiceEntity> service) {
     if (!service) return;
@@ -136,6 +146,7 @@ void ServiceRing::update(float deltaTime) {
     updateServiceAnimations(deltaTime);
     updateFocusTransition(deltaTime);
     updateVisualEffects(deltaTime);
+    updatePickables();
 }
 
 void ServiceRing::render(RenderContext& context) {
@@ -831,4 +842,236 @@ void ServiceRing::updateRingParticles(float deltaTime) {
     }
 }
 
+// ============================================================================
+// ServiceRing Interest Candidates - What the camera can see on the ring
+// ============================================================================
+
+void ServiceRing::collectInterestCandidates(std::vector<InterestCandidate>& candidates) const {
+    for (const auto& entry : m_services) {
+        const ServicePosition& servicePos = entry.second;
+        if (!servicePos.isVisible) continue;
+        
+        // The interaction radius already bounds a service's visuals for picking
+        InterestCandidate candidate;
+        candidate.serviceId = servicePos.serviceId;
+        candidate.position = servicePos.worldPosition;
+        candidate.radius = m_config.interactionRadius * servicePos.scale;
+        candidates.push_back(candidate);
+    }
+}
+
+// ============================================================================
+// ServiceRing Picking - Services, connections and the ring base as pickables
+// ============================================================================
+
+void ServiceRing::setPickingSystem(std::shared_ptr<PickingSystem> picking) {
+    if (picking == m_picking) return;
+
+    if (m_picking) {
+        for (const auto& entry : m_servicePickHandles) m_picking->remove(entry.second);
+        for (const auto& entry : m_connectionPickHandles) m_picking->remove(entry.second);
+        if (m_ringPickHandle) m_picking->remove(m_ringPickHandle);
+    }
+    m_servicePickHandles.clear();
+    m_connectionPickHandles.clear();
+    m_ringPickHandle = 0;
+
+    // Registered again on the next update()
+    m_picking = std::move(picking);
+}
+
+std::string ServiceRing::pickService(const Ray& ray) const {
+    PickHit hit;
+    if (!m_picking || !m_picking->pick(ray, std::numeric_limits<float>::max(), PickLayer::Services, hit)) {
+        return std::string();
+    }
+    return hit.id;
+}
+
+std::string ServiceRing::getServiceAtPosition(const vec3& worldPosition, float tolerance) const {
+    PickHit hit;
+    if (!m_picking || !m_picking->nearest(worldPosition, tolerance, PickLayer::Services, hit)) {
+        return std::string();
+    }
+    return hit.id;
+}
+
+std::string ServiceRing::findNearestService(const vec3& position) const {
+    PickHit hit;
+    if (!m_picking || !m_picking->nearest(position, std::numeric_limits<float>::max(), PickLayer::Services, hit)) {
+        return std::string();
+    }
+    return hit.id;
+}
+
+void ServiceRing::updatePickables() {
+    if (!m_picking) return;
+
+    // Services: the same interaction spheres the interest manager sees
+    for (const auto& entry : m_services) {
+        const ServicePosition& servicePos = entry.second;
+        auto handle = m_servicePickHandles.find(entry.first);
+        if (!servicePos.isVisible || !servicePos.isInteractable) {
+            if (handle != m_servicePickHandles.end()) {
+                m_picking->remove(handle->second);
+                m_servicePickHandles.erase(handle);
+            }
+            continue;
+        }
+
+        float radius = m_config.interactionRadius * servicePos.scale;
+        if (handle == m_servicePickHandles.end()) {
+            m_servicePickHandles[entry.first] =
+                m_picking->addSphere(entry.first, PickLayer::Services, servicePos.worldPosition, radius);
+        } else {
+            m_picking->setSphere(handle->second, servicePos.worldPosition, radius);
+        }
+    }
+    for (auto it = m_servicePickHandles.begin(); it != m_servicePickHandles.end();) {
+        if (m_services.count(it->first) == 0) {
+            m_picking->remove(it->second);
+            it = m_servicePickHandles.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // Connections: triangle trees are only built once a ray reaches a beam
+    for (const auto& entry : m_serviceConnections) {
+        const std::shared_ptr<ConnectionBeam>& beam = entry.second;
+        if (!beam) continue;
+        auto handle = m_connectionPickHandles.find(entry.first);
+        if (handle == m_connectionPickHandles.end()) {
+            std::weak_ptr<ConnectionBeam> weakBeam = beam;
+            m_connectionPickHandles[entry.first] = m_picking->addMesh(
+                entry.first.first + "->" + entry.first.second, PickLayer::Connections,
+                beam->getPickBounds(), beam->getWorldMatrix(),
+                [weakBeam]() -> const TriangleBvh* {
+                    auto locked = weakBeam.lock();
+                    return locked ? locked->getPickMesh() : nullptr;
+                });
+        } else {
+            m_picking->setMesh(handle->second, beam->getPickBounds(), beam->getWorldMatrix());
+        }
+    }
+    for (auto it = m_connectionPickHandles.begin(); it != m_connectionPickHandles.end();) {
+        if (m_serviceConnections.count(it->first) == 0) {
+            m_picking->remove(it->second);
+            it = m_connectionPickHandles.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // Ring base: bounded by a sphere around the outer edge so its animated
+    // displacement never needs the mesh to be walked here
+    if (m_ringBase) {
+        Aabb ringBounds = Aabb::fromSphere(vec3_zero(), m_config.outerRadius + m_config.ringHeight);
+        if (!m_ringPickHandle) {
+            std::weak_ptr<EnergyRing> weakRing = m_ringBase;
+            m_ringPickHandle = m_picking->addMesh("ring", PickLayer::Ring, ringBounds, m_ringBase->getWorldMatrix(),
+                [weakRing]() -> const TriangleBvh* {
+                    auto locked = weakRing.lock();
+                    return locked ? locked->getPickMesh() : nullptr;
+                });
+        } else {
+            m_picking->setMesh(m_ringPickHandle, ringBounds, m_ringBase->getWorldMatrix());
+        }
+    } else if (m_ringPickHandle) {
+        m_picking->remove(m_ringPickHandle);
+        m_ringPickHandle = 0;
+    }
+}
+
+// ============================================================================
+// ServiceRingMetrics Implementation - History and trend analysis
+// ============================================================================
+
+namespace {
+uint64_t steadyMilliseconds() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+} // namespace
+
+ServiceRingMetrics::ServiceRingMetrics()
+    : m_startTime(steadyMilliseconds()) {
+}
+
+ServiceRingMetrics::~ServiceRingMetrics() = default;
+
+void ServiceRingMetrics::recordRingState(const std::string& ringId, const ServiceRing& ring) {
+    RingMetrics& metrics = m_ringMetrics[ringId];
+    metrics.ringId = ringId;
+    metrics.serviceCount = ring.getServiceCount();
+    metrics.averageActivity = ring.getAverageServiceActivity();
+    metrics.averageHealth = ring.getAverageServiceHealth();
+    metrics.rotationSpeed = ring.getConfig().rotationSpeed;
+
+    updateHistory(metrics.activityHistory, metrics.averageActivity);
+    updateHistory(metrics.healthHistory, metrics.averageHealth);
+}
+
+void ServiceRingMetrics::recordPerformanceMetrics(const std::string& ringId, float frameTime) {
+    updateHistory(m_performanceHistory[ringId], frameTime);
+}
+
+std::vector<float> ServiceRingMetrics::getActivityTrend(const std::string& ringId, int dataPoints) const {
+    std::vector<float> trend;
+    auto it = m_ringMetrics.find(ringId);
+    if (it != m_ringMetrics.end() && dataPoints > 0) {
+        it->second.activityHistory.copyRecent(static_cast<size_t>(dataPoints), trend);
+    }
+    return trend;
+}
+
+std::vector<float> ServiceRingMetrics::getHealthTrend(const std::string& ringId, int dataPoints) const {
+    std::vector<float> trend;
+    auto it = m_ringMetrics.find(ringId);
+    if (it != m_ringMetrics.end() && dataPoints > 0) {
+        it->second.healthHistory.copyRecent(static_cast<size_t>(dataPoints), trend);
+    }
+    return trend;
+}
+
+bool ServiceRingMetrics::detectActivitySpike(const std::string& ringId, float threshold) const {
+    auto it = m_ringMetrics.find(ringId);
+    if (it == m_ringMetrics.end()) return false;
+
+    const MetricsTimeSeries& history = it->second.activityHistory;
+    if (history.size() < 2) return false;
+
+    // Spike when the newest sample sits more than threshold deviations above the window mean
+    float deviation = std::sqrt(calculateVariance(history));
+    return history.latest().value > history.mean() + threshold * deviation;
+}
+
+bool ServiceRingMetrics::detectHealthDegradation(const std::string& ringId, float threshold) const {
+    auto it = m_ringMetrics.find(ringId);
+    if (it == m_ringMetrics.end()) return false;
+
+    const MetricsTimeSeries& history = it->second.healthHistory;
+    if (history.size() < 2) return false;
+
+    // Projected health change across the retained window
+    double window = history.latest().timestamp - history.sampleAt(0).timestamp;
+    return calculateTrend(history) * window < -threshold;
+}
+
+double ServiceRingMetrics::getElapsedSeconds() const {
+    return (steadyMilliseconds() - m_startTime) / 1000.0;
+}
+
+void ServiceRingMetrics::updateHistory(MetricsTimeSeries& history, float value) {
+    history.push(getElapsedSeconds(), value);
+}
+
+float ServiceRingMetrics::calculateTrend(const MetricsTimeSeries& data) const {
+    return data.trend();
+}
+
+float ServiceRingMetrics::calculateVariance(const MetricsTimeSeries& data) const {
+    return data.variance();
+}
+
 } // namespace FinalStorm
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include "Services/Components/EnergyRing.h"
 #include "Services/Components/ConnectionBeam.h"
 #include "Services/Visual/ServiceVisualization.h"
+#include "Services/MetricsTimeSeries.h"
 #include <memory>
 #include <vector>
 #include <map>
@@ -24,6 +25,9 @@ class InteractiveOrb;
 class HolographicDisplay;
 class RenderContext;
 class AudioEngine;
+class PickingSystem;
+struct InterestCandidate;
+struct Ray;
 
 // ============================================================================
 // Service Ring Configuration
@@ -288,6 +292,12 @@ public:
     bool isServiceSelected(const std::string& serviceId) const;
     std::string getServiceAtPosition(const vec3& worldPosition, float tolerance = 1.0f) const;
 
+    // Picking: services are spheres of interactionRadius, connections and the
+    // ring base are triangle meshes. update() keeps them in the picking system.
+    void setPickingSystem(std::shared_ptr<PickingSystem> picking);
+    std::shared_ptr<PickingSystem> getPickingSystem() const { return m_picking; }
+    std::string pickService(const Ray& ray) const;
+
     // Clustering
     void enableClustering(bool enable);
     void addServiceToCluster(const std::string& serviceId, const std::string& clusterId);
@@ -330,6 +340,9 @@ public:
     void setMaxVisibleServices(int maxVisible);
     void optimizeForPerformance(bool optimize);
 
+    // Interest management: visible services with their world bounds
+    void collectInterestCandidates(std::vector<InterestCandidate>& candidates) const;
+
     // State queries
     bool isRotating() const { return m_isRotating; }
     bool isArranging() const { return m_isArranging; }
@@ -365,6 +378,7 @@ protected:
     void handleServiceInteraction(const std::string& serviceId, const vec3& position);
     void handleRingInteraction(const vec3& position);
     std::string findNearestService(const vec3& position) const;
+    void updatePickables();
 
     // Visual updates
     void updateConnectionLines(float deltaTime);
@@ -413,6 +427,12 @@ private:
     std::shared_ptr<AudioEngine> m_audioEngine;
     std::string m_ambientAudioId;
 
+    // Picking handles, by service id and by connection endpoints
+    std::shared_ptr<PickingSystem> m_picking;
+    std::map<std::string, uint32_t> m_servicePickHandles;
+    std::map<std::pair<std::string, std::string>, uint32_t> m_connectionPickHandles;
+    uint32_t m_ringPickHandle = 0;
+
     // Performance
     float m_lodDistance;
     bool m_occlusionEnabled;
@@ -667,8 +687,8 @@ public:
         int interactionCount;
         float lastInteractionTime;
         std::map<std::string, int> serviceTypeCount;
-        std::vector<float> activityHistory;
-        std::vector<float> healthHistory;
+        MetricsTimeSeries activityHistory;
+        MetricsTimeSeries healthHistory;
     };
 
     ServiceRingMetrics();
@@ -677,7 +697,7 @@ public:
     // Metrics collection
     void recordRingState(const std::string& ringId, const ServiceRing& ring);
     void recordServiceInteraction(const std::string& ringId, const std::string& serviceId);
-    void recordPerformanceMetrics(const std::string& ringId, float frameTime, int renderCalls);
+    void recordPerformanceMetrics(const std::string& ringId, float frameTime);
 
     // Analytics
     RingMetrics getRingMetrics(const std::string& ringId) const;
@@ -705,12 +725,13 @@ public:
 
 private:
     std::map<std::string, RingMetrics> m_ringMetrics;
-    std::map<std::string, std::vector<float>> m_performanceHistory;
+    std::map<std::string, MetricsTimeSeries> m_performanceHistory;
     uint64_t m_startTime;
     
-    void updateHistory(std::vector<float>& history, float value, size_t maxSize = 1000);
-    float calculateTrend(const std::vector<float>& data) const;
-    float calculateVariance(const std::vector<float>& data) const;
+    double getElapsedSeconds() const;
+    void updateHistory(MetricsTimeSeries& history, float value);
+    float calculateTrend(const MetricsTimeSeries& data) const;
+    float calculateVariance(const MetricsTimeSeries& data) const;
 };
 
 } // namespace FinalStorm
\ No newline at end of file
@@ -7,7 +7,7 @@
 namespace FinalStorm {
 
 BeamMesh::BeamMesh()
-    : m_segmentCount(32), m_isDirty(true), m_vertexBuffer(nullptr), m_indexBuffer(nullptr) {}
+    : m_segmentCount(32), m_isDirty(true), m_pickDirty(true), m_vertexBuffer(nullptr), m_indexBuffer(nullptr) {}
 
 BeamMesh::~BeamMesh() = default;
 
@@ -48,6 +48,7 @@ void BeamMesh::generateTube(const std::vector<vec3>& centerLine, float thickness
         }
     }
     generateIndices();
+    m_pickDirty = true;
 }
 
 void BeamMesh::generateRibbon(const std::vector<vec3>& centerLine, float width) {
@@ -79,6 +80,7 @@ void BeamMesh::generateRibbon(const std::vector<vec3>& centerLine, float width)
         m_indices.push_back(base + 3);
         m_indices.push_back(base + 2);
     }
+    m_pickDirty = true;
 }
 
 void BeamMesh::render(RenderContext& context) {
@@ -91,6 +93,15 @@ void BeamMesh::render(RenderContext& context) {
     }
 }
 
+const TriangleBvh* BeamMesh::getPickMesh() {
+    if (m_pickDirty) {
+        // Same segment count as last time refits; a new shape rebuilds
+        m_pickMesh.update(m_vertices, m_indices);
+        m_pickDirty = false;
+    }
+    return m_pickMesh.isEmpty() ? nullptr : &m_pickMesh;
+}
+
 void BeamMesh::generateIndices() {
     int radialSegments = 8;
     int longitudinalSegments = static_cast<int>(m_vertices.size() / radialSegments) - 1;
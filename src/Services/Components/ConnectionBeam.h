@@ -9,6 +9,7 @@
 #include "Core/Math/MathTypes.h"
 #include "Rendering/Material.h"
 #include "Rendering/Mesh.h"
+#include "Scene/Bvh.h"
 #include <memory>
 #include <vector>
 
@@ -80,6 +81,17 @@ public:
     ConnectionType getType() const { return m_connectionType; }
     ConnectionState getState() const { return m_connectionState; }
     
+    // Picking: bounds of the beam in local space (covering its curve, noise
+    // and thickness) and its triangles, built lazily
+    Aabb getPickBounds() const;
+    const TriangleBvh* getPickMesh();
+    
+    // Snapshots: endpoints, kind and look; flow particles are recreated
+    const char* getSnapshotType() const override { return "ConnectionBeam"; }
+    void writeSnapshot(SnapshotParams& params) const override;
+    void readSnapshot(const SnapshotParamReader& params) override;
+    bool snapshotsChildren() const override { return false; }
+    
     // Advanced effects
     void setTurbulence(float amount);
     void setGlowFalloff(float falloff);
@@ -188,6 +200,10 @@ public:
     const std::vector<vec2>& getUVs() const { return m_uvs; }
     const std::vector<uint32_t>& getIndices() const { return m_indices; }
     
+    // Triangle tree for ray picks, brought up to date on request: beams
+    // regenerate often, but are rarely under the pointer
+    const TriangleBvh* getPickMesh();
+    
 private:
     std::vector<vec3> m_vertices;
     std::vector<vec3> m_normals;
@@ -197,6 +213,9 @@ private:
     int m_segmentCount;
     bool m_isDirty;
     
+    TriangleBvh m_pickMesh;
+    bool m_pickDirty;
+    
     // Metal buffer objects
     id<MTLBuffer> m_vertexBuffer;
     id<MTLBuffer> m_indexBuffer;
@@ -251,6 +270,13 @@ public:
     // SceneNode interface
     void update(float deltaTime) override;
     void render(RenderContext& context) override;
+    
+    // Snapshots: global settings; baked beams come back as children and are
+    // managed again once the tree is built
+    const char* getSnapshotType() const override { return "ConnectionManager"; }
+    void writeSnapshot(SnapshotParams& params) const override;
+    void readSnapshot(const SnapshotParamReader& params) override;
+    void onSnapshotInstantiated() override;
 
 private:
     std::vector<std::shared_ptr<ConnectionBeam>> m_connections;
@@ -5,6 +5,8 @@
 
 #include "Services/Components/EnergyRing.h"
 #include "Services/Components/ParticleEmitter.h"
+#include "Scene/SceneSnapshot.h"
+#include "Core/Audio/AudioEngine.h"
 #include "Rendering/RenderContext.h"
 #include "Core/Math/Math.h"
 #include "Core/Math/Transform.h"
@@ -41,6 +43,7 @@ EnergyRing::EnergyRing()
     , m_harmonyLevel(0.5f)
     , m_resonanceWithSong(0.0f)
     , m_musicalPhase(0.0f)
+    , m_audioLevel(0.0f)
     , m_dataThroughput(0.0f)
     , m_connectionCount(0)
     , m_processingLoad(0.0f)
@@ -75,6 +78,19 @@ void EnergyRing::update(float deltaTime) {
     updateQuantumEffects(deltaTime);
     updateTemporalEffects(deltaTime);
     
+    if (m_chordSource) {
+        m_chordSource->setPosition(getWorldPosition());
+    }
+    
+    // Audio reactivity: louder bands glow brighter and kick the pulse, which
+    // then decays on its own
+    if (m_spectrum) {
+        m_audioLevel = m_spectrum.getLevel();
+        if (m_audioLevel * 1.5f > m_pulseIntensity) {
+            m_pulseIntensity = m_audioLevel * 1.5f;
+        }
+    }
+    
     if (m_geometryDirty) {
         m_ringMesh->rebuild();
         m_geometryDirty = false;
@@ -251,13 +267,79 @@ void EnergyRing::setHarmonyLevel(float harmony) {
 }
 
 void EnergyRing::triggerChord(const std::vector<float>& frequencies) {
-    m_activeChordFrequencies = frequencies;
-    enableHarmonicResonance(true, frequencies.empty() ? 1.0f : frequencies[0]);
+    if (frequencies.empty()) return;
+    
+    // Visuals move at the ring's own harmonic rate; the chord keeps its
+    // intervals as ratios to the root
+    float root = std::max(frequencies[0], 1e-3f);
+    m_activeChordFrequencies.clear();
+    for (float freq : frequencies) {
+        m_activeChordFrequencies.push_back(m_harmonicFrequency * freq / root);
+    }
+    enableHarmonicResonance(true, m_harmonicFrequency);
     
     // Create harmonic ripples for each frequency
     for (float freq : frequencies) {
-        triggerRipple(0.8f + freq * 0.1f);
+        triggerRipple(0.8f + (freq / root) * 0.1f);
     }
+    
+    if (!m_chordSource) return;
+    
+    // Timbre follows harmony: soft when stable, harsh when discordant
+    SynthNote patch;
+    if (m_harmonyLevel > 0.7f) {
+        patch.waveform = SynthWaveform::Triangle;
+        patch.harmonics = 6;
+    } else if (m_harmonyLevel > 0.3f) {
+        patch.waveform = SynthWaveform::Square;
+        patch.harmonics = 12;
+    } else {
+        patch.waveform = SynthWaveform::Saw;
+        patch.harmonics = 10;
+    }
+    patch.amplitude = 0.3f * (0.5f + 0.5f * m_energyLevel) / std::sqrt(static_cast<float>(frequencies.size()));
+    patch.duration = 1.5f;
+    patch.envelope.release = 1.0f;
+    
+    std::vector<float> audible;
+    for (float freq : frequencies) {
+        if (freq >= 20.0f && freq <= 8000.0f) audible.push_back(freq);
+    }
+    m_chordSource->playChord(audible, patch);
+}
+
+void EnergyRing::setChordSource(std::shared_ptr<AudioSource> source) {
+    if (m_chordSource && m_chordSource != source) {
+        m_chordSource->stop();
+    }
+    m_chordSource = source;
+    if (m_chordSource) {
+        m_chordSource->setPosition(getWorldPosition());
+    }
+}
+
+void EnergyRing::sonifyMetrics() {
+    // Load raises the root by up to an octave in semitones; harmony picks a
+    // major or minor third; overload flattens the fifth to a tritone
+    float root = 110.0f * std::pow(2.0f, std::round(m_processingLoad * 12.0f) / 12.0f);
+    bool stressed = m_ringState == RingState::OVERLOAD || m_ringState == RingState::CRITICAL ||
+                    m_ringState == RingState::CORRUPTED;
+    float third = m_harmonyLevel >= 0.5f ? 4.0f : 3.0f;
+    float fifth = stressed ? 6.0f : 7.0f;
+    
+    std::vector<float> chord;
+    chord.push_back(root);
+    chord.push_back(root * std::pow(2.0f, third / 12.0f));
+    chord.push_back(root * std::pow(2.0f, fifth / 12.0f));
+    
+    // Busy rings get a seventh; heavy traffic doubles the root an octave up
+    if (m_connectionCount > 8) {
+        chord.push_back(root * std::pow(2.0f, 10.0f / 12.0f));
+    }
+    if (m_dataThroughput > 100.0f) {
+        chord.push_back(root * 2.0f);
+    }
+    triggerChord(chord);
 }
 
 void EnergyRing::setResonanceWithSong(float resonance) {
@@ -352,6 +434,48 @@ void EnergyRing::setTemporalDistortion(float amount) {
     setRotationSpeed(m_rotationSpeed * timeScale);
 }
 
+const TriangleBvh* EnergyRing::getPickMesh() {
+    return m_ringMesh ? m_ringMesh->getPickMesh() : nullptr;
+}
+
+void EnergyRing::writeSnapshot(SnapshotParams& params) const {
+    params.set("innerRadius", m_innerRadius);
+    params.set("outerRadius", m_outerRadius);
+    params.set("height", m_height);
+    params.set("segments", m_segments);
+    params.set("ringType", static_cast<int>(m_ringType));
+    params.set("ringState", static_cast<int>(m_ringState));
+    params.set("color", m_color);
+    params.set("glowIntensity", m_glowIntensity);
+    params.set("rotationSpeed", m_rotationSpeed);
+    params.set("flowDirection", m_flowDirection);
+    params.set("rotationAxis", m_rotationAxis);
+    params.set("harmonicResonance", m_harmonicResonance);
+    params.set("harmonicFrequency", m_harmonicFrequency);
+    params.set("distortionAmount", m_distortionAmount);
+    params.set("quantumFluctuation", m_quantumFluctuation);
+}
+
+void EnergyRing::readSnapshot(const SnapshotParamReader& params) {
+    // Through the setters, in the order the scenes build rings, so clamps and
+    // effect setup match a procedurally built ring; geometry rebuilds lazily
+    setInnerRadius(params.getFloat("innerRadius", m_innerRadius));
+    setOuterRadius(params.getFloat("outerRadius", m_outerRadius));
+    setHeight(params.getFloat("height", m_height));
+    setSegments(params.getInt("segments", m_segments));
+    setColor(params.getVec3("color", m_color));
+    setGlowIntensity(params.getFloat("glowIntensity", m_glowIntensity));
+    setRotationSpeed(params.getFloat("rotationSpeed", m_rotationSpeed));
+    setFlowDirection(params.getFloat("flowDirection", m_flowDirection));
+    setRotationAxis(params.getVec3("rotationAxis", m_rotationAxis));
+    setRingType(static_cast<RingType>(params.getInt("ringType", static_cast<int>(m_ringType))));
+    setState(static_cast<RingState>(params.getInt("ringState", static_cast<int>(m_ringState))));
+    enableHarmonicResonance(params.getBool("harmonicResonance", m_harmonicResonance),
+                            params.getFloat("harmonicFrequency", m_harmonicFrequency));
+    setDistortionAmount(params.getFloat("distortionAmount", m_distortionAmount));
+    setQuantumFluctuation(params.getFloat("quantumFluctuation", m_quantumFluctuation));
+}
+
 // ============================================================================
 // Private Implementation Methods
 // ============================================================================
@@ -685,6 +809,9 @@ void EnergyRing::updateMaterialColor() {
         finalIntensity *= (1.0f + calculateHarmonicModulation(m_musicalPhase) * 0.2f);
     }
     
+    // Add audio reactivity
+    finalIntensity *= (1.0f + m_audioLevel);
+    
     m_ringMaterial->setEmissionStrength(finalIntensity);
     m_ringMaterial->setAlpha(stateColor.w);
 }
@@ -948,7 +1075,8 @@ RingMesh::RingMesh()
     , m_tessellationLevel(1)
     , m_vertexBuffer(nullptr)
     , m_indexBuffer(nullptr)
-    , m_buffersDirty(true) {
+    , m_buffersDirty(true)
+    , m_pickDirty(true) {
 }
 
 RingMesh::~RingMesh() = default;
@@ -988,6 +1116,7 @@ void RingMesh::build() {
     generateIndices();
     calculateNormals();
     updateBuffers();
+    m_pickDirty = true;
 }
 
 void RingMesh::rebuild() {
@@ -1022,6 +1151,7 @@ void RingMesh::applyHarmonicDistortion(float frequency, float amplitude) {
         vertex = calculateHarmonicPosition(vertex, frequency * amplitude);
     }
     m_buffersDirty = true;
+    m_pickDirty = true;
 }
 
 void RingMesh::applyQuantumDisplacement(float time) {
@@ -1031,6 +1161,17 @@ void RingMesh::applyQuantumDisplacement(float time) {
         vertex = vertex + calculateQuantumDisplacement(vertex, time);
     }
     m_buffersDirty = true;
+    m_pickDirty = true;
+}
+
+const TriangleBvh* RingMesh::getPickMesh() {
+    if (m_pickDirty) {
+        // Displacement only moves vertices, which refits; a rebuild with a
+        // new segment count rebuilds the tree
+        m_pickMesh.update(m_vertices, m_indices);
+        m_pickDirty = false;
+    }
+    return m_pickMesh.isEmpty() ? nullptr : &m_pickMesh;
 }
 
 void RingMesh::generateVertices() {
@@ -9,6 +9,8 @@
 #include "Core/Math/MathTypes.h"
 #include "Rendering/Material.h"
 #include "Rendering/Mesh.h"
+#include "Core/Audio/SpectrumAnalyzer.h"
+#include "Scene/Bvh.h"
 #include <memory>
 #include <vector>
 
@@ -17,6 +19,7 @@ namespace FinalStorm {
 // Forward declarations
 class ParticleEmitter;
 class RenderContext;
+class AudioSource;
 
 // ============================================================================
 // EnergyRing - Rotating energy rings for service visualization
@@ -78,9 +81,16 @@ public:
     // Musical/Harmonic effects (for Finalverse Song mechanics)
     void setMusicalNote(float frequency);
     void setHarmonyLevel(float harmony); // Affects visual harmony/chaos
-    void triggerChord(const std::vector<float>& frequencies);
+    void triggerChord(const std::vector<float>& frequencies); // Hz; audible with a chord source
     void setResonanceWithSong(float resonance);
     
+    // Synth source the ring's chords play on; it follows the ring's position
+    void setChordSource(std::shared_ptr<AudioSource> source);
+    void sonifyMetrics(); // Chord built from load, throughput, connections and harmony
+    
+    // Glow and pulse follow these bands of the master mix
+    void setSpectrumSubscription(SpectrumSubscription subscription) { m_spectrum = std::move(subscription); }
+    
     // Data visualization
     void setDataThroughput(float mbps);
     void setConnectionCount(int connections);
@@ -99,6 +109,16 @@ public:
     RingType getType() const { return m_ringType; }
     RingState getState() const { return m_ringState; }
     float getEnergyLevel() const { return m_energyLevel; }
+    
+    // Picking: the ring's triangles in local space, built lazily
+    const TriangleBvh* getPickMesh();
+    
+    // Snapshots: geometry, type, state and look. Effect children are
+    // recreated from the type, never baked.
+    const char* getSnapshotType() const override { return "EnergyRing"; }
+    void writeSnapshot(SnapshotParams& params) const override;
+    void readSnapshot(const SnapshotParamReader& params) override;
+    bool snapshotsChildren() const override { return false; }
 
 private:
     // Geometry properties
@@ -130,6 +150,9 @@ private:
     float m_resonanceWithSong;
     std::vector<float> m_activeChordFrequencies;
     float m_musicalPhase;
+    std::shared_ptr<AudioSource> m_chordSource;
+    SpectrumSubscription m_spectrum;
+    float m_audioLevel;
     
     // Data visualization
     float m_dataThroughput;
@@ -219,6 +242,9 @@ public:
     void applyHarmonicDistortion(float frequency, float amplitude);
     void applyQuantumDisplacement(float time);
     
+    // Triangle tree for ray picks, brought up to date on request
+    const TriangleBvh* getPickMesh();
+    
 private:
     float m_innerRadius;
     float m_outerRadius;
@@ -239,6 +265,9 @@ private:
     id<MTLBuffer> m_indexBuffer;
     bool m_buffersDirty;
     
+    TriangleBvh m_pickMesh;
+    bool m_pickDirty;
+    
     void generateVertices();
     void generateIndices();
     void calculateNormals();
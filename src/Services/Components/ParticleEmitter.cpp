@@ -5,6 +5,7 @@
 
 #include "Services/Components/ParticleEmitter.h"
 #include "Rendering/RenderContext.h"
+#include "Scene/SceneSnapshot.h"
 #include "Core/Math/MathTypes.h"
 #include "Core/Math/Math.h"
 #include <iostream>
@@ -73,6 +74,42 @@ void ParticleEmitter::setEmitRate(float rate) {
     m_config.emitRate = std::max(0.0f, rate);
 }
 
+void ParticleEmitter::writeSnapshot(SnapshotParams& params) const {
+    const Config& c = m_config;
+    params.set("emitShape", static_cast<int>(c.emitShape));
+    params.set("emitRadius", c.emitRadius);
+    params.set("emitSize", make_vec3(c.emitSize.x, c.emitSize.y, c.emitSize.z));
+    params.set("emitRate", c.emitRate);
+    params.set("particleLifetime", c.particleLifetime);
+    params.set("startSize", c.startSize);
+    params.set("endSize", c.endSize);
+    params.set("startColor", make_vec4(c.startColor.x, c.startColor.y, c.startColor.z, c.startColor.w));
+    params.set("endColor", make_vec4(c.endColor.x, c.endColor.y, c.endColor.z, c.endColor.w));
+    params.set("velocity", c.velocity);
+    params.set("gravity", make_vec3(c.gravity.x, c.gravity.y, c.gravity.z));
+}
+
+void ParticleEmitter::readSnapshot(const SnapshotParamReader& params) {
+    Config c = m_config;
+    vec3 emitSize = params.getVec3("emitSize", make_vec3(c.emitSize.x, c.emitSize.y, c.emitSize.z));
+    vec4 startColor = params.getVec4("startColor", make_vec4(c.startColor.x, c.startColor.y, c.startColor.z, c.startColor.w));
+    vec4 endColor = params.getVec4("endColor", make_vec4(c.endColor.x, c.endColor.y, c.endColor.z, c.endColor.w));
+    vec3 gravity = params.getVec3("gravity", make_vec3(c.gravity.x, c.gravity.y, c.gravity.z));
+
+    c.emitShape = static_cast<Shape>(params.getInt("emitShape", static_cast<int>(c.emitShape)));
+    c.emitRadius = params.getFloat("emitRadius", c.emitRadius);
+    c.emitSize = glm::vec3(emitSize.x, emitSize.y, emitSize.z);
+    c.emitRate = std::max(0.0f, params.getFloat("emitRate", c.emitRate));
+    c.particleLifetime = params.getFloat("particleLifetime", c.particleLifetime);
+    c.startSize = params.getFloat("startSize", c.startSize);
+    c.endSize = params.getFloat("endSize", c.endSize);
+    c.startColor = glm::vec4(startColor.x, startColor.y, startColor.z, startColor.w);
+    c.endColor = glm::vec4(endColor.x, endColor.y, endColor.z, endColor.w);
+    c.velocity = params.getFloat("velocity", c.velocity);
+    c.gravity = glm::vec3(gravity.x, gravity.y, gravity.z);
+    setParams(c);
+}
+
 void ParticleEmitter::setParticleColor(const vec4& color) {
     m_config.startColor = color;
 }
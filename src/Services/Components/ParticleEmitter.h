@@ -45,6 +45,11 @@ public:
     const Config& getParams() const { return m_config; }
     void setParams(const Config& params) { m_config = params; }
     
+    // Snapshots: the emitter config; live particles are not kept
+    const char* getSnapshotType() const override { return "ParticleEmitter"; }
+    void writeSnapshot(SnapshotParams& params) const override;
+    void readSnapshot(const SnapshotParamReader& params) override;
+    
 private:
     Config m_config;
 };
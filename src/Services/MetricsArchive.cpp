@@ -0,0 +1,732 @@
+// src/Services/MetricsArchive.cpp
+// Persistent service metrics archive implementation
+// Segment layout: file header, then length-prefixed series and block records
+
+#include "Services/MetricsArchive.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace FinalStorm {
+
+namespace {
+
+constexpr char kSegmentMagic[4] = { 'F', 'S', 'M', 'A' };
+constexpr uint16_t kSegmentVersion = 1;
+constexpr const char* kSegmentExtension = ".fsm";
+
+constexpr uint32_t kRecordSeries = 1;
+constexpr uint32_t kRecordBlock = 2;
+
+struct SegmentHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t reserved;
+    uint64_t createdTime;
+};
+
+struct RecordHeader {
+    uint32_t type;
+    uint32_t length;
+};
+
+struct BlockSummary {
+    uint32_t seriesId;
+    uint32_t count;
+    int64_t firstTimestamp;
+    int64_t lastTimestamp;
+    float minValue;
+    float maxValue;
+    double sum;
+};
+
+std::string makeSeriesKey(const std::string& serviceId, const std::string& field) {
+    std::string key;
+    key.reserve(serviceId.size() + field.size() + 1);
+    key += serviceId;
+    key += '\0';
+    key += field;
+    return key;
+}
+
+std::string segmentFileName(uint32_t index) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "segment-%06u%s", index, kSegmentExtension);
+    return name;
+}
+
+template<typename T>
+void appendPod(std::vector<uint8_t>& buffer, const T& value) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+void appendString(std::vector<uint8_t>& buffer, const std::string& value) {
+    uint16_t length = static_cast<uint16_t>(std::min<size_t>(value.size(), 0xFFFF));
+    appendPod(buffer, length);
+    buffer.insert(buffer.end(), value.begin(), value.begin() + length);
+}
+
+bool readString(const uint8_t*& cursor, const uint8_t* end, std::string& out) {
+    uint16_t length = 0;
+    if (end - cursor < static_cast<ptrdiff_t>(sizeof(length))) return false;
+    std::memcpy(&length, cursor, sizeof(length));
+    cursor += sizeof(length);
+    if (end - cursor < length) return false;
+    out.assign(reinterpret_cast<const char*>(cursor), length);
+    cursor += length;
+    return true;
+}
+
+uint32_t floatBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float bitsFloat(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+} // namespace
+
+// ============================================================================
+// GorillaBlockEncoder
+// ============================================================================
+
+GorillaBlockEncoder::GorillaBlockEncoder() {
+    reset();
+}
+
+void GorillaBlockEncoder::reset() {
+    m_bytes.clear();
+    m_bitPos = 0;
+    m_count = 0;
+    m_firstTimestamp = 0;
+    m_prevTimestamp = 0;
+    m_prevDelta = 0;
+    m_prevBits = 0;
+    m_prevLeading = -1;
+    m_prevTrailing = 0;
+    m_min = 0.0f;
+    m_max = 0.0f;
+    m_sum = 0.0;
+}
+
+void GorillaBlockEncoder::writeBits(uint64_t value, int count) {
+    while (count > 0) {
+        if (m_bitPos == 0) {
+            m_bytes.push_back(0);
+        }
+        int space = 8 - m_bitPos;
+        int take = std::min(space, count);
+        uint8_t chunk = static_cast<uint8_t>((value >> (count - take)) & ((1u << take) - 1));
+        m_bytes.back() |= static_cast<uint8_t>(chunk << (space - take));
+        m_bitPos = (m_bitPos + take) & 7;
+        count -= take;
+    }
+}
+
+void GorillaBlockEncoder::append(int64_t timestamp, float value) {
+    uint32_t bits = floatBits(value);
+
+    if (m_count == 0) {
+        writeBits(static_cast<uint64_t>(timestamp), 64);
+        writeBits(bits, 32);
+        m_firstTimestamp = timestamp;
+        m_prevTimestamp = timestamp;
+        m_prevBits = bits;
+        m_min = value;
+        m_max = value;
+        m_sum = value;
+        m_count = 1;
+        return;
+    }
+
+    // Timestamp: delta-of-delta with variable-width buckets
+    int64_t delta = timestamp - m_prevTimestamp;
+    int64_t dod = delta - m_prevDelta;
+    if (dod == 0) {
+        writeBits(0b0, 1);
+    } else if (dod >= -63 && dod <= 64) {
+        writeBits(0b10, 2);
+        writeBits(static_cast<uint64_t>(dod + 63), 7);
+    } else if (dod >= -255 && dod <= 256) {
+        writeBits(0b110, 3);
+        writeBits(static_cast<uint64_t>(dod + 255), 9);
+    } else if (dod >= -2047 && dod <= 2048) {
+        writeBits(0b1110, 4);
+        writeBits(static_cast<uint64_t>(dod + 2047), 12);
+    } else {
+        writeBits(0b1111, 4);
+        writeBits(static_cast<uint64_t>(dod), 64);
+    }
+    m_prevDelta = delta;
+    m_prevTimestamp = timestamp;
+
+    // Value: XOR with previous, reuse the previous meaningful-bit window when it fits
+    uint32_t xorBits = bits ^ m_prevBits;
+    if (xorBits == 0) {
+        writeBits(0b0, 1);
+    } else {
+        int leading = std::min(__builtin_clz(xorBits), 31);
+        int trailing = __builtin_ctz(xorBits);
+
+        if (m_prevLeading >= 0 && leading >= m_prevLeading && trailing >= m_prevTrailing) {
+            int significant = 32 - m_prevLeading - m_prevTrailing;
+            writeBits(0b10, 2);
+            writeBits(xorBits >> m_prevTrailing, significant);
+        } else {
+            int significant = 32 - leading - trailing;
+            writeBits(0b11, 2);
+            writeBits(static_cast<uint64_t>(leading), 5);
+            writeBits(static_cast<uint64_t>(significant - 1), 5);
+            writeBits(xorBits >> trailing, significant);
+            m_prevLeading = leading;
+            m_prevTrailing = trailing;
+        }
+    }
+    m_prevBits = bits;
+
+    m_min = std::min(m_min, value);
+    m_max = std::max(m_max, value);
+    m_sum += value;
+    m_count++;
+}
+
+// ============================================================================
+// GorillaBlockDecoder
+// ============================================================================
+
+GorillaBlockDecoder::GorillaBlockDecoder(const uint8_t* data, size_t size, uint32_t count)
+    : m_data(data)
+    , m_sizeBits(size * 8)
+    , m_bitPos(0)
+    , m_remaining(count)
+    , m_index(0)
+    , m_prevTimestamp(0)
+    , m_prevDelta(0)
+    , m_prevBits(0)
+    , m_prevLeading(0)
+    , m_prevTrailing(0) {
+}
+
+bool GorillaBlockDecoder::readBits(int count, uint64_t& out) {
+    if (m_bitPos + count > m_sizeBits) return false;
+
+    out = 0;
+    while (count > 0) {
+        size_t byteIndex = m_bitPos >> 3;
+        int offset = static_cast<int>(m_bitPos & 7);
+        int available = 8 - offset;
+        int take = std::min(available, count);
+        uint8_t chunk = static_cast<uint8_t>(m_data[byteIndex] >> (available - take)) & ((1u << take) - 1);
+        out = (out << take) | chunk;
+        m_bitPos += take;
+        count -= take;
+    }
+    return true;
+}
+
+bool GorillaBlockDecoder::next(int64_t& timestamp, float& value) {
+    if (m_remaining == 0) return false;
+
+    uint64_t bits = 0;
+    if (m_index == 0) {
+        uint64_t raw = 0;
+        if (!readBits(64, raw) || !readBits(32, bits)) return false;
+        m_prevTimestamp = static_cast<int64_t>(raw);
+        m_prevBits = static_cast<uint32_t>(bits);
+    } else {
+        // Timestamp
+        uint64_t flag = 0;
+        int64_t dod = 0;
+        if (!readBits(1, flag)) return false;
+        if (flag != 0) {
+            int prefix = 1;
+            while (prefix < 4) {
+                if (!readBits(1, flag)) return false;
+                if (flag == 0) break;
+                ++prefix;
+            }
+            uint64_t raw = 0;
+            switch (prefix) {
+                case 1: if (!readBits(7, raw)) return false; dod = static_cast<int64_t>(raw) - 63; break;
+                case 2: if (!readBits(9, raw)) return false; dod = static_cast<int64_t>(raw) - 255; break;
+                case 3: if (!readBits(12, raw)) return false; dod = static_cast<int64_t>(raw) - 2047; break;
+                default: if (!readBits(64, raw)) return false; dod = static_cast<int64_t>(raw); break;
+            }
+        }
+        m_prevDelta += dod;
+        m_prevTimestamp += m_prevDelta;
+
+        // Value
+        if (!readBits(1, flag)) return false;
+        if (flag != 0) {
+            if (!readBits(1, flag)) return false;
+            if (flag != 0) {
+                uint64_t leading = 0;
+                uint64_t significant = 0;
+                if (!readBits(5, leading) || !readBits(5, significant)) return false;
+                m_prevLeading = static_cast<int>(leading);
+                m_prevTrailing = 32 - m_prevLeading - static_cast<int>(significant + 1);
+                if (m_prevTrailing < 0) return false;
+            }
+            int width = 32 - m_prevLeading - m_prevTrailing;
+            if (!readBits(width, bits)) return false;
+            m_prevBits ^= static_cast<uint32_t>(bits << m_prevTrailing);
+        }
+    }
+
+    timestamp = m_prevTimestamp;
+    value = bitsFloat(m_prevBits);
+    ++m_index;
+    --m_remaining;
+    return true;
+}
+
+// ============================================================================
+// MetricsArchiveWriter
+// ============================================================================
+
+MetricsArchiveWriter::MetricsArchiveWriter()
+    : m_segmentIndex(0)
+    , m_segmentBytesWritten(0)
+    , m_nextSeriesId(1) {
+}
+
+MetricsArchiveWriter::~MetricsArchiveWriter() {
+    close();
+}
+
+bool MetricsArchiveWriter::open(const MetricsArchiveConfig& config) {
+    close();
+    m_config = config;
+    if (m_config.samplesPerBlock == 0) m_config.samplesPerBlock = 1;
+
+    std::error_code ec;
+    std::filesystem::create_directories(m_config.directory, ec);
+    if (ec) {
+        std::cerr << "MetricsArchive: cannot create " << m_config.directory << ": " << ec.message() << std::endl;
+        return false;
+    }
+
+    // Continue numbering after any existing segments; they are never reopened for writing
+    m_segmentIndex = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(m_config.directory, ec)) {
+        const std::string name = entry.path().filename().string();
+        unsigned index = 0;
+        if (std::sscanf(name.c_str(), "segment-%06u", &index) == 1) {
+            m_segmentIndex = std::max<uint32_t>(m_segmentIndex, index);
+        }
+    }
+
+    return openNextSegment();
+}
+
+void MetricsArchiveWriter::close() {
+    if (!m_stream.is_open()) return;
+    flush();
+    m_stream.close();
+    m_series.clear();
+}
+
+void MetricsArchiveWriter::append(const std::string& serviceId, const std::string& field, int64_t timestamp, float value) {
+    if (!m_stream.is_open()) return;
+
+    std::string key = makeSeriesKey(serviceId, field);
+    auto it = m_series.find(key);
+    if (it == m_series.end()) {
+        SeriesState state;
+        state.serviceId = serviceId;
+        state.field = field;
+        it = m_series.emplace(std::move(key), std::move(state)).first;
+    }
+
+    SeriesState& series = it->second;
+    series.encoder.append(timestamp, value);
+    if (series.encoder.getCount() >= m_config.samplesPerBlock) {
+        writeBlock(series);
+    }
+}
+
+void MetricsArchiveWriter::flush() {
+    if (!m_stream.is_open()) return;
+    for (auto& pair : m_series) {
+        if (pair.second.encoder.getCount() > 0) {
+            writeBlock(pair.second);
+        }
+    }
+    m_stream.flush();
+}
+
+bool MetricsArchiveWriter::openNextSegment() {
+    if (m_stream.is_open()) {
+        m_stream.close();
+    }
+
+    ++m_segmentIndex;
+    std::filesystem::path path = std::filesystem::path(m_config.directory) / segmentFileName(m_segmentIndex);
+    m_stream.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!m_stream.is_open()) {
+        std::cerr << "MetricsArchive: cannot open segment " << path << std::endl;
+        return false;
+    }
+
+    SegmentHeader header{};
+    std::memcpy(header.magic, kSegmentMagic, sizeof(header.magic));
+    header.version = kSegmentVersion;
+    header.createdTime = static_cast<uint64_t>(std::time(nullptr));
+    m_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_segmentBytesWritten = sizeof(header);
+
+    // Series ids are scoped to a segment so each file is self-describing
+    for (auto& pair : m_series) {
+        pair.second.segmentSeriesId = 0;
+    }
+    return true;
+}
+
+void MetricsArchiveWriter::writeSeriesDefinition(SeriesState& series) {
+    series.segmentSeriesId = m_nextSeriesId++;
+
+    std::vector<uint8_t> payload;
+    appendPod(payload, series.segmentSeriesId);
+    appendString(payload, series.serviceId);
+    appendString(payload, series.field);
+    writeRecord(kRecordSeries, payload);
+}
+
+void MetricsArchiveWriter::writeBlock(SeriesState& series) {
+    if (series.segmentSeriesId == 0) {
+        writeSeriesDefinition(series);
+    }
+
+    const GorillaBlockEncoder& encoder = series.encoder;
+    BlockSummary summary{};
+    summary.seriesId = series.segmentSeriesId;
+    summary.count = encoder.getCount();
+    summary.firstTimestamp = encoder.getFirstTimestamp();
+    summary.lastTimestamp = encoder.getLastTimestamp();
+    summary.minValue = encoder.getMin();
+    summary.maxValue = encoder.getMax();
+    summary.sum = encoder.getSum();
+
+    std::vector<uint8_t> payload;
+    payload.reserve(sizeof(summary) + encoder.getBytes().size());
+    appendPod(payload, summary);
+    payload.insert(payload.end(), encoder.getBytes().begin(), encoder.getBytes().end());
+    writeRecord(kRecordBlock, payload);
+
+    series.encoder.reset();
+
+    if (m_segmentBytesWritten >= m_config.segmentBytes) {
+        openNextSegment();
+    }
+}
+
+void MetricsArchiveWriter::writeRecord(uint32_t type, const std::vector<uint8_t>& payload) {
+    RecordHeader header{ type, static_cast<uint32_t>(payload.size()) };
+    m_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_stream.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+    m_segmentBytesWritten += sizeof(header) + payload.size();
+}
+
+// ============================================================================
+// MetricsArchiveReader
+// ============================================================================
+
+struct MetricsArchiveReader::MappedSegment {
+    std::string path;
+    int fd = -1;
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+
+    // Indexing resumes here when the segment grows; series records seen so
+    // far stay resolvable for the blocks after them
+    size_t indexedBytes = sizeof(SegmentHeader);
+    std::unordered_map<uint32_t, std::string> seriesKeys;
+
+    // The old mapping is kept if the new one fails
+    bool map(size_t length) {
+        void* mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) return false;
+        if (data) munmap(const_cast<uint8_t*>(data), size);
+        data = static_cast<const uint8_t*>(mapped);
+        size = length;
+        return true;
+    }
+
+    ~MappedSegment() {
+        if (data) munmap(const_cast<uint8_t*>(data), size);
+        if (fd >= 0) ::close(fd);
+    }
+};
+
+MetricsArchiveReader::MetricsArchiveReader() = default;
+
+MetricsArchiveReader::~MetricsArchiveReader() {
+    close();
+}
+
+bool MetricsArchiveReader::open(const std::string& directory) {
+    close();
+    m_directory = directory;
+    return refresh();
+}
+
+void MetricsArchiveReader::close() {
+    m_index.clear();
+    m_unsorted.clear();
+    m_segments.clear();
+    m_lastSegmentPath.clear();
+}
+
+bool MetricsArchiveReader::refresh() {
+    // Segments already mapped: only the tail past the last indexed record is new
+    for (auto& segment : m_segments) {
+        struct stat st;
+        if (fstat(segment->fd, &st) != 0 || static_cast<size_t>(st.st_size) <= segment->size) continue;
+        if (segment->map(static_cast<size_t>(st.st_size))) {
+            indexSegment(*segment);
+        }
+    }
+
+    std::error_code ec;
+    std::vector<std::string> paths;
+    for (const auto& entry : std::filesystem::directory_iterator(m_directory, ec)) {
+        if (entry.path().extension() == kSegmentExtension && entry.path().string() > m_lastSegmentPath) {
+            paths.push_back(entry.path().string());
+        }
+    }
+    if (ec) return false;
+
+    // Zero-padded names sort chronologically
+    std::sort(paths.begin(), paths.end());
+    for (const auto& path : paths) {
+        mapSegment(path);
+    }
+
+    // Blocks of a series normally arrive in time order; sort the rare one that did not
+    for (std::vector<BlockRef>* blocks : m_unsorted) {
+        std::stable_sort(blocks->begin(), blocks->end(),
+            [](const BlockRef& a, const BlockRef& b) {
+                return a.firstTimestamp < b.firstTimestamp;
+            });
+    }
+    m_unsorted.clear();
+    return true;
+}
+
+bool MetricsArchiveReader::mapSegment(const std::string& path) {
+    auto segment = std::make_unique<MappedSegment>();
+    segment->path = path;
+    segment->fd = ::open(path.c_str(), O_RDONLY);
+    if (segment->fd < 0) return false;
+
+    // A segment the writer has only just created is retried on the next refresh
+    struct stat st;
+    if (fstat(segment->fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(SegmentHeader))) {
+        return false;
+    }
+    if (!segment->map(static_cast<size_t>(st.st_size))) return false;
+    m_lastSegmentPath = path;
+
+    SegmentHeader header;
+    std::memcpy(&header, segment->data, sizeof(header));
+    if (std::memcmp(header.magic, kSegmentMagic, sizeof(header.magic)) != 0 || header.version != kSegmentVersion) {
+        std::cerr << "MetricsArchive: skipping unrecognised segment " << path << std::endl;
+        return false;
+    }
+
+    indexSegment(*segment);
+    m_segments.push_back(std::move(segment));
+    return true;
+}
+
+void MetricsArchiveReader::indexSegment(MappedSegment& segment) {
+    const uint8_t* cursor = segment.data + segment.indexedBytes;
+    const uint8_t* end = segment.data + segment.size;
+
+    // Only record headers and block summaries are touched; payloads stay cold
+    while (end - cursor >= static_cast<ptrdiff_t>(sizeof(RecordHeader))) {
+        RecordHeader header;
+        std::memcpy(&header, cursor, sizeof(header));
+        if (static_cast<size_t>(end - cursor) - sizeof(header) < header.length) break; // Torn tail write
+
+        const uint8_t* payload = cursor + sizeof(header);
+        const uint8_t* payloadEnd = payload + header.length;
+        cursor = payloadEnd;
+        segment.indexedBytes = static_cast<size_t>(cursor - segment.data);
+
+        if (header.type == kRecordSeries) {
+            uint32_t seriesId = 0;
+            std::string serviceId;
+            std::string field;
+            if (header.length < sizeof(seriesId)) continue;
+            std::memcpy(&seriesId, payload, sizeof(seriesId));
+            payload += sizeof(seriesId);
+            if (readString(payload, payloadEnd, serviceId) && readString(payload, payloadEnd, field)) {
+                segment.seriesKeys[seriesId] = makeSeriesKey(serviceId, field);
+            }
+        } else if (header.type == kRecordBlock) {
+            if (header.length < sizeof(BlockSummary)) continue;
+            BlockSummary summary;
+            std::memcpy(&summary, payload, sizeof(summary));
+
+            auto keyIt = segment.seriesKeys.find(summary.seriesId);
+            if (keyIt == segment.seriesKeys.end()) continue;
+
+            BlockRef block;
+            block.segment = &segment;
+            block.offset = static_cast<size_t>(payload - segment.data) + sizeof(summary);
+            block.size = header.length - sizeof(summary);
+            block.count = summary.count;
+            block.firstTimestamp = summary.firstTimestamp;
+            block.lastTimestamp = summary.lastTimestamp;
+            block.minValue = summary.minValue;
+            block.maxValue = summary.maxValue;
+            block.sum = summary.sum;
+
+            std::vector<BlockRef>& blocks = m_index[keyIt->second];
+            if (!blocks.empty() && block.firstTimestamp < blocks.back().firstTimestamp &&
+                std::find(m_unsorted.begin(), m_unsorted.end(), &blocks) == m_unsorted.end()) {
+                m_unsorted.push_back(&blocks);
+            }
+            blocks.push_back(block);
+        }
+    }
+}
+
+const std::vector<MetricsArchiveReader::BlockRef>* MetricsArchiveReader::findBlocks(const std::string& serviceId, const std::string& field) const {
+    auto it = m_index.find(makeSeriesKey(serviceId, field));
+    return (it != m_index.end()) ? &it->second : nullptr;
+}
+
+bool MetricsArchiveReader::hasSeries(const std::string& serviceId, const std::string& field) const {
+    return findBlocks(serviceId, field) != nullptr;
+}
+
+std::vector<std::string> MetricsArchiveReader::getServiceIds() const {
+    std::vector<std::string> ids;
+    for (const auto& pair : m_index) {
+        ids.push_back(pair.first.substr(0, pair.first.find('\0')));
+    }
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    return ids;
+}
+
+template<typename Visitor>
+void MetricsArchiveReader::forEachSample(const std::vector<BlockRef>& blocks, int64_t startTime, int64_t endTime, Visitor&& visitor) const {
+    for (const BlockRef& block : blocks) {
+        if (block.firstTimestamp > endTime) break;
+        if (block.lastTimestamp < startTime) continue;
+
+        GorillaBlockDecoder decoder(block.segment->data + block.offset, block.size, block.count);
+        int64_t timestamp = 0;
+        float value = 0.0f;
+        while (decoder.next(timestamp, value)) {
+            if (timestamp > endTime) break;
+            if (timestamp >= startTime) visitor(timestamp, value);
+        }
+    }
+}
+
+bool MetricsArchiveReader::query(const std::string& serviceId, const std::string& field,
+                                 int64_t startTime, int64_t endTime,
+                                 std::vector<MetricSample>& out) const {
+    out.clear();
+    const std::vector<BlockRef>* blocks = findBlocks(serviceId, field);
+    if (!blocks) return false;
+
+    forEachSample(*blocks, startTime, endTime, [&out](int64_t timestamp, float value) {
+        MetricSample sample;
+        sample.timestamp = timestamp / 1000.0;
+        sample.value = value;
+        out.push_back(sample);
+    });
+    return true;
+}
+
+MetricAggregate MetricsArchiveReader::aggregate(const std::string& serviceId, const std::string& field,
+                                                int64_t startTime, int64_t endTime) const {
+    MetricAggregate result;
+    result.minValue = std::numeric_limits<float>::max();
+    result.maxValue = std::numeric_limits<float>::lowest();
+
+    const std::vector<BlockRef>* blocks = findBlocks(serviceId, field);
+    if (blocks) {
+        for (const BlockRef& block : *blocks) {
+            if (block.firstTimestamp > endTime) break;
+            if (block.lastTimestamp < startTime) continue;
+
+            if (block.firstTimestamp >= startTime && block.lastTimestamp <= endTime) {
+                result.minValue = std::min(result.minValue, block.minValue);
+                result.maxValue = std::max(result.maxValue, block.maxValue);
+                result.sum += block.sum;
+                result.count += block.count;
+                continue;
+            }
+
+            // Partially covered block: decode just this one
+            std::vector<BlockRef> single(1, block);
+            forEachSample(single, startTime, endTime, [&result](int64_t, float value) {
+                result.minValue = std::min(result.minValue, value);
+                result.maxValue = std::max(result.maxValue, value);
+                result.sum += value;
+                result.count++;
+            });
+        }
+    }
+
+    if (result.count == 0) {
+        result.minValue = 0.0f;
+        result.maxValue = 0.0f;
+    }
+    return result;
+}
+
+void MetricsArchiveReader::downsample(const std::string& serviceId, const std::string& field,
+                                      int64_t startTime, int64_t endTime, size_t bucketCount,
+                                      std::vector<MetricRollupBucket>& out) const {
+    out.clear();
+    if (bucketCount == 0 || endTime < startTime) return;
+
+    double span = static_cast<double>(endTime - startTime + 1);
+    double width = span / bucketCount;
+
+    out.resize(bucketCount);
+    for (size_t i = 0; i < bucketCount; ++i) {
+        out[i].startTime = (startTime + width * i) / 1000.0;
+    }
+
+    const std::vector<BlockRef>* blocks = findBlocks(serviceId, field);
+    if (!blocks) return;
+
+    forEachSample(*blocks, startTime, endTime, [&](int64_t timestamp, float value) {
+        size_t index = std::min(bucketCount - 1, static_cast<size_t>((timestamp - startTime) / width));
+        MetricRollupBucket& bucket = out[index];
+        if (bucket.count == 0) {
+            bucket.minValue = value;
+            bucket.maxValue = value;
+        } else {
+            bucket.minValue = std::min(bucket.minValue, value);
+            bucket.maxValue = std::max(bucket.maxValue, value);
+        }
+        bucket.sum += value;
+        bucket.count++;
+    });
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,202 @@
+// src/Services/MetricsArchive.h
+// Persistent service metrics archive
+// Gorilla-compressed append-only segments with an mmap-based range reader
+
+#pragma once
+#include "Services/MetricsTimeSeries.h"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace FinalStorm {
+
+// ============================================================================
+// Gorilla block codec
+// Timestamps (milliseconds) are stored as delta-of-delta, values as XOR
+// against the previous value's bit pattern.
+// ============================================================================
+
+class GorillaBlockEncoder {
+public:
+    GorillaBlockEncoder();
+
+    void reset();
+    void append(int64_t timestamp, float value);
+
+    uint32_t getCount() const { return m_count; }
+    int64_t getFirstTimestamp() const { return m_firstTimestamp; }
+    int64_t getLastTimestamp() const { return m_prevTimestamp; }
+    float getMin() const { return m_min; }
+    float getMax() const { return m_max; }
+    double getSum() const { return m_sum; }
+
+    const std::vector<uint8_t>& getBytes() const { return m_bytes; }
+
+private:
+    void writeBits(uint64_t value, int count);
+
+    std::vector<uint8_t> m_bytes;
+    int m_bitPos;
+
+    uint32_t m_count;
+    int64_t m_firstTimestamp;
+    int64_t m_prevTimestamp;
+    int64_t m_prevDelta;
+    uint32_t m_prevBits;
+    int m_prevLeading;
+    int m_prevTrailing;
+
+    float m_min;
+    float m_max;
+    double m_sum;
+};
+
+class GorillaBlockDecoder {
+public:
+    GorillaBlockDecoder(const uint8_t* data, size_t size, uint32_t count);
+
+    // Returns false once all samples have been read or the block is corrupt
+    bool next(int64_t& timestamp, float& value);
+
+private:
+    bool readBits(int count, uint64_t& out);
+
+    const uint8_t* m_data;
+    size_t m_sizeBits;
+    size_t m_bitPos;
+
+    uint32_t m_remaining;
+    uint32_t m_index;
+    int64_t m_prevTimestamp;
+    int64_t m_prevDelta;
+    uint32_t m_prevBits;
+    int m_prevLeading;
+    int m_prevTrailing;
+};
+
+// ============================================================================
+// Archive writer
+// ============================================================================
+
+struct MetricsArchiveConfig {
+    std::string directory = "metrics";
+    uint32_t samplesPerBlock = 256;
+    size_t segmentBytes = 16 * 1024 * 1024;
+};
+
+class MetricsArchiveWriter {
+public:
+    MetricsArchiveWriter();
+    ~MetricsArchiveWriter();
+
+    bool open(const MetricsArchiveConfig& config);
+    void close();
+    bool isOpen() const { return m_stream.is_open(); }
+
+    // Timestamps are milliseconds; samples per series must be non-decreasing
+    void append(const std::string& serviceId, const std::string& field, int64_t timestamp, float value);
+
+    // Write all partially filled blocks so readers can see them
+    void flush();
+
+private:
+    struct SeriesState {
+        std::string serviceId;
+        std::string field;
+        uint32_t segmentSeriesId = 0;   // 0 until defined in the current segment
+        GorillaBlockEncoder encoder;
+    };
+
+    bool openNextSegment();
+    void writeSeriesDefinition(SeriesState& series);
+    void writeBlock(SeriesState& series);
+    void writeRecord(uint32_t type, const std::vector<uint8_t>& payload);
+
+    MetricsArchiveConfig m_config;
+    std::ofstream m_stream;
+    uint32_t m_segmentIndex;
+    size_t m_segmentBytesWritten;
+    uint32_t m_nextSeriesId;
+    std::unordered_map<std::string, SeriesState> m_series;
+};
+
+// ============================================================================
+// Archive reader
+// ============================================================================
+
+struct MetricAggregate {
+    float minValue = 0.0f;
+    float maxValue = 0.0f;
+    double sum = 0.0;
+    uint64_t count = 0;
+
+    float average() const { return count > 0 ? static_cast<float>(sum / count) : 0.0f; }
+};
+
+class MetricsArchiveReader {
+public:
+    MetricsArchiveReader();
+    ~MetricsArchiveReader();
+
+    bool open(const std::string& directory);
+    void close();
+
+    // Picks up data appended since open() or the last refresh. Segments
+    // already indexed are only re-scanned from where their index ended, so
+    // the cost follows the new data, not the archive size.
+    bool refresh();
+
+    bool hasSeries(const std::string& serviceId, const std::string& field) const;
+    std::vector<std::string> getServiceIds() const;
+
+    // Raw samples with timestamp in [startTime, endTime] (milliseconds).
+    // Returned MetricSample timestamps are in seconds.
+    bool query(const std::string& serviceId, const std::string& field,
+               int64_t startTime, int64_t endTime,
+               std::vector<MetricSample>& out) const;
+
+    // Blocks fully inside the range are answered from their summaries
+    // without decoding.
+    MetricAggregate aggregate(const std::string& serviceId, const std::string& field,
+                              int64_t startTime, int64_t endTime) const;
+
+    // Fixed number of min/max/avg buckets across the range, for charts
+    void downsample(const std::string& serviceId, const std::string& field,
+                    int64_t startTime, int64_t endTime, size_t bucketCount,
+                    std::vector<MetricRollupBucket>& out) const;
+
+private:
+    struct MappedSegment;
+
+    // Located by offset: a segment is re-mapped, at a new address, when it grows
+    struct BlockRef {
+        const MappedSegment* segment;
+        size_t offset;
+        size_t size;
+        uint32_t count;
+        int64_t firstTimestamp;
+        int64_t lastTimestamp;
+        float minValue;
+        float maxValue;
+        double sum;
+    };
+
+    bool mapSegment(const std::string& path);
+    void indexSegment(MappedSegment& segment);
+    const std::vector<BlockRef>* findBlocks(const std::string& serviceId, const std::string& field) const;
+
+    template<typename Visitor>
+    void forEachSample(const std::vector<BlockRef>& blocks, int64_t startTime, int64_t endTime, Visitor&& visitor) const;
+
+    std::string m_directory;
+    std::string m_lastSegmentPath;      // Newest segment mapped or rejected
+    std::vector<std::unique_ptr<MappedSegment>> m_segments;
+    std::unordered_map<std::string, std::vector<BlockRef>> m_index;
+    std::vector<std::vector<BlockRef>*> m_unsorted;    // Series whose new blocks arrived out of order
+};
+
+} // namespace FinalStorm
@@ -0,0 +1,126 @@
+// src/Services/MetricsJitterBuffer.cpp
+// Per-service metrics jitter buffer implementation
+
+#include "Services/MetricsJitterBuffer.h"
+#include <algorithm>
+#include <cmath>
+
+namespace FinalStorm {
+
+namespace {
+
+// Ring slots beyond the delay span: the sample playback is interpolating
+// from, one it may run ahead to, and room for arrival jitter
+constexpr size_t kSpareSamples = 4;
+
+} // namespace
+
+MetricsJitterBuffer::MetricsJitterBuffer()
+    : MetricsJitterBuffer(Config()) {
+}
+
+MetricsJitterBuffer::MetricsJitterBuffer(const Config& config)
+    : m_config(config) {
+}
+
+void MetricsJitterBuffer::push(uint32_t serviceIndex, double senderTime, const ServiceMetrics& metrics) {
+    m_stats.received++;
+
+    if (serviceIndex >= m_channels.size()) {
+        m_channels.resize(serviceIndex + 1);
+    }
+    Channel& channel = m_channels[serviceIndex];
+    size_t capacity = samplesPerService();
+    if (channel.samples.capacity() < capacity) {
+        RingBuffer<Sample> grown(capacity);
+        for (size_t i = 0; i < channel.samples.size(); ++i) {
+            grown.push(channel.samples[i]);
+        }
+        channel.samples = std::move(grown);
+    }
+
+    if (!channel.samples.empty()) {
+        Sample& newest = channel.samples.back();
+        if (senderTime < newest.time) {
+            m_stats.outOfOrder++;
+            return;
+        }
+        if (senderTime == newest.time) {
+            newest.metrics = metrics;
+            return;
+        }
+    }
+
+    // Still worth keeping when late: it is newer than anything buffered
+    if (senderTime < channel.playbackTime) {
+        m_stats.late++;
+    }
+
+    // Evict by time: playback only needs the newest sample at or before
+    // its position and everything after it
+    RingBuffer<Sample>& samples = channel.samples;
+    while (samples.size() >= 2 && samples[1].time <= channel.playbackTime) {
+        samples.popFront();
+    }
+
+    Sample sample;
+    sample.time = senderTime;
+    sample.metrics = metrics;
+    if (samples.push(sample) && channel.playbackTime >= 0.0) {
+        m_stats.overflows++;
+    }
+}
+
+size_t MetricsJitterBuffer::samplesPerService() const {
+    double span = std::max(0.0, m_config.playbackDelay) * std::max(0.0, m_config.maxUpdateRate);
+    return static_cast<size_t>(std::ceil(span)) + kSpareSamples;
+}
+
+bool MetricsJitterBuffer::sample(uint32_t serviceIndex, double serverNow, ServiceMetrics& out) {
+    if (serviceIndex >= m_channels.size() || m_channels[serviceIndex].samples.empty()) return false;
+
+    Channel& channel = m_channels[serviceIndex];
+    RingBuffer<Sample>& samples = channel.samples;
+    double playbackTime = serverNow - m_config.playbackDelay;
+    channel.playbackTime = playbackTime;
+
+    // Keep only the newest sample at or before the playback time
+    while (samples.size() >= 2 && samples[1].time <= playbackTime) {
+        samples.popFront();
+    }
+
+    const Sample& from = samples[0];
+    if (playbackTime <= from.time) {
+        out = from.metrics;
+        return true;
+    }
+    if (samples.size() == 1) {
+        // Nothing newer has arrived yet; hold rather than extrapolate
+        if (!channel.underrun) {
+            channel.underrun = true;
+            m_stats.underruns++;
+        }
+        out = from.metrics;
+        return true;
+    }
+
+    const Sample& to = samples[1];
+    float t = static_cast<float>((playbackTime - from.time) / (to.time - from.time));
+    out = ServiceMetrics::lerp(from.metrics, to.metrics, t);
+    channel.underrun = false;
+    return true;
+}
+
+bool MetricsJitterBuffer::latest(uint32_t serviceIndex, ServiceMetrics& out) const {
+    if (serviceIndex >= m_channels.size() || m_channels[serviceIndex].samples.empty()) return false;
+    out = m_channels[serviceIndex].samples.back().metrics;
+    return true;
+}
+
+void MetricsJitterBuffer::remove(uint32_t serviceIndex) {
+    if (serviceIndex < m_channels.size()) {
+        m_channels[serviceIndex] = Channel();
+    }
+}
+
+} // namespace FinalStorm
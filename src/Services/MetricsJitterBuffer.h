@@ -0,0 +1,78 @@
+// src/Services/MetricsJitterBuffer.h
+// Per-service jitter buffer for network metrics
+// Plays samples a fixed delay behind the sender clock and interpolates between them
+
+#pragma once
+#include "Core/RingBuffer.h"
+#include "Services/ServiceMetrics.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FinalStorm {
+
+// Services are identified by their ServiceDirectory record index, so the
+// per-message path does no string hashing or allocation
+class MetricsJitterBuffer {
+public:
+    struct Config {
+        // How far playback trails the sender clock, in seconds. It should
+        // cover one update interval plus the network jitter; at a 1 Hz
+        // update rate, 1.25 s plays smoothly.
+        double playbackDelay = 0.3;
+        // Highest update rate per service, in Hz. Each service's ring holds
+        // playbackDelay worth of samples at this rate.
+        double maxUpdateRate = 60.0;
+    };
+
+    struct Stats {
+        uint64_t received = 0;
+        uint64_t late = 0;          // Arrived after playback had passed them
+        uint64_t outOfOrder = 0;    // Older than a sample already buffered
+        uint64_t underruns = 0;     // Playback ran past the newest sample and held it
+        uint64_t overflows = 0;     // Ring full of unplayed samples; the oldest was dropped
+    };
+
+    MetricsJitterBuffer();
+    explicit MetricsJitterBuffer(const Config& config);
+
+    // senderTime is the sender's clock in seconds
+    void push(uint32_t serviceIndex, double senderTime, const ServiceMetrics& metrics);
+
+    // Metrics for serverNow - playbackDelay, interpolated between the two
+    // samples around that time. Holds the newest sample when playback runs
+    // ahead, and the oldest before playback reaches it. False if the service
+    // has no samples.
+    bool sample(uint32_t serviceIndex, double serverNow, ServiceMetrics& out);
+
+    // The newest sample without delay, for when no clock estimate exists yet
+    bool latest(uint32_t serviceIndex, ServiceMetrics& out) const;
+
+    void remove(uint32_t serviceIndex);
+    void clear() { m_channels.clear(); }
+
+    // Rings grow to the new span as their services next push
+    void setPlaybackDelay(double seconds) { m_config.playbackDelay = seconds; }
+    double getPlaybackDelay() const { return m_config.playbackDelay; }
+    const Stats& getStats() const { return m_stats; }
+
+private:
+    struct Sample {
+        double time = 0.0;
+        ServiceMetrics metrics;
+    };
+
+    struct Channel {
+        RingBuffer<Sample> samples;
+        double playbackTime = -1.0;     // Last time sampled
+        bool underrun = false;
+    };
+
+    size_t samplesPerService() const;
+
+    Config m_config;
+    Stats m_stats;
+    std::vector<Channel> m_channels;    // By service index; a ring with no capacity is unused
+};
+
+} // namespace FinalStorm
@@ -0,0 +1,199 @@
+// src/Services/MetricsTimeSeries.cpp
+// Metrics time series implementation
+// Incremental statistics and rollup maintenance
+
+#include "Services/MetricsTimeSeries.h"
+#include <algorithm>
+#include <cmath>
+
+namespace FinalStorm {
+
+// RunningStats implementation
+RunningStats::RunningStats() {
+    clear();
+}
+
+void RunningStats::add(double t, double x) {
+    if (!m_hasOrigin) {
+        m_t0 = t;
+        m_x0 = x;
+        m_hasOrigin = true;
+    }
+
+    double dt = t - m_t0;
+    double dx = x - m_x0;
+
+    ++m_count;
+    m_sumT += dt;
+    m_sumX += dx;
+    m_sumTT += dt * dt;
+    m_sumXX += dx * dx;
+    m_sumTX += dt * dx;
+}
+
+void RunningStats::remove(double t, double x) {
+    if (m_count == 0) return;
+
+    if (m_count == 1) {
+        clear();
+        return;
+    }
+
+    double dt = t - m_t0;
+    double dx = x - m_x0;
+
+    --m_count;
+    m_sumT -= dt;
+    m_sumX -= dx;
+    m_sumTT -= dt * dt;
+    m_sumXX -= dx * dx;
+    m_sumTX -= dt * dx;
+}
+
+void RunningStats::clear() {
+    m_count = 0;
+    m_hasOrigin = false;
+    m_t0 = 0.0;
+    m_x0 = 0.0;
+    m_sumT = 0.0;
+    m_sumX = 0.0;
+    m_sumTT = 0.0;
+    m_sumXX = 0.0;
+    m_sumTX = 0.0;
+}
+
+double RunningStats::mean() const {
+    if (m_count == 0) return 0.0;
+    return m_x0 + m_sumX / m_count;
+}
+
+double RunningStats::variance() const {
+    if (m_count < 2) return 0.0;
+    double n = static_cast<double>(m_count);
+    double var = (m_sumXX - (m_sumX * m_sumX) / n) / n;
+    return std::max(0.0, var);
+}
+
+double RunningStats::slope() const {
+    if (m_count < 2) return 0.0;
+    double n = static_cast<double>(m_count);
+    double denom = n * m_sumTT - m_sumT * m_sumT;
+    if (std::abs(denom) < 1e-12) return 0.0;
+    return (n * m_sumTX - m_sumT * m_sumX) / denom;
+}
+
+// MetricRollup implementation
+MetricRollup::MetricRollup(double resolution, size_t capacity)
+    : m_resolution(resolution > 0.0 ? resolution : 1.0)
+    , m_buckets(capacity) {
+}
+
+void MetricRollup::add(double timestamp, float value) {
+    double start = std::floor(timestamp / m_resolution) * m_resolution;
+
+    // Late samples fold into the bucket they belong to if it is still retained
+    for (size_t i = m_buckets.size(); i > 0; --i) {
+        MetricRollupBucket& bucket = m_buckets[i - 1];
+        if (bucket.startTime == start) {
+            bucket.minValue = std::min(bucket.minValue, value);
+            bucket.maxValue = std::max(bucket.maxValue, value);
+            bucket.sum += value;
+            bucket.count++;
+            return;
+        }
+        if (bucket.startTime < start) break;
+    }
+
+    if (!m_buckets.empty() && m_buckets.back().startTime > start) {
+        return; // Older than anything retained
+    }
+
+    MetricRollupBucket bucket;
+    bucket.startTime = start;
+    bucket.minValue = value;
+    bucket.maxValue = value;
+    bucket.sum = value;
+    bucket.count = 1;
+    m_buckets.push(bucket);
+}
+
+// MetricsTimeSeries implementation
+MetricsTimeSeries::MetricsTimeSeries()
+    : MetricsTimeSeries(Config{}) {
+}
+
+MetricsTimeSeries::MetricsTimeSeries(const Config& config)
+    : m_samples(config.rawCapacity)
+    , m_evictionsSinceRebuild(0) {
+    m_rollups.reserve(config.rollups.size());
+    for (const auto& level : config.rollups) {
+        m_rollups.emplace_back(level.resolution, level.capacity);
+    }
+}
+
+void MetricsTimeSeries::push(double timestamp, float value) {
+    MetricSample sample;
+    sample.timestamp = timestamp;
+    sample.value = value;
+
+    MetricSample evicted;
+    if (m_samples.push(sample, &evicted)) {
+        m_stats.remove(evicted.timestamp, evicted.value);
+        ++m_evictionsSinceRebuild;
+    }
+    m_stats.add(timestamp, value);
+
+    // Once the window has turned over, the origin is a sample long gone and
+    // the sums grow with elapsed time; one rebuild per window keeps push O(1)
+    // amortized
+    if (m_evictionsSinceRebuild >= m_samples.capacity()) {
+        rebuildStats();
+    }
+
+    for (auto& rollup : m_rollups) {
+        rollup.add(timestamp, value);
+    }
+}
+
+void MetricsTimeSeries::clear() {
+    m_samples.clear();
+    m_stats.clear();
+    m_evictionsSinceRebuild = 0;
+    for (auto& rollup : m_rollups) {
+        rollup.clear();
+    }
+}
+
+void MetricsTimeSeries::rebuildStats() {
+    m_stats.clear();
+    for (size_t i = 0; i < m_samples.size(); ++i) {
+        m_stats.add(m_samples[i].timestamp, m_samples[i].value);
+    }
+    m_evictionsSinceRebuild = 0;
+}
+
+float MetricsTimeSeries::standardDeviation() const {
+    return std::sqrt(variance());
+}
+
+void MetricsTimeSeries::copyRecent(size_t count, std::vector<float>& out) const {
+    size_t n = std::min(count, m_samples.size());
+    size_t first = m_samples.size() - n;
+
+    out.clear();
+    out.reserve(n);
+    for (size_t i = first; i < m_samples.size(); ++i) {
+        out.push_back(m_samples[i].value);
+    }
+}
+
+const MetricRollup* MetricsTimeSeries::findRollup(double resolution) const {
+    for (const auto& rollup : m_rollups) {
+        if (rollup.getResolution() == resolution) {
+            return &rollup;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace FinalStorm
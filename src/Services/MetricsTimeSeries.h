@@ -0,0 +1,124 @@
+// src/Services/MetricsTimeSeries.h
+// Fixed-capacity time series for service metric history
+// Keeps raw samples, multi-resolution rollups and O(1) running statistics
+
+#pragma once
+#include "Core/RingBuffer.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FinalStorm {
+
+struct MetricSample {
+    double timestamp = 0.0;   // seconds
+    float value = 0.0f;
+};
+
+// Sliding-window sums for mean, variance and least-squares slope.
+// Samples are shifted by the first sample seen so the sums stay well
+// conditioned; add/remove are O(1). The origin drifts away from a sliding
+// window over time, so owners rebuild the sums now and then (see
+// MetricsTimeSeries::push).
+class RunningStats {
+public:
+    RunningStats();
+
+    void add(double t, double x);
+    void remove(double t, double x);
+    void clear();
+
+    size_t count() const { return m_count; }
+    double mean() const;
+    double variance() const;      // population variance
+    double slope() const;         // value units per second
+
+private:
+    size_t m_count;
+    bool m_hasOrigin;
+    double m_t0;
+    double m_x0;
+    double m_sumT;
+    double m_sumX;
+    double m_sumTT;
+    double m_sumXX;
+    double m_sumTX;
+};
+
+struct MetricRollupBucket {
+    double startTime = 0.0;
+    float minValue = 0.0f;
+    float maxValue = 0.0f;
+    double sum = 0.0;
+    uint32_t count = 0;
+
+    float average() const { return count > 0 ? static_cast<float>(sum / count) : 0.0f; }
+};
+
+// Downsampled min/max/avg buckets at a fixed resolution
+class MetricRollup {
+public:
+    MetricRollup(double resolution, size_t capacity);
+
+    void add(double timestamp, float value);
+    void clear() { m_buckets.clear(); }
+
+    double getResolution() const { return m_resolution; }
+    const RingBuffer<MetricRollupBucket>& getBuckets() const { return m_buckets; }
+
+private:
+    double m_resolution;
+    RingBuffer<MetricRollupBucket> m_buckets;
+};
+
+class MetricsTimeSeries {
+public:
+    struct RollupLevel {
+        double resolution;    // seconds per bucket
+        size_t capacity;      // number of buckets retained
+    };
+
+    struct Config {
+        size_t rawCapacity = 1000;
+        std::vector<RollupLevel> rollups = { {1.0, 600}, {10.0, 360}, {60.0, 1440} };
+    };
+
+    MetricsTimeSeries();
+    explicit MetricsTimeSeries(const Config& config);
+
+    void push(double timestamp, float value);
+    void clear();
+
+    // Raw samples, index 0 is the oldest
+    size_t size() const { return m_samples.size(); }
+    size_t capacity() const { return m_samples.capacity(); }
+    bool empty() const { return m_samples.empty(); }
+    const MetricSample& sampleAt(size_t index) const { return m_samples[index]; }
+    const MetricSample& latest() const { return m_samples.back(); }
+
+    // Statistics over the retained raw window, all O(1)
+    float mean() const { return static_cast<float>(m_stats.mean()); }
+    float variance() const { return static_cast<float>(m_stats.variance()); }
+    float standardDeviation() const;
+    float trend() const { return static_cast<float>(m_stats.slope()); }
+
+    // Copy the newest count values (oldest first) into out
+    void copyRecent(size_t count, std::vector<float>& out) const;
+
+    // Rollups
+    size_t getRollupCount() const { return m_rollups.size(); }
+    const MetricRollup& getRollup(size_t level) const { return m_rollups[level]; }
+    const MetricRollup* findRollup(double resolution) const;
+
+private:
+    // Re-bases the running sums on the oldest retained sample, also dropping
+    // the rounding error add/remove pairs accumulate
+    void rebuildStats();
+
+    RingBuffer<MetricSample> m_samples;
+    std::vector<MetricRollup> m_rollups;
+    RunningStats m_stats;
+    size_t m_evictionsSinceRebuild;
+};
+
+} // namespace FinalStorm
@@ -12,10 +12,11 @@ ServiceMetrics ServiceMetrics::lerp(const ServiceMetrics& a, const ServiceMetric
     
     result.cpuUsage = a.cpuUsage + (b.cpuUsage - a.cpuUsage) * t;
     result.memoryUsage = a.memoryUsage + (b.memoryUsage - a.memoryUsage) * t;
-    result.requestsPerSecond = static_cast<uint32_t>(a.requestsPerSecond + (b.requestsPerSecond - a.requestsPerSecond) * t);
+    // Counts go through float so a falling value does not wrap
+    result.requestsPerSecond = static_cast<uint32_t>(a.requestsPerSecond + (static_cast<float>(b.requestsPerSecond) - a.requestsPerSecond) * t);
     result.averageLatency = a.averageLatency + (b.averageLatency - a.averageLatency) * t;
     result.errorRate = a.errorRate + (b.errorRate - a.errorRate) * t;
-    result.activeConnections = static_cast<uint32_t>(a.activeConnections + (b.activeConnections - a.activeConnections) * t);
+    result.activeConnections = static_cast<uint32_t>(a.activeConnections + (static_cast<float>(b.activeConnections) - a.activeConnections) * t);
     
     return result;
 }
@@ -3,6 +3,7 @@
 
 #include "Scene/SceneNode.h"
 #include "Core/Math/Math.h"
+#include "Core/Audio/SpectrumAnalyzer.h"
 #include <random>
 
 namespace FinalStorm {
@@ -860,6 +861,13 @@ public:
         }
     }
     
+    // The ground grid pulses with the low end of the mix and the data motes
+    // drift faster with the highs; without subscriptions both run on timers
+    void setAudioSpectrum(SpectrumSubscription lows, SpectrumSubscription highs) {
+        lowSpectrum = std::move(lows);
+        highSpectrum = std::move(highs);
+    }
+    
     void setNetworkActivity(float activity) {
         // Update particle effects based on network activity
         if (networkParticles) {
@@ -875,7 +883,8 @@ protected:
         
         // Pulse ground grid
         if (groundGrid) {
-            float pulse = 0.5f + 0.5f * sin(environmentTime * 0.5f) * systemHealth;
+            float wave = lowSpectrum ? lowSpectrum.getLevel() : sin(environmentTime * 0.5f);
+            float pulse = 0.5f + 0.5f * wave * systemHealth;
             // Update grid material emission
         }
         
@@ -947,17 +956,18 @@ private:
     
     void updateAmbientEffects(float deltaTime) {
         // Animate data motes
+        float drift = deltaTime * (1.0f + 2.0f * highSpectrum.getLevel());
         for (size_t i = 0; i < dataMotes.size(); ++i) {
             auto& mote = dataMotes[i];
             float3 pos = mote->getPosition();
             
             // Floating motion
             float phase = environmentTime + i * 0.3f;
-            pos.y += sin(phase) * deltaTime * 0.5f;
+            pos.y += sin(phase) * drift * 0.5f;
             
             // Drift
-            pos.x += sin(phase * 0.7f) * deltaTime * 0.3f;
-            pos.z += cos(phase * 0.8f) * deltaTime * 0.3f;
+            pos.x += sin(phase * 0.7f) * drift * 0.3f;
+            pos.z += cos(phase * 0.8f) * drift * 0.3f;
             
             // Wrap around
             if (pos.x > 50.0f) pos.x = -50.0f;
@@ -977,6 +987,8 @@ private:
     std::vector<std::shared_ptr<MeshNode>> dataMotes;
     float systemHealth = 1.0f;
     float environmentTime = 0.0f;
+    SpectrumSubscription lowSpectrum;
+    SpectrumSubscription highSpectrum;
 };
 
 // Mesh library IDs
@@ -18,6 +18,14 @@ HolographicDisplay::HolographicDisplay(float width, float height)
 
 HolographicDisplay::~HolographicDisplay() = default;
 
+void HolographicDisplay::setData(const std::vector<MetricRollupBucket>& buckets) {
+    data.clear();
+    data.reserve(buckets.size());
+    for (const auto& bucket : buckets) {
+        data.push_back(bucket.average());
+    }
+}
+
 void HolographicDisplay::onUpdate(float deltaTime) {
     UI3DPanel::onUpdate(deltaTime);
     animationTime += deltaTime;
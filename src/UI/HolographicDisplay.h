@@ -4,6 +4,7 @@
 
 #pragma once
 #include "UI/UI3DPanel.h"
+#include "Services/MetricsTimeSeries.h"
 
 namespace FinalStorm {
 
@@ -15,6 +16,9 @@ public:
     void setTitle(const std::string& title) { this->title = title; }
     void setData(const std::vector<float>& data) { this->data = data; }
     
+    // Chart bucket averages, e.g. from MetricsArchiveReader::downsample
+    void setData(const std::vector<MetricRollupBucket>& buckets);
+    
 protected:
     void onUpdate(float deltaTime) override;
     void onRender(RenderContext& context) override;
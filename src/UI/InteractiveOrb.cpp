@@ -4,6 +4,7 @@
 
 #include "UI/InteractiveOrb.h"
 #include "Rendering/RenderContext.h"
+#include "Scene/SceneSnapshot.h"
 #include "Core/Math/MathTypes.h"
 #include <cmath>
 
@@ -85,5 +86,29 @@ void InteractiveOrb::enableFloat(bool enable) {
     }
 }
 
+void InteractiveOrb::writeSnapshot(SnapshotParams& params) const {
+    params.set("radius", m_radius);
+    params.set("color", m_color);
+    params.set("glowIntensity", m_glowIntensity);
+    params.set("pulseRate", m_basePulseRate);
+    params.set("floatEnabled", m_floatEnabled);
+    params.set("floatSpeed", m_floatSpeed);
+    params.set("floatRange", m_floatRange);
+    params.set("interactable", m_interactable);
+    params.set("holographic", m_holographic);
+}
+
+void InteractiveOrb::readSnapshot(const SnapshotParamReader& params) {
+    setRadius(params.getFloat("radius", m_radius));
+    setColor(params.getVec3("color", m_color));
+    setGlowIntensity(params.getFloat("glowIntensity", m_glowIntensity));
+    setPulseRate(params.getFloat("pulseRate", m_basePulseRate));
+    setFloatSpeed(params.getFloat("floatSpeed", m_floatSpeed));
+    setFloatRange(params.getFloat("floatRange", m_floatRange));
+    setInteractable(params.getBool("interactable", m_interactable));
+    enableHolographicShader(params.getBool("holographic", m_holographic));
+    enableFloat(params.getBool("floatEnabled", m_floatEnabled)); // Rests at the restored position
+}
+
 } // namespace FinalStorm
 
@@ -36,6 +36,12 @@ public:
 
     void activate();
     
+    // Snapshots: look, pulse and float; the activate callback is code and is
+    // attached again by the owning scene
+    const char* getSnapshotType() const override { return "InteractiveOrb"; }
+    void writeSnapshot(SnapshotParams& params) const override;
+    void readSnapshot(const SnapshotParamReader& params) override;
+    
 protected:
     void onUpdate(float deltaTime) override;
     void onRender(RenderContext& context) override;
@@ -0,0 +1,196 @@
+// src/World/CellGenerator.cpp
+// Deterministic procedural cell generation implementation
+
+#include "World/CellGenerator.h"
+#include "Core/JobSystem.h"
+#include <array>
+#include <cmath>
+
+namespace FinalStorm {
+
+namespace {
+
+uint64_t mix64(uint64_t value) {
+    // splitmix64 finaliser
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+
+uint64_t hashCoordinates(uint64_t seed, int64_t x, int64_t z) {
+    return mix64(seed ^ mix64(static_cast<uint64_t>(x) ^ mix64(static_cast<uint64_t>(z))));
+}
+
+// Small per-cell generator; std engines are not guaranteed identical across standard libraries
+class CellRandom {
+public:
+    explicit CellRandom(uint64_t seed) : m_state(seed) {}
+
+    uint64_t next() {
+        m_state += 0x9e3779b97f4a7c15ULL;
+        return mix64(m_state);
+    }
+
+    float nextFloat() {
+        return static_cast<float>(next() >> 40) * (1.0f / 16777216.0f); // [0, 1)
+    }
+
+    float range(float low, float high) {
+        return low + (high - low) * nextFloat();
+    }
+
+private:
+    uint64_t m_state;
+};
+
+float smooth(float t) {
+    return t * t * (3.0f - 2.0f * t);
+}
+
+int floorMod(int value, int divisor) {
+    int result = value % divisor;
+    return result < 0 ? result + divisor : result;
+}
+
+// Terrain octaves: lattice spacing in world units and height amplitude
+struct Octave {
+    float spacing;
+    float amplitude;
+};
+
+constexpr Octave TerrainOctaves[] = {
+    { 512.0f, 24.0f },
+    { 128.0f, 6.0f },
+    { 32.0f, 1.5f },
+};
+
+// Lattice points one cell can touch at the finest octave, plus the far edge
+constexpr int MaxLatticeSide = static_cast<int>(CellGenerator::CellSize / 32.0f) + 2;
+
+} // namespace
+
+CellGenerator::CellGenerator(uint64_t worldSeed)
+    : m_worldSeed(worldSeed) {
+}
+
+uint64_t CellGenerator::getCellSeed(const GridCoordinate& coord) const {
+    return hashCoordinates(m_worldSeed, coord.x, coord.y);
+}
+
+float CellGenerator::latticeValue(int64_t x, int64_t z, uint64_t octave) const {
+    uint64_t hash = hashCoordinates(m_worldSeed + octave * 0x632be59bd9b4e019ULL, x, z);
+    return static_cast<float>(hash >> 40) * (2.0f / 16777216.0f) - 1.0f; // [-1, 1)
+}
+
+float CellGenerator::valueNoise(float x, float z, uint64_t octave) const {
+    float floorX = std::floor(x);
+    float floorZ = std::floor(z);
+    int64_t ix = static_cast<int64_t>(floorX);
+    int64_t iz = static_cast<int64_t>(floorZ);
+    float tx = smooth(x - floorX);
+    float tz = smooth(z - floorZ);
+
+    float v00 = latticeValue(ix, iz, octave);
+    float v10 = latticeValue(ix + 1, iz, octave);
+    float v01 = latticeValue(ix, iz + 1, octave);
+    float v11 = latticeValue(ix + 1, iz + 1, octave);
+
+    float top = v00 + (v10 - v00) * tx;
+    float bottom = v01 + (v11 - v01) * tx;
+    return top + (bottom - top) * tz;
+}
+
+float CellGenerator::getHeight(float worldX, float worldZ) const {
+    float height = 0.0f;
+    uint64_t octave = 0;
+    for (const Octave& o : TerrainOctaves) {
+        height += o.amplitude * valueNoise(worldX / o.spacing, worldZ / o.spacing, octave++);
+    }
+    return height;
+}
+
+void CellGenerator::generate(const GridCoordinate& coord, CellBuffer& out) const {
+    out.coord = coord;
+    out.seed = getCellSeed(coord);
+    out.spawnCount = 0;
+
+    const float originX = coord.x * CellSize;
+    const float originZ = coord.y * CellSize;
+    const float step = CellSize / (CellBuffer::HeightResolution - 1);
+
+    // Same arithmetic as getHeight(), but each lattice value is hashed once
+    // per cell instead of four times per sample
+    out.heights.fill(0.0f);
+    uint64_t octave = 0;
+    for (const Octave& o : TerrainOctaves) {
+        int64_t latticeX = static_cast<int64_t>(std::floor(originX / o.spacing));
+        int64_t latticeZ = static_cast<int64_t>(std::floor(originZ / o.spacing));
+
+        std::array<float, MaxLatticeSide * MaxLatticeSide> lattice;
+        for (int z = 0; z < MaxLatticeSide; ++z) {
+            for (int x = 0; x < MaxLatticeSide; ++x) {
+                lattice[z * MaxLatticeSide + x] = latticeValue(latticeX + x, latticeZ + z, octave);
+            }
+        }
+
+        for (int z = 0; z < CellBuffer::HeightResolution; ++z) {
+            float fz = (originZ + z * step) / o.spacing;
+            float floorZ = std::floor(fz);
+            int row = static_cast<int>(static_cast<int64_t>(floorZ) - latticeZ);
+            float tz = smooth(fz - floorZ);
+
+            for (int x = 0; x < CellBuffer::HeightResolution; ++x) {
+                float fx = (originX + x * step) / o.spacing;
+                float floorX = std::floor(fx);
+                int column = static_cast<int>(static_cast<int64_t>(floorX) - latticeX);
+                float tx = smooth(fx - floorX);
+
+                const float* v = &lattice[row * MaxLatticeSide + column];
+                float top = v[0] + (v[1] - v[0]) * tx;
+                float bottom = v[MaxLatticeSide] + (v[MaxLatticeSide + 1] - v[MaxLatticeSide]) * tx;
+                out.heights[z * CellBuffer::HeightResolution + x] += o.amplitude * (top + (bottom - top) * tz);
+            }
+        }
+        octave++;
+    }
+
+    CellRandom random(out.seed);
+
+    // A guard every 3rd cell, near the centre
+    if (floorMod(coord.x, 3) == 0 && floorMod(coord.y, 3) == 0) {
+        CellSpawn& guard = out.spawns[out.spawnCount++];
+        guard.kind = CellSpawnKind::Guard;
+        guard.x = originX + CellSize * 0.5f + random.range(-0.125f, 0.125f) * CellSize;
+        guard.z = originZ + CellSize * 0.5f + random.range(-0.125f, 0.125f) * CellSize;
+        guard.y = getHeight(guard.x, guard.z);
+        guard.heading = random.range(0.0f, 360.0f);
+    }
+}
+
+void CellGenerator::generateBlock(JobSystem& jobs, const GridCoordinate* coords, size_t count, CellBuffer* cells) const {
+    // A cell is tens of microseconds of work, so one per chunk balances well
+    jobs.parallelFor(count, 1, [this, coords, cells](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            generate(coords[i], cells[i]);
+        }
+    });
+}
+
+void CellGenerator::generateBlock(JobSystem& jobs, const GridCoordinate& origin, int width, int height,
+                                  std::vector<CellBuffer>& cells) const {
+    if (width <= 0 || height <= 0) {
+        cells.clear();
+        return;
+    }
+    cells.resize(static_cast<size_t>(width) * height);
+
+    jobs.parallelFor(cells.size(), 1, [this, &origin, width, &cells](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            GridCoordinate coord(origin.x + static_cast<int32_t>(i % width), origin.y + static_cast<int32_t>(i / width));
+            generate(coord, cells[i]);
+        }
+    });
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,74 @@
+// src/World/CellGenerator.h
+// Deterministic procedural content for world grid cells
+// Output depends only on the world seed and the cell coordinate, so any
+// thread may generate any cell at any time and get the same result
+
+#pragma once
+
+#include "World/GridCoordinate.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FinalStorm {
+
+class JobSystem;
+
+enum class CellSpawnKind : uint8_t {
+    Guard
+};
+
+struct CellSpawn {
+    CellSpawnKind kind;
+    float x, y, z;      // World position, on the terrain
+    float heading;      // Degrees around +Y
+};
+
+// Everything generated for one cell; plain data, no entities or shared state
+struct CellBuffer {
+    static constexpr int HeightResolution = 33;     // Samples per side, edges shared with neighbours
+    static constexpr size_t MaxSpawns = 16;
+
+    GridCoordinate coord;
+    uint64_t seed = 0;
+    std::array<float, HeightResolution * HeightResolution> heights{};   // Row-major, z rows
+    std::array<CellSpawn, MaxSpawns> spawns{};
+    size_t spawnCount = 0;
+
+    float getHeight(int sampleX, int sampleZ) const { return heights[sampleZ * HeightResolution + sampleX]; }
+};
+
+class CellGenerator {
+public:
+    static constexpr float CellSize = 256.0f;
+    static constexpr uint64_t DefaultWorldSeed = 0x46696e616c53746dULL;
+
+    explicit CellGenerator(uint64_t worldSeed = DefaultWorldSeed);
+
+    uint64_t getWorldSeed() const { return m_worldSeed; }
+
+    // Per-cell seed; neighbouring cells get unrelated sequences
+    uint64_t getCellSeed(const GridCoordinate& coord) const;
+
+    // Terrain height at a world position; continuous across cell edges
+    float getHeight(float worldX, float worldZ) const;
+
+    void generate(const GridCoordinate& coord, CellBuffer& out) const;
+
+    // Generates cells[i] for coords[i] across the job system's workers and
+    // the calling thread; returns when all are done
+    void generateBlock(JobSystem& jobs, const GridCoordinate* coords, size_t count, CellBuffer* cells) const;
+
+    // Generates the width x height block of cells starting at origin, row by row
+    void generateBlock(JobSystem& jobs, const GridCoordinate& origin, int width, int height,
+                       std::vector<CellBuffer>& cells) const;
+
+private:
+    float latticeValue(int64_t x, int64_t z, uint64_t octave) const;
+    float valueNoise(float x, float z, uint64_t octave) const;
+
+    uint64_t m_worldSeed;
+};
+
+} // namespace FinalStorm
@@ -0,0 +1,227 @@
+// src/World/ECS/AIScheduler.cpp
+// Distance-banded AI scheduler implementation
+
+#include "World/ECS/AIScheduler.h"
+#include "Core/Math/Math.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace FinalStorm {
+
+namespace {
+
+// NPCs moved between budget checks
+constexpr size_t BatchSize = 256;
+
+// NPCs in a band that never ticks are still re-banded this often, in frames
+// (a power of two), so one the player approaches wakes up
+constexpr uint32_t IdleRecheckInterval = 64;
+
+uint32_t roundUpToPowerOfTwo(uint32_t value) {
+    uint32_t result = 1;
+    while (result < value) result <<= 1;
+    return result;
+}
+
+float elapsedMsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+AIScheduler::AIScheduler()
+    : AIScheduler(Config()) {
+}
+
+AIScheduler::AIScheduler(const Config& config)
+    : m_config(config)
+    , m_frame(0)
+    , m_time(0.0)
+    , m_frameTime(0.0f)
+    , m_focus(make_vec3(0.0f, 0.0f, 0.0f))
+    , m_hasFocus(false)
+    , m_overBudget(false) {
+}
+
+void AIScheduler::update(EntityRegistry& registry, const PatrolRoutes& routes,
+                         const vec3& focus, bool hasFocus, float deltaTime) {
+    auto start = std::chrono::steady_clock::now();
+    m_stats = Stats();
+    m_focus = focus;
+    m_hasFocus = hasFocus;
+    m_overBudget = false;
+    m_frame++;
+    m_time += deltaTime;
+    m_frameTime = deltaTime;
+
+    uint32_t slotMask[static_cast<size_t>(AIBand::Count)];
+    for (size_t band = 0; band < static_cast<size_t>(AIBand::Count); ++band) {
+        uint32_t interval = m_config.frameInterval[band];
+        slotMask[band] = (interval == 0 ? IdleRecheckInterval : roundUpToPowerOfTwo(interval)) - 1;
+    }
+
+    for (size_t band = 0; band < static_cast<size_t>(AIBand::Count); ++band) {
+        m_due[band].clear();
+        m_carried[band].clear();
+    }
+
+    // Collect NPCs whose slot comes up this frame, plus any the budget cut
+    // last frame. The id staggers slots so a band's NPCs spread evenly over
+    // its interval. This sweep touches every patrolling NPC, so it only reads
+    // the AI column; the distance check that re-bands an NPC happens when it
+    // comes due. In a band that never ticks the slot only re-bands the NPC.
+    registry.forEachTable<TransformComponent, AIComponent, PatrolComponent>(
+        [&](size_t count, const uint32_t* ids, const EntityType*,
+            TransformComponent* transforms, AIComponent* ai, PatrolComponent* patrols) {
+            for (size_t i = 0; i < count; ++i) {
+                if (ai[i].state != AIState::Patrol) continue;
+
+                size_t band = std::min<size_t>(ai[i].band, static_cast<size_t>(AIBand::Dormant));
+                bool slotDue = ((m_frame + ids[i]) & slotMask[band]) == 0;
+                if (!slotDue && !ai[i].deferred) {
+                    m_stats.bandCounts[band]++;
+                    continue;
+                }
+
+                band = static_cast<size_t>(classify(transforms[i].position));
+                ai[i].band = static_cast<uint8_t>(band);
+                m_stats.bandCounts[band]++;
+                if (m_config.frameInterval[band] == 0 && !ai[i].deferred) continue;
+                auto& list = ai[i].deferred ? m_carried[band] : m_due[band];
+                list.push_back(DueEntry{ &transforms[i], &ai[i], &patrols[i] });
+            }
+        });
+
+    m_stats.sweepMs = elapsedMsSince(start);
+    auto tickStart = std::chrono::steady_clock::now();
+
+    // Nearest bands first, and within a band the NPCs cut last frame before
+    // this frame's own, longest waiting first. Whatever misses the budget is
+    // deferred to the next frame and takes a larger step then, so a short
+    // budget delays NPCs but never starves the same ones.
+    for (size_t band = 0; band < static_cast<size_t>(AIBand::Count); ++band) {
+        auto& carried = m_carried[band];
+        std::stable_sort(carried.begin(), carried.end(), [](const DueEntry& a, const DueEntry& b) {
+            return a.ai->lastTickTime < b.ai->lastTickTime;
+        });
+
+        m_stats.due += carried.size() + m_due[band].size();
+        runBand(carried, routes, tickStart);
+        runBand(m_due[band], routes, tickStart);
+    }
+
+    m_stats.elapsedMs = elapsedMsSince(start);
+}
+
+void AIScheduler::runBand(const std::vector<DueEntry>& due, const PatrolRoutes& routes,
+                          std::chrono::steady_clock::time_point tickStart) {
+    size_t begin = 0;
+    for (; begin < due.size(); begin += BatchSize) {
+        if (!m_overBudget && m_stats.ticked > 0 && elapsedMsSince(tickStart) >= m_config.budgetMs) {
+            m_overBudget = true;
+        }
+        if (m_overBudget) break;
+
+        size_t batchEnd = std::min(due.size(), begin + BatchSize);
+        stepPatrols(due, begin, batchEnd, routes);
+        m_stats.ticked += batchEnd - begin;
+    }
+
+    for (size_t i = begin; i < due.size(); ++i) {
+        due[i].ai->deferred = 1;
+    }
+    if (begin < due.size()) {
+        m_stats.deferred += due.size() - begin;
+    }
+}
+
+AIBand AIScheduler::classify(const vec3& position) const {
+    if (!m_hasFocus) return AIBand::Near;
+
+    float dx = position.x - m_focus.x;
+    float dz = position.z - m_focus.z;
+    float distanceSq = dx * dx + dz * dz;
+    if (distanceSq < m_config.nearDistance * m_config.nearDistance) return AIBand::Near;
+    if (distanceSq < m_config.midDistance * m_config.midDistance) return AIBand::Mid;
+    if (distanceSq < m_config.farDistance * m_config.farDistance) return AIBand::Far;
+    return AIBand::Dormant;
+}
+
+void AIScheduler::stepPatrols(const std::vector<DueEntry>& entries, size_t begin, size_t end, const PatrolRoutes& routes) {
+    const size_t n = end - begin;
+    m_posX.resize(n);
+    m_posY.resize(n);
+    m_posZ.resize(n);
+    m_targetX.resize(n);
+    m_targetY.resize(n);
+    m_targetZ.resize(n);
+    m_maxStep.resize(n);
+    m_arrived.resize(n);
+
+    // Gather
+    for (size_t k = 0; k < n; ++k) {
+        const DueEntry& entry = entries[begin + k];
+        const vec3& position = entry.transform->position;
+        m_posX[k] = position.x;
+        m_posY[k] = position.y;
+        m_posZ[k] = position.z;
+
+        vec3 target = position;
+        uint32_t pointCount = routes.getPointCount(entry.patrol->routeId);
+        if (pointCount > 0) {
+            target = routes.getPoints(entry.patrol->routeId)[entry.patrol->pointIndex % pointCount];
+        }
+        m_targetX[k] = target.x;
+        m_targetY[k] = target.y;
+        m_targetZ[k] = target.z;
+
+        // Time compensation: the whole interval since the last tick in one step
+        double lastTick = entry.ai->lastTickTime;
+        float stepTime = lastTick < 0.0 ? m_frameTime : static_cast<float>(m_time - lastTick);
+        m_maxStep[k] = entry.ai->moveSpeed * stepTime;
+    }
+
+    // Move every NPC toward its waypoint, stopping on it rather than
+    // overshooting. Branch-free over plain arrays so it vectorizes.
+    float* __restrict posX = m_posX.data();
+    float* __restrict posY = m_posY.data();
+    float* __restrict posZ = m_posZ.data();
+    const float* __restrict targetX = m_targetX.data();
+    const float* __restrict targetY = m_targetY.data();
+    const float* __restrict targetZ = m_targetZ.data();
+    const float* __restrict maxStep = m_maxStep.data();
+    uint8_t* __restrict arrived = m_arrived.data();
+    const float arriveDistance = m_config.arriveDistance;
+
+    for (size_t k = 0; k < n; ++k) {
+        float dx = targetX[k] - posX[k];
+        float dy = targetY[k] - posY[k];
+        float dz = targetZ[k] - posZ[k];
+        float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+        float step = std::min(maxStep[k], distance);
+        float scale = step / std::max(distance, 1e-6f);
+        posX[k] += dx * scale;
+        posY[k] += dy * scale;
+        posZ[k] += dz * scale;
+        arrived[k] = (distance - step) < arriveDistance ? 1 : 0;
+    }
+
+    // Scatter
+    for (size_t k = 0; k < n; ++k) {
+        const DueEntry& entry = entries[begin + k];
+        vec3 position = make_vec3(m_posX[k], m_posY[k], m_posZ[k]);
+        entry.transform->position = position;
+        entry.ai->lastTickTime = m_time;
+        entry.ai->deferred = 0;
+
+        if (m_arrived[k]) {
+            uint32_t pointCount = routes.getPointCount(entry.patrol->routeId);
+            if (pointCount > 0) {
+                entry.patrol->pointIndex = (entry.patrol->pointIndex + 1) % pointCount;
+            }
+        }
+    }
+}
+
+} // namespace FinalStorm
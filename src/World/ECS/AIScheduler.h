@@ -0,0 +1,91 @@
+// src/World/ECS/AIScheduler.h
+// Distance-banded, time-budgeted AI updates for component NPCs
+// Far NPCs tick less often with the elapsed time folded into one larger
+// step; due patrols are moved in batches by one branch-free loop
+
+#pragma once
+
+#include "World/ECS/EntityRegistry.h"
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace FinalStorm {
+
+enum class AIBand : uint8_t {
+    Near,
+    Mid,
+    Far,
+    Dormant,
+    Count
+};
+
+class AIScheduler {
+public:
+    struct Config {
+        float nearDistance = 64.0f;         // Beyond this an NPC drops to Mid
+        float midDistance = 256.0f;
+        float farDistance = 1024.0f;        // Beyond this an NPC is Dormant
+        uint32_t frameInterval[static_cast<size_t>(AIBand::Count)] = { 1, 4, 16, 64 };    // Rounded up to powers of two; 0 never ticks but still re-bands every 64 frames
+        float budgetMs = 1.0f;              // Tick time per frame; nearer bands go first
+        float arriveDistance = 1.0f;        // Waypoint reached within this
+    };
+
+    struct Stats {
+        size_t due = 0;                     // NPCs whose slot came up this frame
+        size_t ticked = 0;
+        size_t deferred = 0;                // Due but over budget; they go first next frame
+        size_t bandCounts[static_cast<size_t>(AIBand::Count)] = {};
+        float sweepMs = 0.0f;               // Finding due NPCs; touches every patrolling NPC, not budgeted
+        float elapsedMs = 0.0f;
+    };
+
+    AIScheduler();
+    explicit AIScheduler(const Config& config);
+
+    void setConfig(const Config& config) { m_config = config; }
+    const Config& getConfig() const { return m_config; }
+
+    // With hasFocus false every NPC is treated as Near
+    void update(EntityRegistry& registry, const PatrolRoutes& routes,
+                const vec3& focus, bool hasFocus, float deltaTime);
+
+    const Stats& getStats() const { return m_stats; }
+
+private:
+    struct DueEntry {
+        TransformComponent* transform;
+        AIComponent* ai;
+        PatrolComponent* patrol;
+    };
+
+    AIBand classify(const vec3& position) const;
+
+    // Ticks due in batches until the budget runs out, then marks the rest
+    // deferred so they come due again next frame
+    void runBand(const std::vector<DueEntry>& due, const PatrolRoutes& routes,
+                 std::chrono::steady_clock::time_point tickStart);
+
+    // Moves entries [begin, end) of one band toward their waypoints
+    void stepPatrols(const std::vector<DueEntry>& entries, size_t begin, size_t end, const PatrolRoutes& routes);
+
+    Config m_config;
+    Stats m_stats;
+    uint32_t m_frame;
+    double m_time;
+    float m_frameTime;
+    vec3 m_focus;
+    bool m_hasFocus;
+
+    std::vector<DueEntry> m_due[static_cast<size_t>(AIBand::Count)];
+    std::vector<DueEntry> m_carried[static_cast<size_t>(AIBand::Count)];   // Deferred last frame; run first
+    bool m_overBudget;
+
+    // Batch scratch, struct-of-arrays for the movement loop
+    std::vector<float> m_posX, m_posY, m_posZ;
+    std::vector<float> m_targetX, m_targetY, m_targetZ;
+    std::vector<float> m_maxStep;
+    std::vector<uint8_t> m_arrived;
+};
+
+} // namespace FinalStorm
@@ -0,0 +1,93 @@
+// src/World/ECS/Components.h
+// Plain-data components stored in EntityRegistry archetype tables
+// Components must be trivially copyable; tables move rows with memcpy
+
+#pragma once
+
+#include "Core/Math/MathTypes.h"
+#include "World/Entity.h"
+#include <cstdint>
+#include <vector>
+
+namespace FinalStorm {
+
+struct TransformComponent {
+    vec3 position;
+    quat rotation;
+    vec3 scale;
+};
+
+struct VelocityComponent {
+    vec3 linear;
+    float damping;          // Multiplier applied per update, 1 keeps speed
+};
+
+struct AIComponent {
+    AIState state;
+    uint32_t targetId;
+    float moveSpeed;        // World units per second
+    uint8_t band = 0;               // AIBand, refreshed when the NPC's slot comes up
+    double lastTickTime = -1.0;     // AIScheduler clock; negative until the first tick
+    uint8_t deferred = 0;           // Due but cut by the tick budget; due again next frame
+};
+
+struct PatrolComponent {
+    uint32_t routeId;       // Into PatrolRoutes
+    uint32_t pointIndex;
+};
+
+struct MeshComponent {
+    uint32_t meshId;        // EntityRegistry::internMesh
+};
+
+// Rows mirrored from a class-based Entity added through WorldManager::addEntity;
+// the object stays authoritative and its update() still runs
+struct LegacyEntityComponent {
+    Entity* entity;
+};
+
+// Component type indices, one bit each in an archetype mask
+template<typename T> struct ComponentIndex;
+template<> struct ComponentIndex<TransformComponent>    { static constexpr uint32_t value = 0; };
+template<> struct ComponentIndex<VelocityComponent>     { static constexpr uint32_t value = 1; };
+template<> struct ComponentIndex<AIComponent>           { static constexpr uint32_t value = 2; };
+template<> struct ComponentIndex<PatrolComponent>       { static constexpr uint32_t value = 3; };
+template<> struct ComponentIndex<MeshComponent>         { static constexpr uint32_t value = 4; };
+template<> struct ComponentIndex<LegacyEntityComponent> { static constexpr uint32_t value = 5; };
+
+constexpr uint32_t ComponentTypeCount = 6;
+
+using ComponentMask = uint32_t;
+
+template<typename... Ts>
+constexpr ComponentMask componentMask() {
+    return (ComponentMask(0) | ... | (ComponentMask(1) << ComponentIndex<Ts>::value));
+}
+
+// Patrol routes share one point pool instead of a vector per NPC
+class PatrolRoutes {
+public:
+    uint32_t add(const vec3* points, size_t count) {
+        Route route;
+        route.offset = static_cast<uint32_t>(m_points.size());
+        route.count = static_cast<uint32_t>(count);
+        m_points.insert(m_points.end(), points, points + count);
+        m_routes.push_back(route);
+        return static_cast<uint32_t>(m_routes.size() - 1);
+    }
+
+    const vec3* getPoints(uint32_t routeId) const { return m_points.data() + m_routes[routeId].offset; }
+    uint32_t getPointCount(uint32_t routeId) const { return m_routes[routeId].count; }
+    size_t getRouteCount() const { return m_routes.size(); }
+
+private:
+    struct Route {
+        uint32_t offset;
+        uint32_t count;
+    };
+
+    std::vector<vec3> m_points;
+    std::vector<Route> m_routes;
+};
+
+} // namespace FinalStorm
@@ -0,0 +1,142 @@
+// src/World/ECS/EntityRegistry.cpp
+// Archetype-based component storage implementation
+
+#include "World/ECS/EntityRegistry.h"
+
+namespace FinalStorm {
+
+namespace {
+
+// Element sizes by ComponentIndex
+constexpr size_t ComponentSizes[ComponentTypeCount] = {
+    sizeof(TransformComponent),
+    sizeof(VelocityComponent),
+    sizeof(AIComponent),
+    sizeof(PatrolComponent),
+    sizeof(MeshComponent),
+    sizeof(LegacyEntityComponent),
+};
+
+bool hasComponent(ComponentMask mask, uint32_t componentIndex) {
+    return (mask & (ComponentMask(1) << componentIndex)) != 0;
+}
+
+} // namespace
+
+// Archetype implementation
+Archetype::Archetype(ComponentMask mask)
+    : m_mask(mask) {
+}
+
+size_t Archetype::appendRow(uint32_t id, EntityType type) {
+    size_t row = m_ids.size();
+    m_ids.push_back(id);
+    m_types.push_back(type);
+    for (uint32_t c = 0; c < ComponentTypeCount; ++c) {
+        if (hasComponent(m_mask, c)) {
+            m_columns[c].resize(m_columns[c].size() + ComponentSizes[c], 0);
+        }
+    }
+    return row;
+}
+
+uint32_t Archetype::removeRow(size_t row) {
+    size_t last = m_ids.size() - 1;
+    uint32_t moved = 0;
+    if (row != last) {
+        moved = m_ids[last];
+        m_ids[row] = m_ids[last];
+        m_types[row] = m_types[last];
+        for (uint32_t c = 0; c < ComponentTypeCount; ++c) {
+            if (hasComponent(m_mask, c)) {
+                std::memcpy(componentAt(c, row), componentAt(c, last), ComponentSizes[c]);
+            }
+        }
+    }
+
+    m_ids.pop_back();
+    m_types.pop_back();
+    for (uint32_t c = 0; c < ComponentTypeCount; ++c) {
+        if (hasComponent(m_mask, c)) {
+            m_columns[c].resize(m_columns[c].size() - ComponentSizes[c]);
+        }
+    }
+    return moved;
+}
+
+void* Archetype::componentAt(uint32_t componentIndex, size_t row) {
+    return m_columns[componentIndex].data() + row * ComponentSizes[componentIndex];
+}
+
+// EntityRegistry implementation
+EntityRegistry::EntityRegistry() = default;
+
+void EntityRegistry::destroy(uint32_t id) {
+    auto it = m_locations.find(id);
+    if (it == m_locations.end()) return;
+
+    Location location = it->second;
+    m_locations.erase(it);
+
+    uint32_t moved = m_archetypes[location.archetype]->removeRow(location.row);
+    if (moved != 0) {
+        m_locations[moved].row = location.row;
+    }
+}
+
+void EntityRegistry::clear() {
+    m_archetypes.clear();
+    m_archetypeByMask.clear();
+    m_locations.clear();
+}
+
+EntityType EntityRegistry::getType(uint32_t id) const {
+    auto it = m_locations.find(id);
+    if (it == m_locations.end()) return EntityType::Object;
+    return m_archetypes[it->second.archetype]->getTypes()[it->second.row];
+}
+
+uint32_t EntityRegistry::internMesh(const std::string& meshName) {
+    auto it = m_meshIds.find(meshName);
+    if (it != m_meshIds.end()) return it->second;
+
+    uint32_t meshId = static_cast<uint32_t>(m_meshNames.size());
+    m_meshNames.push_back(meshName);
+    m_meshIds.emplace(meshName, meshId);
+    return meshId;
+}
+
+uint32_t EntityRegistry::findOrCreateArchetype(ComponentMask mask) {
+    auto it = m_archetypeByMask.find(mask);
+    if (it != m_archetypeByMask.end()) return it->second;
+
+    uint32_t index = static_cast<uint32_t>(m_archetypes.size());
+    m_archetypes.push_back(std::make_unique<Archetype>(mask));
+    m_archetypeByMask.emplace(mask, index);
+    return index;
+}
+
+void EntityRegistry::moveEntity(uint32_t id, ComponentMask newMask) {
+    Location from = m_locations[id];
+    uint32_t targetIndex = findOrCreateArchetype(newMask);
+
+    // Both references stay valid: archetypes are heap-allocated
+    Archetype& source = *m_archetypes[from.archetype];
+    Archetype& target = *m_archetypes[targetIndex];
+
+    size_t row = target.appendRow(id, source.getTypes()[from.row]);
+    ComponentMask shared = source.getMask() & newMask;
+    for (uint32_t c = 0; c < ComponentTypeCount; ++c) {
+        if (hasComponent(shared, c)) {
+            std::memcpy(target.componentAt(c, row), source.componentAt(c, from.row), ComponentSizes[c]);
+        }
+    }
+
+    uint32_t moved = source.removeRow(from.row);
+    if (moved != 0) {
+        m_locations[moved].row = from.row;
+    }
+    m_locations[id] = Location{ targetIndex, static_cast<uint32_t>(row) };
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,184 @@
+// src/World/ECS/EntityRegistry.h
+// Archetype-based component storage
+// Entities with the same component set share a table with one contiguous
+// column per component, so systems walk arrays instead of objects
+
+#pragma once
+
+#include "World/ECS/Components.h"
+#include <array>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace FinalStorm {
+
+class Archetype {
+public:
+    explicit Archetype(ComponentMask mask);
+
+    ComponentMask getMask() const { return m_mask; }
+    size_t size() const { return m_ids.size(); }
+    const uint32_t* getIds() const { return m_ids.data(); }
+    const EntityType* getTypes() const { return m_types.data(); }
+
+    template<typename T>
+    T* column() {
+        return reinterpret_cast<T*>(m_columns[ComponentIndex<T>::value].data());
+    }
+
+    template<typename T>
+    const T* column() const {
+        return reinterpret_cast<const T*>(m_columns[ComponentIndex<T>::value].data());
+    }
+
+private:
+    friend class EntityRegistry;
+
+    // Appends a row with zeroed components and returns its index
+    size_t appendRow(uint32_t id, EntityType type);
+
+    // Moves the last row into row; returns the id that moved, or 0
+    uint32_t removeRow(size_t row);
+
+    void* componentAt(uint32_t componentIndex, size_t row);
+
+    ComponentMask m_mask;
+    std::vector<uint32_t> m_ids;
+    std::vector<EntityType> m_types;
+    std::array<std::vector<unsigned char>, ComponentTypeCount> m_columns;
+};
+
+class EntityRegistry {
+public:
+    EntityRegistry();
+
+    // Ids come from the caller (Entity::allocateId) so legacy and
+    // component entities share one id space
+    template<typename... Ts>
+    void create(uint32_t id, EntityType type, const Ts&... components);
+
+    void destroy(uint32_t id);
+    bool contains(uint32_t id) const { return m_locations.count(id) != 0; }
+    size_t size() const { return m_locations.size(); }
+    void clear();
+
+    EntityType getType(uint32_t id) const;
+
+    template<typename T> bool has(uint32_t id) const;
+    template<typename T> T* get(uint32_t id);
+
+    // Adding or removing a component moves the entity to another table
+    template<typename T> void add(uint32_t id, const T& component);
+    template<typename T> void remove(uint32_t id);
+
+    // Calls fn(count, ids, types, columns...) once per table holding all of Ts.
+    // Do not create or destroy entities from inside fn.
+    template<typename... Ts, typename Fn>
+    void forEachTable(Fn&& fn);
+    template<typename... Ts, typename Fn>
+    void forEachTable(Fn&& fn) const;
+
+    uint32_t internMesh(const std::string& meshName);
+    const std::string& getMeshName(uint32_t meshId) const { return m_meshNames[meshId]; }
+
+private:
+    struct Location {
+        uint32_t archetype;
+        uint32_t row;
+    };
+
+    uint32_t findOrCreateArchetype(ComponentMask mask);
+    void moveEntity(uint32_t id, ComponentMask newMask);
+
+    template<typename T>
+    static void checkComponent() {
+        static_assert(std::is_trivially_copyable<T>::value, "Components must be trivially copyable");
+    }
+
+    std::vector<std::unique_ptr<Archetype>> m_archetypes;
+    std::unordered_map<ComponentMask, uint32_t> m_archetypeByMask;
+    std::unordered_map<uint32_t, Location> m_locations;
+
+    std::vector<std::string> m_meshNames;
+    std::unordered_map<std::string, uint32_t> m_meshIds;
+};
+
+template<typename... Ts>
+void EntityRegistry::create(uint32_t id, EntityType type, const Ts&... components) {
+    (checkComponent<Ts>(), ...);
+    if (contains(id)) {
+        destroy(id);
+    }
+
+    uint32_t archetypeIndex = findOrCreateArchetype(componentMask<Ts...>());
+    Archetype& archetype = *m_archetypes[archetypeIndex];
+    size_t row = archetype.appendRow(id, type);
+    (std::memcpy(archetype.componentAt(ComponentIndex<Ts>::value, row), &components, sizeof(Ts)), ...);
+
+    m_locations[id] = Location{ archetypeIndex, static_cast<uint32_t>(row) };
+}
+
+template<typename T>
+bool EntityRegistry::has(uint32_t id) const {
+    auto it = m_locations.find(id);
+    if (it == m_locations.end()) return false;
+    return (m_archetypes[it->second.archetype]->getMask() & componentMask<T>()) != 0;
+}
+
+template<typename T>
+T* EntityRegistry::get(uint32_t id) {
+    auto it = m_locations.find(id);
+    if (it == m_locations.end()) return nullptr;
+    Archetype& archetype = *m_archetypes[it->second.archetype];
+    if ((archetype.getMask() & componentMask<T>()) == 0) return nullptr;
+    return archetype.column<T>() + it->second.row;
+}
+
+template<typename T>
+void EntityRegistry::add(uint32_t id, const T& component) {
+    checkComponent<T>();
+    auto it = m_locations.find(id);
+    if (it == m_locations.end()) return;
+
+    ComponentMask mask = m_archetypes[it->second.archetype]->getMask();
+    if ((mask & componentMask<T>()) == 0) {
+        moveEntity(id, mask | componentMask<T>());
+    }
+    *get<T>(id) = component;
+}
+
+template<typename T>
+void EntityRegistry::remove(uint32_t id) {
+    auto it = m_locations.find(id);
+    if (it == m_locations.end()) return;
+
+    ComponentMask mask = m_archetypes[it->second.archetype]->getMask();
+    if ((mask & componentMask<T>()) != 0) {
+        moveEntity(id, mask & ~componentMask<T>());
+    }
+}
+
+template<typename... Ts, typename Fn>
+void EntityRegistry::forEachTable(Fn&& fn) {
+    const ComponentMask required = componentMask<Ts...>();
+    for (auto& archetype : m_archetypes) {
+        if ((archetype->getMask() & required) != required || archetype->size() == 0) continue;
+        fn(archetype->size(), archetype->getIds(), archetype->getTypes(), archetype->template column<Ts>()...);
+    }
+}
+
+template<typename... Ts, typename Fn>
+void EntityRegistry::forEachTable(Fn&& fn) const {
+    const ComponentMask required = componentMask<Ts...>();
+    for (const auto& archetype : m_archetypes) {
+        if ((archetype->getMask() & required) != required || archetype->size() == 0) continue;
+        const Archetype& table = *archetype;
+        fn(table.size(), table.getIds(), table.getTypes(), table.template column<Ts>()...);
+    }
+}
+
+} // namespace FinalStorm
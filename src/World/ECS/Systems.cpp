@@ -0,0 +1,33 @@
+// src/World/ECS/Systems.cpp
+// Per-frame systems implementation
+
+#include "World/ECS/Systems.h"
+#include "Core/Math/Math.h"
+
+namespace FinalStorm {
+
+void integrateVelocitySystem(EntityRegistry& registry, float deltaTime) {
+    registry.forEachTable<TransformComponent, VelocityComponent>(
+        [&](size_t count, const uint32_t*, const EntityType*,
+            TransformComponent* transforms, VelocityComponent* velocities) {
+            for (size_t i = 0; i < count; ++i) {
+                transforms[i].position += velocities[i].linear * deltaTime;
+                velocities[i].linear *= velocities[i].damping;
+            }
+        });
+}
+
+void syncLegacyTransformSystem(EntityRegistry& registry) {
+    registry.forEachTable<TransformComponent, LegacyEntityComponent>(
+        [](size_t count, const uint32_t*, const EntityType*,
+           TransformComponent* transforms, LegacyEntityComponent* legacy) {
+            for (size_t i = 0; i < count; ++i) {
+                const Transform& transform = legacy[i].entity->getTransform();
+                transforms[i].position = transform.position;
+                transforms[i].rotation = transform.rotation;
+                transforms[i].scale = transform.scale;
+            }
+        });
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,18 @@
+// src/World/ECS/Systems.h
+// Per-frame systems over EntityRegistry tables
+// Each system is one loop per matching table, with no virtual calls
+
+#pragma once
+
+#include "World/ECS/EntityRegistry.h"
+
+namespace FinalStorm {
+
+// Applies velocity to position, then damping
+void integrateVelocitySystem(EntityRegistry& registry, float deltaTime);
+
+// Copies class-based entity transforms into their mirror rows so queries
+// over the registry see them
+void syncLegacyTransformSystem(EntityRegistry& registry);
+
+} // namespace FinalStorm
@@ -7,10 +7,10 @@
 
 namespace FinalStorm {
 
-uint32_t Entity::nextId = 1;
+std::atomic<uint32_t> Entity::nextId{1};
 
 Entity::Entity(EntityType entityType)
-    : id(nextId++)
+    : id(allocateId())
     , type(entityType)
     , active(true)
     , transform() {
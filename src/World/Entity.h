@@ -9,6 +9,7 @@
 
 #include "Core/Math/MathTypes.h"
 #include "Core/Math/Transform.h"
+#include <atomic>
 #include <string>
 #include <memory>
 #include <vector>
@@ -50,6 +51,9 @@ public:
     virtual void update(float deltaTime);
     bool isInFrustum(const mat4& viewProjectionMatrix) const;
     
+    // Ids for component-only entities come from the same sequence
+    static uint32_t allocateId() { return nextId++; }
+    
 protected:
     uint32_t id;
     EntityType type;
@@ -58,7 +62,7 @@ protected:
     bool active;
     
 private:
-    static uint32_t nextId;
+    static std::atomic<uint32_t> nextId;   // Grids are generated on worker threads
 };
 
 using EntityPtr = std::shared_ptr<Entity>;
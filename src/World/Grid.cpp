@@ -0,0 +1,29 @@
+// src/World/Grid.cpp
+// World grid cell implementation
+
+#include "World/Grid.h"
+#include <algorithm>
+
+namespace FinalStorm {
+
+Grid::Grid(const GridCoordinate& coord)
+    : coordinate(coord) {
+}
+
+void Grid::addEntity(EntityPtr entity) {
+    if (entity) {
+        entities.push_back(entity);
+    }
+}
+
+void Grid::removeEntity(uint32_t entityId) {
+    entities.erase(
+        std::remove_if(entities.begin(), entities.end(),
+            [entityId](const EntityPtr& entity) {
+                return entity->getId() == entityId;
+            }),
+        entities.end()
+    );
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,39 @@
+// src/World/Grid.h
+// World grid cells
+// A Grid owns the generated cell data and entities for one GRID_SIZE square of the world
+
+#pragma once
+
+#include "World/CellGenerator.h"
+#include "World/Entity.h"
+#include "World/GridCoordinate.h"
+#include <memory>
+#include <vector>
+
+namespace FinalStorm {
+
+class Grid {
+public:
+    Grid(const GridCoordinate& coord);
+    
+    void addEntity(EntityPtr entity);
+    void removeEntity(uint32_t entityId);
+    const std::vector<EntityPtr>& getEntities() const { return entities; }
+    
+    // Entities that live only in the EntityRegistry
+    void addComponentEntity(uint32_t entityId) { componentEntities.push_back(entityId); }
+    const std::vector<uint32_t>& getComponentEntities() const { return componentEntities; }
+    
+    void setCell(std::unique_ptr<CellBuffer> generated) { cell = std::move(generated); }
+    const CellBuffer* getCell() const { return cell.get(); }
+    
+    const GridCoordinate& getCoordinate() const { return coordinate; }
+    
+private:
+    GridCoordinate coordinate;
+    std::vector<EntityPtr> entities;
+    std::vector<uint32_t> componentEntities;
+    std::unique_ptr<CellBuffer> cell;
+};
+
+} // namespace FinalStorm
@@ -0,0 +1,33 @@
+// src/World/GridCoordinate.h
+// Integer coordinates of a world grid cell
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace FinalStorm {
+
+struct GridCoordinate {
+    int32_t x;
+    int32_t y;
+    
+    GridCoordinate() : x(0), y(0) {}
+    GridCoordinate(int32_t x, int32_t y) : x(x), y(y) {}
+    
+    bool operator==(const GridCoordinate& other) const {
+        return x == other.x && y == other.y;
+    }
+    
+    bool operator!=(const GridCoordinate& other) const {
+        return !(*this == other);
+    }
+};
+
+struct GridCoordinateHash {
+    std::size_t operator()(const GridCoordinate& coord) const {
+        return std::hash<int32_t>()(coord.x) ^ (std::hash<int32_t>()(coord.y) << 1);
+    }
+};
+
+} // namespace FinalStorm
@@ -0,0 +1,148 @@
+// src/World/GridStreamer.cpp
+// Background grid generation implementation
+
+#include "World/GridStreamer.h"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace FinalStorm {
+
+struct GridStreamer::State {
+    Generator generator;
+
+    mutable std::mutex mutex;
+    std::vector<GridCoordinate> pending;    // Heap, best grid at the front
+    std::unordered_set<GridCoordinate, GridCoordinateHash> pendingSet;
+    std::deque<std::unique_ptr<Grid>> completed;
+    size_t inFlight = 0;
+    bool shutdown = false;
+
+    GridCoordinate center;
+    float directionX = 0.0f;
+    float directionY = 0.0f;
+
+    // How many grids of distance being straight ahead is worth
+    static constexpr float AheadWeight = 1.5f;
+
+    float score(const GridCoordinate& coord) const {
+        float dx = static_cast<float>(coord.x - center.x);
+        float dy = static_cast<float>(coord.y - center.y);
+        float distance = std::sqrt(dx * dx + dy * dy);
+        if (distance == 0.0f) return 0.0f;
+        float ahead = (dx * directionX + dy * directionY) / distance;
+        return distance - AheadWeight * ahead;
+    }
+
+    // Max-heap comparator that puts the lowest score on top
+    bool lowerPriority(const GridCoordinate& a, const GridCoordinate& b) const {
+        return score(a) > score(b);
+    }
+
+    void reheap() {
+        std::make_heap(pending.begin(), pending.end(),
+            [this](const GridCoordinate& a, const GridCoordinate& b) { return lowerPriority(a, b); });
+    }
+};
+
+GridStreamer::GridStreamer(std::shared_ptr<JobSystem> jobs, Generator generator)
+    : m_jobs(std::move(jobs))
+    , m_state(std::make_shared<State>()) {
+    m_state->generator = std::move(generator);
+}
+
+GridStreamer::~GridStreamer() {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    m_state->shutdown = true;
+    m_state->pending.clear();
+    m_state->pendingSet.clear();
+    m_state->completed.clear();
+}
+
+void GridStreamer::setFocus(const GridCoordinate& center, float directionX, float directionY) {
+    float length = std::sqrt(directionX * directionX + directionY * directionY);
+
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    m_state->center = center;
+    m_state->directionX = length > 0.0f ? directionX / length : 0.0f;
+    m_state->directionY = length > 0.0f ? directionY / length : 0.0f;
+    m_state->reheap();
+}
+
+void GridStreamer::request(const GridCoordinate& coord) {
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        if (!m_state->pendingSet.insert(coord).second) return;
+
+        State& state = *m_state;
+        state.pending.push_back(coord);
+        std::push_heap(state.pending.begin(), state.pending.end(),
+            [&state](const GridCoordinate& a, const GridCoordinate& b) { return state.lowerPriority(a, b); });
+    }
+
+    // Each job takes whichever grid is best when it starts, not this one
+    std::shared_ptr<State> state = m_state;
+    m_jobs->submit([state]() { generateNext(state); });
+}
+
+void GridStreamer::cancel(const GridCoordinate& coord) {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    if (m_state->pendingSet.erase(coord) == 0) return;
+
+    auto& pending = m_state->pending;
+    pending.erase(std::find(pending.begin(), pending.end(), coord));
+    m_state->reheap();
+}
+
+bool GridStreamer::popCompleted(std::unique_ptr<Grid>& grid) {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    if (m_state->completed.empty()) return false;
+    grid = std::move(m_state->completed.front());
+    m_state->completed.pop_front();
+    return true;
+}
+
+void GridStreamer::destroyAsync(std::unique_ptr<Grid> grid) {
+    if (!grid) return;
+    std::shared_ptr<Grid> doomed(std::move(grid));
+    m_jobs->submit([doomed]() mutable { doomed.reset(); });
+}
+
+size_t GridStreamer::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->pending.size();
+}
+
+size_t GridStreamer::getInFlightCount() const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->inFlight;
+}
+
+void GridStreamer::generateNext(const std::shared_ptr<State>& state) {
+    GridCoordinate coord;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->shutdown || state->pending.empty()) return; // Cancelled
+
+        std::pop_heap(state->pending.begin(), state->pending.end(),
+            [&state](const GridCoordinate& a, const GridCoordinate& b) { return state->lowerPriority(a, b); });
+        coord = state->pending.back();
+        state->pending.pop_back();
+        state->pendingSet.erase(coord);
+        state->inFlight++;
+    }
+
+    auto grid = std::make_unique<Grid>(coord);
+    state->generator(coord, *grid);
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->inFlight--;
+    if (!state->shutdown) {
+        state->completed.push_back(std::move(grid));
+    }
+}
+
+} // namespace FinalStorm
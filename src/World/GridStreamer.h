@@ -0,0 +1,52 @@
+// src/World/GridStreamer.h
+// Background grid generation for WorldManager
+// Requested grids are generated on JobSystem workers, nearest and most-ahead first
+
+#pragma once
+
+#include "World/Grid.h"
+#include "Core/JobSystem.h"
+#include <functional>
+#include <memory>
+
+namespace FinalStorm {
+
+class GridStreamer {
+public:
+    // Runs on worker threads, several at once; must only touch the grid it is given
+    using Generator = std::function<void(const GridCoordinate&, Grid&)>;
+
+    GridStreamer(std::shared_ptr<JobSystem> jobs, Generator generator);
+
+    // Drops pending requests; grids still generating are discarded on their worker
+    ~GridStreamer();
+
+    // Pending grids are ordered by distance from center, with grids in the
+    // travel direction (grid units, any length, zero for none) pulled forward
+    void setFocus(const GridCoordinate& center, float directionX, float directionY);
+
+    // Queues a grid for generation; does nothing if it is already pending
+    void request(const GridCoordinate& coord);
+
+    // Withdraws a request that has not started yet
+    void cancel(const GridCoordinate& coord);
+
+    // Finished grids, in completion order (main thread)
+    bool popCompleted(std::unique_ptr<Grid>& grid);
+
+    // Releases a grid and its entities on a worker thread
+    void destroyAsync(std::unique_ptr<Grid> grid);
+
+    size_t getPendingCount() const;
+    size_t getInFlightCount() const;
+
+private:
+    struct State;
+
+    static void generateNext(const std::shared_ptr<State>& state);
+
+    std::shared_ptr<JobSystem> m_jobs;
+    std::shared_ptr<State> m_state;     // Shared with queued jobs, which may outlive us
+};
+
+} // namespace FinalStorm
@@ -0,0 +1,278 @@
+// src/World/Navigation/NavCell.cpp
+// Per-cell walkability and local search implementation
+
+#include "World/Navigation/NavCell.h"
+#include <algorithm>
+#include <cmath>
+
+namespace FinalStorm {
+
+namespace {
+
+// Longest stretch of open border served by one entrance
+constexpr int MaxEntranceSpan = 8;
+
+constexpr float Diagonal = 1.41421356f;
+
+struct Step {
+    int dx, dz;
+    float cost;     // In tiles
+};
+
+constexpr Step Steps[8] = {
+    { 1, 0, 1.0f }, { -1, 0, 1.0f }, { 0, 1, 1.0f }, { 0, -1, 1.0f },
+    { 1, 1, Diagonal }, { 1, -1, Diagonal }, { -1, 1, Diagonal }, { -1, -1, Diagonal },
+};
+
+bool heapOrder(const std::pair<float, int32_t>& a, const std::pair<float, int32_t>& b) {
+    return a.first > b.first;   // Min-heap on cost
+}
+
+float octile(int fromX, int fromZ, int toX, int toZ) {
+    int dx = std::abs(toX - fromX);
+    int dz = std::abs(toZ - fromZ);
+    return static_cast<float>(std::max(dx, dz)) + (Diagonal - 1.0f) * static_cast<float>(std::min(dx, dz));
+}
+
+bool tileWalkable(const CellGenerator& generator, int64_t tileX, int64_t tileZ, float maxRise) {
+    float x0 = tileX * NavCell::TileSize;
+    float z0 = tileZ * NavCell::TileSize;
+    float h00 = generator.getHeight(x0, z0);
+    float h10 = generator.getHeight(x0 + NavCell::TileSize, z0);
+    float h01 = generator.getHeight(x0, z0 + NavCell::TileSize);
+    float h11 = generator.getHeight(x0 + NavCell::TileSize, z0 + NavCell::TileSize);
+    float low = std::min(std::min(h00, h10), std::min(h01, h11));
+    float high = std::max(std::max(h00, h10), std::max(h01, h11));
+    return high - low <= maxRise;
+}
+
+int borderTile(NavCell::Side side, int offset) {
+    switch (side) {
+        case NavCell::NegX: return offset * NavCell::Size;
+        case NavCell::PosX: return offset * NavCell::Size + NavCell::Size - 1;
+        case NavCell::NegZ: return offset;
+        case NavCell::PosZ: return (NavCell::Size - 1) * NavCell::Size + offset;
+    }
+    return 0;
+}
+
+} // namespace
+
+void NavScratch::begin(size_t tileCount) {
+    if (cost.size() < tileCount) {
+        cost.resize(tileCount);
+        parent.resize(tileCount);
+        visited.assign(tileCount, 0);
+        generation = 0;
+    }
+    if (++generation == 0) {
+        std::fill(visited.begin(), visited.end(), 0);
+        generation = 1;
+    }
+    open.clear();
+}
+
+NavCell::NavCell(const CellGenerator& generator, const GridCoordinate& coord, float maxRise)
+    : m_coord(coord)
+    , m_walkable(TileCount, 0) {
+    CellBuffer cell;
+    generator.generate(coord, cell);
+
+    const int stride = CellBuffer::HeightResolution;
+    for (int z = 0; z < Size; ++z) {
+        for (int x = 0; x < Size; ++x) {
+            float h00 = cell.heights[z * stride + x];
+            float h10 = cell.heights[z * stride + x + 1];
+            float h01 = cell.heights[(z + 1) * stride + x];
+            float h11 = cell.heights[(z + 1) * stride + x + 1];
+            float low = std::min(std::min(h00, h10), std::min(h01, h11));
+            float high = std::max(std::max(h00, h10), std::max(h01, h11));
+            m_walkable[z * Size + x] = high - low <= maxRise ? 1 : 0;
+        }
+    }
+
+    // Entrances: runs of border where this side and the neighbour's facing
+    // tiles are both walkable. Both cells derive the same runs, so their
+    // entrances pair up by side and offset.
+    const int64_t originX = static_cast<int64_t>(coord.x) * Size;
+    const int64_t originZ = static_cast<int64_t>(coord.y) * Size;
+    for (Side side : { NegX, PosX, NegZ, PosZ }) {
+        bool open[Size];
+        for (int offset = 0; offset < Size; ++offset) {
+            int64_t outsideX = originX, outsideZ = originZ;
+            switch (side) {
+                case NegX: outsideX = originX - 1;    outsideZ = originZ + offset; break;
+                case PosX: outsideX = originX + Size; outsideZ = originZ + offset; break;
+                case NegZ: outsideX = originX + offset; outsideZ = originZ - 1;    break;
+                case PosZ: outsideX = originX + offset; outsideZ = originZ + Size; break;
+            }
+            open[offset] = isWalkable(borderTile(side, offset)) &&
+                           tileWalkable(generator, outsideX, outsideZ, maxRise);
+        }
+
+        for (int start = 0; start < Size;) {
+            if (!open[start]) {
+                ++start;
+                continue;
+            }
+            int end = start;
+            while (end < Size && open[end] && end - start < MaxEntranceSpan) {
+                ++end;
+            }
+            int middle = (start + end - 1) / 2;
+            m_entrances.push_back(Entrance{ static_cast<uint16_t>(borderTile(side, middle)), side, static_cast<uint8_t>(middle) });
+            start = end;
+        }
+    }
+
+    // Intra-cell edges between every pair of entrances
+    const size_t count = m_entrances.size();
+    m_entranceCosts.assign(count * count, -1.0f);
+    NavScratch scratch;
+    std::vector<float> costs;
+    for (size_t from = 0; from < count; ++from) {
+        getCostsToEntrances(m_entrances[from].tile, costs, scratch);
+        std::copy(costs.begin(), costs.end(), m_entranceCosts.begin() + from * count);
+    }
+}
+
+int NavCell::findEntrance(Side side, uint8_t offset) const {
+    for (size_t i = 0; i < m_entrances.size(); ++i) {
+        if (m_entrances[i].side == side && m_entrances[i].offset == offset) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+int NavCell::findWalkableNear(int tile, int radius) const {
+    if (isWalkable(tile)) return tile;
+
+    int tileX = tile % Size;
+    int tileZ = tile / Size;
+    int best = -1;
+    int bestDistance = radius * radius + 1;
+    for (int dz = -radius; dz <= radius; ++dz) {
+        for (int dx = -radius; dx <= radius; ++dx) {
+            int x = tileX + dx;
+            int z = tileZ + dz;
+            if (x < 0 || z < 0 || x >= Size || z >= Size) continue;
+            int distance = dx * dx + dz * dz;
+            if (distance < bestDistance && isWalkable(z * Size + x)) {
+                best = z * Size + x;
+                bestDistance = distance;
+            }
+        }
+    }
+    return best;
+}
+
+bool NavCell::findPath(int from, int to, std::vector<int>& tiles, NavScratch& scratch) const {
+    tiles.clear();
+    if (!isWalkable(from) || !isWalkable(to)) return false;
+    if (from == to) return true;
+
+    const int toX = to % Size;
+    const int toZ = to / Size;
+    scratch.begin(TileCount);
+    scratch.visited[from] = scratch.generation;
+    scratch.cost[from] = 0.0f;
+    scratch.parent[from] = -1;
+    scratch.open.push_back({ octile(from % Size, from / Size, toX, toZ), from });
+
+    while (!scratch.open.empty()) {
+        std::pop_heap(scratch.open.begin(), scratch.open.end(), heapOrder);
+        auto [priority, tile] = scratch.open.back();
+        scratch.open.pop_back();
+
+        const int x = tile % Size;
+        const int z = tile / Size;
+        if (priority > scratch.cost[tile] + octile(x, z, toX, toZ) + 1e-4f) continue;     // Stale entry
+
+        if (tile == to) {
+            for (int at = to; at != from; at = scratch.parent[at]) {
+                tiles.push_back(at);
+            }
+            std::reverse(tiles.begin(), tiles.end());
+            return true;
+        }
+
+        for (const Step& step : Steps) {
+            int nx = x + step.dx;
+            int nz = z + step.dz;
+            if (nx < 0 || nz < 0 || nx >= Size || nz >= Size) continue;
+            int next = nz * Size + nx;
+            if (!isWalkable(next)) continue;
+            // No cutting corners past unwalkable tiles
+            if (step.dx != 0 && step.dz != 0 && (!isWalkable(z * Size + nx) || !isWalkable(nz * Size + x))) continue;
+
+            float cost = scratch.cost[tile] + step.cost;
+            if (scratch.visited[next] == scratch.generation && cost >= scratch.cost[next]) continue;
+
+            scratch.visited[next] = scratch.generation;
+            scratch.cost[next] = cost;
+            scratch.parent[next] = tile;
+            scratch.open.push_back({ cost + octile(nx, nz, toX, toZ), next });
+            std::push_heap(scratch.open.begin(), scratch.open.end(), heapOrder);
+        }
+    }
+    return false;
+}
+
+void NavCell::getCostsToEntrances(int from, std::vector<float>& costs, NavScratch& scratch) const {
+    costs.assign(m_entrances.size(), -1.0f);
+    if (!isWalkable(from)) return;
+
+    flood(from, scratch);
+    for (size_t i = 0; i < m_entrances.size(); ++i) {
+        int tile = m_entrances[i].tile;
+        if (scratch.visited[tile] == scratch.generation) {
+            costs[i] = scratch.cost[tile] * TileSize;
+        }
+    }
+}
+
+void NavCell::flood(int from, NavScratch& scratch) const {
+    scratch.begin(TileCount);
+    scratch.visited[from] = scratch.generation;
+    scratch.cost[from] = 0.0f;
+    scratch.open.push_back({ 0.0f, from });
+
+    while (!scratch.open.empty()) {
+        std::pop_heap(scratch.open.begin(), scratch.open.end(), heapOrder);
+        auto [cost, tile] = scratch.open.back();
+        scratch.open.pop_back();
+        if (cost > scratch.cost[tile]) continue;
+
+        const int x = tile % Size;
+        const int z = tile / Size;
+        for (const Step& step : Steps) {
+            int nx = x + step.dx;
+            int nz = z + step.dz;
+            if (nx < 0 || nz < 0 || nx >= Size || nz >= Size) continue;
+            int next = nz * Size + nx;
+            if (!isWalkable(next)) continue;
+            if (step.dx != 0 && step.dz != 0 && (!isWalkable(z * Size + nx) || !isWalkable(nz * Size + x))) continue;
+
+            float nextCost = cost + step.cost;
+            if (scratch.visited[next] == scratch.generation && nextCost >= scratch.cost[next]) continue;
+
+            scratch.visited[next] = scratch.generation;
+            scratch.cost[next] = nextCost;
+            scratch.open.push_back({ nextCost, next });
+            std::push_heap(scratch.open.begin(), scratch.open.end(), heapOrder);
+        }
+    }
+}
+
+NavCell::Side NavCell::opposite(Side side) {
+    switch (side) {
+        case NegX: return PosX;
+        case PosX: return NegX;
+        case NegZ: return PosZ;
+        case PosZ: return NegZ;
+    }
+    return side;
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,73 @@
+// src/World/Navigation/NavCell.h
+// Walkability grid and local search for one world grid cell
+// Built from CellGenerator terrain; immutable once built, so any number of
+// path queries may share it
+
+#pragma once
+
+#include "World/CellGenerator.h"
+#include <cstdint>
+#include <vector>
+
+namespace FinalStorm {
+
+// Per-thread buffers for local searches
+struct NavScratch {
+    std::vector<float> cost;
+    std::vector<int32_t> parent;
+    std::vector<uint32_t> visited;      // Equals generation when touched this search
+    std::vector<std::pair<float, int32_t>> open;
+    uint32_t generation = 0;
+
+    void begin(size_t tileCount);
+};
+
+class NavCell {
+public:
+    static constexpr int Size = CellBuffer::HeightResolution - 1;       // Tiles per side
+    static constexpr int TileCount = Size * Size;
+    static constexpr float TileSize = CellGenerator::CellSize / Size;   // World units
+
+    enum Side : uint8_t { NegX, PosX, NegZ, PosZ };
+
+    // A border tile with a walkable partner tile in the neighbouring cell
+    struct Entrance {
+        uint16_t tile;      // Local index, z * Size + x
+        Side side;
+        uint8_t offset;     // Position along the border
+    };
+
+    // maxRise: largest height difference across one tile that is still walkable
+    NavCell(const CellGenerator& generator, const GridCoordinate& coord, float maxRise);
+
+    const GridCoordinate& getCoordinate() const { return m_coord; }
+    bool isWalkable(int tile) const { return m_walkable[tile] != 0; }
+
+    const std::vector<Entrance>& getEntrances() const { return m_entrances; }
+    int findEntrance(Side side, uint8_t offset) const;
+
+    // Walking cost between two entrances of this cell, negative if unreachable
+    float getEntranceCost(size_t from, size_t to) const { return m_entranceCosts[from * m_entrances.size() + to]; }
+
+    // Nearest walkable tile within radius tiles, or -1
+    int findWalkableNear(int tile, int radius) const;
+
+    // A* between two tiles of this cell; tiles gets the route excluding from
+    bool findPath(int from, int to, std::vector<int>& tiles, NavScratch& scratch) const;
+
+    // Walking cost from a tile to every entrance, negative if unreachable
+    void getCostsToEntrances(int from, std::vector<float>& costs, NavScratch& scratch) const;
+
+    static Side opposite(Side side);
+
+private:
+    // Dijkstra over the whole cell; leaves costs in scratch
+    void flood(int from, NavScratch& scratch) const;
+
+    GridCoordinate m_coord;
+    std::vector<uint8_t> m_walkable;
+    std::vector<Entrance> m_entrances;
+    std::vector<float> m_entranceCosts;
+};
+
+} // namespace FinalStorm
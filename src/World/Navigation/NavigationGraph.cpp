@@ -0,0 +1,388 @@
+// src/World/Navigation/NavigationGraph.cpp
+// Hierarchical path search implementation
+
+#include "World/Navigation/NavigationGraph.h"
+#include <algorithm>
+#include <cmath>
+
+namespace FinalStorm {
+
+namespace {
+
+// Start and goal tiles are snapped this far to reach walkable ground
+constexpr int SnapRadius = 3;
+
+// Starts and goals in the same block of tiles share a cached corridor. A
+// block never straddles a cell, so the cached first and last entrances stay
+// in the right cells.
+constexpr int CorridorBlockShift = 2;
+static_assert(NavCell::Size % (1 << CorridorBlockShift) == 0, "Corridor blocks must tile a cell");
+
+int64_t floorDiv(int64_t value, int64_t divisor) {
+    int64_t result = value / divisor;
+    return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? result - 1 : result;
+}
+
+int64_t worldToTile(float value) {
+    return static_cast<int64_t>(std::floor(value / NavCell::TileSize));
+}
+
+int localTile(int64_t tileX, int64_t tileZ, const GridCoordinate& cell) {
+    int x = static_cast<int>(tileX - static_cast<int64_t>(cell.x) * NavCell::Size);
+    int z = static_cast<int>(tileZ - static_cast<int64_t>(cell.y) * NavCell::Size);
+    return z * NavCell::Size + x;
+}
+
+GridCoordinate neighbour(const GridCoordinate& cell, NavCell::Side side) {
+    switch (side) {
+        case NavCell::NegX: return GridCoordinate(cell.x - 1, cell.y);
+        case NavCell::PosX: return GridCoordinate(cell.x + 1, cell.y);
+        case NavCell::NegZ: return GridCoordinate(cell.x, cell.y - 1);
+        case NavCell::PosZ: return GridCoordinate(cell.x, cell.y + 1);
+    }
+    return cell;
+}
+
+// Abstract search node: an entrance of a cell, or the start or goal tile
+struct NodeKey {
+    int32_t cellX;
+    int32_t cellZ;
+    int32_t entrance;
+
+    bool operator==(const NodeKey& other) const {
+        return cellX == other.cellX && cellZ == other.cellZ && entrance == other.entrance;
+    }
+};
+
+constexpr int32_t StartNode = -1;
+constexpr int32_t GoalNode = -2;
+
+struct NodeKeyHash {
+    size_t operator()(const NodeKey& key) const {
+        uint64_t value = (static_cast<uint64_t>(static_cast<uint32_t>(key.cellX)) << 32) ^ static_cast<uint32_t>(key.cellZ);
+        value = value * 0x9e3779b97f4a7c15ULL ^ static_cast<uint32_t>(key.entrance);
+        return static_cast<size_t>(value ^ (value >> 29));
+    }
+};
+
+struct NodeRecord {
+    float cost;
+    NodeKey parent;
+    bool closed;
+};
+
+} // namespace
+
+NavigationGraph::NavigationGraph(const CellGenerator& generator)
+    : NavigationGraph(generator, Config()) {
+}
+
+NavigationGraph::NavigationGraph(const CellGenerator& generator, const Config& config)
+    : m_generator(generator)
+    , m_config(config) {
+}
+
+GridCoordinate NavigationGraph::cellOf(int64_t tileX, int64_t tileZ) {
+    return GridCoordinate(static_cast<int32_t>(floorDiv(tileX, NavCell::Size)),
+                          static_cast<int32_t>(floorDiv(tileZ, NavCell::Size)));
+}
+
+vec3 NavigationGraph::tileCenter(int64_t tileX, int64_t tileZ) const {
+    float x = (static_cast<float>(tileX) + 0.5f) * NavCell::TileSize;
+    float z = (static_cast<float>(tileZ) + 0.5f) * NavCell::TileSize;
+    return make_vec3(x, m_generator.getHeight(x, z), z);
+}
+
+std::shared_ptr<const NavCell> NavigationGraph::getCell(const GridCoordinate& coord) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_cells.find(coord);
+        if (it != m_cells.end()) {
+            m_cellOrder.splice(m_cellOrder.end(), m_cellOrder, it->second);
+            return it->second->second;
+        }
+    }
+
+    // Built outside the lock; two threads racing on one cell build the same thing
+    auto cell = std::make_shared<const NavCell>(m_generator, coord, m_config.maxRise);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_cells.find(coord);
+    if (it != m_cells.end()) {
+        return it->second->second;
+    }
+    m_stats.cellsBuilt++;
+    m_cellOrder.emplace_back(coord, cell);
+    m_cells.emplace(coord, std::prev(m_cellOrder.end()));
+    while (m_cells.size() > m_config.cellCacheSize) {
+        m_cells.erase(m_cellOrder.front().first);
+        m_cellOrder.pop_front();
+    }
+    return cell;
+}
+
+bool NavigationGraph::findPath(const vec3& from, const vec3& to, size_t refineSegments, bool useCache,
+                               NavPath& path, NavScratch& scratch) {
+    path = NavPath();
+
+    int64_t startX = worldToTile(from.x), startZ = worldToTile(from.z);
+    int64_t goalX = worldToTile(to.x), goalZ = worldToTile(to.z);
+    GridCoordinate startCell = cellOf(startX, startZ);
+    GridCoordinate goalCell = cellOf(goalX, goalZ);
+
+    // Snap both ends onto walkable tiles
+    auto snap = [this](int64_t& tileX, int64_t& tileZ, const GridCoordinate& cellCoord) {
+        auto cell = getCell(cellCoord);
+        int tile = cell->findWalkableNear(localTile(tileX, tileZ, cellCoord), SnapRadius);
+        if (tile < 0) return false;
+        tileX = static_cast<int64_t>(cellCoord.x) * NavCell::Size + tile % NavCell::Size;
+        tileZ = static_cast<int64_t>(cellCoord.y) * NavCell::Size + tile / NavCell::Size;
+        return true;
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats.searches++;
+    }
+    if (!snap(startX, startZ, startCell) || !snap(goalX, goalZ, goalCell)) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats.failures++;
+        return false;
+    }
+
+    vec3 start = tileCenter(startX, startZ);
+    vec3 goal = tileCenter(goalX, goalZ);
+
+    // Same cell: try the local route first; it may still need to leave the cell
+    if (startCell == goalCell) {
+        path.corridor = { start, goal };
+        if (refine(path, 1, scratch)) return true;
+        path = NavPath();
+    }
+
+    uint64_t key = (static_cast<uint64_t>((startX >> CorridorBlockShift) & 0xFFFF) << 48) |
+                   (static_cast<uint64_t>((startZ >> CorridorBlockShift) & 0xFFFF) << 32) |
+                   (static_cast<uint64_t>((goalX >> CorridorBlockShift) & 0xFFFF) << 16) |
+                    static_cast<uint64_t>((goalZ >> CorridorBlockShift) & 0xFFFF);
+
+    std::vector<vec3> entrances;
+    bool cached = useCache && lookupCorridor(key, entrances);
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        if (!cached && !searchCorridor(start, goal, entrances, scratch)) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stats.failures++;
+            return false;
+        }
+
+        path.corridor.clear();
+        path.corridor.reserve(entrances.size() + 2);
+        path.corridor.push_back(start);
+        path.corridor.insert(path.corridor.end(), entrances.begin(), entrances.end());
+        path.corridor.push_back(goal);
+        path.points.clear();
+        path.refinedSegments = 0;
+
+        if (refine(path, refineSegments, scratch)) {
+            if (useCache && !cached) storeCorridor(key, entrances);
+            return true;
+        }
+        if (!cached) break;
+        cached = false;     // A neighbour's corridor did not fit this start; search properly
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.failures++;
+    return false;
+}
+
+bool NavigationGraph::refine(NavPath& path, size_t segments, NavScratch& scratch) {
+    std::vector<int> tiles;
+    while (segments-- > 0 && !path.isFullyRefined()) {
+        const vec3& from = path.corridor[path.refinedSegments];
+        const vec3& to = path.corridor[path.refinedSegments + 1];
+
+        int64_t fromX = worldToTile(from.x), fromZ = worldToTile(from.z);
+        int64_t toX = worldToTile(to.x), toZ = worldToTile(to.z);
+        GridCoordinate fromCell = cellOf(fromX, fromZ);
+        GridCoordinate toCell = cellOf(toX, toZ);
+
+        if (fromCell != toCell) {
+            // Entrance to its partner across the border: one step
+            path.points.push_back(to);
+        } else {
+            auto cell = getCell(fromCell);
+            if (!cell->findPath(localTile(fromX, fromZ, fromCell), localTile(toX, toZ, toCell), tiles, scratch)) {
+                return false;
+            }
+            int64_t originX = static_cast<int64_t>(fromCell.x) * NavCell::Size;
+            int64_t originZ = static_cast<int64_t>(fromCell.y) * NavCell::Size;
+            for (int tile : tiles) {
+                path.points.push_back(tileCenter(originX + tile % NavCell::Size, originZ + tile / NavCell::Size));
+            }
+        }
+        path.refinedSegments++;
+    }
+    return true;
+}
+
+bool NavigationGraph::searchCorridor(const vec3& from, const vec3& to, std::vector<vec3>& entrances, NavScratch& scratch) {
+    entrances.clear();
+
+    int64_t startX = worldToTile(from.x), startZ = worldToTile(from.z);
+    int64_t goalX = worldToTile(to.x), goalZ = worldToTile(to.z);
+    GridCoordinate startCoord = cellOf(startX, startZ);
+    GridCoordinate goalCoord = cellOf(goalX, goalZ);
+
+    // Cells touched by this search, so each is fetched from the cache once
+    std::unordered_map<GridCoordinate, std::shared_ptr<const NavCell>, GridCoordinateHash> cells;
+    auto cellAt = [&](const GridCoordinate& coord) -> const NavCell& {
+        auto& cell = cells[coord];
+        if (!cell) cell = getCell(coord);
+        return *cell;
+    };
+
+    std::vector<float> startCosts, goalCosts;
+    cellAt(startCoord).getCostsToEntrances(localTile(startX, startZ, startCoord), startCosts, scratch);
+    cellAt(goalCoord).getCostsToEntrances(localTile(goalX, goalZ, goalCoord), goalCosts, scratch);
+
+    auto entranceTile = [&](const NodeKey& node, int64_t& tileX, int64_t& tileZ) {
+        const NavCell::Entrance& entrance = cellAt(GridCoordinate(node.cellX, node.cellZ)).getEntrances()[node.entrance];
+        tileX = static_cast<int64_t>(node.cellX) * NavCell::Size + entrance.tile % NavCell::Size;
+        tileZ = static_cast<int64_t>(node.cellZ) * NavCell::Size + entrance.tile / NavCell::Size;
+    };
+    auto heuristic = [&](int64_t tileX, int64_t tileZ) {
+        float dx = static_cast<float>(goalX - tileX);
+        float dz = static_cast<float>(goalZ - tileZ);
+        return std::sqrt(dx * dx + dz * dz) * NavCell::TileSize;
+    };
+
+    std::unordered_map<NodeKey, NodeRecord, NodeKeyHash> records;
+    std::vector<std::pair<float, NodeKey>> open;
+    auto openOrder = [](const std::pair<float, NodeKey>& a, const std::pair<float, NodeKey>& b) { return a.first > b.first; };
+
+    auto relax = [&](const NodeKey& node, const NodeKey& parent, float cost, float estimate) {
+        auto it = records.find(node);
+        if (it != records.end() && (it->second.closed || cost >= it->second.cost)) return;
+        records[node] = NodeRecord{ cost, parent, false };
+        open.push_back({ cost + estimate, node });
+        std::push_heap(open.begin(), open.end(), openOrder);
+    };
+
+    const NodeKey start{ startCoord.x, startCoord.y, StartNode };
+    const NodeKey goal{ goalCoord.x, goalCoord.y, GoalNode };
+    records[start] = NodeRecord{ 0.0f, start, false };
+    open.push_back({ heuristic(startX, startZ), start });
+
+    size_t expanded = 0;
+    bool found = false;
+    while (!open.empty()) {
+        std::pop_heap(open.begin(), open.end(), openOrder);
+        NodeKey node = open.back().second;
+        open.pop_back();
+
+        NodeRecord& record = records[node];
+        if (record.closed) continue;
+        record.closed = true;
+        float cost = record.cost;
+
+        if (node == goal) {
+            found = true;
+            break;
+        }
+        if (++expanded > m_config.maxExpandedNodes) break;
+
+        GridCoordinate coord(node.cellX, node.cellZ);
+        const NavCell& cell = cellAt(coord);
+        const auto& cellEntrances = cell.getEntrances();
+
+        if (node.entrance == StartNode) {
+            for (size_t i = 0; i < cellEntrances.size(); ++i) {
+                if (startCosts[i] < 0.0f) continue;
+                NodeKey next{ coord.x, coord.y, static_cast<int32_t>(i) };
+                int64_t tileX, tileZ;
+                entranceTile(next, tileX, tileZ);
+                relax(next, node, cost + startCosts[i], heuristic(tileX, tileZ));
+            }
+            continue;
+        }
+
+        const NavCell::Entrance& entrance = cellEntrances[node.entrance];
+
+        // Across the border to the partner entrance
+        GridCoordinate across = neighbour(coord, entrance.side);
+        int partner = cellAt(across).findEntrance(NavCell::opposite(entrance.side), entrance.offset);
+        if (partner >= 0) {
+            NodeKey next{ across.x, across.y, partner };
+            int64_t tileX, tileZ;
+            entranceTile(next, tileX, tileZ);
+            relax(next, node, cost + NavCell::TileSize, heuristic(tileX, tileZ));
+        }
+
+        // Through the cell to its other entrances
+        for (size_t i = 0; i < cellEntrances.size(); ++i) {
+            float edge = cell.getEntranceCost(node.entrance, i);
+            if (edge < 0.0f || static_cast<int32_t>(i) == node.entrance) continue;
+            NodeKey next{ coord.x, coord.y, static_cast<int32_t>(i) };
+            int64_t tileX, tileZ;
+            entranceTile(next, tileX, tileZ);
+            relax(next, node, cost + edge, heuristic(tileX, tileZ));
+        }
+
+        if (coord == goalCoord && goalCosts[node.entrance] >= 0.0f) {
+            relax(goal, node, cost + goalCosts[node.entrance], 0.0f);
+        }
+    }
+
+    if (!found) return false;
+
+    for (NodeKey node = records[goal].parent; !(node == start); node = records[node].parent) {
+        int64_t tileX, tileZ;
+        entranceTile(node, tileX, tileZ);
+        entrances.push_back(tileCenter(tileX, tileZ));
+    }
+    std::reverse(entrances.begin(), entrances.end());
+    return true;
+}
+
+bool NavigationGraph::lookupCorridor(uint64_t key, std::vector<vec3>& entrances) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_corridors.find(key);
+    if (it == m_corridors.end()) return false;
+
+    m_corridorOrder.splice(m_corridorOrder.end(), m_corridorOrder, it->second);
+    entrances = it->second->second.entrances;
+    m_stats.cacheHits++;
+    return true;
+}
+
+void NavigationGraph::storeCorridor(uint64_t key, const std::vector<vec3>& entrances) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_corridors.find(key);
+    if (it != m_corridors.end()) {
+        it->second->second.entrances = entrances;
+        m_corridorOrder.splice(m_corridorOrder.end(), m_corridorOrder, it->second);
+        return;
+    }
+
+    m_corridorOrder.emplace_back(key, Corridor{ entrances });
+    m_corridors.emplace(key, std::prev(m_corridorOrder.end()));
+    while (m_corridors.size() > m_config.pathCacheSize) {
+        m_corridors.erase(m_corridorOrder.front().first);
+        m_corridorOrder.pop_front();
+    }
+}
+
+NavigationGraph::Stats NavigationGraph::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void NavigationGraph::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cells.clear();
+    m_cellOrder.clear();
+    m_corridors.clear();
+    m_corridorOrder.clear();
+}
+
+} // namespace FinalStorm
@@ -0,0 +1,90 @@
+// src/World/Navigation/NavigationGraph.h
+// Hierarchical (HPA*-style) path search across world grid cells
+// Searches run over cell entrances first; the tile-level route is filled
+// in per cell, a few cells at a time, as the walker gets there
+
+#pragma once
+
+#include "World/Navigation/NavCell.h"
+#include "Core/Math/MathTypes.h"
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace FinalStorm {
+
+struct NavPath {
+    std::vector<vec3> corridor;     // Start, cell entrances in walking order, goal
+    std::vector<vec3> points;       // Tile-level route for the refined prefix of the corridor
+    size_t refinedSegments = 0;
+
+    bool isFullyRefined() const { return corridor.size() < 2 || refinedSegments >= corridor.size() - 1; }
+    const vec3& getGoal() const { return corridor.back(); }
+};
+
+class NavigationGraph {
+public:
+    struct Config {
+        float maxRise = 3.0f;           // Steepest walkable tile, height change across one tile
+        size_t maxExpandedNodes = 4096; // Abstract search gives up past this
+        size_t cellCacheSize = 1024;
+        size_t pathCacheSize = 1024;
+    };
+
+    struct Stats {
+        size_t cellsBuilt = 0;
+        size_t searches = 0;
+        size_t cacheHits = 0;
+        size_t failures = 0;
+    };
+
+    explicit NavigationGraph(const CellGenerator& generator);
+    NavigationGraph(const CellGenerator& generator, const Config& config);
+
+    // All public members are safe to call from several threads at once
+
+    // Builds the corridor and refines its first refineSegments segments.
+    // useCache lets nearby starts toward nearby goals share one corridor.
+    bool findPath(const vec3& from, const vec3& to, size_t refineSegments, bool useCache,
+                  NavPath& path, NavScratch& scratch);
+
+    // Refines up to segments more corridor segments; false if one is blocked
+    bool refine(NavPath& path, size_t segments, NavScratch& scratch);
+
+    std::shared_ptr<const NavCell> getCell(const GridCoordinate& coord);
+
+    Stats getStats() const;
+    void clear();
+
+    static GridCoordinate cellOf(int64_t tileX, int64_t tileZ);
+
+private:
+    struct Corridor {
+        std::vector<vec3> entrances;
+    };
+
+    bool searchCorridor(const vec3& from, const vec3& to, std::vector<vec3>& entrances, NavScratch& scratch);
+    vec3 tileCenter(int64_t tileX, int64_t tileZ) const;
+
+    bool lookupCorridor(uint64_t key, std::vector<vec3>& entrances);
+    void storeCorridor(uint64_t key, const std::vector<vec3>& entrances);
+
+    CellGenerator m_generator;
+    Config m_config;
+
+    mutable std::mutex m_mutex;
+    Stats m_stats;
+
+    // Least recently used first
+    using CellList = std::list<std::pair<GridCoordinate, std::shared_ptr<const NavCell>>>;
+    CellList m_cellOrder;
+    std::unordered_map<GridCoordinate, CellList::iterator, GridCoordinateHash> m_cells;
+
+    using CorridorList = std::list<std::pair<uint64_t, Corridor>>;
+    CorridorList m_corridorOrder;
+    std::unordered_map<uint64_t, CorridorList::iterator> m_corridors;
+};
+
+} // namespace FinalStorm
@@ -0,0 +1,290 @@
+// src/World/Navigation/NavigationSystem.cpp
+// Asynchronous path queries and Chase/Attack movement implementation
+
+#include "World/Navigation/NavigationSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
+namespace FinalStorm {
+
+namespace {
+
+// Refinement is requested while this many refined points are still ahead,
+// so the walker rarely waits at the end of the refined prefix
+constexpr size_t RefineLead = 8;
+
+// Hysteresis so an NPC at the edge of range does not flip every frame
+constexpr float AttackLeaveFactor = 1.5f;
+
+float distanceXZ(const vec3& a, const vec3& b) {
+    float dx = b.x - a.x;
+    float dz = b.z - a.z;
+    return std::sqrt(dx * dx + dz * dz);
+}
+
+// Moves position toward target by at most budget, which is reduced by the
+// distance covered; returns the distance still left to target
+float stepToward(vec3& position, const vec3& target, float& budget) {
+    vec3 delta = make_vec3(target.x - position.x, target.y - position.y, target.z - position.z);
+    float distance = std::sqrt(delta.x * delta.x + delta.y * delta.y + delta.z * delta.z);
+    float step = std::min(budget, distance);
+    if (distance > 1e-6f) {
+        float scale = step / distance;
+        position.x += delta.x * scale;
+        position.y += delta.y * scale;
+        position.z += delta.z * scale;
+    }
+    budget -= step;
+    return distance - step;
+}
+
+} // namespace
+
+struct NavigationSystem::State {
+    std::shared_ptr<NavigationGraph> graph;
+
+    std::mutex mutex;
+    std::deque<Query> completed;
+    bool shutdown = false;
+};
+
+NavigationSystem::NavigationSystem(std::shared_ptr<JobSystem> jobs, const CellGenerator& generator)
+    : NavigationSystem(std::move(jobs), generator, Config()) {
+}
+
+NavigationSystem::NavigationSystem(std::shared_ptr<JobSystem> jobs, const CellGenerator& generator, const Config& config)
+    : m_jobs(std::move(jobs))
+    , m_state(std::make_shared<State>())
+    , m_config(config)
+    , m_inFlight(0)
+    , m_nextSequence(1)
+    , m_frame(0) {
+    m_state->graph = std::make_shared<NavigationGraph>(generator);
+}
+
+NavigationSystem::~NavigationSystem() {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    m_state->shutdown = true;
+    m_state->completed.clear();
+}
+
+void NavigationSystem::requestPath(uint32_t entityId, const vec3& from, const vec3& to) {
+    Agent& agent = m_agents[entityId];
+    agent.sequence = m_nextSequence++;
+    agent.waiting = true;
+    agent.plannedTarget = to;
+    agent.sinceRepath = 0.0f;
+    agent.lastSeenFrame = m_frame;
+
+    Query query;
+    query.entityId = entityId;
+    query.sequence = agent.sequence;
+    query.kind = QueryKind::Find;
+    query.segments = m_config.refineAhead;
+    query.from = from;
+    query.to = to;
+    m_pending.push_back(std::move(query));
+}
+
+void NavigationSystem::requestRefine(uint32_t entityId, Agent& agent) {
+    agent.waiting = true;
+
+    Query query;
+    query.entityId = entityId;
+    query.sequence = agent.sequence;
+    query.kind = QueryKind::Refine;
+    query.segments = m_config.refineAhead;
+    query.from = agent.path.corridor.front();
+    query.to = agent.path.getGoal();
+    query.path = agent.path;
+    m_pending.push_back(std::move(query));
+}
+
+const NavPath* NavigationSystem::getPath(uint32_t entityId) const {
+    auto it = m_agents.find(entityId);
+    return it != m_agents.end() && it->second.hasPath ? &it->second.path : nullptr;
+}
+
+NavigationGraph& NavigationSystem::getGraph() {
+    return *m_state->graph;
+}
+
+void NavigationSystem::runQuery(const std::shared_ptr<State>& state, Query query) {
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->shutdown) return;
+    }
+
+    // Searches reuse their buffers across queries on the same worker
+    thread_local NavScratch scratch;
+    if (query.kind == QueryKind::Find) {
+        query.succeeded = state->graph->findPath(query.from, query.to, query.segments, true, query.path, scratch);
+    } else {
+        query.succeeded = state->graph->refine(query.path, query.segments, scratch);
+    }
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (!state->shutdown) {
+        state->completed.push_back(std::move(query));
+    }
+}
+
+void NavigationSystem::update(EntityRegistry& registry, float deltaTime) {
+    m_frame++;
+    m_stats = Stats();
+
+    applyResults();
+
+    registry.forEachTable<TransformComponent, AIComponent>(
+        [&](size_t count, const uint32_t* ids, const EntityType*,
+            TransformComponent* transforms, AIComponent* ai) {
+            for (size_t i = 0; i < count; ++i) {
+                if (ai[i].state != AIState::Chase && ai[i].state != AIState::Attack) continue;
+
+                const TransformComponent* target = ai[i].targetId != ids[i] ? registry.get<TransformComponent>(ai[i].targetId) : nullptr;
+                if (!target) {
+                    ai[i].state = AIState::Idle;
+                    continue;
+                }
+
+                const vec3 targetPosition = target->position;
+                float distance = distanceXZ(transforms[i].position, targetPosition);
+                if (ai[i].state == AIState::Attack) {
+                    // Holds position while the target stays in reach
+                    if (distance > m_config.attackRange * AttackLeaveFactor) {
+                        ai[i].state = AIState::Chase;
+                    }
+                    continue;
+                }
+                if (distance <= m_config.attackRange) {
+                    ai[i].state = AIState::Attack;
+                    continue;
+                }
+
+                moveAgent(ids[i], transforms[i], ai[i], targetPosition, deltaTime);
+            }
+        });
+
+    // Forget agents that stopped chasing or no longer exist
+    for (auto it = m_agents.begin(); it != m_agents.end();) {
+        if (it->second.lastSeenFrame != m_frame) {
+            it = m_agents.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    submitPending();
+
+    m_stats.agents = m_agents.size();
+    m_stats.inFlight = m_inFlight;
+}
+
+void NavigationSystem::moveAgent(uint32_t entityId, TransformComponent& transform, AIComponent& ai,
+                                 const vec3& targetPosition, float deltaTime) {
+    auto inserted = m_agents.emplace(entityId, Agent());
+    Agent& agent = inserted.first->second;
+    if (inserted.second) {
+        agent.sinceRepath = m_config.repathInterval;    // Plan right away
+    }
+    agent.lastSeenFrame = m_frame;
+    agent.sinceRepath += deltaTime;
+
+    bool targetMoved = agent.hasPath && distanceXZ(targetPosition, agent.plannedTarget) > m_config.repathDistance;
+    if (!agent.waiting && (agent.sinceRepath >= m_config.repathInterval || targetMoved)) {
+        requestPath(entityId, transform.position, targetPosition);
+    }
+
+    // Keeps following the old path while a new one is planned
+    float budget = ai.moveSpeed * deltaTime;
+    vec3 position = transform.position;
+    if (agent.hasPath) {
+        const std::vector<vec3>& points = agent.path.points;
+        while (budget > 0.0f && agent.nextPoint < points.size()) {
+            if (stepToward(position, points[agent.nextPoint], budget) < m_config.arriveDistance) {
+                agent.nextPoint++;
+            }
+        }
+
+        if (!agent.path.isFullyRefined() && !agent.waiting && points.size() - agent.nextPoint < RefineLead) {
+            requestRefine(entityId, agent);
+        }
+    }
+
+    // Last stretch, or a target close enough that no path is needed
+    bool pathDone = agent.hasPath && agent.path.isFullyRefined() && agent.nextPoint >= agent.path.points.size();
+    bool adjacent = distanceXZ(position, targetPosition) < NavCell::TileSize * 2.0f;
+    if (budget > 0.0f && (pathDone || adjacent)) {
+        float approach = std::max(0.0f, distanceXZ(position, targetPosition) - m_config.attackRange * 0.5f);
+        budget = std::min(budget, approach);
+        stepToward(position, targetPosition, budget);
+    }
+
+    transform.position = position;
+}
+
+void NavigationSystem::applyResults() {
+    std::deque<Query> results;
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        size_t count = std::min(m_config.maxResultsPerFrame, m_state->completed.size());
+        for (size_t i = 0; i < count; ++i) {
+            results.push_back(std::move(m_state->completed.front()));
+            m_state->completed.pop_front();
+        }
+        m_stats.backlog = m_state->completed.size();
+    }
+    m_inFlight -= results.size();
+
+    for (Query& query : results) {
+        auto it = m_agents.find(query.entityId);
+        if (it == m_agents.end() || it->second.sequence != query.sequence) {
+            m_stats.stale++;
+            continue;
+        }
+
+        Agent& agent = it->second;
+        agent.waiting = false;
+        if (!query.succeeded) {
+            m_stats.failed++;
+            if (query.kind == QueryKind::Find) {
+                agent.hasPath = false;          // Tries again after repathInterval
+            } else {
+                agent.sinceRepath = m_config.repathInterval;  // Blocked ahead; re-plan now
+            }
+            continue;
+        }
+
+        // A refined path only grows, so the walker's place in it stays valid
+        if (query.kind == QueryKind::Find) {
+            agent.nextPoint = 0;
+            agent.hasPath = true;
+        }
+        agent.path = std::move(query.path);
+        m_stats.applied++;
+    }
+}
+
+void NavigationSystem::submitPending() {
+    while (!m_pending.empty() && m_inFlight < m_config.maxInFlight) {
+        Query query = std::move(m_pending.front());
+        m_pending.pop_front();
+
+        // Superseded while it waited for a slot
+        auto it = m_agents.find(query.entityId);
+        if (it == m_agents.end() || it->second.sequence != query.sequence) {
+            m_stats.stale++;
+            continue;
+        }
+
+        m_inFlight++;
+        m_stats.submitted++;
+        std::shared_ptr<State> state = m_state;
+        m_jobs->submit([state, query = std::move(query)]() mutable {
+            runQuery(state, std::move(query));
+        });
+    }
+}
+
+} // namespace FinalStorm
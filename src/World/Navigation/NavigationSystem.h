@@ -0,0 +1,105 @@
+// src/World/Navigation/NavigationSystem.h
+// Asynchronous path queries and Chase/Attack movement for component NPCs
+// Searches run on JobSystem workers; finished paths are applied on the main
+// thread, a bounded number per frame
+
+#pragma once
+
+#include "World/Navigation/NavigationGraph.h"
+#include "World/ECS/EntityRegistry.h"
+#include "Core/JobSystem.h"
+#include <deque>
+#include <memory>
+#include <unordered_map>
+
+namespace FinalStorm {
+
+class NavigationSystem {
+public:
+    struct Config {
+        size_t maxResultsPerFrame = 32;     // Finished queries applied per update
+        size_t maxInFlight = 64;            // Queries queued on workers at once
+        float repathInterval = 1.0f;        // Seconds before a chaser re-plans regardless
+        float repathDistance = 16.0f;       // Target movement that forces a re-plan
+        float attackRange = 2.0f;
+        float arriveDistance = 0.5f;        // Close enough to a path point to take the next
+        size_t refineAhead = 2;             // Corridor segments refined per query
+    };
+
+    struct Stats {
+        size_t agents = 0;
+        size_t submitted = 0;
+        size_t applied = 0;
+        size_t stale = 0;           // Superseded before they were applied
+        size_t failed = 0;
+        size_t backlog = 0;         // Finished but over this frame's budget
+        size_t inFlight = 0;
+    };
+
+    NavigationSystem(std::shared_ptr<JobSystem> jobs, const CellGenerator& generator);
+    NavigationSystem(std::shared_ptr<JobSystem> jobs, const CellGenerator& generator, const Config& config);
+
+    // Results of queries still running are discarded on their worker
+    ~NavigationSystem();
+
+    void setConfig(const Config& config) { m_config = config; }
+    const Config& getConfig() const { return m_config; }
+
+    // Plans a path for an entity, replacing any it already has or is waiting for
+    void requestPath(uint32_t entityId, const vec3& from, const vec3& to);
+
+    // Applies finished queries, then moves every Chase/Attack NPC (main thread)
+    void update(EntityRegistry& registry, float deltaTime);
+
+    const NavPath* getPath(uint32_t entityId) const;
+    const Stats& getStats() const { return m_stats; }
+    NavigationGraph& getGraph();
+
+private:
+    enum class QueryKind : uint8_t { Find, Refine };
+
+    struct Query {
+        uint32_t entityId;
+        uint32_t sequence;      // Matches the agent's while the query is current
+        QueryKind kind;
+        size_t segments;        // Corridor segments to refine
+        vec3 from;
+        vec3 to;
+        NavPath path;           // Refine: the path to extend; both: the result
+        bool succeeded = false;
+    };
+
+    struct State;
+
+    struct Agent {
+        NavPath path;
+        size_t nextPoint = 0;
+        uint32_t sequence = 0;      // Of the current path request; never reused across agents
+        bool hasPath = false;
+        bool waiting = false;       // A query for this agent is queued or running
+        vec3 plannedTarget;         // Target position the path was planned toward
+        float sinceRepath = 0.0f;
+        uint64_t lastSeenFrame = 0;
+    };
+
+    static void runQuery(const std::shared_ptr<State>& state, Query query);
+
+    void submitPending();
+    void applyResults();
+    void moveAgent(uint32_t entityId, TransformComponent& transform, AIComponent& ai,
+                   const vec3& targetPosition, float deltaTime);
+    void requestRefine(uint32_t entityId, Agent& agent);
+
+    std::shared_ptr<JobSystem> m_jobs;
+    std::shared_ptr<State> m_state;     // Shared with queued jobs, which may outlive us
+    Config m_config;
+    Stats m_stats;
+
+    std::deque<Query> m_pending;        // Waiting for an in-flight slot
+    std::unordered_map<uint32_t, Agent> m_agents;
+    size_t m_inFlight;
+    uint32_t m_nextSequence;            // System-wide, so a dropped and re-created agent cannot match an old query
+    uint64_t m_frame;
+};
+
+} // namespace FinalStorm
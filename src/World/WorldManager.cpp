@@ -4,45 +4,31 @@
 
 #include "World/WorldManager.h"
 #include "World/Entity.h"
+#include "World/ECS/Systems.h"
 #include "Core/Math/Math.h"
 #include "Core/Math/Camera.h"
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstdlib>
 
 namespace FinalStorm {
 
-// Grid implementation
-Grid::Grid(const GridCoordinate& coord)
-    : coordinate(coord) {
-}
-
-void Grid::addEntity(EntityPtr entity) {
-    if (entity) {
-        entities.push_back(entity);
-    }
-}
-
-void Grid::removeEntity(uint32_t entityId) {
-    entities.erase(
-        std::remove_if(entities.begin(), entities.end(),
-            [entityId](const EntityPtr& entity) {
-                return entity->getId() == entityId;
-            }),
-        entities.end()
-    );
-}
-
 // WorldManager implementation
 WorldManager::WorldManager() 
     : currentGrid(0, 0)
-    , viewDistance(3) {
+    , lastPlayerPosition(make_vec3(0.0f, 0.0f, 0.0f))
+    , travelDirectionX(0.0f)
+    , travelDirectionY(0.0f)
+    , viewDistance(3)
+    , prefetchDistance(1)
+    , integrationBudgetMs(2.0f) {
 }
 
 WorldManager::~WorldManager() = default;
 
 void WorldManager::update(float deltaTime) {
-    // Update all active entities
+    // Update all active class-based entities
     for (auto& entity : entities) {
         if (entity && entity->isActive()) {
             entity->update(deltaTime);
@@ -52,30 +38,53 @@ void WorldManager::update(float deltaTime) {
     // Remove inactive entities
     entities.erase(
         std::remove_if(entities.begin(), entities.end(),
-            [](const EntityPtr& entity) {
-                return !entity || !entity->isActive();
+            [this](const EntityPtr& entity) {
+                if (entity && entity->isActive()) return false;
+                if (entity) registry.destroy(entity->getId());
+                return true;
             }),
         entities.end()
     );
     
+    // Component systems; AI is banded by distance from the player
+    vec3 focus = playerEntity ? playerEntity->getTransform().position : make_vec3(0.0f, 0.0f, 0.0f);
+    aiScheduler.update(registry, patrolRoutes, focus, playerEntity != nullptr, deltaTime);
+    integrateVelocitySystem(registry, deltaTime);
+    syncLegacyTransformSystem(registry);
+    if (navigation) {
+        navigation->update(registry, deltaTime);
+    }
+    
     // Update player grid if we have a player
     if (playerEntity) {
+        updateTravelDirection(deltaTime);
         GridCoordinate newGrid = getGridFromPosition(playerEntity->getTransform().position);
         if (newGrid != currentGrid) {
             onPlayerGridChange(currentGrid, newGrid);
             currentGrid = newGrid;
         }
     }
+    
+    // Add grids the workers finished, within this frame's budget
+    integrateCompletedGrids();
 }
 
 void WorldManager::addEntity(EntityPtr entity) {
     if (entity) {
         entities.push_back(entity);
         
+        const Transform& transform = entity->getTransform();
+        registry.create(entity->getId(), entity->getType(),
+            TransformComponent{ transform.position, transform.rotation, transform.scale },
+            MeshComponent{ registry.internMesh(entity->getMeshName()) },
+            LegacyEntityComponent{ entity.get() });
+        
         // If this is a player entity, track it
         if (entity->getType() == EntityType::Player) {
             playerEntity = entity;
             currentGrid = getGridFromPosition(entity->getTransform().position);
+            lastPlayerPosition = entity->getTransform().position;
+            requestGridsAround(currentGrid);
         }
         
         // Add to appropriate grid
@@ -111,6 +120,9 @@ void WorldManager::removeEntity(uint32_t entityId) {
         if (grid) {
             grid->removeEntity(entityId);
         }
+    } else {
+        // Component-only entity
+        registry.destroy(entityId);
     }
 }
 
@@ -157,20 +169,166 @@ std::vector<EntityPtr> WorldManager::getEntitiesInRadius(const vec3& center, flo
     return result;
 }
 
+uint32_t WorldManager::createNPC(const std::string& npcType, const vec3& position) {
+    uint32_t entityId = Entity::allocateId();
+    registry.create(entityId, EntityType::NPC,
+        TransformComponent{ position, simd_quaternion(0.0f, make_vec3(0.0f, 1.0f, 0.0f)), make_vec3(1.0f, 1.0f, 1.0f) },
+        AIComponent{ AIState::Idle, 0, 2.0f },
+        MeshComponent{ registry.internMesh("npc_" + npcType) });
+    
+    if (Grid* grid = getGrid(getGridFromPosition(position))) {
+        grid->addComponentEntity(entityId);
+    }
+    return entityId;
+}
+
+void WorldManager::setPatrolRoute(uint32_t entityId, const std::vector<vec3>& points) {
+    if (!registry.contains(entityId) || points.empty()) return;
+    
+    PatrolComponent patrol{ patrolRoutes.add(points.data(), points.size()), 0 };
+    registry.add(entityId, patrol);
+    if (AIComponent* ai = registry.get<AIComponent>(entityId)) {
+        ai->state = AIState::Patrol;
+        ai->lastTickTime = -1.0;
+    }
+}
+
+void WorldManager::getVisibleEntityIds(const Camera& camera, std::vector<uint32_t>& result) const {
+    result.clear();
+    mat4 viewProjection = camera.getViewProjectionMatrix();
+    
+    registry.forEachTable<TransformComponent>(
+        [&](size_t count, const uint32_t* ids, const EntityType*, const TransformComponent* transforms) {
+            for (size_t i = 0; i < count; ++i) {
+                vec3 position = transforms[i].position;
+                vec4 clip = simd_mul(viewProjection, make_vec4(position.x, position.y, position.z, 1.0f));
+                if (clip.w <= 0.0f) continue;
+                
+                // Same NDC test as Entity::isInFrustum, without the divide
+                if (clip.x >= -clip.w && clip.x <= clip.w &&
+                    clip.y >= -clip.w && clip.y <= clip.w &&
+                    clip.z >= 0.0f && clip.z <= clip.w) {
+                    result.push_back(ids[i]);
+                }
+            }
+        });
+}
+
+void WorldManager::getEntityIdsInRadius(const vec3& center, float radius, std::vector<uint32_t>& result) const {
+    result.clear();
+    float radiusSq = radius * radius;
+    
+    registry.forEachTable<TransformComponent>(
+        [&](size_t count, const uint32_t* ids, const EntityType*, const TransformComponent* transforms) {
+            for (size_t i = 0; i < count; ++i) {
+                vec3 delta = transforms[i].position - center;
+                if (dot(delta, delta) <= radiusSq) {
+                    result.push_back(ids[i]);
+                }
+            }
+        });
+}
+
 void WorldManager::loadGrid(const GridCoordinate& coord) {
     // Create new grid if it doesn't exist
     if (grids.find(coord) == grids.end()) {
+        if (requestedGrids.erase(coord) > 0) {
+            getGridStreamer().cancel(coord);
+        }
+        auto cell = std::make_unique<CellBuffer>();
+        cellGenerator.generate(coord, *cell);
         auto grid = std::make_unique<Grid>(coord);
-        generateGridContent(coord, *grid);
-        grids[coord] = std::move(grid);
+        grid->setCell(std::move(cell));
+        addGrid(std::move(grid));
+    }
+}
+
+void WorldManager::loadGridsAround(const GridCoordinate& center, int radius) {
+    std::vector<GridCoordinate> missing;
+    for (int y = -radius; y <= radius; ++y) {
+        for (int x = -radius; x <= radius; ++x) {
+            GridCoordinate coord(center.x + x, center.y + y);
+            if (grids.find(coord) != grids.end()) continue;
+            if (requestedGrids.erase(coord) > 0) {
+                getGridStreamer().cancel(coord);
+            }
+            missing.push_back(coord);
+        }
+    }
+    if (missing.empty()) return;
+    
+    std::vector<CellBuffer> cells(missing.size());
+    cellGenerator.generateBlock(getJobSystem(), missing.data(), missing.size(), cells.data());
+    
+    for (const CellBuffer& cell : cells) {
+        auto grid = std::make_unique<Grid>(cell.coord);
+        grid->setCell(std::make_unique<CellBuffer>(cell));
+        addGrid(std::move(grid));
     }
 }
 
 void WorldManager::unloadGrid(const GridCoordinate& coord) {
     auto it = grids.find(coord);
     if (it != grids.end()) {
+        std::unique_ptr<Grid> grid = std::move(it->second);
         grids.erase(it);
+        retireGrid(std::move(grid));
+    }
+}
+
+void WorldManager::setJobSystem(std::shared_ptr<JobSystem> jobs) {
+    // Outstanding requests belong to the old workers
+    gridStreamer.reset();
+    navigation.reset();
+    requestedGrids.clear();
+    jobSystem = std::move(jobs);
+}
+
+void WorldManager::setWorldSeed(uint64_t seed) {
+    // Loaded grids stay; only new ones use the new seed
+    gridStreamer.reset();
+    navigation.reset();
+    requestedGrids.clear();
+    cellGenerator = CellGenerator(seed);
+}
+
+JobSystem& WorldManager::getJobSystem() {
+    if (!jobSystem) {
+        jobSystem = std::make_shared<JobSystem>();
     }
+    return *jobSystem;
+}
+
+NavigationSystem& WorldManager::getNavigation() {
+    if (!navigation) {
+        getJobSystem();
+        navigation = std::make_unique<NavigationSystem>(jobSystem, cellGenerator);
+    }
+    return *navigation;
+}
+
+void WorldManager::chase(uint32_t npcId, uint32_t targetId) {
+    AIComponent* ai = registry.get<AIComponent>(npcId);
+    if (!ai || !registry.has<TransformComponent>(targetId)) return;
+    
+    ai->state = AIState::Chase;
+    ai->targetId = targetId;
+    getNavigation();
+}
+
+GridStreamer& WorldManager::getGridStreamer() {
+    if (!gridStreamer) {
+        getJobSystem();
+        // The generator is copied into the streamer, whose jobs may outlive this manager
+        CellGenerator generator = cellGenerator;
+        gridStreamer = std::make_unique<GridStreamer>(jobSystem,
+            [generator](const GridCoordinate& coord, Grid& grid) {
+                auto cell = std::make_unique<CellBuffer>();
+                generator.generate(coord, *cell);
+                grid.setCell(std::move(cell));
+            });
+    }
+    return *gridStreamer;
 }
 
 Grid* WorldManager::getGrid(const GridCoordinate& coord) const {
@@ -185,52 +343,153 @@ GridCoordinate WorldManager::getGridFromPosition(const vec3& position) const {
 }
 
 void WorldManager::onPlayerGridChange(const GridCoordinate& oldGrid, const GridCoordinate& newGrid) {
-    // Load grids around new position
-    for (int x = newGrid.x - viewDistance; x <= newGrid.x + viewDistance; ++x) {
-        for (int y = newGrid.y - viewDistance; y <= newGrid.y + viewDistance; ++y) {
-            loadGrid(GridCoordinate(x, y));
-        }
+    // After a teleport nothing nearby is loaded or queued; build the
+    // immediate neighbourhood now so the player never stands in a hole
+    int jump = std::max(std::abs(newGrid.x - oldGrid.x), std::abs(newGrid.y - oldGrid.y));
+    if (jump > 1) {
+        loadGridsAround(newGrid, 1);
     }
     
-    // Unload grids that are too far from new position
+    // Queue grids around the new position; they arrive over the next frames
+    requestGridsAround(newGrid);
+    
+    // Unload grids that are too far from new position. Prefetched grids
+    // count as near so turning back does not reload them.
+    int keepDistance = viewDistance + prefetchDistance;
+    auto isFar = [&](const GridCoordinate& coord) {
+        return std::abs(coord.x - newGrid.x) > keepDistance || std::abs(coord.y - newGrid.y) > keepDistance;
+    };
+    
     std::vector<GridCoordinate> gridsToUnload;
     for (const auto& pair : grids) {
-        const GridCoordinate& coord = pair.first;
-        int dx = std::abs(coord.x - newGrid.x);
-        int dy = std::abs(coord.y - newGrid.y);
-        
-        if (dx > viewDistance || dy > viewDistance) {
-            gridsToUnload.push_back(coord);
+        if (isFar(pair.first)) {
+            gridsToUnload.push_back(pair.first);
         }
     }
-    
     for (const auto& coord : gridsToUnload) {
         unloadGrid(coord);
     }
+    
+    for (auto it = requestedGrids.begin(); it != requestedGrids.end();) {
+        if (isFar(*it)) {
+            getGridStreamer().cancel(*it);
+            it = requestedGrids.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void WorldManager::updateTravelDirection(float deltaTime) {
+    vec3 position = playerEntity->getTransform().position;
+    if (deltaTime > 0.0f) {
+        // Smoothed velocity in grid axes (world x and z); only its direction is used
+        float smoothing = std::min(1.0f, deltaTime * 4.0f);
+        float velocityX = (position.x - lastPlayerPosition.x) / deltaTime;
+        float velocityY = (position.z - lastPlayerPosition.z) / deltaTime;
+        travelDirectionX += (velocityX - travelDirectionX) * smoothing;
+        travelDirectionY += (velocityY - travelDirectionY) * smoothing;
+    }
+    lastPlayerPosition = position;
+    
+    if (!requestedGrids.empty()) {
+        getGridStreamer().setFocus(currentGrid, travelDirectionX, travelDirectionY);
+    }
 }
 
-void WorldManager::generateGridContent(const GridCoordinate& coord, Grid& grid) {
-    // Generate procedural content for this grid
-    // For now, this is just a placeholder
+void WorldManager::requestGridsAround(const GridCoordinate& center) {
+    GridStreamer& streamer = getGridStreamer();
+    streamer.setFocus(center, travelDirectionX, travelDirectionY);
     
-    // You could add terrain generation, NPC spawning, etc. here
-    // Example: spawn some NPCs in certain grids
-    if (coord.x % 3 == 0 && coord.y % 3 == 0) {
-        // Spawn an NPC every 3rd grid
-        auto npc = std::make_shared<NPCEntity>("guard");
+    float speed = std::sqrt(travelDirectionX * travelDirectionX + travelDirectionY * travelDirectionY);
+    int reach = viewDistance + (speed > 0.0f ? prefetchDistance : 0);
+    
+    for (int x = -reach; x <= reach; ++x) {
+        for (int y = -reach; y <= reach; ++y) {
+            bool inView = std::abs(x) <= viewDistance && std::abs(y) <= viewDistance;
+            if (!inView) {
+                // Beyond the view square, only prefetch within ~45 degrees of travel
+                float distance = std::sqrt(static_cast<float>(x * x + y * y));
+                float ahead = (x * travelDirectionX + y * travelDirectionY) / (distance * speed);
+                if (ahead < 0.7f) continue;
+            }
+            
+            GridCoordinate coord(center.x + x, center.y + y);
+            if (grids.find(coord) != grids.end() || !requestedGrids.insert(coord).second) {
+                continue;
+            }
+            streamer.request(coord);
+        }
+    }
+}
+
+void WorldManager::integrateCompletedGrids() {
+    if (!gridStreamer) return;
+    
+    auto start = std::chrono::steady_clock::now();
+    std::unique_ptr<Grid> grid;
+    while (gridStreamer->popCompleted(grid)) {
+        GridCoordinate coord = grid->getCoordinate();
+        if (requestedGrids.erase(coord) > 0 && grids.find(coord) == grids.end()) {
+            addGrid(std::move(grid));
+        } else {
+            // Cancelled while generating, or loaded synchronously meanwhile
+            gridStreamer->destroyAsync(std::move(grid));
+        }
         
-        // Position within the grid
-        vec3 gridWorldPos = make_vec3(
-            coord.x * GRID_SIZE + GRID_SIZE * 0.5f,
-            0.0f,
-            coord.y * GRID_SIZE + GRID_SIZE * 0.5f
-        );
+        std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() >= integrationBudgetMs) {
+            break; // The rest wait for the next frame
+        }
+    }
+}
+
+void WorldManager::addGrid(std::unique_ptr<Grid> grid) {
+    if (const CellBuffer* cell = grid->getCell()) {
+        instantiateCell(*cell, *grid);
+    }
+    for (const auto& entity : grid->getEntities()) {
+        entities.push_back(entity);
+    }
+    GridCoordinate coord = grid->getCoordinate();
+    grids[coord] = std::move(grid);
+}
+
+void WorldManager::retireGrid(std::unique_ptr<Grid> grid) {
+    // Grid content goes with the grid (update() drops inactive entities); players stay
+    for (const auto& entity : grid->getEntities()) {
+        if (entity && entity->getType() != EntityType::Player) {
+            entity->setActive(false);
+        }
+    }
+    for (uint32_t entityId : grid->getComponentEntities()) {
+        registry.destroy(entityId);
+    }
+    getGridStreamer().destroyAsync(std::move(grid));
+}
+
+void WorldManager::instantiateCell(const CellBuffer& cell, Grid& grid) {
+    // Turns generated cell data into component entities (main thread)
+    for (size_t i = 0; i < cell.spawnCount; ++i) {
+        const CellSpawn& spawn = cell.spawns[i];
         
-        npc->getTransform().setPosition(gridWorldPos);
-        grid.addEntity(npc);
+        const char* npcType = nullptr;
+        switch (spawn.kind) {
+            case CellSpawnKind::Guard:
+                npcType = "guard";
+                break;
+        }
+        if (!npcType) continue;
         
-        // Also add to main entity list
-        entities.push_back(npc);
+        uint32_t entityId = Entity::allocateId();
+        registry.create(entityId, EntityType::NPC,
+            TransformComponent{
+                make_vec3(spawn.x, spawn.y, spawn.z),
+                simd_quaternion(radians(spawn.heading), make_vec3(0.0f, 1.0f, 0.0f)),
+                make_vec3(1.0f, 1.0f, 1.0f) },
+            AIComponent{ AIState::Idle, 0, 2.0f },
+            MeshComponent{ registry.internMesh(std::string("npc_") + npcType) });
+        grid.addComponentEntity(entityId);
     }
 }
 
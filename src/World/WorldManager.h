@@ -8,51 +8,22 @@
 #pragma once
 
 #include "World/Entity.h"
+#include "World/CellGenerator.h"
+#include "World/ECS/AIScheduler.h"
+#include "World/ECS/EntityRegistry.h"
+#include "World/Grid.h"
+#include "World/GridStreamer.h"
+#include "World/Navigation/NavigationSystem.h"
+#include "Core/JobSystem.h"
 #include "Core/Math/MathTypes.h"
 #include "Core/Math/Camera.h"
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
 
 namespace FinalStorm {
 
-struct GridCoordinate {
-    int32_t x;
-    int32_t y;
-    
-    GridCoordinate() : x(0), y(0) {}
-    GridCoordinate(int32_t x, int32_t y) : x(x), y(y) {}
-    
-    bool operator==(const GridCoordinate& other) const {
-        return x == other.x && y == other.y;
-    }
-    
-    bool operator!=(const GridCoordinate& other) const {
-        return !(*this == other);
-    }
-};
-
-struct GridCoordinateHash {
-    std::size_t operator()(const GridCoordinate& coord) const {
-        return std::hash<int32_t>()(coord.x) ^ (std::hash<int32_t>()(coord.y) << 1);
-    }
-};
-
-class Grid {
-public:
-    Grid(const GridCoordinate& coord);
-    
-    void addEntity(EntityPtr entity);
-    void removeEntity(uint32_t entityId);
-    const std::vector<EntityPtr>& getEntities() const { return entities; }
-    
-    const GridCoordinate& getCoordinate() const { return coordinate; }
-    
-private:
-    GridCoordinate coordinate;
-    std::vector<EntityPtr> entities;
-};
-
 class WorldManager {
 public:
     WorldManager();
@@ -60,6 +31,8 @@ public:
     
     void update(float deltaTime);
     
+    // Class-based entities keep working: their update() still runs and a
+    // mirror row in the registry keeps them visible to component queries
     void addEntity(EntityPtr entity);
     void removeEntity(uint32_t entityId);
     EntityPtr getEntity(uint32_t entityId) const;
@@ -67,10 +40,44 @@ public:
     std::vector<EntityPtr> getVisibleEntities(const Camera& camera) const;
     std::vector<EntityPtr> getEntitiesInRadius(const vec3& center, float radius) const;
     
+    // Component entities; NPCs created here have no Entity object
+    uint32_t createNPC(const std::string& npcType, const vec3& position);
+    void setPatrolRoute(uint32_t entityId, const std::vector<vec3>& points);
+    void setAIConfig(const AIScheduler::Config& config) { aiScheduler.setConfig(config); }
+    const AIScheduler::Stats& getAIStats() const { return aiScheduler.getStats(); }
+    
+    // Component NPCs chase any entity with a row, class-based or not, and
+    // switch to Attack once in range
+    void chase(uint32_t npcId, uint32_t targetId);
+    NavigationSystem& getNavigation();
+    EntityRegistry& getRegistry() { return registry; }
+    const EntityRegistry& getRegistry() const { return registry; }
+    
+    // Queries over every entity, class-based or not
+    void getVisibleEntityIds(const Camera& camera, std::vector<uint32_t>& result) const;
+    void getEntityIdsInRadius(const vec3& center, float radius, std::vector<uint32_t>& result) const;
+    
+    // Synchronous load, for grids needed this frame; streaming around the
+    // player happens in the background
     void loadGrid(const GridCoordinate& coord);
     void unloadGrid(const GridCoordinate& coord);
     
-    // Get all entities (for simple iteration)
+    // Synchronous load of every missing grid within radius, generated in
+    // parallel; used when the player arrives somewhere without warning
+    void loadGridsAround(const GridCoordinate& center, int radius);
+    
+    // Background grid streaming
+    void setJobSystem(std::shared_ptr<JobSystem> jobs);
+    void setWorldSeed(uint64_t seed);
+    void setViewDistance(int distance) { viewDistance = distance; }
+    void setPrefetchDistance(int distance) { prefetchDistance = distance; }
+    void setGridIntegrationBudget(float milliseconds) { integrationBudgetMs = milliseconds; }
+    size_t getPendingGridCount() const { return requestedGrids.size(); }
+    
+    // Terrain height of the generated world at a position
+    float getTerrainHeight(float x, float z) const { return cellGenerator.getHeight(x, z); }
+    
+    // Get all class-based entities (for simple iteration)
     const std::vector<EntityPtr>& getAllEntities() const { return entities; }
     
 private:
@@ -78,19 +85,42 @@ private:
     Grid* getGrid(const GridCoordinate& coord) const;
     GridCoordinate getGridFromPosition(const vec3& position) const;
     void onPlayerGridChange(const GridCoordinate& oldGrid, const GridCoordinate& newGrid);
-    void generateGridContent(const GridCoordinate& coord, Grid& grid);
+    void updateTravelDirection(float deltaTime);
+    JobSystem& getJobSystem();
+    GridStreamer& getGridStreamer();
+    void requestGridsAround(const GridCoordinate& center);
+    void integrateCompletedGrids();
+    void addGrid(std::unique_ptr<Grid> grid);
+    void retireGrid(std::unique_ptr<Grid> grid);
+    void instantiateCell(const CellBuffer& cell, Grid& grid);
     
-    // Entity storage - using simple vector for now, can optimize to grid later
+    // Entity storage: component tables for everything, plus the objects
+    // behind class-based entities
+    EntityRegistry registry;
+    PatrolRoutes patrolRoutes;
+    AIScheduler aiScheduler;
     std::vector<EntityPtr> entities;
     std::unordered_map<GridCoordinate, std::unique_ptr<Grid>, GridCoordinateHash> grids;
     
     // Player tracking
     EntityPtr playerEntity;
     GridCoordinate currentGrid;
+    vec3 lastPlayerPosition;
+    float travelDirectionX;     // Smoothed, in grid axes
+    float travelDirectionY;
+    
+    // Background streaming and path queries; both are declared after the job system so they are destroyed first
+    CellGenerator cellGenerator;
+    std::shared_ptr<JobSystem> jobSystem;
+    std::unordered_set<GridCoordinate, GridCoordinateHash> requestedGrids;
+    std::unique_ptr<GridStreamer> gridStreamer;
+    std::unique_ptr<NavigationSystem> navigation;
     
     // Configuration
     int viewDistance;
-    static constexpr float GRID_SIZE = 256.0f; // Size of each grid cell in world units
+    int prefetchDistance;       // Extra grids loaded ahead in the travel direction
+    float integrationBudgetMs;  // Main-thread time per frame for adding finished grids
+    static constexpr float GRID_SIZE = CellGenerator::CellSize; // Size of each grid cell in world units
 };
 
 } // namespace FinalStorm
\ No newline at end of file
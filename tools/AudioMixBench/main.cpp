@@ -0,0 +1,173 @@
+// tools/AudioMixBench/main.cpp
+// Offline mixer benchmark: N voices of procedural clips rendered as fast as possible
+// Usage: FinalStorm-AudioMixBench [--voices N] [--seconds N] [--rate N] [--out file.wav]
+
+#include "Core/Audio/AudioMixer.h"
+#include "Core/Audio/AudioOutput.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace FinalStorm;
+
+namespace {
+
+constexpr float TwoPi = 6.28318531f;
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --voices N     Voices playing at once (default 64)\n"
+              << "  --seconds N    Seconds of audio rendered (default 20)\n"
+              << "  --rate N       Output sample rate (default 48000)\n"
+              << "  --out PATH     Also write the mix to a 16-bit WAV file\n";
+}
+
+// Looping tone with a few harmonics
+std::unique_ptr<AudioBuffer> makeTone(float frequency, uint32_t sampleRate, float seconds) {
+    size_t frames = static_cast<size_t>(sampleRate * seconds);
+    std::vector<float> samples(frames);
+    for (size_t i = 0; i < frames; ++i) {
+        float t = static_cast<float>(i) / sampleRate;
+        samples[i] = 0.5f * std::sin(TwoPi * frequency * t) + 0.2f * std::sin(TwoPi * 2.0f * frequency * t);
+    }
+    return std::make_unique<AudioBuffer>(std::move(samples), 1, sampleRate);
+}
+
+// Stereo noise burst with a decaying envelope, played as a one-shot
+std::unique_ptr<AudioBuffer> makeBurst(uint32_t sampleRate, float seconds, uint32_t seed) {
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> noise(-1.0f, 1.0f);
+    size_t frames = static_cast<size_t>(sampleRate * seconds);
+    std::vector<float> samples(frames * 2);
+    for (size_t i = 0; i < frames; ++i) {
+        float envelope = std::exp(-6.0f * static_cast<float>(i) / frames);
+        samples[i * 2] = 0.4f * envelope * noise(random);
+        samples[i * 2 + 1] = 0.4f * envelope * noise(random);
+    }
+    return std::make_unique<AudioBuffer>(std::move(samples), 2, sampleRate);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    uint32_t voiceCount = 64;
+    double seconds = 20.0;
+    uint32_t sampleRate = 48000;
+    std::string outPath;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            printUsage(argv[0]);
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return 1;
+        }
+
+        const char* value = argv[++i];
+        if (arg == "--voices") voiceCount = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--seconds") seconds = std::strtod(value, nullptr);
+        else if (arg == "--rate") sampleRate = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--out") outPath = value;
+        else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    // Clips at assorted rates so every voice resamples
+    std::vector<std::unique_ptr<AudioBuffer>> clips;
+    clips.push_back(makeTone(220.0f, 44100, 1.0f));
+    clips.push_back(makeTone(330.0f, 22050, 0.5f));
+    clips.push_back(makeTone(440.0f, 48000, 2.0f));
+    clips.push_back(makeBurst(44100, 0.75f, 1));
+    clips.push_back(makeBurst(32000, 0.3f, 2));
+
+    AudioMixer mixer(sampleRate, voiceCount);
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    auto playVoice = [&](uint32_t voice) {
+        AudioCommand command;
+        command.type = AudioCommandType::Play;
+        command.voice = voice;
+        size_t clip = voice % clips.size();
+        command.buffer = clips[clip].get();
+        command.looping = clips[clip]->getChannels() == 1;
+        command.pitch = 0.5f + unit(random);
+        float gain = 1.0f / std::sqrt(static_cast<float>(voiceCount));
+        float pan = unit(random);
+        command.gainLeft = gain * std::cos(pan * 1.5707963f);
+        command.gainRight = gain * std::sin(pan * 1.5707963f);
+        while (!mixer.post(command)) {
+            mixer.render(nullptr, 0);   // Only when the queue is full: let the mixer drain it
+        }
+    };
+    for (uint32_t voice = 0; voice < voiceCount; ++voice) {
+        playVoice(voice);
+    }
+
+    std::unique_ptr<WavFileOutput> wav;
+    if (!outPath.empty()) {
+        wav = std::make_unique<WavFileOutput>(outPath);
+        if (!wav->open(sampleRate, AudioMixer::Channels)) {
+            std::cerr << "Cannot write " << outPath << std::endl;
+            return 1;
+        }
+    }
+
+    // One block per iteration, with game-side traffic between blocks the
+    // way AudioEngine::update would send it
+    const size_t blockCount = static_cast<size_t>(seconds * sampleRate / AudioMixer::BlockSize);
+    std::vector<float> block(AudioMixer::BlockSize * AudioMixer::Channels);
+    double totalMs = 0.0;
+    double worstMs = 0.0;
+    size_t restarts = 0;
+    for (size_t b = 0; b < blockCount; ++b) {
+        AudioEvent event;
+        while (mixer.pollEvent(event)) {
+            playVoice(event.voice);
+            restarts++;
+        }
+        AudioCommand params;
+        params.type = AudioCommandType::SetParams;
+        params.voice = static_cast<uint32_t>(b % voiceCount);
+        params.gainLeft = params.gainRight = 0.7f / std::sqrt(static_cast<float>(voiceCount));
+        params.pitch = 0.5f + unit(random);
+        mixer.post(params);
+
+        auto start = std::chrono::steady_clock::now();
+        mixer.render(block.data(), AudioMixer::BlockSize);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        totalMs += ms;
+        worstMs = std::max(worstMs, ms);
+
+        if (wav) wav->write(block.data(), AudioMixer::BlockSize);
+    }
+    if (wav) wav->close();
+
+    double audioMs = 1000.0 * blockCount * AudioMixer::BlockSize / sampleRate;
+    double blockMs = 1000.0 * AudioMixer::BlockSize / sampleRate;
+    std::cout << std::fixed << std::setprecision(3)
+              << voiceCount << " voices, " << blockCount << " blocks of " << AudioMixer::BlockSize << " frames at " << sampleRate << " Hz\n"
+              << "  mean block   " << totalMs / blockCount << " ms (budget " << blockMs << " ms)\n"
+              << "  worst block  " << worstMs << " ms\n"
+              << "  realtime     " << std::setprecision(1) << audioMs / totalMs << "x, "
+              << std::setprecision(2) << 100.0 * totalMs / audioMs << "% of one core\n"
+              << "  per voice    " << std::setprecision(3) << 1000.0 * totalMs / blockCount / voiceCount << " us per block\n"
+              << "  restarts     " << restarts << std::endl;
+    if (wav) {
+        std::cout << "  wrote " << outPath << " (" << wav->getFramesWritten() << " frames)" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,254 @@
+// tools/BatchLoopback/main.cpp
+// Outbound batching check: OutboundBatcher coalescing, cancellation, order
+// and byte budget, then FinalverseClient against the synthetic server on
+// loopback, counting the frames a burst of pings goes out in and the pongs
+// that come back.
+// Usage: FinalStorm-BatchLoopback [--pings N] [--ticks N] [--port PORT] [--timeout SECONDS]
+
+#include "Network/FinalverseClient.h"
+#include "Network/OutboundBatcher.h"
+#include "SyntheticServer/SyntheticServer.h"
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace FinalStorm;
+
+namespace {
+
+int g_failures = 0;
+
+void check(bool condition, const std::string& what) {
+    std::cout << (condition ? "  ok    " : "  FAIL  ") << what << std::endl;
+    if (!condition) ++g_failures;
+}
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --pings N      Pings queued across the ticks (default 3000)\n"
+              << "  --ticks N      Client updates the pings are spread over (default 60)\n"
+              << "  --port PORT    Loopback port for the synthetic server (default 3917)\n"
+              << "  --timeout S    Seconds to wait for the connection and the pongs (default 10)\n";
+}
+
+// Messages in the batcher tests are a 4-byte sequence number plus padding
+std::vector<uint8_t> makeMessage(uint32_t sequence, size_t size = sizeof(uint32_t)) {
+    std::vector<uint8_t> bytes(std::max(size, sizeof(uint32_t)), 0);
+    std::memcpy(bytes.data(), &sequence, sizeof(sequence));
+    return bytes;
+}
+
+uint32_t sequenceOf(const uint8_t* data) {
+    uint32_t sequence = 0;
+    std::memcpy(&sequence, data, sizeof(sequence));
+    return sequence;
+}
+
+// ============================================================================
+// OutboundBatcher
+// ============================================================================
+
+void checkBatcher(int pairs) {
+    std::cout << "outbound batcher" << std::endl;
+
+    {
+        OutboundBatcher batcher;
+        for (int i = 0; i < pairs; ++i) {
+            std::string id = "service-" + std::to_string(i);
+            auto bytes = makeMessage(static_cast<uint32_t>(i));
+            batcher.queueSubscription(id, true, bytes.data(), bytes.size());
+            batcher.queueSubscription(id, false, bytes.data(), bytes.size());
+        }
+        size_t emitted = batcher.flush([](const uint8_t*, size_t) {});
+        check(emitted == 0 && batcher.empty() &&
+              batcher.getStats().cancelled == static_cast<uint64_t>(pairs) * 2,
+              std::to_string(pairs) + " subscribe/unsubscribe pairs cancel out");
+    }
+
+    {
+        OutboundBatcher batcher;
+        for (uint32_t i = 0; i < 100; ++i) {
+            auto status = makeMessage(i);
+            batcher.queueLatest("status", status.data(), status.size());
+        }
+        std::vector<uint32_t> seen;
+        batcher.flush([&](const uint8_t* data, size_t) { seen.push_back(sequenceOf(data)); });
+        check(seen == std::vector<uint32_t>{ 99 } && batcher.getStats().coalesced == 99,
+              "keyed messages coalesce to the newest copy");
+    }
+
+    {
+        // Ordered messages around a keyed one keep their order; the keyed
+        // message takes the position of its newest copy
+        OutboundBatcher batcher;
+        std::vector<uint8_t> bytes;
+        bytes = makeMessage(1);  batcher.queue(bytes.data(), bytes.size());
+        bytes = makeMessage(90); batcher.queueLatest("list", bytes.data(), bytes.size());
+        bytes = makeMessage(2);  batcher.queue(bytes.data(), bytes.size());
+        bytes = makeMessage(91); batcher.queueLatest("list", bytes.data(), bytes.size());
+        bytes = makeMessage(3);  batcher.queue(bytes.data(), bytes.size());
+        std::vector<uint32_t> seen;
+        batcher.flush([&](const uint8_t* data, size_t) { seen.push_back(sequenceOf(data)); });
+        check(seen == std::vector<uint32_t>{ 1, 2, 91, 3 }, "flush preserves queue order");
+    }
+
+    {
+        OutboundBatcher::Config config;
+        config.tickByteBudget = 16 * 1024;
+        OutboundBatcher batcher(config);
+        for (uint32_t i = 0; i < 100; ++i) {
+            auto bytes = makeMessage(i, 1000);
+            batcher.queue(bytes.data(), bytes.size());
+        }
+
+        std::vector<uint32_t> seen;
+        size_t flushes = 0;
+        bool withinBudget = true;
+        while (!batcher.empty() && flushes < 100) {
+            size_t bytes = 0;
+            batcher.flush([&](const uint8_t* data, size_t size) {
+                seen.push_back(sequenceOf(data));
+                bytes += size;
+            });
+            withinBudget = withinBudget && bytes <= config.tickByteBudget;
+            ++flushes;
+        }
+        bool inOrder = seen.size() == 100;
+        for (size_t i = 0; inOrder && i < seen.size(); ++i) inOrder = seen[i] == i;
+        check(withinBudget && inOrder && flushes == 7,
+              "byte budget caps each flush and the rest carries over in order");
+    }
+}
+
+// ============================================================================
+// FinalverseClient against the synthetic server
+// ============================================================================
+
+// Pings carry a 4-byte sequence; clock sync pings carry 8 bytes
+constexpr size_t kPingPayloadSize = sizeof(uint32_t);
+
+void checkLoopback(int pings, int ticks, uint16_t port, double timeout) {
+    std::cout << "synthetic server loopback" << std::endl;
+
+    SyntheticServerConfig serverConfig;
+    serverConfig.port = port;
+    serverConfig.serviceCount = 0;
+    serverConfig.connectionEventRate = 0.0;
+
+    SyntheticServer server;
+    if (!server.start(serverConfig)) {
+        check(false, "synthetic server listens on port " + std::to_string(port));
+        return;
+    }
+    std::thread serverThread([&server]() { server.run(); });
+
+    FinalverseClient client;
+    client.setPingInterval(1e9);    // One clock sync ping at most, so it cannot add frames
+
+    std::vector<bool> ponged(static_cast<size_t>(pings), false);
+    int pongs = 0;
+    int duplicates = 0;
+    client.setMessageCallback([&](const Message& message) {
+        if (message.getType() != MessageType::Pong || message.data.size() != kPingPayloadSize) return;
+        uint32_t sequence = sequenceOf(message.data.data());
+        if (sequence >= ponged.size()) return;
+        if (ponged[sequence]) ++duplicates;
+        ponged[sequence] = true;
+        ++pongs;
+    });
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::duration<double>(timeout);
+    client.connect("ws://127.0.0.1:" + std::to_string(port) + "/ws");
+    while (!client.isConnected() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    check(client.isConnected(), "client connects");
+
+    if (client.isConnected()) {
+        // Each tick queues its share of pings plus subscribe/unsubscribe
+        // pairs that must never reach the wire, then updates once
+        uint64_t flushesBefore = client.getOutboundStats().flushes;
+        uint32_t sequence = 0;
+        for (int tick = 0; tick < ticks; ++tick) {
+            int end = static_cast<int>(static_cast<int64_t>(pings) * (tick + 1) / ticks);
+            for (; static_cast<int>(sequence) < end; ++sequence) {
+                Message ping(MessageType::Ping);
+                ping.data = makeMessage(sequence);
+                client.sendMessage(ping);
+
+                std::string id = "service-" + std::to_string(sequence);
+                client.subscribeToService(id);
+                client.unsubscribeFromService(id);
+            }
+            client.update();
+        }
+        uint64_t frames = client.getOutboundStats().flushes - flushesBefore;
+
+        while (pongs < pings && std::chrono::steady_clock::now() < deadline) {
+            client.update();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        const OutboundBatcher::Stats& stats = client.getOutboundStats();
+        std::cout << "  " << pings << " pings over " << ticks << " ticks went out in " << frames
+                  << " frames, " << pongs << " pongs back" << std::endl;
+        check(frames == static_cast<uint64_t>(ticks), "one frame per tick");
+        check(pongs == pings && duplicates == 0, "every ping answered exactly once");
+        check(stats.cancelled == static_cast<uint64_t>(pings) * 2, "every subscribe/unsubscribe pair cancelled");
+    }
+
+    client.disconnect();
+    server.stop();
+    serverThread.join();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int pings = 3000;
+    int ticks = 60;
+    int port = 3917;
+    double timeout = 10.0;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            printUsage(argv[0]);
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return 1;
+        }
+
+        const char* value = argv[++i];
+        if (arg == "--pings") pings = std::max(1, std::atoi(value));
+        else if (arg == "--ticks") ticks = std::max(1, std::atoi(value));
+        else if (arg == "--port") port = std::atoi(value);
+        else if (arg == "--timeout") timeout = std::max(0.1, std::atof(value));
+        else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    ticks = std::min(ticks, pings);
+
+    std::signal(SIGPIPE, SIG_IGN);
+
+    checkBatcher(pings);
+    checkLoopback(pings, ticks, static_cast<uint16_t>(port), timeout);
+
+    if (g_failures > 0) {
+        std::cout << "FAIL: " << g_failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "PASS: batching checks" << std::endl;
+    return 0;
+}
@@ -0,0 +1,132 @@
+// tools/CellGenBench/main.cpp
+// Cells/sec benchmark for the procedural cell generator
+// Usage: FinalStorm-CellGenBench [--cells N] [--workers N] [--block N] [--seed N]
+
+#include "World/CellGenerator.h"
+#include "Core/JobSystem.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace FinalStorm;
+
+namespace {
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --cells N      Cells generated per measurement (default 4096)\n"
+              << "  --workers N    Job system workers, 0 for one per spare core (default 0)\n"
+              << "  --block N      Side of the teleport-sized block, N x N cells (default 7)\n"
+              << "  --seed N       World seed (default CellGenerator::DefaultWorldSeed)\n";
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Order-dependent digest of everything a cell buffer holds
+uint64_t digest(const std::vector<CellBuffer>& cells) {
+    uint64_t hash = 1469598103934665603ULL;
+    auto mix = [&hash](const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ULL;
+        }
+    };
+    for (const CellBuffer& cell : cells) {
+        mix(&cell.seed, sizeof(cell.seed));
+        mix(cell.heights.data(), sizeof(float) * cell.heights.size());
+        for (size_t i = 0; i < cell.spawnCount; ++i) {
+            const CellSpawn& spawn = cell.spawns[i];
+            float values[4] = { spawn.x, spawn.y, spawn.z, spawn.heading };
+            mix(&spawn.kind, sizeof(spawn.kind));
+            mix(values, sizeof(values));
+        }
+    }
+    return hash;
+}
+
+void report(const char* label, size_t cells, double seconds) {
+    std::cout << std::left << std::setw(28) << label
+              << std::right << std::setw(12) << std::fixed << std::setprecision(0) << cells / seconds << " cells/s"
+              << std::setw(10) << std::setprecision(3) << seconds * 1000.0 << " ms" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t cellCount = 4096;
+    size_t workerCount = 0;
+    int blockSide = 7;
+    uint64_t seed = CellGenerator::DefaultWorldSeed;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            printUsage(argv[0]);
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return 1;
+        }
+
+        const char* value = argv[++i];
+        if (arg == "--cells") cellCount = std::strtoull(value, nullptr, 10);
+        else if (arg == "--workers") workerCount = std::strtoull(value, nullptr, 10);
+        else if (arg == "--block") blockSide = std::atoi(value);
+        else if (arg == "--seed") seed = std::strtoull(value, nullptr, 10);
+        else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    int side = 1;
+    while (static_cast<size_t>(side) * side < cellCount) {
+        ++side;
+    }
+    cellCount = static_cast<size_t>(side) * side;
+    GridCoordinate origin(-side / 2, -side / 2);
+
+    CellGenerator generator(seed);
+    JobSystem jobs(workerCount);
+    std::cout << "Generating " << cellCount << " cells (" << side << " x " << side << "), "
+              << jobs.getWorkerCount() << " workers + caller" << std::endl;
+
+    // Serial reference
+    std::vector<CellBuffer> serial(cellCount);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < cellCount; ++i) {
+        generator.generate(GridCoordinate(origin.x + static_cast<int32_t>(i % side), origin.y + static_cast<int32_t>(i / side)), serial[i]);
+    }
+    report("serial", cellCount, secondsSince(start));
+
+    std::vector<CellBuffer> parallel;
+    start = std::chrono::steady_clock::now();
+    generator.generateBlock(jobs, origin, side, side, parallel);
+    report("parallel", cellCount, secondsSince(start));
+
+    // Teleport-sized blocks, the latency that matters for fast travel
+    std::vector<CellBuffer> block;
+    const int repeats = 32;
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r) {
+        generator.generateBlock(jobs, GridCoordinate(r * 1000, -r * 1000), blockSide, blockSide, block);
+    }
+    double blockSeconds = secondsSince(start);
+    std::string label = "parallel " + std::to_string(blockSide) + "x" + std::to_string(blockSide) + " blocks";
+    report(label.c_str(), static_cast<size_t>(blockSide) * blockSide * repeats, blockSeconds);
+    std::cout << "  per block " << std::setprecision(3) << blockSeconds * 1000.0 / repeats << " ms" << std::endl;
+
+    uint64_t serialDigest = digest(serial);
+    uint64_t parallelDigest = digest(parallel);
+    std::cout << "digest " << std::hex << serialDigest << std::dec
+              << (serialDigest == parallelDigest ? " (serial and parallel match)" : " MISMATCH") << std::endl;
+    return serialDigest == parallelDigest ? 0 : 1;
+}
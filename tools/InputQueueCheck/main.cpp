@@ -0,0 +1,188 @@
+// tools/InputQueueCheck/main.cpp
+// Folding and latency checks for InputQueue: runs of moves and scrolls sum
+// their deltas, pinch folds by product and rotate by sum, discrete events
+// are never folded and keep their order, and drains keep the latency stats
+// and the pointer history.
+// Usage: FinalStorm-InputQueueCheck
+
+#include "Core/Input/InputQueue.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace FinalStorm;
+
+namespace {
+
+int g_failures = 0;
+
+void check(bool condition, const std::string& what) {
+    std::cout << (condition ? "  ok    " : "  FAIL  ") << what << std::endl;
+    if (!condition) ++g_failures;
+}
+
+bool near(float a, float b) {
+    return std::fabs(a - b) <= 1e-4f * std::max(1.0f, std::fabs(b));
+}
+
+InputEvent pointer(InputEventType type, float x, float y, float dx = 0.0f, float dy = 0.0f) {
+    InputEvent event;
+    event.type = type;
+    event.position = float2(x, y);
+    event.delta = float2(dx, dy);
+    return event;
+}
+
+InputEvent gesture(GestureType kind, float value) {
+    InputEvent event;
+    event.type = InputEventType::Gesture;
+    event.gesture = kind;
+    event.gestureValue = value;
+    return event;
+}
+
+InputEvent key(InputEventType type, uint16_t keyCode) {
+    InputEvent event;
+    event.type = type;
+    event.keyCode = keyCode;
+    return event;
+}
+
+} // namespace
+
+int main() {
+    std::vector<InputEvent> events;
+
+    std::cout << "continuous events" << std::endl;
+    {
+        InputQueue queue;
+        for (int i = 1; i <= 5; ++i) {
+            queue.push(pointer(InputEventType::MouseMove, 10.0f * i, 20.0f * i, 1.0f, 2.0f));
+        }
+        queue.drain(events);
+        check(events.size() == 1 && near(events[0].delta.x, 5.0f) && near(events[0].delta.y, 10.0f),
+              "a run of moves folds into one with summed deltas");
+        check(events.size() == 1 && near(events[0].position.x, 50.0f) && near(events[0].position.y, 100.0f),
+              "the folded move keeps the newest position");
+
+        queue.push(pointer(InputEventType::MouseScroll, 0.0f, 0.0f, 0.0f, 1.5f));
+        queue.push(pointer(InputEventType::MouseScroll, 0.0f, 0.0f, 0.0f, -0.5f));
+        queue.push(pointer(InputEventType::MouseScroll, 0.0f, 0.0f, 0.0f, 3.0f));
+        queue.drain(events);
+        check(events.size() == 1 && near(events[0].delta.y, 4.0f), "a run of scrolls sums its deltas");
+
+        InputEvent shifted = pointer(InputEventType::MouseMove, 1.0f, 1.0f, 1.0f, 0.0f);
+        shifted.shift = true;
+        queue.push(pointer(InputEventType::MouseMove, 0.0f, 0.0f, 1.0f, 0.0f));
+        queue.push(shifted);
+        queue.drain(events);
+        check(events.size() == 2, "moves with different modifiers are not folded together");
+    }
+
+    std::cout << "gestures" << std::endl;
+    {
+        InputQueue queue;
+        queue.push(gesture(GestureType::Pinch, 1.1f));
+        queue.push(gesture(GestureType::Pinch, 1.2f));
+        queue.push(gesture(GestureType::Pinch, 0.5f));
+        queue.drain(events);
+        check(events.size() == 1 && near(events[0].gestureValue, 1.1f * 1.2f * 0.5f),
+              "pinch steps fold into their product");
+
+        queue.push(gesture(GestureType::Rotate, 0.1f));
+        queue.push(gesture(GestureType::Rotate, 0.2f));
+        queue.push(gesture(GestureType::Rotate, -0.05f));
+        queue.drain(events);
+        check(events.size() == 1 && near(events[0].gestureValue, 0.25f), "rotate steps fold into their sum");
+
+        queue.push(gesture(GestureType::Pinch, 2.0f));
+        queue.push(gesture(GestureType::Rotate, 0.5f));
+        queue.push(gesture(GestureType::Pinch, 2.0f));
+        queue.drain(events);
+        check(events.size() == 3 && near(events[0].gestureValue, 2.0f) && near(events[2].gestureValue, 2.0f),
+              "pinch runs split by a rotate fold separately");
+    }
+
+    std::cout << "discrete events" << std::endl;
+    {
+        InputQueue queue;
+        queue.push(pointer(InputEventType::MouseMove, 1.0f, 0.0f, 1.0f, 0.0f));
+        queue.push(pointer(InputEventType::MouseMove, 2.0f, 0.0f, 1.0f, 0.0f));
+        queue.push(pointer(InputEventType::MouseDown, 2.0f, 0.0f));
+        queue.push(pointer(InputEventType::MouseDown, 2.0f, 0.0f));
+        queue.push(pointer(InputEventType::MouseMove, 3.0f, 0.0f, 1.0f, 0.0f));
+        queue.push(pointer(InputEventType::MouseUp, 3.0f, 0.0f));
+        queue.push(key(InputEventType::KeyDown, 12));
+        queue.push(key(InputEventType::KeyDown, 12));
+        queue.push(key(InputEventType::KeyUp, 12));
+        queue.push(pointer(InputEventType::MouseMove, 4.0f, 0.0f, 1.0f, 0.0f));
+        queue.push(pointer(InputEventType::MouseMove, 5.0f, 0.0f, 1.0f, 0.0f));
+        queue.drain(events);
+
+        const InputEventType expected[] = {
+            InputEventType::MouseMove, InputEventType::MouseDown, InputEventType::MouseDown,
+            InputEventType::MouseMove, InputEventType::MouseUp, InputEventType::KeyDown,
+            InputEventType::KeyDown, InputEventType::KeyUp, InputEventType::MouseMove
+        };
+        bool ordered = events.size() == sizeof(expected) / sizeof(expected[0]);
+        for (size_t i = 0; ordered && i < events.size(); ++i) {
+            ordered = events[i].type == expected[i];
+        }
+        check(ordered, "clicks and keys are never folded and keep their order among moves");
+        check(ordered && near(events[0].delta.x, 2.0f) && near(events[3].delta.x, 1.0f) && near(events[8].delta.x, 2.0f),
+              "moves only fold within a run between discrete events");
+    }
+
+    std::cout << "latency and history" << std::endl;
+    {
+        InputQueue queue;
+        double start = InputQueue::now();
+        InputEvent old = pointer(InputEventType::MouseMove, 0.0f, 0.0f);
+        old.timestamp = start - 0.05;
+        queue.push(old);
+        queue.push(key(InputEventType::KeyDown, 1));
+        queue.drain(events);
+        const InputLatencyStats& stats = queue.getLatencyStats();
+        check(stats.frames == 1 && stats.received == 2 && stats.dispatched == 2, "drains count frames and events");
+        check(stats.lastMs >= 50.0f && stats.worstMs >= stats.lastMs && near(stats.averageMs, stats.lastMs),
+              "latency is the age of the oldest event drained");
+
+        check(queue.drain(events) == 0 && queue.getLatencyStats().frames == 1, "an empty drain leaves the stats alone");
+
+        queue.resetLatencyStats();
+        InputEvent fresh = pointer(InputEventType::MouseMove, 0.0f, 0.0f);
+        queue.push(fresh);
+        queue.drain(events);
+        check(queue.getLatencyStats().frames == 1 && queue.getLatencyStats().lastMs < 50.0f,
+              "events stamped on push measure from the push");
+
+        // 300 moves 1 ms apart, one point to the right each, in one drain
+        InputQueue history;
+        double t0 = InputQueue::now() - 1.0;
+        const size_t moveCount = 300;
+        for (size_t i = 0; i < moveCount; ++i) {
+            InputEvent move = pointer(InputEventType::MouseMove, static_cast<float>(i), 0.0f, 1.0f, 0.0f);
+            move.timestamp = t0 + i * 0.001;
+            history.push(move);
+        }
+        history.drain(events);
+        size_t count = history.getPointerSampleCount();
+        check(events.size() == 1 && count == InputQueue::HistorySize,
+              "folded moves still fill the 256-entry pointer history");
+        check(count == InputQueue::HistorySize &&
+              near(history.getPointerSample(0).position.x, static_cast<float>(moveCount - InputQueue::HistorySize)) &&
+              near(history.getPointerSample(count - 1).position.x, static_cast<float>(moveCount - 1)),
+              "history keeps the newest samples, oldest first");
+        float2 velocity = history.getPointerVelocity(0.05);
+        check(near(velocity.x, 1000.0f) && near(velocity.y, 0.0f), "pointer velocity over the history window");
+    }
+
+    if (g_failures > 0) {
+        std::cout << "FAIL: " << g_failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "PASS: input queue checks" << std::endl;
+    return 0;
+}
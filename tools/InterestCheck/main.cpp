@@ -0,0 +1,112 @@
+// tools/InterestCheck/main.cpp
+// Subscription tier checks for InterestManager: which tier changes it
+// announces on first sight, at steady state, after a reset, on demotion
+// and when a service leaves the scene.
+// Usage: FinalStorm-InterestCheck
+
+#include "Network/InterestManager.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace FinalStorm;
+
+namespace {
+
+int g_failures = 0;
+
+void check(bool condition, const std::string& what) {
+    std::cout << (condition ? "  ok    " : "  FAIL  ") << what << std::endl;
+    if (!condition) ++g_failures;
+}
+
+// Camera at the origin with an identity view-projection and a 90 degree
+// field of view, so a service of radius r at distance d covers r / d of the
+// viewport height and anything near the z axis is on screen
+InterestView makeView() {
+    InterestView view;
+    view.cameraPosition = vec3_zero();
+    view.viewProjection = make_mat4(1.0f);
+    view.fieldOfViewY = 3.14159265f * 0.5f;
+    return view;
+}
+
+InterestCandidate makeCandidate(const std::string& id, float distance) {
+    InterestCandidate candidate;
+    candidate.serviceId = id;
+    candidate.position = make_vec3(0.0f, 0.0f, distance);
+    candidate.radius = 1.0f;
+    return candidate;
+}
+
+// Service distances for each tier with the default thresholds
+constexpr float kNear = 5.0f;      // 0.2 of the viewport: Full
+constexpr float kFar = 1000.0f;    // 0.001: None
+
+bool changesAre(const InterestManager& manager, const std::vector<TierUpdateEntry>& expected) {
+    const auto& changes = manager.getChanges();
+    if (changes.size() != expected.size()) return false;
+    for (size_t i = 0; i < changes.size(); ++i) {
+        // Map iteration order is unspecified, so match entries by id
+        bool found = false;
+        for (const auto& entry : expected) {
+            found = found || (entry.serviceId == changes[i].serviceId && entry.tier == changes[i].tier);
+        }
+        if (!found) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main() {
+    InterestView view = makeView();
+    InterestManager manager;
+    std::vector<InterestCandidate> candidates = { makeCandidate("far", kFar) };
+
+    std::cout << "announcement" << std::endl;
+
+    manager.update(view, candidates, 0.016f);
+    check(changesAre(manager, { { "far", SubscriptionTier::None } }),
+          "first classification of None is announced");
+
+    manager.update(view, candidates, 0.016f);
+    check(manager.getChanges().empty(), "an unchanged tier is not announced again");
+
+    candidates.push_back(makeCandidate("near", kNear));
+    manager.update(view, candidates, 0.016f);
+    check(changesAre(manager, { { "near", SubscriptionTier::Full } }),
+          "first classification of Full is announced");
+
+    manager.reset();
+    manager.update(view, candidates, 0.016f);
+    check(changesAre(manager, { { "far", SubscriptionTier::None }, { "near", SubscriptionTier::Full } }),
+          "after reset every tier is announced again, None included");
+
+    std::cout << "changes" << std::endl;
+
+    // Demotion waits for demotionDelay; the first frame only starts the timer
+    candidates[1] = makeCandidate("near", kFar);
+    float delay = manager.getConfig().demotionDelay;
+    manager.update(view, candidates, delay * 0.5f);
+    check(manager.getChanges().empty(), "a demotion is held before demotionDelay");
+    manager.update(view, candidates, delay * 0.6f);
+    check(changesAre(manager, { { "near", SubscriptionTier::None } }), "the demotion applies after demotionDelay");
+
+    candidates[1] = makeCandidate("near", kNear);
+    manager.update(view, candidates, 0.016f);
+    check(changesAre(manager, { { "near", SubscriptionTier::Full } }), "a promotion applies at once");
+
+    candidates.pop_back();
+    manager.update(view, candidates, 0.016f);
+    check(changesAre(manager, { { "near", SubscriptionTier::None } }) &&
+          manager.getTier("near") == SubscriptionTier::None,
+          "a service that leaves the scene drops to None");
+
+    if (g_failures > 0) {
+        std::cout << "FAIL: " << g_failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "PASS: interest tier checks" << std::endl;
+    return 0;
+}
@@ -0,0 +1,256 @@
+// tools/PickBench/main.cpp
+// Ray picking benchmark: a dense service graph (service spheres plus tube
+// beams to their nearest neighbours, as BeamMesh builds them) picked from a
+// camera above it, checked against brute force and a per-pick budget.
+// Usage: FinalStorm-PickBench [--services N] [--beams N] [--picks N] [--budget US] [--seed N]
+
+#include "Scene/PickingSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace FinalStorm;
+
+namespace {
+
+// Beam tubes: sides around the circumference, rings along the length
+constexpr int TubeSides = 8;
+constexpr int TubeRings = 16;
+constexpr float TubeRadius = 0.1f;
+constexpr float ServiceRadius = 1.0f;
+
+// Rays checked against brute force before timing
+constexpr int VerifyRays = 200;
+
+struct Beam {
+    std::vector<vec3> vertices;
+    std::vector<uint32_t> indices;
+    TriangleBvh mesh;
+    mat4 world;
+};
+
+struct Graph {
+    std::vector<vec3> centers;
+    std::vector<uint32_t> handles;
+    std::vector<std::unique_ptr<Beam>> beams;
+};
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --services N   Service spheres (default 2000)\n"
+              << "  --beams N      Connection beams, mostly between neighbours (default 4000)\n"
+              << "  --picks N      Hover picks timed (default 20000)\n"
+              << "  --budget US    Most a 99th-percentile pick may take (default 1000)\n"
+              << "  --seed N       Layout seed (default 1)\n";
+}
+
+// Tube from the origin to end in the beam's local space
+void buildTube(const vec3& end, Beam& beam) {
+    vec3 axis = normalize(end);
+    vec3 side = normalize(cross(axis, std::fabs(axis.y) < 0.9f ? make_vec3(0.0f, 1.0f, 0.0f) : make_vec3(1.0f, 0.0f, 0.0f)));
+    vec3 up = cross(axis, side);
+    for (int ring = 0; ring <= TubeRings; ++ring) {
+        vec3 center = end * (static_cast<float>(ring) / TubeRings);
+        for (int j = 0; j < TubeSides; ++j) {
+            float angle = TWO_PI * j / TubeSides;
+            beam.vertices.push_back(center + (side * std::cos(angle) + up * std::sin(angle)) * TubeRadius);
+        }
+    }
+    for (int ring = 0; ring < TubeRings; ++ring) {
+        for (int j = 0; j < TubeSides; ++j) {
+            uint32_t a = ring * TubeSides + j;
+            uint32_t b = ring * TubeSides + (j + 1) % TubeSides;
+            beam.indices.insert(beam.indices.end(), { a, a + TubeSides, b, b, a + TubeSides, b + TubeSides });
+        }
+    }
+}
+
+void buildGraph(PickingSystem& picking, Graph& graph, uint32_t services, uint32_t beams, std::mt19937& random) {
+    std::uniform_real_distribution<float> spread(-60.0f, 60.0f);
+    std::uniform_real_distribution<float> height(-10.0f, 10.0f);
+    for (uint32_t i = 0; i < services; ++i) {
+        vec3 center = make_vec3(spread(random), height(random), spread(random));
+        graph.centers.push_back(center);
+        graph.handles.push_back(picking.addSphere("service" + std::to_string(i), PickLayer::Services, center, ServiceRadius));
+    }
+
+    // Most beams join a service to one of its close neighbours; one in twenty
+    // crosses the whole graph
+    for (uint32_t k = 0; k < beams; ++k) {
+        uint32_t from = k % services;
+        uint32_t to = (from + 1) % services;
+        if (random() % 20 == 0) {
+            to = random() % services;
+        } else {
+            float closest = 1e30f;
+            for (uint32_t j = 0; j < services; ++j) {
+                float distance = length(graph.centers[j] - graph.centers[from]);
+                if (j != from && distance < closest && random() % 3 != 0) {
+                    closest = distance;
+                    to = j;
+                }
+            }
+        }
+        if (to == from) continue;
+
+        auto beam = std::make_unique<Beam>();
+        buildTube(graph.centers[to] - graph.centers[from], *beam);
+        beam->world = translate(make_mat4(), graph.centers[from]);
+        beam->mesh.build(beam->vertices, beam->indices);
+        Beam* source = beam.get();
+        picking.addMesh("beam" + std::to_string(k), PickLayer::Connections, beam->mesh.getBounds(), beam->world,
+                        [source]() -> const TriangleBvh* { return &source->mesh; });
+        graph.beams.push_back(std::move(beam));
+    }
+}
+
+// Nearest hit distance by testing every sphere and triangle
+float bruteForce(const Graph& graph, const Ray& ray) {
+    float best = 1e30f;
+    for (const vec3& center : graph.centers) {
+        vec3 offset = ray.origin - center;
+        float b = dot(offset, ray.direction);
+        float c = dot(offset, offset) - ServiceRadius * ServiceRadius;
+        float discriminant = b * b - c;
+        if (discriminant < 0.0f) continue;
+        float distance = c <= 0.0f ? 0.0f : -b - std::sqrt(discriminant);
+        if (distance >= 0.0f) best = std::min(best, distance);
+    }
+    for (const auto& beam : graph.beams) {
+        vec4 local = inverse(beam->world) * make_vec4(ray.origin, 1.0f);
+        vec3 origin = make_vec3(local.x, local.y, local.z);
+        for (size_t t = 0; t < beam->indices.size(); t += 3) {
+            vec3 v0 = beam->vertices[beam->indices[t]];
+            vec3 edge1 = beam->vertices[beam->indices[t + 1]] - v0;
+            vec3 edge2 = beam->vertices[beam->indices[t + 2]] - v0;
+            vec3 p = cross(ray.direction, edge2);
+            float det = dot(edge1, p);
+            if (std::fabs(det) < 1e-12f) continue;
+            vec3 s = origin - v0;
+            float u = dot(s, p) / det;
+            if (u < 0.0f || u > 1.0f) continue;
+            vec3 q = cross(s, edge1);
+            float v = dot(ray.direction, q) / det;
+            if (v < 0.0f || u + v > 1.0f) continue;
+            float distance = dot(edge2, q) / det;
+            if (distance >= 0.0f) best = std::min(best, distance);
+        }
+    }
+    return best;
+}
+
+Ray hoverRay(std::mt19937& random) {
+    std::uniform_real_distribution<float> spread(-60.0f, 60.0f);
+    std::uniform_real_distribution<float> height(-10.0f, 10.0f);
+    vec3 eye = make_vec3(0.0f, 60.0f, 120.0f);
+    return Ray(eye, make_vec3(spread(random), height(random), spread(random)) - eye);
+}
+
+double percentile(const std::vector<double>& sorted, double fraction) {
+    return sorted[std::min(sorted.size() - 1, static_cast<size_t>(fraction * sorted.size()))];
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    uint32_t services = 2000;
+    uint32_t beams = 4000;
+    uint32_t picks = 20000;
+    double budget = 1000.0;
+    uint32_t seed = 1;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            printUsage(argv[0]);
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return 1;
+        }
+
+        const char* value = argv[++i];
+        if (arg == "--services") services = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--beams") beams = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--picks") picks = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--budget") budget = std::strtod(value, nullptr);
+        else if (arg == "--seed") seed = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (services < 2 || picks == 0) {
+        std::cerr << "Need at least two services and one pick" << std::endl;
+        return 1;
+    }
+
+    std::mt19937 random(seed);
+    PickingSystem picking;
+    Graph graph;
+
+    auto start = std::chrono::steady_clock::now();
+    buildGraph(picking, graph, services, beams, random);
+    PickHit hit;
+    picking.pick(hoverRay(random), 1e30f, PickLayer::All, hit);     // Builds the broadphase tree
+    double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    int mismatches = 0;
+    for (int i = 0; i < VerifyRays; ++i) {
+        Ray ray = hoverRay(random);
+        float expected = bruteForce(graph, ray);
+        bool found = picking.pick(ray, 1e30f, PickLayer::All, hit);
+        if (found != (expected < 1e30f) || (found && std::fabs(hit.distance - expected) > 1e-3f)) ++mismatches;
+    }
+
+    std::vector<double> times;
+    times.reserve(picks);
+    uint32_t hits = 0;
+    for (uint32_t i = 0; i < picks; ++i) {
+        Ray ray = hoverRay(random);
+        auto pickStart = std::chrono::steady_clock::now();
+        hits += picking.pick(ray, 1e30f, PickLayer::All, hit) ? 1 : 0;
+        times.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - pickStart).count());
+    }
+    std::sort(times.begin(), times.end());
+
+    // Every service drifts, then one pick pays for the refit
+    std::uniform_real_distribution<float> drift(-0.5f, 0.5f);
+    for (uint32_t i = 0; i < services; ++i) {
+        graph.centers[i] = graph.centers[i] + make_vec3(drift(random), 0.0f, drift(random));
+        picking.setSphere(graph.handles[i], graph.centers[i], ServiceRadius);
+    }
+    auto refitStart = std::chrono::steady_clock::now();
+    picking.pick(hoverRay(random), 1e30f, PickLayer::All, hit);
+    double refitUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - refitStart).count();
+
+    double p99 = percentile(times, 0.99);
+    std::cout << services << " services, " << graph.beams.size() << " beams of "
+              << TubeRings * TubeSides * 2 << " triangles (graph set up in " << std::setprecision(1) << std::fixed
+              << buildMs << " ms)\n"
+              << "  verify         " << mismatches << " of " << VerifyRays << " rays differ from brute force\n"
+              << "  hover picks    " << picks << ", " << hits << " hit\n"
+              << "  per pick       p50 " << percentile(times, 0.5) << " us, p99 " << p99
+              << " us, max " << times.back() << " us\n"
+              << "  refit + pick   " << refitUs << " us after moving every service\n";
+
+    if (mismatches > 0) {
+        std::cout << "FAIL: picks disagree with brute force" << std::endl;
+        return 1;
+    }
+    if (p99 > budget) {
+        std::cout << "FAIL: p99 " << p99 << " us is over the " << budget << " us budget" << std::endl;
+        return 1;
+    }
+    std::cout << "PASS: p99 " << p99 << " us within the " << budget << " us budget" << std::endl;
+    return 0;
+}
@@ -0,0 +1,149 @@
+// tools/ServiceListCheck/main.cpp
+// Service list checks for ServiceListParser and ServiceDirectory: a list fed
+// in small chunks, a list that ends before its last service, and service ids
+// too long for the directory's records.
+// Usage: FinalStorm-ServiceListCheck
+
+#include "Network/ServiceDirectory.h"
+#include "Network/ServiceListParser.h"
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace FinalStorm;
+
+namespace {
+
+int g_failures = 0;
+
+void check(bool condition, const std::string& what) {
+    std::cout << (condition ? "  ok    " : "  FAIL  ") << what << std::endl;
+    if (!condition) ++g_failures;
+}
+
+ServiceStatusPayload makeService(const std::string& id) {
+    ServiceStatusPayload status;
+    status.serviceId = id;
+    status.serviceName = id;
+    status.serviceType = "test";
+    return status;
+}
+
+// Header for serviceCount services followed by the records for ids
+std::vector<uint8_t> makeList(uint32_t serviceCount, const std::vector<std::string>& ids) {
+    std::vector<uint8_t> stream;
+    appendServiceListHeader(stream, serviceCount);
+    for (const auto& id : ids) {
+        appendServiceRecord(stream, makeService(id));
+    }
+    return stream;
+}
+
+ServiceListParser::Result feedInChunks(ServiceListParser& parser, const std::vector<uint8_t>& stream, size_t chunkSize) {
+    auto result = ServiceListParser::Result::NeedMore;
+    for (size_t offset = 0; offset < stream.size(); offset += chunkSize) {
+        size_t size = std::min(chunkSize, stream.size() - offset);
+        result = parser.feed(stream.data() + offset, size);
+    }
+    return result;
+}
+
+bool isOnline(const ServiceDirectory& directory, const std::string& id) {
+    const ServiceRecord* record = directory.find(id);
+    return record != nullptr && record->status == ServiceStatus::Online;
+}
+
+// Counts how each list ends
+struct EndCounter : ServiceListHandler {
+    int ended = 0;
+    int abandoned = 0;
+    void onListEnd() override { ++ended; }
+    void onListAbandoned() override { ++abandoned; }
+};
+
+} // namespace
+
+int main() {
+    std::cout << "chunked list" << std::endl;
+
+    ServiceDirectory directory;
+    ServiceListParser parser;
+    {
+        auto stream = makeList(3, { "alpha", "beta", "gamma" });
+        parser.begin(&directory);
+        auto result = feedInChunks(parser, stream, 1);
+        check(result == ServiceListParser::Result::Complete && directory.size() == 3 &&
+              isOnline(directory, "alpha") && isOnline(directory, "beta") && isOnline(directory, "gamma"),
+              "a list fed a byte at a time completes with every service");
+    }
+
+    std::cout << "incomplete list" << std::endl;
+
+    {
+        // Header promises three services; the last chunk carries one
+        auto stream = makeList(3, { "alpha" });
+        parser.begin(&directory);
+        auto result = parser.feed(stream.data(), stream.size());
+        check(result == ServiceListParser::Result::NeedMore, "a short list still needs more");
+        parser.abandon();
+        check(!parser.isActive(), "abandon ends the list");
+        check(isOnline(directory, "beta") && isOnline(directory, "gamma"),
+              "services an abandoned list did not reach stay online");
+
+        stream = makeList(1, { "alpha" });
+        parser.begin(&directory);
+        parser.feed(stream.data(), stream.size());
+        check(!isOnline(directory, "beta") && !isOnline(directory, "gamma"),
+              "the next complete list still takes services offline");
+    }
+
+    {
+        EndCounter counter;
+        auto stream = makeList(2, { "alpha" });
+        parser.begin(&counter);
+        parser.feed(stream.data(), stream.size());
+        parser.abandon();
+        parser.abandon();
+        check(counter.abandoned == 1 && counter.ended == 0, "an abandoned list is reported once");
+
+        stream = makeList(1, { "alpha" });
+        parser.begin(&counter);
+        parser.feed(stream.data(), stream.size());
+        parser.abandon();
+        check(counter.abandoned == 1 && counter.ended == 1, "a completed list is not reported abandoned");
+
+        stream = makeList(2, { "alpha" });
+        parser.begin(&counter);
+        parser.feed(stream.data(), stream.size());
+        parser.begin(&counter);
+        check(counter.abandoned == 2, "starting a new list abandons the one in progress");
+        parser.abandon();
+    }
+
+    std::cout << "long ids" << std::endl;
+
+    {
+        ServiceDirectory longIds;
+        std::string prefix(ServiceRecord().id.capacity, 'x');
+        auto stream = makeList(3, { prefix + "-one", prefix + "-two", "short" });
+        parser.begin(&longIds);
+        parser.feed(stream.data(), stream.size());
+        check(longIds.size() == 1 && longIds.getRejectedCount() == 2 && isOnline(longIds, "short"),
+              "ids longer than the record holds are rejected, not merged");
+        check(longIds.find(prefix) == nullptr, "no record is keyed on the truncated prefix");
+
+        stream = makeList(1, { prefix });
+        parser.begin(&longIds);
+        parser.feed(stream.data(), stream.size());
+        check(isOnline(longIds, prefix) && longIds.getRejectedCount() == 2,
+              "an id of exactly the record capacity is kept");
+    }
+
+    if (g_failures > 0) {
+        std::cout << "FAIL: " << g_failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "PASS: service list checks" << std::endl;
+    return 0;
+}
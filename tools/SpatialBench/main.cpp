@@ -0,0 +1,227 @@
+// tools/SpatialBench/main.cpp
+// Offline spatial audio benchmark: N mono voices circling the listener,
+// rendered through the HRTF convolvers and the shared reverb, checked against
+// a CPU budget. A panned pass of the same scene gives the baseline.
+// Usage: FinalStorm-SpatialBench [--voices N] [--seconds N] [--rate N] [--budget PCT] [--out file.wav]
+
+#include "Core/Audio/AudioMixer.h"
+#include "Core/Audio/AudioOutput.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace FinalStorm;
+
+namespace {
+
+constexpr float TwoPi = 6.28318531f;
+
+struct PassResult {
+    double totalMs = 0.0;
+    double worstMs = 0.0;
+    size_t blocks = 0;
+};
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --voices N     Spatialized voices playing at once (default 64)\n"
+              << "  --seconds N    Seconds of audio rendered per pass (default 20)\n"
+              << "  --rate N       Output sample rate (default 48000)\n"
+              << "  --budget PCT   Most of one core the binaural pass may use (default 25)\n"
+              << "  --out PATH     Also write the binaural pass to a 16-bit WAV file\n";
+}
+
+// Mono loop: a pitched tone over a little noise, so the HRTF has highs to shape
+std::unique_ptr<AudioBuffer> makeSource(float frequency, uint32_t sampleRate, uint32_t seed) {
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> noise(-1.0f, 1.0f);
+    float phase = TwoPi * 0.5f * (noise(random) + 1.0f);    // Loops restart together; phases must not
+    size_t frames = sampleRate;
+    std::vector<float> samples(frames);
+    for (size_t i = 0; i < frames; ++i) {
+        float t = static_cast<float>(i) / sampleRate;
+        samples[i] = 0.4f * std::sin(TwoPi * frequency * t + phase) + 0.1f * noise(random);
+    }
+    return std::make_unique<AudioBuffer>(std::move(samples), 1, sampleRate);
+}
+
+PassResult runPass(AudioMixer& mixer, const std::vector<std::unique_ptr<AudioBuffer>>& clips,
+                   uint32_t voiceCount, double seconds, bool binaural, WavFileOutput* wav) {
+    const uint32_t sampleRate = mixer.getSampleRate();
+    const float gain = 0.7f / std::sqrt(static_cast<float>(voiceCount));
+
+    // Voices spread around the listener, each circling at its own rate and height
+    std::vector<float> speeds(voiceCount);
+    std::vector<float> heights(voiceCount);
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    for (uint32_t voice = 0; voice < voiceCount; ++voice) {
+        speeds[voice] = (unit(random) - 0.5f) * 2.0f;       // Up to one radian a second
+        heights[voice] = (unit(random) - 0.3f) * 1.2f;
+
+        AudioCommand command;
+        command.type = AudioCommandType::Play;
+        command.voice = voice;
+        command.buffer = clips[voice].get();
+        command.looping = true;
+        command.gainLeft = command.gainRight = gain;
+        command.azimuth = TwoPi * voice / voiceCount;
+        command.elevation = heights[voice];
+        command.send = 0.5f * gain;
+        command.binaural = binaural;
+        while (!mixer.post(command)) {
+            mixer.render(nullptr, 0);
+        }
+    }
+
+    AudioCommand reverb;
+    reverb.type = AudioCommandType::SetReverb;
+    reverb.reverb.decaySeconds = 2.0f;
+    mixer.post(reverb);
+
+    // Game-rate parameter traffic: every voice moves once per 60 Hz update
+    PassResult result;
+    result.blocks = static_cast<size_t>(seconds * sampleRate / AudioMixer::BlockSize);
+    const size_t blocksPerUpdate = std::max<size_t>(1, sampleRate / 60 / AudioMixer::BlockSize);
+    std::vector<float> block(AudioMixer::BlockSize * AudioMixer::Channels);
+    for (size_t b = 0; b < result.blocks; ++b) {
+        if (b % blocksPerUpdate == 0) {
+            float time = static_cast<float>(b * AudioMixer::BlockSize) / sampleRate;
+            for (uint32_t voice = 0; voice < voiceCount; ++voice) {
+                float azimuth = TwoPi * voice / voiceCount + speeds[voice] * time;
+                AudioCommand params;
+                params.type = AudioCommandType::SetParams;
+                params.voice = voice;
+                params.azimuth = azimuth;
+                params.elevation = heights[voice];
+                params.send = 0.5f * gain;
+                if (binaural) {
+                    params.gainLeft = params.gainRight = gain;
+                } else {
+                    float pan = 0.5f + 0.5f * std::sin(azimuth);
+                    params.gainLeft = gain * std::cos(pan * 1.5707963f);
+                    params.gainRight = gain * std::sin(pan * 1.5707963f);
+                }
+                while (!mixer.post(params)) {
+                    mixer.render(nullptr, 0);
+                }
+            }
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        mixer.render(block.data(), AudioMixer::BlockSize);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        result.totalMs += ms;
+        result.worstMs = std::max(result.worstMs, ms);
+
+        if (wav) wav->write(block.data(), AudioMixer::BlockSize);
+    }
+    return result;
+}
+
+void printPass(const char* name, const PassResult& pass, uint32_t voiceCount, uint32_t sampleRate) {
+    double audioMs = 1000.0 * pass.blocks * AudioMixer::BlockSize / sampleRate;
+    std::cout << std::fixed
+              << "  " << name << "\n"
+              << "    mean block   " << std::setprecision(3) << pass.totalMs / pass.blocks << " ms\n"
+              << "    worst block  " << pass.worstMs << " ms\n"
+              << "    load         " << std::setprecision(2) << 100.0 * pass.totalMs / audioMs << "% of one core\n"
+              << "    per voice    " << std::setprecision(3) << 1000.0 * pass.totalMs / pass.blocks / voiceCount << " us per block\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    uint32_t voiceCount = 64;
+    double seconds = 20.0;
+    uint32_t sampleRate = 48000;
+    double budget = 25.0;
+    std::string outPath;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            printUsage(argv[0]);
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return 1;
+        }
+
+        const char* value = argv[++i];
+        if (arg == "--voices") voiceCount = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--seconds") seconds = std::strtod(value, nullptr);
+        else if (arg == "--rate") sampleRate = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--budget") budget = std::strtod(value, nullptr);
+        else if (arg == "--out") outPath = value;
+        else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (voiceCount == 0) {
+        std::cerr << "Need at least one voice" << std::endl;
+        return 1;
+    }
+
+    // One pitch per voice, so the sources sum incoherently and the mix stays in range
+    std::vector<std::unique_ptr<AudioBuffer>> clips;
+    for (uint32_t voice = 0; voice < voiceCount; ++voice) {
+        clips.push_back(makeSource(110.0f * std::pow(2.0f, voice / 12.0f * 0.37f), sampleRate, voice + 1));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto hrtf = HrtfSet::createSphericalHead(sampleRate);
+    double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::unique_ptr<WavFileOutput> wav;
+    if (!outPath.empty()) {
+        wav = std::make_unique<WavFileOutput>(outPath);
+        if (!wav->open(sampleRate, AudioMixer::Channels)) {
+            std::cerr << "Cannot write " << outPath << std::endl;
+            return 1;
+        }
+    }
+
+    AudioMixer binauralMixer(sampleRate, voiceCount, hrtf);
+    PassResult binaural = runPass(binauralMixer, clips, voiceCount, seconds, true, wav.get());
+    if (wav) wav->close();
+
+    AudioMixer pannedMixer(sampleRate, voiceCount);
+    PassResult panned = runPass(pannedMixer, clips, voiceCount, seconds, false, nullptr);
+
+    double audioMs = 1000.0 * binaural.blocks * AudioMixer::BlockSize / sampleRate;
+    double load = 100.0 * binaural.totalMs / audioMs;
+    double perVoice = (binaural.totalMs - panned.totalMs) / audioMs * 100.0 / voiceCount;
+    uint32_t affordable = static_cast<uint32_t>(budget / (load / voiceCount));
+
+    std::cout << voiceCount << " voices, " << binaural.blocks << " blocks of " << AudioMixer::BlockSize
+              << " frames at " << sampleRate << " Hz, HRIR " << hrtf->getLength() << " taps in "
+              << hrtf->getPartitionCount() << " partitions (set built in " << std::setprecision(1) << std::fixed
+              << buildMs << " ms)\n";
+    printPass("binaural + reverb", binaural, voiceCount, sampleRate);
+    printPass("panned + reverb", panned, voiceCount, sampleRate);
+    std::cout << std::setprecision(3)
+              << "  HRTF cost      " << perVoice << "% of one core per voice\n"
+              << "  budget         " << std::setprecision(1) << budget << "%: about "
+              << affordable << " binaural voices fit\n";
+    if (wav) {
+        std::cout << "  wrote " << outPath << " (" << wav->getFramesWritten() << " frames)" << std::endl;
+    }
+
+    if (load > budget) {
+        std::cout << "FAIL: " << std::setprecision(2) << load << "% is over the " << budget << "% budget" << std::endl;
+        return 1;
+    }
+    std::cout << "PASS: " << std::setprecision(2) << load << "% within the " << budget << "% budget" << std::endl;
+    return 0;
+}
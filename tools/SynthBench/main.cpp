@@ -0,0 +1,208 @@
+// tools/SynthBench/main.cpp
+// Offline synth benchmark: chords of band-limited partials on mixer synth voices
+// Usage: FinalStorm-SynthBench [--partials N] [--voices N] [--seconds N] [--rate N] [--out file.wav]
+
+#include "Core/Audio/AudioMixer.h"
+#include "Core/Audio/AudioOutput.h"
+#include "Core/Audio/OscillatorBank.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace FinalStorm;
+
+namespace {
+
+constexpr double TwoPi = 6.28318530717958648;
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --partials N   Partials sounding at once, spread over the voices (default 384)\n"
+              << "  --voices N     Synth voices, one per service ring (default 12)\n"
+              << "  --seconds N    Seconds of audio rendered (default 20)\n"
+              << "  --rate N       Output sample rate (default 48000)\n"
+              << "  --out PATH     Also write the mix to a 16-bit WAV file\n";
+}
+
+// Accuracy of one held sine note: largest difference from std::sin over the
+// first second, and how far its peak has moved from 1 after seconds
+void measureAccuracy(uint32_t sampleRate, double seconds, double& error, double& drift) {
+    OscillatorBank bank(sampleRate, 4);
+    SynthNote note;
+    note.frequency = 997.0f;
+    note.amplitude = 1.0f;
+    note.envelope.attack = 0.0f;
+    note.envelope.decay = 0.0f;
+    note.envelope.sustain = 1.0f;
+    bank.noteOn(note);
+
+    std::vector<float> block(AudioMixer::BlockSize);
+    const size_t blocks = static_cast<size_t>(seconds * sampleRate / AudioMixer::BlockSize);
+    const size_t firstSecond = sampleRate / AudioMixer::BlockSize;
+    error = 0.0;
+    double peak = 0.0;
+    for (size_t b = 0; b < blocks; ++b) {
+        bank.render(block.data(), block.size());
+        for (size_t i = 0; i < block.size(); ++i) {
+            if (b > 0 && b < firstSecond) {     // The envelope ramps in over the first block
+                double frame = static_cast<double>(b * block.size() + i);
+                double expected = std::sin(TwoPi * note.frequency * frame / sampleRate);
+                error = std::max(error, std::fabs(block[i] - expected));
+            }
+            if (b + firstSecond >= blocks) {
+                peak = std::max(peak, static_cast<double>(std::fabs(block[i])));
+            }
+        }
+    }
+    drift = std::fabs(peak - 1.0);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    uint32_t partialTarget = 384;
+    uint32_t voiceCount = 12;
+    double seconds = 20.0;
+    uint32_t sampleRate = 48000;
+    std::string outPath;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            printUsage(argv[0]);
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return 1;
+        }
+
+        const char* value = argv[++i];
+        if (arg == "--partials") partialTarget = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--voices") voiceCount = std::max<uint32_t>(1, static_cast<uint32_t>(std::strtoul(value, nullptr, 10)));
+        else if (arg == "--seconds") seconds = std::strtod(value, nullptr);
+        else if (arg == "--rate") sampleRate = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--out") outPath = value;
+        else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    // Each voice holds four-note chords of eight-partial tones; chords are
+    // re-struck with overlapping releases, so the bank also adds and retires
+    // notes while it plays
+    constexpr uint32_t ChordNotes = 4;
+    constexpr uint32_t Harmonics = 8;
+    const uint32_t partialsPerVoice = std::max<uint32_t>(ChordNotes * Harmonics, partialTarget / voiceCount);
+    const uint32_t chordsPerVoice = std::max<uint32_t>(1, partialsPerVoice / (ChordNotes * Harmonics));
+
+    AudioMixer mixer(sampleRate, voiceCount);
+    std::vector<std::unique_ptr<OscillatorBank>> banks;
+    for (uint32_t voice = 0; voice < voiceCount; ++voice) {
+        banks.push_back(std::make_unique<OscillatorBank>(sampleRate, partialsPerVoice * 2));
+
+        AudioCommand command;
+        command.type = AudioCommandType::Play;
+        command.voice = voice;
+        command.synth = banks.back().get();
+        float pan = (voice + 0.5f) / voiceCount;
+        float gain = 1.0f / std::sqrt(static_cast<float>(voiceCount * chordsPerVoice * ChordNotes));
+        command.gainLeft = gain * std::cos(pan * 1.5707963f);
+        command.gainRight = gain * std::sin(pan * 1.5707963f);
+        mixer.post(command);
+    }
+
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> degree(0, 11);
+    static const float Intervals[ChordNotes] = { 1.0f, 1.2599f, 1.4983f, 2.0f };     // Major triad plus octave
+    uint32_t nextId = 1;
+    auto strike = [&](uint32_t voice, float hold) {
+        for (uint32_t c = 0; c < chordsPerVoice; ++c) {
+            float root = 110.0f * std::pow(2.0f, degree(random) / 12.0f) * (1 + c % 3);
+            for (float interval : Intervals) {
+                AudioCommand command;
+                command.type = AudioCommandType::NoteOn;
+                command.voice = voice;
+                command.note.id = nextId++;
+                command.note.frequency = root * interval;
+                command.note.waveform = (voice % 2) ? SynthWaveform::Saw : SynthWaveform::Square;
+                command.note.harmonics = Harmonics * ((voice % 2) ? 1 : 2);     // Square: odd ones only
+                command.note.amplitude = 0.5f;
+                command.note.duration = hold;
+                command.note.envelope.release = 0.25f;
+                while (!mixer.post(command)) {
+                    mixer.render(nullptr, 0);
+                }
+            }
+        }
+    };
+
+    std::unique_ptr<WavFileOutput> wav;
+    if (!outPath.empty()) {
+        wav = std::make_unique<WavFileOutput>(outPath);
+        if (!wav->open(sampleRate, AudioMixer::Channels)) {
+            std::cerr << "Cannot write " << outPath << std::endl;
+            return 1;
+        }
+    }
+
+    // Chords last two seconds; voices re-strike in turn, offset from each other
+    const size_t blockCount = static_cast<size_t>(seconds * sampleRate / AudioMixer::BlockSize);
+    const size_t strikeBlocks = static_cast<size_t>(2.0 * sampleRate / AudioMixer::BlockSize);
+    std::vector<float> block(AudioMixer::BlockSize * AudioMixer::Channels);
+    double totalMs = 0.0;
+    double worstMs = 0.0;
+    size_t partialBlocks = 0;
+    for (size_t b = 0; b < blockCount; ++b) {
+        for (uint32_t voice = 0; voice < voiceCount; ++voice) {
+            if ((b + voice * strikeBlocks / voiceCount) % strikeBlocks == 0) {
+                strike(voice, 2.0f);
+            }
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        mixer.render(block.data(), AudioMixer::BlockSize);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        totalMs += ms;
+        worstMs = std::max(worstMs, ms);
+
+        for (const auto& bank : banks) {
+            partialBlocks += bank->getPartialCount();
+        }
+        if (wav) wav->write(block.data(), AudioMixer::BlockSize);
+    }
+    if (wav) wav->close();
+
+    double error = 0.0;
+    double drift = 0.0;
+    measureAccuracy(sampleRate, 60.0, error, drift);
+
+    double audioMs = 1000.0 * blockCount * AudioMixer::BlockSize / sampleRate;
+    double blockMs = 1000.0 * AudioMixer::BlockSize / sampleRate;
+    double meanPartials = static_cast<double>(partialBlocks) / blockCount;
+    double partialSamples = static_cast<double>(partialBlocks) * AudioMixer::BlockSize;
+    std::cout << std::fixed << std::setprecision(3)
+              << voiceCount << " synth voices, " << std::setprecision(0) << meanPartials << " partials on average, "
+              << blockCount << " blocks of " << AudioMixer::BlockSize << " frames at " << sampleRate << " Hz\n"
+              << std::setprecision(3)
+              << "  mean block   " << totalMs / blockCount << " ms (budget " << blockMs << " ms)\n"
+              << "  worst block  " << worstMs << " ms\n"
+              << "  realtime     " << std::setprecision(1) << audioMs / totalMs << "x, "
+              << std::setprecision(2) << 100.0 * totalMs / audioMs << "% of one core\n"
+              << "  per partial  " << std::setprecision(2) << 1e6 * totalMs / partialSamples << " ns per sample\n"
+              << "  sine error   " << std::scientific << std::setprecision(1) << error
+              << " against std::sin, peak drift " << drift << " after 60 s" << std::endl;
+    if (wav) {
+        std::cout << "  wrote " << outPath << " (" << wav->getFramesWritten() << " frames)" << std::endl;
+    }
+    return 0;
+}
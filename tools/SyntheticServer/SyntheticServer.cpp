@@ -0,0 +1,612 @@
+// tools/SyntheticServer/SyntheticServer.cpp
+// Local synthetic Finalverse server implementation
+// Single-threaded poll() loop; every outbound message is a binary WebSocket frame
+
+#include "SyntheticServer/SyntheticServer.h"
+#include "Network/ServiceListParser.h"
+#include "Network/WebSocketProtocol.h"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace FinalStorm {
+
+namespace {
+
+const char* kServiceTypes[] = {
+    "api-gateway", "database", "ai-service", "audio-service",
+    "world-engine", "community", "harmony-service", "echo-engine"
+};
+
+bool setNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+double secondsSince(const std::chrono::steady_clock::time_point& start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+float drift(std::mt19937& rng, float value, float step, float minValue, float maxValue) {
+    std::uniform_real_distribution<float> dist(-step, step);
+    return std::max(minValue, std::min(maxValue, value + dist(rng)));
+}
+
+// How many reports a tier skips between the ones it receives
+uint32_t tierInterval(SubscriptionTier tier) {
+    switch (tier) {
+        case SubscriptionTier::Full: return 1;
+        case SubscriptionTier::Reduced: return 4;
+        case SubscriptionTier::Summary: return 16;
+        case SubscriptionTier::None: break;
+    }
+    return 0;
+}
+
+} // namespace
+
+SyntheticServer::SyntheticServer()
+    : m_running(false)
+    , m_listenFd(-1)
+    , m_nextService(0)
+    , m_nextEntity(0)
+    , m_metricsDebt(0.0)
+    , m_entityDebt(0.0)
+    , m_connectionDebt(0.0)
+    , m_messagesSent(0)
+    , m_bytesQueued(0)
+    , m_messagesDropped(0)
+    , m_lastStatsTime(0.0) {
+}
+
+SyntheticServer::~SyntheticServer() {
+    for (auto& client : m_clients) {
+        if (client.fd >= 0) ::close(client.fd);
+    }
+    if (m_listenFd >= 0) ::close(m_listenFd);
+}
+
+bool SyntheticServer::start(const SyntheticServerConfig& config) {
+    m_config = config;
+    m_rng.seed(config.seed);
+
+    m_listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (m_listenFd < 0) {
+        std::cerr << "[SyntheticServer] socket failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    int reuse = 1;
+    setsockopt(m_listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    // Loopback only: this process must never be reachable from the network
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(config.port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if (bind(m_listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        listen(m_listenFd, 16) != 0 || !setNonBlocking(m_listenFd)) {
+        std::cerr << "[SyntheticServer] cannot listen on 127.0.0.1:" << config.port
+                  << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    createPopulation();
+
+    std::cout << "[SyntheticServer] listening on ws://127.0.0.1:" << config.port
+              << " services=" << m_services.size()
+              << " entities=" << m_entities.size() << std::endl;
+    return true;
+}
+
+void SyntheticServer::createPopulation() {
+    const size_t typeCount = sizeof(kServiceTypes) / sizeof(kServiceTypes[0]);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    m_services.resize(m_config.serviceCount);
+    for (uint32_t i = 0; i < m_config.serviceCount; ++i) {
+        SimService& service = m_services[i];
+        service.type = kServiceTypes[i % typeCount];
+        service.id = "svc-" + std::to_string(i);
+        service.name = service.type + "-" + std::to_string(i / typeCount);
+        service.metrics.serviceId = service.id;
+        service.metrics.cpuUsage = 10.0f + unit(m_rng) * 50.0f;
+        service.metrics.memoryUsage = 20.0f + unit(m_rng) * 50.0f;
+        service.metrics.requestsPerSecond = static_cast<uint32_t>(unit(m_rng) * 1000.0f);
+        service.metrics.averageLatency = 5.0f + unit(m_rng) * 100.0f;
+        service.metrics.errorRate = unit(m_rng) * 2.0f;
+        service.metrics.activeConnections = static_cast<uint32_t>(unit(m_rng) * 200.0f);
+    }
+
+    m_entities.resize(m_config.entityCount);
+    for (uint32_t i = 0; i < m_config.entityCount; ++i) {
+        SimEntity& entity = m_entities[i];
+        entity.id = i + 1;
+        for (int axis = 0; axis < 3; axis += 2) {
+            entity.position[axis] = (unit(m_rng) - 0.5f) * 1024.0f;
+            entity.velocity[axis] = (unit(m_rng) - 0.5f) * 4.0f;
+        }
+    }
+}
+
+void SyntheticServer::run() {
+    m_running = true;
+    auto startTime = std::chrono::steady_clock::now();
+    double lastTick = 0.0;
+
+    std::vector<pollfd> fds;
+    while (m_running) {
+        fds.clear();
+        fds.push_back({ m_listenFd, POLLIN, 0 });
+        for (const auto& client : m_clients) {
+            short events = POLLIN;
+            if (client.outputOffset < client.output.size()) events |= POLLOUT;
+            fds.push_back({ client.fd, events, 0 });
+        }
+
+        if (poll(fds.data(), fds.size(), 1) < 0 && errno != EINTR) {
+            std::cerr << "[SyntheticServer] poll failed: " << std::strerror(errno) << std::endl;
+            break;
+        }
+
+        if (fds[0].revents & POLLIN) {
+            acceptClients();
+        }
+
+        // New clients were appended after fds was built, so indices still line up
+        for (size_t i = 1; i < fds.size(); ++i) {
+            Client& client = m_clients[i - 1];
+            if (fds[i].revents & (POLLERR | POLLHUP | POLLNVAL)) client.closing = true;
+            if (!client.closing && (fds[i].revents & POLLIN)) readClient(client);
+            if (!client.closing && (fds[i].revents & POLLOUT)) writeClient(client);
+        }
+
+        double now = secondsSince(startTime);
+        tick(now, now - lastTick);
+        lastTick = now;
+
+        for (auto& client : m_clients) {
+            if (!client.closing && client.outputOffset < client.output.size()) writeClient(client);
+        }
+
+        for (auto& client : m_clients) {
+            if (client.closing) closeClient(client);
+        }
+        m_clients.erase(std::remove_if(m_clients.begin(), m_clients.end(),
+            [](const Client& client) { return client.fd < 0; }), m_clients.end());
+
+        if (now - m_lastStatsTime >= 1.0) {
+            printStats(now - m_lastStatsTime);
+            m_lastStatsTime = now;
+        }
+
+        if (m_config.duration > 0.0 && now >= m_config.duration) {
+            m_running = false;
+        }
+    }
+
+    std::cout << "[SyntheticServer] stopped" << std::endl;
+}
+
+// ============================================================================
+// Simulation
+// ============================================================================
+
+bool SyntheticServer::isBursting(double now) const {
+    if (m_config.burstPeriod <= 0.0) return false;
+    return std::fmod(now, m_config.burstPeriod) < m_config.burstDuration;
+}
+
+void SyntheticServer::tick(double now, double deltaTime) {
+    bool anyReady = std::any_of(m_clients.begin(), m_clients.end(),
+        [](const Client& client) { return client.handshakeComplete && !client.closing; });
+    if (!anyReady) {
+        return; // Nothing accumulates while nobody is listening
+    }
+
+    double multiplier = isBursting(now) ? m_config.burstMultiplier : 1.0;
+
+    m_metricsDebt += m_config.metricsRate * m_services.size() * deltaTime * multiplier;
+    m_entityDebt += m_config.entityRate * m_entities.size() * deltaTime * multiplier;
+    m_connectionDebt += m_config.connectionEventRate * deltaTime * multiplier;
+
+    while (m_metricsDebt >= 1.0 && !m_services.empty()) {
+        emitServiceMetrics();
+        m_metricsDebt -= 1.0;
+    }
+    while (m_entityDebt >= 1.0 && !m_entities.empty()) {
+        emitEntityUpdate();
+        m_entityDebt -= 1.0;
+    }
+    while (m_connectionDebt >= 1.0 && !m_services.empty()) {
+        emitConnectionEvent();
+        m_connectionDebt -= 1.0;
+    }
+}
+
+void SyntheticServer::emitServiceMetrics() {
+    // Round-robin so every service reports at the configured per-service rate
+    SimService& service = m_services[m_nextService];
+    m_nextService = (m_nextService + 1) % m_services.size();
+    if (!service.online) return;
+
+    ServiceMetricsPayload& metrics = service.metrics;
+    metrics.cpuUsage = drift(m_rng, metrics.cpuUsage, 3.0f, 0.0f, 100.0f);
+    metrics.memoryUsage = drift(m_rng, metrics.memoryUsage, 1.0f, 0.0f, 100.0f);
+    metrics.averageLatency = drift(m_rng, metrics.averageLatency, 5.0f, 1.0f, 2000.0f);
+    metrics.errorRate = drift(m_rng, metrics.errorRate, 0.2f, 0.0f, 100.0f);
+    metrics.requestsPerSecond = static_cast<uint32_t>(drift(m_rng, static_cast<float>(metrics.requestsPerSecond), 25.0f, 0.0f, 100000.0f));
+    metrics.activeConnections = static_cast<uint32_t>(drift(m_rng, static_cast<float>(metrics.activeConnections), 4.0f, 0.0f, 100000.0f));
+
+    Message message(MessageType::ServiceMetrics);
+    message.setTimestamp(currentTimeMs());
+    writePayload(message, metrics);
+    broadcastServiceMetrics(message, service);
+    service.reports++;
+}
+
+void SyntheticServer::emitEntityUpdate() {
+    SimEntity& entity = m_entities[m_nextEntity];
+    m_nextEntity = (m_nextEntity + 1) % m_entities.size();
+
+    float step = m_config.entityRate > 0.0 ? static_cast<float>(1.0 / m_config.entityRate) : 0.0f;
+    for (int axis = 0; axis < 3; ++axis) {
+        entity.velocity[axis] = drift(m_rng, entity.velocity[axis], 0.5f, -5.0f, 5.0f);
+        entity.position[axis] += entity.velocity[axis] * step;
+    }
+    entity.velocity[1] = 0.0f;
+
+    EntityUpdatePayload payload;
+    payload.entityId = entity.id;
+    std::memcpy(payload.position, entity.position, sizeof(payload.position));
+    std::memcpy(payload.velocity, entity.velocity, sizeof(payload.velocity));
+
+    Message message(MessageType::EntityUpdate);
+    message.setTimestamp(currentTimeMs());
+    writePayload(message, payload);
+    broadcast(message);
+}
+
+void SyntheticServer::emitConnectionEvent() {
+    std::uniform_int_distribution<size_t> pick(0, m_services.size() - 1);
+    SimService& service = m_services[pick(m_rng)];
+    service.online = !service.online;
+
+    ServiceStatusPayload payload;
+    payload.serviceId = service.id;
+    payload.serviceName = service.name;
+    payload.serviceType = service.type;
+    payload.status = service.online ? ServiceStatus::Online : ServiceStatus::Offline;
+
+    Message message(MessageType::ServiceUpdate);
+    message.setTimestamp(currentTimeMs());
+    writePayload(message, payload);
+    broadcast(message);
+}
+
+void SyntheticServer::sendServiceList(Client& client) {
+    // One stream for the whole list, cut into fixed-size chunks regardless
+    // of record boundaries
+    m_listScratch.clear();
+    appendServiceListHeader(m_listScratch, static_cast<uint32_t>(m_services.size()));
+    for (const auto& service : m_services) {
+        ServiceStatusPayload status;
+        status.serviceId = service.id;
+        status.serviceName = service.name;
+        status.serviceType = service.type;
+        status.status = service.online ? ServiceStatus::Online : ServiceStatus::Offline;
+        appendServiceRecord(m_listScratch, status, &service.metrics);
+    }
+
+    const size_t chunkSize = m_config.serviceListChunkBytes;
+    for (size_t offset = 0; offset < m_listScratch.size(); offset += chunkSize) {
+        size_t size = std::min(chunkSize, m_listScratch.size() - offset);
+        uint8_t flags = 0;
+        if (offset == 0) flags |= ServiceListFirst;
+        if (offset + size == m_listScratch.size()) flags |= ServiceListLast;
+
+        Message message(MessageType::ServiceList);
+        message.setTimestamp(currentTimeMs());
+        message.data.reserve(size + 1);
+        message.data.push_back(flags);
+        message.data.insert(message.data.end(), m_listScratch.begin() + offset, m_listScratch.begin() + offset + size);
+
+        std::vector<uint8_t> bytes = message.serialize();
+        m_frameScratch.clear();
+        WebSocket::appendFrame(m_frameScratch, WebSocket::Opcode::Binary, bytes.data(), bytes.size());
+        queueFrame(client, m_frameScratch);
+    }
+}
+
+// ============================================================================
+// Transport
+// ============================================================================
+
+void SyntheticServer::acceptClients() {
+    while (true) {
+        int fd = accept(m_listenFd, nullptr, nullptr);
+        if (fd < 0) break;
+
+        setNonBlocking(fd);
+        int noDelay = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+#ifdef SO_NOSIGPIPE
+        int noSigPipe = 1;
+        setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+
+        Client client;
+        client.fd = fd;
+        m_clients.push_back(std::move(client));
+        std::cout << "[SyntheticServer] client connected (fd " << fd << ")" << std::endl;
+    }
+}
+
+void SyntheticServer::readClient(Client& client) {
+    uint8_t buffer[16384];
+    while (true) {
+        ssize_t n = recv(client.fd, buffer, sizeof(buffer), 0);
+        if (n > 0) {
+            client.input.insert(client.input.end(), buffer, buffer + n);
+            continue;
+        }
+        if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+            client.closing = true;
+        }
+        break;
+    }
+
+    if (!client.handshakeComplete) {
+        handleHandshake(client);
+    }
+    if (client.handshakeComplete) {
+        handleFrames(client);
+    }
+}
+
+void SyntheticServer::writeClient(Client& client) {
+    while (client.outputOffset < client.output.size()) {
+        int flags = 0;
+#ifdef MSG_NOSIGNAL
+        flags |= MSG_NOSIGNAL;
+#endif
+        ssize_t n = send(client.fd, client.output.data() + client.outputOffset,
+                         client.output.size() - client.outputOffset, flags);
+        if (n > 0) {
+            client.outputOffset += static_cast<size_t>(n);
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) break;
+        client.closing = true;
+        return;
+    }
+
+    // Compact once the written prefix dominates the buffer
+    if (client.outputOffset == client.output.size()) {
+        client.output.clear();
+        client.outputOffset = 0;
+    } else if (client.outputOffset > client.output.size() / 2) {
+        client.output.erase(client.output.begin(), client.output.begin() + client.outputOffset);
+        client.outputOffset = 0;
+    }
+}
+
+void SyntheticServer::handleHandshake(Client& client) {
+    static const char terminator[] = "\r\n\r\n";
+    auto end = std::search(client.input.begin(), client.input.end(), terminator, terminator + 4);
+    if (end == client.input.end()) {
+        if (client.input.size() > 8192) client.closing = true;
+        return;
+    }
+
+    std::string request(client.input.begin(), end);
+    client.input.erase(client.input.begin(), end + 4);
+
+    std::string key;
+    size_t lineStart = 0;
+    while (lineStart < request.size()) {
+        size_t lineEnd = request.find("\r\n", lineStart);
+        if (lineEnd == std::string::npos) lineEnd = request.size();
+        std::string line = request.substr(lineStart, lineEnd - lineStart);
+        size_t colon = line.find(':');
+        if (colon != std::string::npos) {
+            std::string name = line.substr(0, colon);
+            std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+            if (name == "sec-websocket-key") {
+                size_t valueStart = line.find_first_not_of(' ', colon + 1);
+                if (valueStart != std::string::npos) key = line.substr(valueStart);
+            }
+        }
+        lineStart = lineEnd + 2;
+    }
+
+    if (key.empty()) {
+        static const char badRequest[] = "HTTP/1.1 400 Bad Request\r\nContent-Length: 0\r\n\r\n";
+        client.output.insert(client.output.end(), badRequest, badRequest + sizeof(badRequest) - 1);
+        writeClient(client);
+        client.closing = true;
+        return;
+    }
+
+    std::string response =
+        "HTTP/1.1 101 Switching Protocols\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        "Sec-WebSocket-Accept: " + WebSocket::computeAcceptKey(key) + "\r\n\r\n";
+    client.output.insert(client.output.end(), response.begin(), response.end());
+    client.handshakeComplete = true;
+
+    // New clients get the full service list up front, as the real server does
+    sendServiceList(client);
+}
+
+void SyntheticServer::handleFrames(Client& client) {
+    size_t offset = 0;
+    while (offset < client.input.size()) {
+        WebSocket::FrameHeader header;
+        auto result = WebSocket::parseFrameHeader(client.input.data() + offset, client.input.size() - offset, header);
+        if (result == WebSocket::ParseResult::NeedMoreData) break;
+        if (result == WebSocket::ParseResult::ProtocolError || !header.masked) {
+            client.closing = true; // Client frames must be masked
+            return;
+        }
+        if (client.input.size() - offset - header.headerLength < header.payloadLength) break;
+
+        uint8_t* payload = client.input.data() + offset + header.headerLength;
+        size_t payloadLength = static_cast<size_t>(header.payloadLength);
+        WebSocket::applyMask(payload, payloadLength, header.maskKey);
+        offset += header.headerLength + payloadLength;
+
+        switch (header.opcode) {
+            case WebSocket::Opcode::Ping:
+                m_frameScratch.clear();
+                WebSocket::appendFrame(m_frameScratch, WebSocket::Opcode::Pong, payload, payloadLength);
+                queueFrame(client, m_frameScratch);
+                break;
+            case WebSocket::Opcode::Close:
+                m_frameScratch.clear();
+                WebSocket::appendFrame(m_frameScratch, WebSocket::Opcode::Close, payload, std::min<size_t>(payloadLength, 2));
+                queueFrame(client, m_frameScratch);
+                writeClient(client);
+                client.closing = true;
+                return;
+            case WebSocket::Opcode::Binary: {
+                Message message(MessageType::Ping);
+                if (message.deserialize(payload, payloadLength)) {
+                    handleMessage(client, message);
+                }
+                break;
+            }
+            default:
+                // Text commands and continuation frames are accepted and ignored
+                break;
+        }
+    }
+
+    client.input.erase(client.input.begin(), client.input.begin() + offset);
+}
+
+void SyntheticServer::handleMessage(Client& client, const Message& message) {
+    if (message.getType() == MessageType::Batch) {
+        std::vector<Message> messages;
+        if (readBatch(message, messages)) {
+            for (const auto& entry : messages) {
+                handleMessage(client, entry);
+            }
+        }
+        return;
+    }
+    if (message.getType() == MessageType::SubscriptionTiers) {
+        SubscriptionTierPayload payload;
+        if (readPayload(message, payload)) {
+            for (const auto& entry : payload.entries) {
+                client.tiers[entry.serviceId] = entry.tier;
+            }
+        }
+        return;
+    }
+    if (message.getType() == MessageType::ServiceListRequest) {
+        sendServiceList(client);
+        return;
+    }
+    if (message.getType() != MessageType::Ping) return;
+
+    // Echo the client's payload so it can pair request and response; the
+    // timestamp carries server time for clock offset estimation
+    Message pong(MessageType::Pong);
+    pong.setTimestamp(currentTimeMs());
+    pong.data = message.data;
+
+    std::vector<uint8_t> bytes = pong.serialize();
+    m_frameScratch.clear();
+    WebSocket::appendFrame(m_frameScratch, WebSocket::Opcode::Binary, bytes.data(), bytes.size());
+    queueFrame(client, m_frameScratch);
+}
+
+void SyntheticServer::broadcast(const Message& message) {
+    std::vector<uint8_t> bytes = message.serialize();
+    m_frameScratch.clear();
+    WebSocket::appendFrame(m_frameScratch, WebSocket::Opcode::Binary, bytes.data(), bytes.size());
+
+    for (auto& client : m_clients) {
+        if (client.handshakeComplete && !client.closing) {
+            queueFrame(client, m_frameScratch);
+        }
+    }
+}
+
+void SyntheticServer::broadcastServiceMetrics(const Message& message, const SimService& service) {
+    std::vector<uint8_t> bytes = message.serialize();
+    m_frameScratch.clear();
+    WebSocket::appendFrame(m_frameScratch, WebSocket::Opcode::Binary, bytes.data(), bytes.size());
+
+    for (auto& client : m_clients) {
+        if (!client.handshakeComplete || client.closing) continue;
+
+        auto it = client.tiers.find(service.id);
+        if (it != client.tiers.end()) {
+            uint32_t interval = tierInterval(it->second);
+            if (interval == 0 || service.reports % interval != 0) continue;
+        }
+        queueFrame(client, m_frameScratch);
+    }
+}
+
+void SyntheticServer::queueFrame(Client& client, const std::vector<uint8_t>& frame) {
+    if (client.output.size() - client.outputOffset + frame.size() > m_config.maxBufferedBytes) {
+        client.droppedMessages++;
+        m_messagesDropped++;
+        return;
+    }
+    client.output.insert(client.output.end(), frame.begin(), frame.end());
+    m_messagesSent++;
+    m_bytesQueued += frame.size();
+}
+
+void SyntheticServer::closeClient(Client& client) {
+    if (client.fd < 0) return;
+    std::cout << "[SyntheticServer] client disconnected (fd " << client.fd
+              << ", dropped " << client.droppedMessages << ")" << std::endl;
+    ::close(client.fd);
+    client.fd = -1;
+}
+
+void SyntheticServer::printStats(double elapsed) {
+    size_t backlog = 0;
+    for (const auto& client : m_clients) {
+        backlog = std::max(backlog, client.output.size() - client.outputOffset);
+    }
+
+    char line[256];
+    std::snprintf(line, sizeof(line),
+        "[SyntheticServer] clients=%zu msgs/s=%.0f MB/s=%.2f dropped/s=%.0f max-backlog=%.1fMB%s",
+        m_clients.size(),
+        m_messagesSent / elapsed,
+        m_bytesQueued / elapsed / (1024.0 * 1024.0),
+        m_messagesDropped / elapsed,
+        backlog / (1024.0 * 1024.0),
+        isBursting(m_lastStatsTime + elapsed) ? " [burst]" : "");
+    std::cout << line << std::endl;
+
+    m_messagesSent = 0;
+    m_bytesQueued = 0;
+    m_messagesDropped = 0;
+}
+
+uint64_t SyntheticServer::currentTimeMs() const {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} // namespace FinalStorm
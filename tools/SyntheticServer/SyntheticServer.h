@@ -0,0 +1,132 @@
+// tools/SyntheticServer/SyntheticServer.h
+// Local synthetic Finalverse server
+// Loopback-only WebSocket server that simulates many services for scale testing
+
+#pragma once
+#include "Network/MessageProtocol.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace FinalStorm {
+
+struct SyntheticServerConfig {
+    uint16_t port = 3000;
+
+    // Simulated population
+    uint32_t serviceCount = 100;
+    uint32_t entityCount = 0;
+
+    // Emission rates
+    double metricsRate = 1.0;           // ServiceMetrics per service per second
+    double entityRate = 10.0;           // EntityUpdate per entity per second
+    double connectionEventRate = 0.1;   // Service online/offline flips per second
+
+    // Burst pattern: every burstPeriod seconds, rates are multiplied for burstDuration
+    double burstPeriod = 0.0;           // 0 disables bursts
+    double burstDuration = 1.0;
+    double burstMultiplier = 10.0;
+
+    double duration = 0.0;              // Seconds to run, 0 runs until interrupted
+    uint32_t seed = 1;
+
+    // Per-client send backlog above which messages are dropped (and counted)
+    size_t maxBufferedBytes = 64 * 1024 * 1024;
+
+    // Service list stream bytes per ServiceList message; records straddle chunks
+    size_t serviceListChunkBytes = 16 * 1024;
+};
+
+class SyntheticServer {
+public:
+    SyntheticServer();
+    ~SyntheticServer();
+
+    bool start(const SyntheticServerConfig& config);
+    void run();
+    void stop() { m_running = false; }
+
+private:
+    struct Client {
+        int fd = -1;
+        bool handshakeComplete = false;
+        bool closing = false;
+        std::vector<uint8_t> input;
+        std::vector<uint8_t> output;
+        size_t outputOffset = 0;
+        uint64_t droppedMessages = 0;
+
+        // Metric subscription tiers the client asked for; absent means Full
+        std::unordered_map<std::string, SubscriptionTier> tiers;
+    };
+
+    struct SimService {
+        std::string id;
+        std::string name;
+        std::string type;
+        bool online = true;
+        uint32_t reports = 0;
+        ServiceMetricsPayload metrics;
+    };
+
+    struct SimEntity {
+        uint32_t id = 0;
+        float position[3] = { 0.0f, 0.0f, 0.0f };
+        float velocity[3] = { 0.0f, 0.0f, 0.0f };
+    };
+
+    // Simulation
+    void createPopulation();
+    void tick(double now, double deltaTime);
+    bool isBursting(double now) const;
+    void emitServiceMetrics();
+    void emitEntityUpdate();
+    void emitConnectionEvent();
+    void sendServiceList(Client& client);
+
+    // Transport
+    void acceptClients();
+    void readClient(Client& client);
+    void writeClient(Client& client);
+    void handleHandshake(Client& client);
+    void handleFrames(Client& client);
+    void handleMessage(Client& client, const Message& message);
+    void broadcast(const Message& message);
+    void broadcastServiceMetrics(const Message& message, const SimService& service);
+    void queueFrame(Client& client, const std::vector<uint8_t>& frame);
+    void closeClient(Client& client);
+
+    void printStats(double elapsed);
+    uint64_t currentTimeMs() const;
+
+    SyntheticServerConfig m_config;
+    std::atomic<bool> m_running;
+    int m_listenFd;
+    std::vector<Client> m_clients;
+
+    std::mt19937 m_rng;
+    std::vector<SimService> m_services;
+    std::vector<SimEntity> m_entities;
+    size_t m_nextService;
+    size_t m_nextEntity;
+
+    double m_metricsDebt;
+    double m_entityDebt;
+    double m_connectionDebt;
+
+    // Scratch buffers reused for every broadcast
+    std::vector<uint8_t> m_frameScratch;
+    std::vector<uint8_t> m_listScratch;
+
+    // Statistics for the current reporting interval
+    uint64_t m_messagesSent;
+    uint64_t m_bytesQueued;
+    uint64_t m_messagesDropped;
+    double m_lastStatsTime;
+};
+
+} // namespace FinalStorm
@@ -0,0 +1,89 @@
+// tools/SyntheticServer/main.cpp
+// Entry point for the local synthetic Finalverse server
+// Usage: FinalStorm-SyntheticServer [--services N] [--metrics-rate HZ] ...
+
+#include "SyntheticServer/SyntheticServer.h"
+#include <algorithm>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+using namespace FinalStorm;
+
+namespace {
+
+SyntheticServer* g_server = nullptr;
+
+void onSignal(int) {
+    if (g_server) g_server->stop();
+}
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --port N                 Loopback port (default 3000)\n"
+              << "  --services N             Simulated services (default 100)\n"
+              << "  --entities N             Simulated entities (default 0)\n"
+              << "  --metrics-rate HZ        ServiceMetrics per service per second (default 1)\n"
+              << "  --entity-rate HZ         EntityUpdate per entity per second (default 10)\n"
+              << "  --connection-rate HZ     Service online/offline events per second (default 0.1)\n"
+              << "  --burst-period S         Seconds between bursts, 0 disables (default 0)\n"
+              << "  --burst-duration S       Burst length in seconds (default 1)\n"
+              << "  --burst-multiplier X     Rate multiplier during bursts (default 10)\n"
+              << "  --duration S             Run time in seconds, 0 runs until Ctrl-C (default 0)\n"
+              << "  --seed N                 Random seed (default 1)\n"
+              << "  --max-backlog-mb N       Per-client backlog before dropping (default 64)\n"
+              << "  --list-chunk-bytes N     Service list bytes per message (default 16384)\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    SyntheticServerConfig config;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            printUsage(argv[0]);
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return 1;
+        }
+
+        const char* value = argv[++i];
+        if (arg == "--port") config.port = static_cast<uint16_t>(std::atoi(value));
+        else if (arg == "--services") config.serviceCount = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--entities") config.entityCount = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--metrics-rate") config.metricsRate = std::atof(value);
+        else if (arg == "--entity-rate") config.entityRate = std::atof(value);
+        else if (arg == "--connection-rate") config.connectionEventRate = std::atof(value);
+        else if (arg == "--burst-period") config.burstPeriod = std::atof(value);
+        else if (arg == "--burst-duration") config.burstDuration = std::atof(value);
+        else if (arg == "--burst-multiplier") config.burstMultiplier = std::atof(value);
+        else if (arg == "--duration") config.duration = std::atof(value);
+        else if (arg == "--seed") config.seed = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--max-backlog-mb") config.maxBufferedBytes = std::strtoull(value, nullptr, 10) * 1024 * 1024;
+        else if (arg == "--list-chunk-bytes") config.serviceListChunkBytes = std::max<size_t>(1, std::strtoull(value, nullptr, 10));
+        else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::signal(SIGPIPE, SIG_IGN);
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+
+    SyntheticServer server;
+    g_server = &server;
+    if (!server.start(config)) {
+        return 1;
+    }
+    server.run();
+    g_server = nullptr;
+    return 0;
+}
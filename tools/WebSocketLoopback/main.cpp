@@ -0,0 +1,413 @@
+// tools/WebSocketLoopback/main.cpp
+// WebSocket transport check: frame codec round trips, then WebSocketClient
+// against a scripted echo server on loopback covering the upgrade, client
+// masking, server pings, a fragmented message, a large binary echo and the
+// close handshake.
+// Usage: FinalStorm-WebSocketLoopback [--binary-bytes N] [--timeout SECONDS]
+
+#include "Network/WebSocketClient.h"
+#include "Network/WebSocketProtocol.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace FinalStorm;
+using WebSocket::Opcode;
+
+namespace {
+
+int g_failures = 0;
+
+void check(bool condition, const std::string& what) {
+    std::cout << (condition ? "  ok    " : "  FAIL  ") << what << std::endl;
+    if (!condition) ++g_failures;
+}
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --binary-bytes N   Size of the echoed binary message (default 307200)\n"
+              << "  --timeout S        Seconds to wait for each loopback step (default 5)\n";
+}
+
+// ============================================================================
+// Frame codec
+// ============================================================================
+
+bool roundTrip(Opcode opcode, size_t size, bool masked, size_t expectedHeader) {
+    std::vector<uint8_t> payload(size);
+    for (size_t i = 0; i < size; ++i) payload[i] = static_cast<uint8_t>(i * 31 + 7);
+    const uint8_t maskKey[4] = { 0x12, 0x34, 0x56, 0x78 };
+
+    std::vector<uint8_t> frame;
+    WebSocket::appendFrame(frame, opcode, payload.data(), size, true, masked ? maskKey : nullptr);
+
+    // Every strict prefix of the header must ask for more data
+    WebSocket::FrameHeader header;
+    for (size_t prefix = 0; prefix < expectedHeader; ++prefix) {
+        if (WebSocket::parseFrameHeader(frame.data(), prefix, header) != WebSocket::ParseResult::NeedMoreData) return false;
+    }
+    if (WebSocket::parseFrameHeader(frame.data(), frame.size(), header) != WebSocket::ParseResult::Complete) return false;
+    if (header.headerLength != expectedHeader || header.payloadLength != size ||
+        header.opcode != opcode || header.masked != masked || !header.fin) {
+        return false;
+    }
+
+    uint8_t* body = frame.data() + header.headerLength;
+    if (masked) {
+        // The wire bytes must differ from the payload, and unmask back to it
+        if (size > 0 && std::memcmp(body, payload.data(), size) == 0) return false;
+        WebSocket::applyMask(body, size, header.maskKey);
+    }
+    return frame.size() == expectedHeader + size && std::memcmp(body, payload.data(), size) == 0;
+}
+
+void checkCodec() {
+    std::cout << "frame codec" << std::endl;
+
+    // RFC 6455 section 1.3
+    check(WebSocket::computeAcceptKey("dGhlIHNhbXBsZSBub25jZQ==") == "s3pPLMBiTxaQ9kYGzzhZRbK+xOo=",
+          "accept key matches the RFC example");
+
+    check(roundTrip(Opcode::Text, 0, false, 2), "empty unmasked frame");
+    check(roundTrip(Opcode::Binary, 125, true, 6), "125 bytes, 7-bit length, masked");
+    check(roundTrip(Opcode::Binary, 126, true, 8), "126 bytes, 16-bit length, masked");
+    check(roundTrip(Opcode::Binary, 65535, false, 4), "65535 bytes, 16-bit length");
+    check(roundTrip(Opcode::Binary, 65536, true, 14), "65536 bytes, 64-bit length, masked");
+
+    // Masking in pieces, as a payload split across reads is, matches masking it whole
+    std::vector<uint8_t> whole(1000), pieces;
+    for (size_t i = 0; i < whole.size(); ++i) whole[i] = static_cast<uint8_t>(i);
+    pieces = whole;
+    const uint8_t maskKey[4] = { 0xA1, 0xB2, 0xC3, 0xD4 };
+    WebSocket::applyMask(whole.data(), whole.size(), maskKey);
+    WebSocket::applyMask(pieces.data(), 333, maskKey, 0);
+    WebSocket::applyMask(pieces.data() + 333, pieces.size() - 333, maskKey, 333);
+    check(whole == pieces, "mask offset continues across split payloads");
+
+    // A fragment header keeps fin clear
+    uint8_t header[WebSocket::MaxFrameHeaderSize];
+    size_t length = WebSocket::writeFrameHeader(header, Opcode::Text, 5, false);
+    WebSocket::FrameHeader parsed;
+    check(WebSocket::parseFrameHeader(header, length, parsed) == WebSocket::ParseResult::Complete && !parsed.fin,
+          "fragment header has fin clear");
+}
+
+// ============================================================================
+// Scripted echo server: one connection on a blocking socket
+// ============================================================================
+
+class EchoServer {
+public:
+    struct Result {
+        bool upgraded = false;
+        bool allClientFramesMasked = true;
+        std::vector<std::string> pongs;
+        size_t echoedMessages = 0;
+        int closeCode = -1;
+        std::string error;
+    };
+
+    ~EchoServer() {
+        if (m_thread.joinable()) m_thread.join();
+        if (m_listenFd >= 0) ::close(m_listenFd);
+    }
+
+    // Listens on an ephemeral loopback port
+    bool start() {
+        m_listenFd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (m_listenFd < 0) return false;
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        socklen_t length = sizeof(address);
+        if (::bind(m_listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+            ::listen(m_listenFd, 1) != 0 ||
+            ::getsockname(m_listenFd, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+            return false;
+        }
+        m_port = ntohs(address.sin_port);
+        m_thread = std::thread([this]() { serve(); });
+        return true;
+    }
+
+    uint16_t getPort() const { return m_port; }
+
+    Result finish() {
+        if (m_thread.joinable()) m_thread.join();
+        return m_result;
+    }
+
+private:
+    void serve() {
+        int fd = ::accept(m_listenFd, nullptr, nullptr);
+        if (fd < 0) {
+            m_result.error = "accept failed";
+            return;
+        }
+        m_fd = fd;
+        if (upgrade()) script();
+        ::close(fd);
+    }
+
+    bool upgrade() {
+        static const char terminator[] = "\r\n\r\n";
+        auto end = m_input.end();
+        while ((end = std::search(m_input.begin(), m_input.end(), terminator, terminator + 4)) == m_input.end()) {
+            if (!receive()) {
+                m_result.error = "connection closed during upgrade";
+                return false;
+            }
+        }
+        std::string request(m_input.begin(), end);
+        m_input.erase(m_input.begin(), end + 4);
+
+        static const char keyHeader[] = "Sec-WebSocket-Key: ";
+        size_t keyStart = request.find(keyHeader);
+        if (request.compare(0, 4, "GET ") != 0 || keyStart == std::string::npos) {
+            m_result.error = "malformed upgrade request";
+            return false;
+        }
+        keyStart += sizeof(keyHeader) - 1;
+        std::string key = request.substr(keyStart, request.find("\r\n", keyStart) - keyStart);
+
+        std::string response =
+            "HTTP/1.1 101 Switching Protocols\r\n"
+            "Upgrade: websocket\r\n"
+            "Connection: Upgrade\r\n"
+            "Sec-WebSocket-Accept: " + WebSocket::computeAcceptKey(key) + "\r\n\r\n";
+        if (!sendAll(reinterpret_cast<const uint8_t*>(response.data()), response.size())) return false;
+        m_result.upgraded = true;
+        return true;
+    }
+
+    void script() {
+        // A server ping, then a text message in three fragments with a ping
+        // between them, which the client must answer mid-message
+        std::vector<uint8_t> out;
+        appendString(out, Opcode::Ping, "loopback-ping", true);
+        appendString(out, Opcode::Text, "Hello, ", false);
+        appendString(out, Opcode::Ping, "mid-message", true);
+        appendString(out, Opcode::Continuation, "fragmented ", false);
+        appendString(out, Opcode::Continuation, "world", true);
+        if (!sendAll(out.data(), out.size())) return;
+
+        // Echo data messages unmasked until the client closes
+        WebSocket::FrameHeader header;
+        std::vector<uint8_t> payload;
+        while (readFrame(header, payload)) {
+            if (!header.masked) m_result.allClientFramesMasked = false;
+
+            switch (header.opcode) {
+                case Opcode::Pong:
+                    m_result.pongs.emplace_back(payload.begin(), payload.end());
+                    break;
+                case Opcode::Text:
+                case Opcode::Binary:
+                    out.clear();
+                    WebSocket::appendFrame(out, header.opcode, payload.data(), payload.size());
+                    if (!sendAll(out.data(), out.size())) return;
+                    ++m_result.echoedMessages;
+                    break;
+                case Opcode::Close:
+                    if (payload.size() >= 2) m_result.closeCode = (payload[0] << 8) | payload[1];
+                    out.clear();
+                    WebSocket::appendFrame(out, Opcode::Close, payload.data(), std::min<size_t>(payload.size(), 2));
+                    sendAll(out.data(), out.size());
+                    return;
+                default:
+                    break;
+            }
+        }
+        m_result.error = "connection dropped before the close handshake";
+    }
+
+    static void appendString(std::vector<uint8_t>& out, Opcode opcode, const char* text, bool fin) {
+        WebSocket::appendFrame(out, opcode, reinterpret_cast<const uint8_t*>(text), std::strlen(text), fin);
+    }
+
+    bool readFrame(WebSocket::FrameHeader& header, std::vector<uint8_t>& payload) {
+        for (;;) {
+            auto result = WebSocket::parseFrameHeader(m_input.data(), m_input.size(), header);
+            if (result == WebSocket::ParseResult::ProtocolError) return false;
+            if (result == WebSocket::ParseResult::Complete &&
+                m_input.size() >= header.headerLength + header.payloadLength) {
+                break;
+            }
+            if (!receive()) return false;
+        }
+
+        auto begin = m_input.begin() + static_cast<std::ptrdiff_t>(header.headerLength);
+        auto end = begin + static_cast<std::ptrdiff_t>(header.payloadLength);
+        payload.assign(begin, end);
+        m_input.erase(m_input.begin(), end);
+        if (header.masked) WebSocket::applyMask(payload.data(), payload.size(), header.maskKey);
+        return true;
+    }
+
+    bool receive() {
+        uint8_t buffer[64 * 1024];
+        ssize_t received = ::recv(m_fd, buffer, sizeof(buffer), 0);
+        if (received <= 0) return false;
+        m_input.insert(m_input.end(), buffer, buffer + received);
+        return true;
+    }
+
+    bool sendAll(const uint8_t* data, size_t size) {
+        while (size > 0) {
+            ssize_t sent = ::send(m_fd, data, size, 0);
+            if (sent <= 0) {
+                m_result.error = "send failed";
+                return false;
+            }
+            data += sent;
+            size -= static_cast<size_t>(sent);
+        }
+        return true;
+    }
+
+    int m_listenFd = -1;
+    int m_fd = -1;
+    uint16_t m_port = 0;
+    std::vector<uint8_t> m_input;
+    std::thread m_thread;
+    Result m_result;
+};
+
+// ============================================================================
+// Client side: what the callbacks saw, waited on from the main thread
+// ============================================================================
+
+struct ClientLog {
+    std::mutex mutex;
+    std::condition_variable changed;
+    bool opened = false;
+    bool closed = false;
+    std::string closeReason;
+    std::vector<std::pair<Opcode, std::vector<uint8_t>>> messages;
+
+    template<typename Predicate>
+    bool waitFor(double seconds, Predicate predicate) {
+        std::unique_lock<std::mutex> lock(mutex);
+        return changed.wait_for(lock, std::chrono::duration<double>(seconds), predicate);
+    }
+};
+
+void checkLoopback(size_t binaryBytes, double timeout) {
+    std::cout << "loopback echo server" << std::endl;
+
+    EchoServer server;
+    if (!server.start()) {
+        check(false, "echo server listens on loopback");
+        return;
+    }
+
+    ClientLog log;
+    WebSocketClient client;
+    client.setOpenCallback([&log]() {
+        std::lock_guard<std::mutex> lock(log.mutex);
+        log.opened = true;
+        log.changed.notify_all();
+    });
+    client.setMessageCallback([&log](Opcode opcode, const uint8_t* data, size_t size) {
+        std::lock_guard<std::mutex> lock(log.mutex);
+        log.messages.emplace_back(opcode, std::vector<uint8_t>(data, data + size));
+        log.changed.notify_all();
+    });
+    client.setCloseCallback([&log](const std::string& reason) {
+        std::lock_guard<std::mutex> lock(log.mutex);
+        log.closed = true;
+        log.closeReason = reason;
+        log.changed.notify_all();
+    });
+
+    // The client is driven from its own network thread, as the app does
+    std::atomic<bool> running(true);
+    std::string url = "ws://127.0.0.1:" + std::to_string(server.getPort()) + "/ws";
+    std::thread networkThread([&]() {
+        if (client.connect(url)) client.run(running);
+    });
+
+    check(log.waitFor(timeout, [&]() { return log.opened; }), "upgrade completes and the client opens");
+
+    bool gotText = log.waitFor(timeout, [&]() { return !log.messages.empty(); });
+    std::string text;
+    if (gotText) text.assign(log.messages[0].second.begin(), log.messages[0].second.end());
+    check(gotText && log.messages[0].first == Opcode::Text && text == "Hello, fragmented world",
+          "fragmented text arrives as one message across an interleaved ping");
+
+    std::vector<uint8_t> binary(binaryBytes);
+    for (size_t i = 0; i < binary.size(); ++i) binary[i] = static_cast<uint8_t>((i * 2654435761u) >> 13);
+    client.sendBinary(binary.data(), binary.size());
+    bool gotEcho = log.waitFor(timeout, [&]() { return log.messages.size() >= 2; });
+    check(gotEcho && log.messages[1].first == Opcode::Binary && log.messages[1].second == binary,
+          std::to_string(binaryBytes) + "-byte binary message echoes back intact");
+
+    client.close(1000);
+    check(log.waitFor(timeout, [&]() { return log.closed; }) && log.closeReason == "closed",
+          "close handshake completes from the client side");
+
+    running = false;
+    networkThread.join();
+    EchoServer::Result result = server.finish();
+    if (!result.error.empty()) std::cout << "  server: " << result.error << std::endl;
+
+    check(result.upgraded, "server accepted the upgrade request");
+    check(result.allClientFramesMasked, "every client frame was masked");
+    check(result.pongs == std::vector<std::string>{ "loopback-ping", "mid-message" },
+          "both server pings answered with matching pongs, in order");
+    check(result.echoedMessages == 1, "server echoed exactly the one data message");
+    check(result.closeCode == 1000, "server received close code 1000");
+    check(client.getState() == WebSocketClient::State::Closed, "client ends in the Closed state");
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t binaryBytes = 300 * 1024;
+    double timeout = 5.0;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            printUsage(argv[0]);
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return 1;
+        }
+
+        const char* value = argv[++i];
+        if (arg == "--binary-bytes") binaryBytes = static_cast<size_t>(std::max(1L, std::atol(value)));
+        else if (arg == "--timeout") timeout = std::max(0.1, std::atof(value));
+        else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    checkCodec();
+    checkLoopback(binaryBytes, timeout);
+
+    if (g_failures > 0) {
+        std::cout << "FAIL: " << g_failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "PASS: codec and loopback checks" << std::endl;
+    return 0;
+}